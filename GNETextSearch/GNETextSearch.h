@@ -8,4 +8,6 @@
 
 #import "ternarytree.h"
 #import "countedset.h"
+#import "postings.h"
+#import "indexfile.h"
 
@@ -9,6 +9,9 @@
 #ifndef GNETextSearchPrivate_h
 #define GNETextSearchPrivate_h
 
+#include "GNETextSearchPublic.h"
+#include <string.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -31,6 +34,109 @@ TSEARCH_INLINE size_t _tsearch_next_buf_len(size_t *capacity, const size_t size)
     return validCount * size;
 }
 
+
+/// The 64-bit finalizer from MurmurHash3, which spreads sequential integers across a hash table.
+TSEARCH_INLINE size_t _tsearch_hash_uint64(const uint64_t integer)
+{
+    uint64_t hash = integer;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return (size_t)hash;
+}
+
+
+/// The 32-bit finalizer from MurmurHash3.
+TSEARCH_INLINE size_t _tsearch_hash_uint32(const uint32_t integer)
+{
+    uint32_t hash = integer;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16;
+    return (size_t)hash;
+}
+
+
+// The hash tables of the forward index, the trigram index and the prefix cache use linear probing.
+// Their capacities are always powers of two, so a slot's home slot is found by masking its hash,
+// and their empty slots are all zero bytes. Each table describes its slots with a
+// _tsearch_hashtable_type.
+typedef struct _tsearch_hashtable_type
+{
+    size_t slotSize;
+    bool (*isEmpty)(const void *slot);
+    size_t (*hash)(const void *slot);
+    bool (*hasKey)(const void *slot, const void *key);
+} _tsearch_hashtable_type;
+
+
+/// Returns the slot containing the key or, if the key isn't in the table, the empty slot where
+/// it belongs. The hash must be the hash of a slot containing the key.
+TSEARCH_INLINE size_t _tsearch_hashtable_find_slot(const _tsearch_hashtable_type *typePtr, const void *slots,
+                                                   const size_t capacity, const size_t hash, const void *key)
+{
+    const unsigned char *bytes = slots;
+    size_t mask = capacity - 1;
+    size_t slot = hash & mask;
+    while (typePtr->isEmpty(bytes + slot * typePtr->slotSize) == false &&
+           typePtr->hasKey(bytes + slot * typePtr->slotSize, key) == false)
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+
+/// Returns a copy of the table with twice the capacity, with each slot moved to its home slot in
+/// the larger table, or NULL if the table can't grow. The caller is responsible for freeing the slots.
+TSEARCH_INLINE void * _tsearch_hashtable_copy_grown(const _tsearch_hashtable_type *typePtr, const void *slots,
+                                                   const size_t capacity)
+{
+    size_t slotSize = typePtr->slotSize;
+    size_t grownCapacity = capacity * 2;
+    if (grownCapacity <= capacity || grownCapacity > SIZE_MAX / slotSize) { return NULL; }
+
+    unsigned char *grownSlots = calloc(grownCapacity, slotSize);
+    if (grownSlots == NULL) { return NULL; }
+
+    const unsigned char *bytes = slots;
+    size_t mask = grownCapacity - 1;
+    for (size_t i = 0; i < capacity; i++) {
+        const unsigned char *slotPtr = bytes + i * slotSize;
+        if (typePtr->isEmpty(slotPtr) == true) { continue; }
+        size_t slot = typePtr->hash(slotPtr) & mask;
+        while (typePtr->isEmpty(grownSlots + slot * slotSize) == false) { slot = (slot + 1) & mask; }
+        memcpy(grownSlots + slot * slotSize, slotPtr, slotSize);
+    }
+
+    return grownSlots;
+}
+
+
+/// Empties the slot, whose contents must already have been freed.
+TSEARCH_INLINE void _tsearch_hashtable_remove(const _tsearch_hashtable_type *typePtr, void *slots,
+                                              const size_t capacity, const size_t slot)
+{
+    // Instead of leaving a tombstone, shift back any of the following slots whose home slot is
+    // at or before the emptied slot, so that lookups can stop at the first empty slot.
+    unsigned char *bytes = slots;
+    size_t slotSize = typePtr->slotSize;
+    size_t mask = capacity - 1;
+    size_t emptySlot = slot;
+    for (size_t i = (slot + 1) & mask; typePtr->isEmpty(bytes + i * slotSize) == false; i = (i + 1) & mask) {
+        size_t homeSlot = typePtr->hash(bytes + i * slotSize) & mask;
+        if (((i - homeSlot) & mask) >= ((i - emptySlot) & mask)) {
+            memcpy(bytes + emptySlot * slotSize, bytes + i * slotSize, slotSize);
+            emptySlot = i;
+        }
+    }
+    memset(bytes + emptySlot * slotSize, 0, slotSize);
+}
+
 #ifdef __cplusplus
 }
 #endif
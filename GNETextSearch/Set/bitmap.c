@@ -0,0 +1,1000 @@
+//
+//  bitmap.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "bitmap.h"
+#include "sortedints.h"
+#include "GNETextSearchPrivate.h"
+#include <string.h>
+
+// ------------------------------------------------------------------------------------------
+
+#define CHUNK_BITS 16
+#define CHUNK_LENGTH 65536
+#define ARRAY_MAX_CARDINALITY 4096
+#define BITMAP_WORDS_COUNT (CHUNK_LENGTH / 64)
+
+// Flipping the sign bit makes the unsigned keys sort in the same order as the signed integers.
+#define SIGN_BIT 0x8000000000000000ULL
+
+#define OPERATION_UNION 0
+#define OPERATION_INTERSECT 1
+#define OPERATION_MINUS 2
+
+typedef struct _tsearch_bitmap_container
+{
+    uint64_t key;
+    size_t cardinality;
+    size_t capacity; // The number of values and counts allocated.
+    uint16_t *values; // The sorted low 16 bits of the integers, if this is an array container.
+    uint64_t *words; // The bits of the integers, if this is a bitmap container.
+    uint32_t *counts; // NULL if the bitmap doesn't keep counts.
+} _tsearch_bitmap_container;
+
+
+typedef struct tsearch_bitmap
+{
+    _tsearch_bitmap_container *containers;
+    size_t containersCount;
+    size_t containersCapacity;
+    size_t count;
+    bool keepsCounts;
+} tsearch_bitmap;
+
+
+// Scratch space for combining two containers that can't be combined word by word.
+typedef struct _tsearch_bitmap_scratch
+{
+    GNEInteger *integers1;
+    size_t *counts1;
+    GNEInteger *integers2;
+    size_t *counts2;
+    GNEInteger *outIntegers;
+    size_t *outCounts;
+} _tsearch_bitmap_scratch;
+
+// ------------------------------------------------------------------------------------------
+
+result _tsearch_bitmap_combine(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr, const int operation);
+result _tsearch_bitmap_combine_containers(_tsearch_bitmap_container *containerPtr,
+                                          const _tsearch_bitmap_container *otherContainerPtr,
+                                          const bool keepsCounts, const int operation,
+                                          _tsearch_bitmap_scratch *scratchPtr);
+result _tsearch_bitmap_insert_container(const tsearch_bitmap_ptr ptr, const size_t index, const uint64_t key);
+void _tsearch_bitmap_remove_container(const tsearch_bitmap_ptr ptr, const size_t index);
+size_t _tsearch_bitmap_find_container(const tsearch_bitmap_ptr ptr, const uint64_t key, bool *outFound);
+size_t _tsearch_bitmap_container_find(const _tsearch_bitmap_container *containerPtr, const uint16_t low,
+                                      bool *outFound);
+result _tsearch_bitmap_container_init(_tsearch_bitmap_container *containerPtr, const uint64_t key,
+                                      const GNEInteger *integers, const size_t *counts, const size_t count,
+                                      const bool keepsCounts);
+result _tsearch_bitmap_container_copy(const _tsearch_bitmap_container *containerPtr,
+                                      _tsearch_bitmap_container *outContainerPtr, const bool keepsCounts);
+void _tsearch_bitmap_container_free(_tsearch_bitmap_container *containerPtr);
+size_t _tsearch_bitmap_container_decode(const _tsearch_bitmap_container *containerPtr,
+                                        GNEInteger *outIntegers, size_t *outCounts);
+result _tsearch_bitmap_container_add(_tsearch_bitmap_container *containerPtr, const uint16_t low,
+                                     const size_t countToAdd, const bool keepsCounts, bool *outInserted);
+void _tsearch_bitmap_container_subtract(_tsearch_bitmap_container *containerPtr, const uint16_t low,
+                                        const size_t countToSubtract, bool *outRemoved);
+result _tsearch_bitmap_container_reserve(_tsearch_bitmap_container *containerPtr, const size_t capacity,
+                                         const bool keepsCounts);
+result _tsearch_bitmap_container_convert_to_bitmap(_tsearch_bitmap_container *containerPtr);
+result _tsearch_bitmap_container_convert_to_array(_tsearch_bitmap_container *containerPtr);
+size_t _tsearch_bitmap_count_bits(const uint64_t *words);
+size_t _tsearch_bitmap_count_bits_in_range(const uint64_t *words, const size_t start, const size_t end);
+void _tsearch_bitmap_scratch_free(_tsearch_bitmap_scratch *scratchPtr);
+
+
+TSEARCH_INLINE uint64_t _tsearch_bitmap_get_key(const GNEInteger integer)
+{
+    return ((uint64_t)integer ^ SIGN_BIT) >> CHUNK_BITS;
+}
+
+
+TSEARCH_INLINE uint16_t _tsearch_bitmap_get_low(const GNEInteger integer)
+{
+    return (uint16_t)((uint64_t)integer & (CHUNK_LENGTH - 1));
+}
+
+
+TSEARCH_INLINE GNEInteger _tsearch_bitmap_get_integer(const uint64_t key, const uint16_t low)
+{
+    return (GNEInteger)(((key << CHUNK_BITS) | low) ^ SIGN_BIT);
+}
+
+
+TSEARCH_INLINE uint32_t _tsearch_bitmap_add_counts(const uint32_t count, const size_t countToAdd)
+{
+    return (countToAdd >= (size_t)(UINT32_MAX - count)) ? UINT32_MAX : (uint32_t)(count + countToAdd);
+}
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Bitmap
+// ------------------------------------------------------------------------------------------
+tsearch_bitmap_ptr tsearch_bitmap_init(const bool keepsCounts)
+{
+    tsearch_bitmap_ptr ptr = calloc(1, sizeof(tsearch_bitmap));
+    if (ptr == NULL) { return NULL; }
+
+    size_t capacity = 4;
+    _tsearch_bitmap_container *containers = calloc(capacity, sizeof(_tsearch_bitmap_container));
+    if (containers == NULL) { tsearch_bitmap_free(ptr); return NULL; }
+
+    ptr->containers = containers;
+    ptr->containersCount = 0;
+    ptr->containersCapacity = capacity;
+    ptr->count = 0;
+    ptr->keepsCounts = keepsCounts;
+    return ptr;
+}
+
+
+tsearch_bitmap_ptr tsearch_bitmap_init_with_sorted_ints(const GNEInteger *integers, const size_t *counts,
+                                                        const size_t count, const bool keepsCounts)
+{
+    if (count > 0 && integers == NULL) { return NULL; }
+    tsearch_bitmap_ptr ptr = tsearch_bitmap_init(keepsCounts);
+    if (ptr == NULL) { return NULL; }
+
+    size_t start = 0;
+    while (start < count) {
+        uint64_t key = _tsearch_bitmap_get_key(integers[start]);
+        size_t end = start + 1;
+        while (end < count && _tsearch_bitmap_get_key(integers[end]) == key) {
+            if (integers[end - 1] >= integers[end]) { tsearch_bitmap_free(ptr); return NULL; }
+            end += 1;
+        }
+        if (end < count && integers[end - 1] >= integers[end]) { tsearch_bitmap_free(ptr); return NULL; }
+
+        size_t index = ptr->containersCount;
+        if (_tsearch_bitmap_insert_container(ptr, index, key) == failure) { tsearch_bitmap_free(ptr); return NULL; }
+        _tsearch_bitmap_container *containerPtr = &(ptr->containers[index]);
+        const size_t *containerCounts = (counts == NULL) ? NULL : &(counts[start]);
+        if (_tsearch_bitmap_container_init(containerPtr, key, &(integers[start]), containerCounts,
+                                           end - start, keepsCounts) == failure) {
+            tsearch_bitmap_free(ptr);
+            return NULL;
+        }
+        ptr->count += (end - start);
+        start = end;
+    }
+    return ptr;
+}
+
+
+tsearch_bitmap_ptr tsearch_bitmap_copy(const tsearch_bitmap_ptr ptr)
+{
+    if (ptr == NULL || ptr->containers == NULL) { return NULL; }
+    tsearch_bitmap_ptr copyPtr = tsearch_bitmap_init(ptr->keepsCounts);
+    if (copyPtr == NULL) { return NULL; }
+
+    for (size_t i = 0; i < ptr->containersCount; i++) {
+        const _tsearch_bitmap_container *containerPtr = &(ptr->containers[i]);
+        if (_tsearch_bitmap_insert_container(copyPtr, i, containerPtr->key) == failure ||
+            _tsearch_bitmap_container_copy(containerPtr, &(copyPtr->containers[i]), ptr->keepsCounts) == failure) {
+            tsearch_bitmap_free(copyPtr);
+            return NULL;
+        }
+    }
+    copyPtr->count = ptr->count;
+    return copyPtr;
+}
+
+
+void tsearch_bitmap_free(const tsearch_bitmap_ptr ptr)
+{
+    if (ptr != NULL) {
+        if (ptr->containers != NULL) {
+            for (size_t i = 0; i < ptr->containersCount; i++) {
+                _tsearch_bitmap_container_free(&(ptr->containers[i]));
+            }
+        }
+        free(ptr->containers);
+        ptr->containers = NULL;
+        ptr->containersCount = 0;
+        ptr->containersCapacity = 0;
+        ptr->count = 0;
+        free(ptr);
+    }
+}
+
+
+result tsearch_bitmap_shrink_to_fit(const tsearch_bitmap_ptr ptr)
+{
+    if (ptr == NULL) { return failure; }
+
+    // Shrinking can't lose any integers, so a failure to shrink is ignored.
+    for (size_t i = 0; i < ptr->containersCount; i++) {
+        _tsearch_bitmap_container *containerPtr = &(ptr->containers[i]);
+        size_t capacity = (containerPtr->cardinality > 0) ? containerPtr->cardinality : 1;
+        if (capacity >= containerPtr->capacity) { continue; }
+        if (containerPtr->values != NULL) {
+            uint16_t *values = realloc(containerPtr->values, capacity * sizeof(uint16_t));
+            if (values == NULL) { continue; }
+            containerPtr->values = values;
+        }
+        if (containerPtr->counts != NULL) {
+            uint32_t *counts = realloc(containerPtr->counts, capacity * sizeof(uint32_t));
+            if (counts == NULL) { continue; }
+            containerPtr->counts = counts;
+        }
+        containerPtr->capacity = capacity;
+    }
+
+    // Keep room for a few containers, like a new bitmap has, so that the array can still grow by half.
+    size_t containersCapacity = (ptr->containersCount > 4) ? ptr->containersCount : 4;
+    if (containersCapacity < ptr->containersCapacity) {
+        size_t size = containersCapacity * sizeof(_tsearch_bitmap_container);
+        _tsearch_bitmap_container *containers = realloc(ptr->containers, size);
+        if (containers != NULL) {
+            ptr->containers = containers;
+            ptr->containersCapacity = containersCapacity;
+        }
+    }
+    return success;
+}
+
+
+size_t tsearch_bitmap_get_count(const tsearch_bitmap_ptr ptr)
+{
+    return (ptr == NULL) ? 0 : ptr->count;
+}
+
+
+size_t tsearch_bitmap_get_size(const tsearch_bitmap_ptr ptr)
+{
+    if (ptr == NULL) { return 0; }
+    size_t size = sizeof(tsearch_bitmap) + (ptr->containersCapacity * sizeof(_tsearch_bitmap_container));
+    for (size_t i = 0; i < ptr->containersCount; i++) {
+        const _tsearch_bitmap_container *containerPtr = &(ptr->containers[i]);
+        if (containerPtr->values != NULL) { size += containerPtr->capacity * sizeof(uint16_t); }
+        if (containerPtr->words != NULL) { size += BITMAP_WORDS_COUNT * sizeof(uint64_t); }
+        if (containerPtr->counts != NULL) { size += containerPtr->capacity * sizeof(uint32_t); }
+    }
+    return size;
+}
+
+
+bool tsearch_bitmap_contains_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer)
+{
+    if (ptr == NULL || ptr->count == 0) { return false; }
+    bool found = false;
+    size_t index = _tsearch_bitmap_find_container(ptr, _tsearch_bitmap_get_key(integer), &found);
+    if (found == false) { return false; }
+
+    const _tsearch_bitmap_container *containerPtr = &(ptr->containers[index]);
+    uint16_t low = _tsearch_bitmap_get_low(integer);
+    if (containerPtr->words != NULL) {
+        return ((containerPtr->words[low / 64] >> (low % 64)) & 1) ? true : false;
+    }
+    _tsearch_bitmap_container_find(containerPtr, low, &found);
+    return found;
+}
+
+
+size_t tsearch_bitmap_get_count_for_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer)
+{
+    if (ptr == NULL || ptr->count == 0) { return 0; }
+    if (ptr->keepsCounts == false) { return (tsearch_bitmap_contains_int(ptr, integer) == true) ? 1 : 0; }
+
+    bool found = false;
+    size_t index = _tsearch_bitmap_find_container(ptr, _tsearch_bitmap_get_key(integer), &found);
+    if (found == false) { return 0; }
+
+    const _tsearch_bitmap_container *containerPtr = &(ptr->containers[index]);
+    size_t rank = _tsearch_bitmap_container_find(containerPtr, _tsearch_bitmap_get_low(integer), &found);
+    return (found == true) ? (size_t)containerPtr->counts[rank] : 0;
+}
+
+
+result tsearch_bitmap_add_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer, const size_t countToAdd)
+{
+    if (ptr == NULL || ptr->containers == NULL) { return failure; }
+    if (countToAdd == 0) { return success; }
+
+    uint64_t key = _tsearch_bitmap_get_key(integer);
+    bool found = false;
+    size_t index = _tsearch_bitmap_find_container(ptr, key, &found);
+    if (found == false && _tsearch_bitmap_insert_container(ptr, index, key) == failure) { return failure; }
+
+    bool inserted = false;
+    _tsearch_bitmap_container *containerPtr = &(ptr->containers[index]);
+    if (_tsearch_bitmap_container_add(containerPtr, _tsearch_bitmap_get_low(integer), countToAdd,
+                                      ptr->keepsCounts, &inserted) == failure) {
+        if (containerPtr->cardinality == 0) { _tsearch_bitmap_remove_container(ptr, index); }
+        return failure;
+    }
+    if (inserted == true) { ptr->count += 1; }
+    return success;
+}
+
+
+result tsearch_bitmap_subtract_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer,
+                                   const size_t countToSubtract)
+{
+    if (ptr == NULL || ptr->containers == NULL) { return failure; }
+    if (countToSubtract == 0) { return success; }
+
+    bool found = false;
+    size_t index = _tsearch_bitmap_find_container(ptr, _tsearch_bitmap_get_key(integer), &found);
+    if (found == false) { return success; }
+
+    bool removed = false;
+    _tsearch_bitmap_container *containerPtr = &(ptr->containers[index]);
+    _tsearch_bitmap_container_subtract(containerPtr, _tsearch_bitmap_get_low(integer), countToSubtract, &removed);
+    if (removed == true) { ptr->count -= 1; }
+    if (containerPtr->cardinality == 0) { _tsearch_bitmap_remove_container(ptr, index); }
+    return success;
+}
+
+
+result tsearch_bitmap_copy_sorted_ints(const tsearch_bitmap_ptr ptr, GNEInteger *outIntegers, size_t *outCounts)
+{
+    if (ptr == NULL || outIntegers == NULL || outCounts == NULL) { return failure; }
+    size_t count = 0;
+    for (size_t i = 0; i < ptr->containersCount; i++) {
+        count += _tsearch_bitmap_container_decode(&(ptr->containers[i]), &(outIntegers[count]), &(outCounts[count]));
+    }
+    return success;
+}
+
+
+void tsearch_bitmap_enumerate_ints(const tsearch_bitmap_ptr ptr, tsearch_bitmap_int_func func, void *context)
+{
+    if (ptr == NULL || func == NULL) { return; }
+    for (size_t i = 0; i < ptr->containersCount; i++) {
+        _tsearch_bitmap_container *containerPtr = &(ptr->containers[i]);
+        uint64_t key = containerPtr->key;
+        uint32_t *counts = containerPtr->counts;
+        if (containerPtr->words != NULL) {
+            size_t rank = 0;
+            for (size_t j = 0; j < BITMAP_WORDS_COUNT; j++) {
+                uint64_t word = containerPtr->words[j];
+                while (word != 0) {
+                    uint16_t low = (uint16_t)((j * 64) + (size_t)__builtin_ctzll(word));
+                    GNEInteger integer = _tsearch_bitmap_get_integer(key, low);
+                    func(integer, (counts == NULL) ? 1 : (size_t)counts[rank], context);
+                    rank += 1;
+                    word &= (word - 1);
+                }
+            }
+        } else {
+            for (size_t j = 0; j < containerPtr->cardinality; j++) {
+                GNEInteger integer = _tsearch_bitmap_get_integer(key, containerPtr->values[j]);
+                func(integer, (counts == NULL) ? 1 : (size_t)counts[j], context);
+            }
+        }
+    }
+}
+
+
+void tsearch_bitmap_cursor_init(tsearch_bitmap_cursor *cursor)
+{
+    if (cursor == NULL) { return; }
+    *cursor = (tsearch_bitmap_cursor){0, 0, 0};
+}
+
+
+bool tsearch_bitmap_cursor_next(const tsearch_bitmap_ptr ptr, tsearch_bitmap_cursor *cursor,
+                                GNEInteger *outInteger, size_t *outCount)
+{
+    if (ptr == NULL || cursor == NULL || outInteger == NULL || outCount == NULL) { return false; }
+
+    while (cursor->containerIndex < ptr->containersCount) {
+        _tsearch_bitmap_container *containerPtr = &(ptr->containers[cursor->containerIndex]);
+        bool found = false;
+        uint16_t low = 0;
+        if (containerPtr->words != NULL) {
+            for (size_t i = cursor->position / 64; i < BITMAP_WORDS_COUNT && found == false; i++) {
+                uint64_t word = containerPtr->words[i];
+                if (i == cursor->position / 64) { word &= ~0ULL << (cursor->position % 64); }
+                if (word == 0) { continue; }
+                low = (uint16_t)((i * 64) + (size_t)__builtin_ctzll(word));
+                found = true;
+            }
+        } else if (cursor->rank < containerPtr->cardinality) {
+            low = containerPtr->values[cursor->rank];
+            found = true;
+        }
+
+        if (found == true) {
+            *outInteger = _tsearch_bitmap_get_integer(containerPtr->key, low);
+            *outCount = (containerPtr->counts == NULL) ? 1 : (size_t)containerPtr->counts[cursor->rank];
+            cursor->rank += 1;
+            cursor->position = (uint32_t)low + 1;
+            return true;
+        }
+
+        cursor->containerIndex += 1;
+        cursor->rank = 0;
+        cursor->position = 0;
+    }
+    return false;
+}
+
+
+bool tsearch_bitmap_cursor_advance_to(const tsearch_bitmap_ptr ptr, tsearch_bitmap_cursor *cursor,
+                                      const GNEInteger target, GNEInteger *outInteger, size_t *outCount)
+{
+    if (ptr == NULL || cursor == NULL) { return false; }
+    if (cursor->containerIndex >= ptr->containersCount) { return false; }
+
+    uint64_t key = _tsearch_bitmap_get_key(target);
+    if (ptr->containers[cursor->containerIndex].key < key) {
+        bool found = false;
+        cursor->containerIndex = _tsearch_bitmap_find_container(ptr, key, &found);
+        cursor->rank = 0;
+        cursor->position = 0;
+    }
+
+    // Skip to the target inside of its container, keeping track of the integers skipped so that
+    // the cursor can still find the counts.
+    uint16_t low = _tsearch_bitmap_get_low(target);
+    if (cursor->containerIndex < ptr->containersCount && ptr->containers[cursor->containerIndex].key == key &&
+        low > cursor->position)
+    {
+        _tsearch_bitmap_container *containerPtr = &(ptr->containers[cursor->containerIndex]);
+        if (containerPtr->words != NULL) {
+            cursor->rank += _tsearch_bitmap_count_bits_in_range(containerPtr->words, cursor->position, low);
+        } else {
+            size_t start = cursor->rank;
+            size_t end = containerPtr->cardinality;
+            while (start < end) {
+                size_t middle = start + ((end - start) / 2);
+                if (containerPtr->values[middle] < low) { start = middle + 1; }
+                else { end = middle; }
+            }
+            cursor->rank = start;
+        }
+        cursor->position = low;
+    }
+
+    return tsearch_bitmap_cursor_next(ptr, cursor, outInteger, outCount);
+}
+
+
+result tsearch_bitmap_union(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr)
+{
+    return _tsearch_bitmap_combine(ptr, otherPtr, OPERATION_UNION);
+}
+
+
+result tsearch_bitmap_intersect(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr)
+{
+    return _tsearch_bitmap_combine(ptr, otherPtr, OPERATION_INTERSECT);
+}
+
+
+result tsearch_bitmap_minus(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr)
+{
+    return _tsearch_bitmap_combine(ptr, otherPtr, OPERATION_MINUS);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Walks the containers of both bitmaps in order of their keys and builds a new list of
+/// containers. Containers that are only present in the specified bitmap are moved into the
+/// new list instead of being copied.
+result _tsearch_bitmap_combine(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr, const int operation)
+{
+    if (ptr == NULL || ptr->containers == NULL) { return failure; }
+    if (otherPtr == NULL || otherPtr->containers == NULL) { return failure; }
+
+    size_t capacity = ptr->containersCount;
+    if (operation == OPERATION_UNION) { capacity += otherPtr->containersCount; }
+    if (capacity < 4) { capacity = 4; }
+    _tsearch_bitmap_container *containers = calloc(capacity, sizeof(_tsearch_bitmap_container));
+    if (containers == NULL) { return failure; }
+
+    _tsearch_bitmap_scratch scratch;
+    memset(&scratch, 0, sizeof(scratch));
+
+    size_t i = 0, j = 0, k = 0, count = 0;
+    size_t containersCount = ptr->containersCount;
+    size_t otherContainersCount = otherPtr->containersCount;
+    int result = success;
+    while (i < containersCount || j < otherContainersCount) {
+        _tsearch_bitmap_container *containerPtr = (i < containersCount) ? &(ptr->containers[i]) : NULL;
+        _tsearch_bitmap_container *otherContainerPtr = (j < otherContainersCount) ? &(otherPtr->containers[j]) : NULL;
+
+        if (otherContainerPtr == NULL || (containerPtr != NULL && containerPtr->key < otherContainerPtr->key)) {
+            // Only in this bitmap
+            if (operation == OPERATION_INTERSECT) {
+                _tsearch_bitmap_container_free(containerPtr);
+            } else {
+                containers[k] = *containerPtr;
+                count += containers[k].cardinality;
+                k += 1;
+            }
+            i += 1;
+        } else if (containerPtr == NULL || otherContainerPtr->key < containerPtr->key) {
+            // Only in the other bitmap
+            if (operation == OPERATION_UNION && result == success) {
+                result = _tsearch_bitmap_container_copy(otherContainerPtr, &(containers[k]), ptr->keepsCounts);
+                if (result == success) {
+                    count += containers[k].cardinality;
+                    k += 1;
+                }
+            }
+            j += 1;
+        } else {
+            if (result == success) {
+                result = _tsearch_bitmap_combine_containers(containerPtr, otherContainerPtr, ptr->keepsCounts,
+                                                            operation, &scratch);
+            }
+            if (result == success && containerPtr->cardinality > 0) {
+                containers[k] = *containerPtr;
+                count += containers[k].cardinality;
+                k += 1;
+            } else {
+                _tsearch_bitmap_container_free(containerPtr);
+            }
+            i += 1;
+            j += 1;
+        }
+    }
+    _tsearch_bitmap_scratch_free(&scratch);
+
+    // Every one of this bitmap's containers has been moved or freed, so the old list can be
+    // replaced even if the operation failed part of the way through.
+    free(ptr->containers);
+    ptr->containers = containers;
+    ptr->containersCount = k;
+    ptr->containersCapacity = capacity;
+    ptr->count = count;
+    return result;
+}
+
+
+/// Combines the other container into the specified container. If the containers are both
+/// bitmaps and the counts don't matter, they're combined one 64-bit word at a time.
+result _tsearch_bitmap_combine_containers(_tsearch_bitmap_container *containerPtr,
+                                          const _tsearch_bitmap_container *otherContainerPtr,
+                                          const bool keepsCounts, const int operation,
+                                          _tsearch_bitmap_scratch *scratchPtr)
+{
+    if (keepsCounts == false && containerPtr->words != NULL && otherContainerPtr->words != NULL) {
+        uint64_t *words = containerPtr->words;
+        const uint64_t *otherWords = otherContainerPtr->words;
+        if (operation == OPERATION_UNION) {
+            for (size_t i = 0; i < BITMAP_WORDS_COUNT; i++) { words[i] |= otherWords[i]; }
+        } else if (operation == OPERATION_INTERSECT) {
+            for (size_t i = 0; i < BITMAP_WORDS_COUNT; i++) { words[i] &= otherWords[i]; }
+        } else {
+            for (size_t i = 0; i < BITMAP_WORDS_COUNT; i++) { words[i] &= ~otherWords[i]; }
+        }
+        containerPtr->cardinality = _tsearch_bitmap_count_bits(words);
+        if (containerPtr->cardinality <= ARRAY_MAX_CARDINALITY) {
+            return _tsearch_bitmap_container_convert_to_array(containerPtr);
+        }
+        return success;
+    }
+
+    if (scratchPtr->integers1 == NULL) {
+        scratchPtr->integers1 = malloc(CHUNK_LENGTH * sizeof(GNEInteger));
+        scratchPtr->counts1 = malloc(CHUNK_LENGTH * sizeof(size_t));
+        scratchPtr->integers2 = malloc(CHUNK_LENGTH * sizeof(GNEInteger));
+        scratchPtr->counts2 = malloc(CHUNK_LENGTH * sizeof(size_t));
+        scratchPtr->outIntegers = malloc(CHUNK_LENGTH * sizeof(GNEInteger));
+        scratchPtr->outCounts = malloc(CHUNK_LENGTH * sizeof(size_t));
+        if (scratchPtr->integers1 == NULL || scratchPtr->counts1 == NULL ||
+            scratchPtr->integers2 == NULL || scratchPtr->counts2 == NULL ||
+            scratchPtr->outIntegers == NULL || scratchPtr->outCounts == NULL) {
+            _tsearch_bitmap_scratch_free(scratchPtr);
+            return failure;
+        }
+    }
+
+    size_t count1 = _tsearch_bitmap_container_decode(containerPtr, scratchPtr->integers1, scratchPtr->counts1);
+    size_t count2 = _tsearch_bitmap_container_decode(otherContainerPtr, scratchPtr->integers2, scratchPtr->counts2);
+    size_t outCount = 0;
+    if (operation == OPERATION_UNION) {
+        outCount = tsearch_sortedints_union(scratchPtr->integers1, scratchPtr->counts1, count1,
+                                            scratchPtr->integers2, scratchPtr->counts2, count2,
+                                            scratchPtr->outIntegers, scratchPtr->outCounts);
+    } else if (operation == OPERATION_INTERSECT) {
+        outCount = tsearch_sortedints_intersect(scratchPtr->integers1, scratchPtr->counts1, count1,
+                                                scratchPtr->integers2, scratchPtr->counts2, count2,
+                                                scratchPtr->outIntegers, scratchPtr->outCounts);
+    } else {
+        outCount = tsearch_sortedints_minus(scratchPtr->integers1, scratchPtr->counts1, count1,
+                                            scratchPtr->integers2, scratchPtr->counts2, count2,
+                                            scratchPtr->outIntegers, scratchPtr->outCounts);
+    }
+
+    uint64_t key = containerPtr->key;
+    _tsearch_bitmap_container_free(containerPtr);
+    return _tsearch_bitmap_container_init(containerPtr, key, scratchPtr->outIntegers, scratchPtr->outCounts,
+                                          outCount, keepsCounts);
+}
+
+
+/// Inserts an empty container with the specified key at the specified index.
+result _tsearch_bitmap_insert_container(const tsearch_bitmap_ptr ptr, const size_t index, const uint64_t key)
+{
+    if (ptr->containersCount == ptr->containersCapacity) {
+        size_t capacity = ptr->containersCapacity;
+        size_t size = _tsearch_next_buf_len(&capacity, sizeof(_tsearch_bitmap_container));
+        if (capacity == ptr->containersCapacity) { return failure; }
+        _tsearch_bitmap_container *containers = realloc(ptr->containers, size);
+        if (containers == NULL) { return failure; }
+        ptr->containers = containers;
+        ptr->containersCapacity = capacity;
+    }
+
+    _tsearch_bitmap_container *containers = ptr->containers;
+    size_t moveCount = ptr->containersCount - index;
+    memmove(&(containers[index + 1]), &(containers[index]), moveCount * sizeof(_tsearch_bitmap_container));
+    memset(&(containers[index]), 0, sizeof(_tsearch_bitmap_container));
+    containers[index].key = key;
+    ptr->containersCount += 1;
+    return success;
+}
+
+
+void _tsearch_bitmap_remove_container(const tsearch_bitmap_ptr ptr, const size_t index)
+{
+    _tsearch_bitmap_container *containers = ptr->containers;
+    _tsearch_bitmap_container_free(&(containers[index]));
+    size_t moveCount = ptr->containersCount - index - 1;
+    memmove(&(containers[index]), &(containers[index + 1]), moveCount * sizeof(_tsearch_bitmap_container));
+    ptr->containersCount -= 1;
+}
+
+
+/// Returns the index of the container with the specified key or, if there isn't one,
+/// the index at which it should be inserted.
+size_t _tsearch_bitmap_find_container(const tsearch_bitmap_ptr ptr, const uint64_t key, bool *outFound)
+{
+    size_t low = 0;
+    size_t high = ptr->containersCount;
+    while (low < high) {
+        size_t middle = low + ((high - low) / 2);
+        if (ptr->containers[middle].key < key) { low = middle + 1; }
+        else { high = middle; }
+    }
+    *outFound = (low < ptr->containersCount && ptr->containers[low].key == key) ? true : false;
+    return low;
+}
+
+
+/// Returns the rank of the specified value in the container, which is also the index of its count,
+/// or, if the value isn't present, the rank at which it should be inserted.
+size_t _tsearch_bitmap_container_find(const _tsearch_bitmap_container *containerPtr, const uint16_t low,
+                                      bool *outFound)
+{
+    if (containerPtr->words != NULL) {
+        const uint64_t *words = containerPtr->words;
+        size_t wordIndex = low / 64;
+        uint64_t bit = 1ULL << (low % 64);
+        size_t rank = 0;
+        for (size_t i = 0; i < wordIndex; i++) { rank += (size_t)__builtin_popcountll(words[i]); }
+        rank += (size_t)__builtin_popcountll(words[wordIndex] & (bit - 1));
+        *outFound = (words[wordIndex] & bit) ? true : false;
+        return rank;
+    }
+
+    const uint16_t *values = containerPtr->values;
+    size_t start = 0;
+    size_t end = containerPtr->cardinality;
+    while (start < end) {
+        size_t middle = start + ((end - start) / 2);
+        if (values[middle] < low) { start = middle + 1; }
+        else { end = middle; }
+    }
+    *outFound = (start < containerPtr->cardinality && values[start] == low) ? true : false;
+    return start;
+}
+
+
+/// Fills an empty container with the specified integers, which must all share the same key.
+result _tsearch_bitmap_container_init(_tsearch_bitmap_container *containerPtr, const uint64_t key,
+                                      const GNEInteger *integers, const size_t *counts, const size_t count,
+                                      const bool keepsCounts)
+{
+    memset(containerPtr, 0, sizeof(_tsearch_bitmap_container));
+    containerPtr->key = key;
+
+    size_t capacity = (count > 0) ? count : 1;
+    if (count > ARRAY_MAX_CARDINALITY) {
+        containerPtr->words = calloc(BITMAP_WORDS_COUNT, sizeof(uint64_t));
+        if (containerPtr->words == NULL) { return failure; }
+        for (size_t i = 0; i < count; i++) {
+            uint16_t low = _tsearch_bitmap_get_low(integers[i]);
+            containerPtr->words[low / 64] |= (1ULL << (low % 64));
+        }
+    } else {
+        containerPtr->values = malloc(capacity * sizeof(uint16_t));
+        if (containerPtr->values == NULL) { return failure; }
+        for (size_t i = 0; i < count; i++) {
+            containerPtr->values[i] = _tsearch_bitmap_get_low(integers[i]);
+        }
+    }
+
+    if (keepsCounts == true) {
+        containerPtr->counts = malloc(capacity * sizeof(uint32_t));
+        if (containerPtr->counts == NULL) { _tsearch_bitmap_container_free(containerPtr); return failure; }
+        for (size_t i = 0; i < count; i++) {
+            size_t integerCount = (counts == NULL) ? 1 : counts[i];
+            containerPtr->counts[i] = (integerCount > UINT32_MAX) ? UINT32_MAX : (uint32_t)integerCount;
+        }
+    }
+
+    containerPtr->capacity = capacity;
+    containerPtr->cardinality = count;
+    return success;
+}
+
+
+/// Copies the container, adding counts of 1 or dropping the counts to match keepsCounts.
+result _tsearch_bitmap_container_copy(const _tsearch_bitmap_container *containerPtr,
+                                      _tsearch_bitmap_container *outContainerPtr, const bool keepsCounts)
+{
+    memset(outContainerPtr, 0, sizeof(_tsearch_bitmap_container));
+    outContainerPtr->key = containerPtr->key;
+
+    size_t cardinality = containerPtr->cardinality;
+    size_t capacity = (cardinality > 0) ? cardinality : 1;
+    if (containerPtr->words != NULL) {
+        outContainerPtr->words = malloc(BITMAP_WORDS_COUNT * sizeof(uint64_t));
+        if (outContainerPtr->words == NULL) { return failure; }
+        memcpy(outContainerPtr->words, containerPtr->words, BITMAP_WORDS_COUNT * sizeof(uint64_t));
+    } else {
+        outContainerPtr->values = malloc(capacity * sizeof(uint16_t));
+        if (outContainerPtr->values == NULL) { return failure; }
+        memcpy(outContainerPtr->values, containerPtr->values, cardinality * sizeof(uint16_t));
+    }
+
+    if (keepsCounts == true) {
+        outContainerPtr->counts = malloc(capacity * sizeof(uint32_t));
+        if (outContainerPtr->counts == NULL) { _tsearch_bitmap_container_free(outContainerPtr); return failure; }
+        if (containerPtr->counts != NULL) {
+            memcpy(outContainerPtr->counts, containerPtr->counts, cardinality * sizeof(uint32_t));
+        } else {
+            for (size_t i = 0; i < cardinality; i++) { outContainerPtr->counts[i] = 1; }
+        }
+    }
+
+    outContainerPtr->capacity = capacity;
+    outContainerPtr->cardinality = cardinality;
+    return success;
+}
+
+
+void _tsearch_bitmap_container_free(_tsearch_bitmap_container *containerPtr)
+{
+    if (containerPtr == NULL) { return; }
+    free(containerPtr->values);
+    containerPtr->values = NULL;
+    free(containerPtr->words);
+    containerPtr->words = NULL;
+    free(containerPtr->counts);
+    containerPtr->counts = NULL;
+    containerPtr->cardinality = 0;
+    containerPtr->capacity = 0;
+}
+
+
+/// Writes the container's integers and their counts in ascending order. Returns the number written.
+size_t _tsearch_bitmap_container_decode(const _tsearch_bitmap_container *containerPtr,
+                                        GNEInteger *outIntegers, size_t *outCounts)
+{
+    uint64_t key = containerPtr->key;
+    size_t count = 0;
+    if (containerPtr->words != NULL) {
+        for (size_t i = 0; i < BITMAP_WORDS_COUNT; i++) {
+            uint64_t word = containerPtr->words[i];
+            while (word != 0) {
+                uint16_t low = (uint16_t)((i * 64) + (size_t)__builtin_ctzll(word));
+                outIntegers[count] = _tsearch_bitmap_get_integer(key, low);
+                count += 1;
+                word &= (word - 1);
+            }
+        }
+    } else {
+        count = containerPtr->cardinality;
+        for (size_t i = 0; i < count; i++) {
+            outIntegers[i] = _tsearch_bitmap_get_integer(key, containerPtr->values[i]);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        outCounts[i] = (containerPtr->counts == NULL) ? 1 : (size_t)containerPtr->counts[i];
+    }
+    return count;
+}
+
+
+result _tsearch_bitmap_container_add(_tsearch_bitmap_container *containerPtr, const uint16_t low,
+                                     const size_t countToAdd, const bool keepsCounts, bool *outInserted)
+{
+    *outInserted = false;
+    bool found = false;
+    size_t rank = _tsearch_bitmap_container_find(containerPtr, low, &found);
+    if (found == true) {
+        if (containerPtr->counts != NULL) {
+            containerPtr->counts[rank] = _tsearch_bitmap_add_counts(containerPtr->counts[rank], countToAdd);
+        }
+        return success;
+    }
+
+    if (containerPtr->words == NULL && containerPtr->cardinality == ARRAY_MAX_CARDINALITY) {
+        if (_tsearch_bitmap_container_convert_to_bitmap(containerPtr) == failure) { return failure; }
+    }
+    if (_tsearch_bitmap_container_reserve(containerPtr, containerPtr->cardinality + 1, keepsCounts) == failure) {
+        return failure;
+    }
+
+    size_t moveCount = containerPtr->cardinality - rank;
+    if (containerPtr->words != NULL) {
+        containerPtr->words[low / 64] |= (1ULL << (low % 64));
+    } else {
+        uint16_t *values = containerPtr->values;
+        memmove(&(values[rank + 1]), &(values[rank]), moveCount * sizeof(uint16_t));
+        values[rank] = low;
+    }
+    if (containerPtr->counts != NULL) {
+        uint32_t *counts = containerPtr->counts;
+        memmove(&(counts[rank + 1]), &(counts[rank]), moveCount * sizeof(uint32_t));
+        counts[rank] = _tsearch_bitmap_add_counts(0, countToAdd);
+    }
+    containerPtr->cardinality += 1;
+    *outInserted = true;
+    return success;
+}
+
+
+void _tsearch_bitmap_container_subtract(_tsearch_bitmap_container *containerPtr, const uint16_t low,
+                                        const size_t countToSubtract, bool *outRemoved)
+{
+    *outRemoved = false;
+    bool found = false;
+    size_t rank = _tsearch_bitmap_container_find(containerPtr, low, &found);
+    if (found == false) { return; }
+
+    uint32_t *counts = containerPtr->counts;
+    if (counts != NULL && (size_t)counts[rank] > countToSubtract) {
+        counts[rank] -= (uint32_t)countToSubtract;
+        return;
+    }
+
+    size_t moveCount = containerPtr->cardinality - rank - 1;
+    if (containerPtr->words != NULL) {
+        containerPtr->words[low / 64] &= ~(1ULL << (low % 64));
+    } else {
+        uint16_t *values = containerPtr->values;
+        memmove(&(values[rank]), &(values[rank + 1]), moveCount * sizeof(uint16_t));
+    }
+    if (counts != NULL) {
+        memmove(&(counts[rank]), &(counts[rank + 1]), moveCount * sizeof(uint32_t));
+    }
+    containerPtr->cardinality -= 1;
+    *outRemoved = true;
+
+    // If converting fails, the container remains a valid (if oversized) bitmap.
+    if (containerPtr->words != NULL && containerPtr->cardinality <= ARRAY_MAX_CARDINALITY) {
+        _tsearch_bitmap_container_convert_to_array(containerPtr);
+    }
+}
+
+
+/// Makes sure the container has room for the specified number of values and counts.
+result _tsearch_bitmap_container_reserve(_tsearch_bitmap_container *containerPtr, const size_t capacity,
+                                         const bool keepsCounts)
+{
+    bool needsCounts = (keepsCounts == true && containerPtr->counts == NULL) ? true : false;
+    bool needsValues = (containerPtr->words == NULL && containerPtr->values == NULL) ? true : false;
+    if (capacity <= containerPtr->capacity && needsCounts == false && needsValues == false) { return success; }
+
+    size_t newCapacity = containerPtr->capacity;
+    while (newCapacity < capacity) {
+        size_t nextCapacity = newCapacity;
+        _tsearch_next_buf_len(&nextCapacity, sizeof(uint32_t));
+        newCapacity = (nextCapacity > newCapacity + 4) ? nextCapacity : (newCapacity + 4);
+    }
+    if (newCapacity > CHUNK_LENGTH) { newCapacity = CHUNK_LENGTH; }
+
+    if (containerPtr->words == NULL) {
+        uint16_t *values = realloc(containerPtr->values, newCapacity * sizeof(uint16_t));
+        if (values == NULL) { return failure; }
+        containerPtr->values = values;
+    }
+    if (keepsCounts == true) {
+        uint32_t *counts = realloc(containerPtr->counts, newCapacity * sizeof(uint32_t));
+        if (counts == NULL) { return failure; }
+        containerPtr->counts = counts;
+    }
+    containerPtr->capacity = newCapacity;
+    return success;
+}
+
+
+result _tsearch_bitmap_container_convert_to_bitmap(_tsearch_bitmap_container *containerPtr)
+{
+    uint64_t *words = calloc(BITMAP_WORDS_COUNT, sizeof(uint64_t));
+    if (words == NULL) { return failure; }
+    for (size_t i = 0; i < containerPtr->cardinality; i++) {
+        uint16_t low = containerPtr->values[i];
+        words[low / 64] |= (1ULL << (low % 64));
+    }
+    free(containerPtr->values);
+    containerPtr->values = NULL;
+    containerPtr->words = words;
+    return success;
+}
+
+
+result _tsearch_bitmap_container_convert_to_array(_tsearch_bitmap_container *containerPtr)
+{
+    size_t cardinality = containerPtr->cardinality;
+    size_t capacity = (cardinality > 0) ? cardinality : 1;
+    uint16_t *values = malloc(capacity * sizeof(uint16_t));
+    if (values == NULL) { return failure; }
+
+    size_t count = 0;
+    for (size_t i = 0; i < BITMAP_WORDS_COUNT; i++) {
+        uint64_t word = containerPtr->words[i];
+        while (word != 0) {
+            values[count] = (uint16_t)((i * 64) + (size_t)__builtin_ctzll(word));
+            count += 1;
+            word &= (word - 1);
+        }
+    }
+
+    // Shrinking the counts can't lose any of them, so a failure to shrink is ignored.
+    if (containerPtr->counts != NULL) {
+        uint32_t *counts = realloc(containerPtr->counts, capacity * sizeof(uint32_t));
+        if (counts != NULL) { containerPtr->counts = counts; }
+    }
+
+    free(containerPtr->words);
+    containerPtr->words = NULL;
+    containerPtr->values = values;
+    containerPtr->capacity = capacity;
+    return success;
+}
+
+
+size_t _tsearch_bitmap_count_bits(const uint64_t *words)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < BITMAP_WORDS_COUNT; i++) { count += (size_t)__builtin_popcountll(words[i]); }
+    return count;
+}
+
+
+/// Returns the number of bits set in [start, end).
+size_t _tsearch_bitmap_count_bits_in_range(const uint64_t *words, const size_t start, const size_t end)
+{
+    if (start >= end) { return 0; }
+
+    size_t startWord = start / 64;
+    size_t endWord = end / 64;
+    uint64_t startMask = ~0ULL << (start % 64);
+    uint64_t endMask = ((end % 64) == 0) ? 0 : (~0ULL >> (64 - (end % 64)));
+    if (startWord == endWord) { return (size_t)__builtin_popcountll(words[startWord] & startMask & endMask); }
+
+    size_t count = (size_t)__builtin_popcountll(words[startWord] & startMask);
+    for (size_t i = startWord + 1; i < endWord; i++) { count += (size_t)__builtin_popcountll(words[i]); }
+    if (endMask != 0) { count += (size_t)__builtin_popcountll(words[endWord] & endMask); }
+    return count;
+}
+
+
+void _tsearch_bitmap_scratch_free(_tsearch_bitmap_scratch *scratchPtr)
+{
+    free(scratchPtr->integers1);
+    free(scratchPtr->counts1);
+    free(scratchPtr->integers2);
+    free(scratchPtr->counts2);
+    free(scratchPtr->outIntegers);
+    free(scratchPtr->outCounts);
+    memset(scratchPtr, 0, sizeof(_tsearch_bitmap_scratch));
+}
@@ -0,0 +1,103 @@
+//
+//  bitmap.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_bitmap_h
+#define tsearch_bitmap_h
+
+#include "GNETextSearchPublic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A compressed bitmap of integers, organized like a roaring bitmap. The integers are split into
+// chunks of 65,536 values that share their high 48 bits. Each chunk is stored in a container
+// that is either a sorted array of the low 16 bits (for up to 4,096 integers) or a 65,536-bit
+// bitmap. Optionally, each integer has a count, which is stored in a side array in ascending
+// order of the integers. Counts are saturated at UINT32_MAX.
+
+typedef struct tsearch_bitmap * tsearch_bitmap_ptr;
+typedef void(*tsearch_bitmap_int_func)(const GNEInteger integer, const size_t count, void *context);
+
+/// A position in a bitmap, used to visit its integers in ascending order one at a time. A cursor
+/// is only valid until the bitmap is changed.
+typedef struct tsearch_bitmap_cursor
+{
+    size_t containerIndex;
+    size_t rank; // The number of the container's integers before the position.
+    uint32_t position; // The low 16 bits of the next integer that may be visited in the container.
+} tsearch_bitmap_cursor;
+
+/// Creates an empty bitmap. If keepsCounts is false, every integer's count is 1.
+tsearch_bitmap_ptr tsearch_bitmap_init(const bool keepsCounts);
+/// Creates a bitmap containing the specified integers, which must be unique and in ascending order.
+tsearch_bitmap_ptr tsearch_bitmap_init_with_sorted_ints(const GNEInteger *integers, const size_t *counts,
+                                                        const size_t count, const bool keepsCounts);
+tsearch_bitmap_ptr tsearch_bitmap_copy(const tsearch_bitmap_ptr ptr);
+void tsearch_bitmap_free(const tsearch_bitmap_ptr ptr);
+
+/// Releases any memory the bitmap's containers have reserved for integers that haven't been added yet.
+result tsearch_bitmap_shrink_to_fit(const tsearch_bitmap_ptr ptr);
+
+/// Returns the number of integers in the bitmap.
+size_t tsearch_bitmap_get_count(const tsearch_bitmap_ptr ptr);
+
+/// Returns the number of bytes used by the bitmap and its containers.
+size_t tsearch_bitmap_get_size(const tsearch_bitmap_ptr ptr);
+
+bool tsearch_bitmap_contains_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer);
+
+/// Returns the count for the specified integer. Returns 0 if the integer is not in the bitmap.
+size_t tsearch_bitmap_get_count_for_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer);
+
+/// Adds the integer to the bitmap or, if it is already present, adds to its count.
+result tsearch_bitmap_add_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer, const size_t countToAdd);
+
+/// Subtracts from the integer's count and removes the integer once its count reaches zero.
+/// Success is unrelated to whether or not the integer exists in the bitmap.
+result tsearch_bitmap_subtract_int(const tsearch_bitmap_ptr ptr, const GNEInteger integer,
+                                   const size_t countToSubtract);
+
+/// Writes all of the integers in the bitmap and their counts in ascending order of the integers.
+/// The out arrays must have room for tsearch_bitmap_get_count() integers.
+result tsearch_bitmap_copy_sorted_ints(const tsearch_bitmap_ptr ptr, GNEInteger *outIntegers, size_t *outCounts);
+
+/// Calls the function with each of the integers in the bitmap and its count in ascending order
+/// of the integers.
+void tsearch_bitmap_enumerate_ints(const tsearch_bitmap_ptr ptr, tsearch_bitmap_int_func func, void *context);
+
+/// Moves the cursor to the start of the bitmap.
+void tsearch_bitmap_cursor_init(tsearch_bitmap_cursor *cursor);
+
+/// Moves the cursor past the next integer in the bitmap and returns the integer and its count.
+/// Returns false if there aren't any more integers.
+bool tsearch_bitmap_cursor_next(const tsearch_bitmap_ptr ptr, tsearch_bitmap_cursor *cursor,
+                                GNEInteger *outInteger, size_t *outCount);
+
+/// Moves the cursor past the next integer that is greater than or equal to the target and returns
+/// the integer and its count. Containers before the target's container are skipped without being
+/// visited. Returns false if there aren't any more integers.
+bool tsearch_bitmap_cursor_advance_to(const tsearch_bitmap_ptr ptr, tsearch_bitmap_cursor *cursor,
+                                      const GNEInteger target, GNEInteger *outInteger, size_t *outCount);
+
+/// Adds each integer and its count in the other bitmap to the specified bitmap.
+result tsearch_bitmap_union(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr);
+
+/// Removes from the specified bitmap each integer that isn’t a member of the other bitmap.
+/// If an integer is present in both bitmaps, its counts are added together.
+result tsearch_bitmap_intersect(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr);
+
+/// Subtracts the counts of the integers in the other bitmap from the specified bitmap, removing
+/// each integer whose count reaches zero.
+result tsearch_bitmap_minus(const tsearch_bitmap_ptr ptr, const tsearch_bitmap_ptr otherPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_bitmap_h */
@@ -8,6 +8,8 @@
 
 #include "countedset.h"
 #include "GNETextSearchPrivate.h"
+#include "sortedints.h"
+#include "bitmap.h"
 #include <string.h>
 
 // ------------------------------------------------------------------------------------------
@@ -16,6 +18,24 @@
 #define BALANCED 0
 #define RIGHT_HEAVY -1
 
+// An AVL tree's height is at most ~1.44 * log2(n), so 96 levels is more than enough
+// for any number of nodes that can be addressed with a size_t.
+#define MAX_TREE_HEIGHT 96
+
+// Once a counted set holds at least this many integers, it checks whether its integers are dense
+// enough to be stored more compactly in a bitmap. The check is repeated each time the count doubles.
+#define BITMAP_MIN_COUNT 16384
+
+// A counted set is dense if, on average, each 65,536-integer chunk of its range holds at least
+// this many integers. At that point, a bitmap container needs at most ~7 bytes per integer,
+// compared to 40 bytes per tree node.
+#define BITMAP_MIN_INTEGERS_PER_CHUNK 8
+
+// Removed integers leave nodes with a count of zero in the tree. Once they make up more than this
+// percentage of the nodes, the tree is rebuilt without them. Small trees are never rebuilt.
+#define DEFAULT_MAX_TOMBSTONE_PERCENTAGE 25
+#define COMPACTION_MIN_NODES 64
+
 typedef struct _tsearch_countedset_node
 {
     GNEInteger integer;
@@ -32,25 +52,84 @@ typedef struct tsearch_countedset
     size_t count; // The number of nodes whose count > 0.
     size_t nodesCapacity;
     size_t insertIndex;
+    tsearch_bitmap_ptr bitmap; // If not NULL, holds the integers instead of the nodes.
+    size_t nextDensityCheck;
+    bool ignoresCounts;
+    size_t maxTombstonePercentage;
 } tsearch_countedset;
 
+
+typedef struct _tsearch_countedset_ranked_int
+{
+    GNEInteger integer;
+    size_t count;
+} _tsearch_countedset_ranked_int;
+
+
+typedef struct tsearch_countedset_iterator
+{
+    tsearch_countedset_ptr countedSet;
+    tsearch_bitmap_cursor cursor; // Used instead of the stack if the counted set is a bitmap.
+    // The nodes whose integers and right subtrees haven't been visited yet, deepest last.
+    size_t stack[MAX_TREE_HEIGHT];
+    size_t stackCount;
+    size_t index; // The root of the next subtree to visit or SIZE_MAX.
+    bool hasVisited; // True once an integer has been visited.
+    GNEInteger lastInteger;
+} tsearch_countedset_iterator;
+
+
+// A min-heap of the highest-ranked integers seen so far. The lowest-ranked of them is at the
+// root, so it can be replaced whenever a higher-ranked integer comes along.
+typedef struct _tsearch_countedset_top_ints
+{
+    _tsearch_countedset_ranked_int *heap;
+    size_t count;
+    size_t maxCount;
+} _tsearch_countedset_top_ints;
+
 // ------------------------------------------------------------------------------------------
 
 _tsearch_countedset_node * _tsearch_countedset_copy_nodes(const tsearch_countedset_ptr ptr);
 result _tsearch_countedset_copy_ints(const tsearch_countedset_ptr ptr, GNEInteger *integers,
                                   const size_t integersCount);
 int _tsearch_countedset_compare(const void *valuePtr1, const void *valuePtr2);
+void _tsearch_countedset_top_ints_add(const GNEInteger integer, const size_t count, void *context);
+void _tsearch_countedset_top_ints_sift_down(_tsearch_countedset_ranked_int *heap, const size_t count,
+                                            size_t index);
+bool _tsearch_countedset_ranks_higher(const _tsearch_countedset_ranked_int value1,
+                                      const _tsearch_countedset_ranked_int value2);
 result _tsearch_countedset_add_int(const tsearch_countedset_ptr ptr,
                                    const GNEInteger newInteger, const size_t countToAdd);
+result _tsearch_countedset_subtract_int(const tsearch_countedset_ptr ptr, const GNEInteger integer,
+                                        const size_t countToSubtract);
 _tsearch_countedset_node * _tsearch_countedset_get_node_for_int(const tsearch_countedset_ptr ptr,
                                                                 const GNEInteger integer);
 size_t _tsearch_countedset_get_node_idx_for_int_insert(const tsearch_countedset_ptr ptr, const GNEInteger integer);
-size_t _tsearch_countedset_get_node_and_parent_idx_for_int_insert(const tsearch_countedset_ptr ptr,
-                                                                  const GNEInteger integer,
-                                                                  size_t *outParentIndex);
-int _tsearch_countedset_balance_node_at_idx(_tsearch_countedset_node *nodes, const size_t index);
+void _tsearch_countedset_balance_path_after_insert(_tsearch_countedset_node *nodes, const size_t *path,
+                                                   const size_t pathLength, const GNEInteger integer);
 void _tsearch_countedset_rotate_left(_tsearch_countedset_node *nodes, const size_t index);
 void _tsearch_countedset_rotate_right(_tsearch_countedset_node *nodes, const size_t index);
+void _tsearch_countedset_rotate_left_right(_tsearch_countedset_node *nodes, const size_t index);
+void _tsearch_countedset_rotate_right_left(_tsearch_countedset_node *nodes, const size_t index);
+bool _tsearch_countedset_should_probe(const size_t largeCount, const size_t smallCount);
+size_t _tsearch_countedset_get_balanced_height(size_t count);
+result _tsearch_countedset_alloc_sorted_ints(const size_t count, GNEInteger **outIntegers, size_t **outCounts);
+result _tsearch_countedset_copy_sorted_ints(const tsearch_countedset_ptr ptr,
+                                            GNEInteger **outIntegers, size_t **outCounts);
+size_t _tsearch_countedset_intersect_probing(const tsearch_countedset_ptr ptr, GNEInteger *integers,
+                                             size_t *counts, const size_t count);
+result _tsearch_countedset_replace_with_sorted_ints(const tsearch_countedset_ptr ptr, const GNEInteger *integers,
+                                                    const size_t *counts, const size_t count);
+size_t _tsearch_countedset_build_balanced_nodes(_tsearch_countedset_node *nodes, const GNEInteger *integers,
+                                                const size_t *counts, const size_t start, const size_t end,
+                                                size_t *nextIndex);
+bool _tsearch_countedset_is_dense(const GNEInteger *integers, const size_t count);
+result _tsearch_countedset_convert_to_bitmap_if_dense(const tsearch_countedset_ptr ptr);
+result _tsearch_countedset_replace_with_bitmap(const tsearch_countedset_ptr ptr, const GNEInteger *integers,
+                                               const size_t *counts, const size_t count);
+bool _tsearch_countedset_should_compact(const tsearch_countedset_ptr ptr);
+result _tsearch_countedset_compact(const tsearch_countedset_ptr ptr);
 result _tsearch_countedset_node_init(const tsearch_countedset_ptr ptr, const GNEInteger integer,
                                      const size_t count, size_t *outIndex);
 result _tsearch_countedset_increase_values_buf(const tsearch_countedset_ptr ptr);
@@ -72,6 +151,38 @@ tsearch_countedset_ptr tsearch_countedset_init(void)
     ptr->count = 0;
     ptr->nodesCapacity = (count * size);
     ptr->insertIndex = 0;
+    ptr->bitmap = NULL;
+    ptr->nextDensityCheck = BITMAP_MIN_COUNT;
+    ptr->ignoresCounts = false;
+    ptr->maxTombstonePercentage = DEFAULT_MAX_TOMBSTONE_PERCENTAGE;
+    return ptr;
+}
+
+
+tsearch_countedset_ptr tsearch_countedset_init_ignoring_counts(void)
+{
+    tsearch_countedset_ptr ptr = tsearch_countedset_init();
+    if (ptr == NULL) { return NULL; }
+    ptr->ignoresCounts = true;
+    return ptr;
+}
+
+
+tsearch_countedset_ptr tsearch_countedset_init_with_sorted_ints(const GNEInteger *integers, const size_t *counts,
+                                                                const size_t count)
+{
+    if (count > 0 && (integers == NULL || counts == NULL)) { return NULL; }
+    for (size_t i = 0; i < count; i++) {
+        if (counts[i] == 0) { return NULL; }
+        if (i > 0 && integers[i - 1] >= integers[i]) { return NULL; }
+    }
+
+    tsearch_countedset_ptr ptr = tsearch_countedset_init();
+    if (ptr == NULL) { return NULL; }
+    if (_tsearch_countedset_replace_with_sorted_ints(ptr, integers, counts, count) == failure) {
+        tsearch_countedset_free(ptr);
+        return NULL;
+    }
     return ptr;
 }
 
@@ -92,6 +203,14 @@ tsearch_countedset_ptr tsearch_countedset_copy(const tsearch_countedset_ptr ptr)
     copyPtr->count = ptr->count;
     copyPtr->nodesCapacity = ptr->nodesCapacity;
     copyPtr->insertIndex = ptr->insertIndex;
+    copyPtr->nextDensityCheck = ptr->nextDensityCheck;
+    copyPtr->ignoresCounts = ptr->ignoresCounts;
+    copyPtr->maxTombstonePercentage = ptr->maxTombstonePercentage;
+
+    if (ptr->bitmap != NULL) {
+        copyPtr->bitmap = tsearch_bitmap_copy(ptr->bitmap);
+        if (copyPtr->bitmap == NULL) { tsearch_countedset_free(copyPtr); return NULL; }
+    }
     return copyPtr;
 }
 
@@ -104,19 +223,75 @@ void tsearch_countedset_free(const tsearch_countedset_ptr ptr)
         ptr->count = 0;
         ptr->nodesCapacity = 0;
         ptr->insertIndex = 0;
+        tsearch_bitmap_free(ptr->bitmap);
+        ptr->bitmap = NULL;
         free(ptr);
     }
 }
 
 
+result tsearch_countedset_set_max_tombstone_percentage(const tsearch_countedset_ptr ptr, const size_t percentage)
+{
+    if (ptr == NULL || percentage > 100) { return failure; }
+    ptr->maxTombstonePercentage = percentage;
+    if (_tsearch_countedset_should_compact(ptr) == true) { return _tsearch_countedset_compact(ptr); }
+    return success;
+}
+
+
+result tsearch_countedset_shrink_to_fit(const tsearch_countedset_ptr ptr)
+{
+    if (ptr == NULL || ptr->nodes == NULL) { return failure; }
+
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { return failure; }
+
+    // A bitmap that is still dense is kept even if it has become small, because it will
+    // still need less memory than a tree.
+    int result = success;
+    size_t count = ptr->count;
+    bool usesBitmap = (ptr->bitmap != NULL || count >= BITMAP_MIN_COUNT) ? true : false;
+    if (usesBitmap == true && _tsearch_countedset_is_dense(integers, count) == true) {
+        if (ptr->bitmap != NULL) { result = tsearch_bitmap_shrink_to_fit(ptr->bitmap); }
+        else { result = _tsearch_countedset_replace_with_bitmap(ptr, integers, counts, count); }
+    } else {
+        // The integers have already been copied, so the nodes can be shrunk before the tree is rebuilt.
+        // Two spare nodes are kept, just like when the nodes grow.
+        size_t size = sizeof(_tsearch_countedset_node);
+        size_t capacity = (count + 2 > 5) ? (count + 2) : 5;
+        if (capacity < ptr->nodesCapacity / size) {
+            _tsearch_countedset_node *nodes = realloc(ptr->nodes, capacity * size);
+            if (nodes != NULL) {
+                ptr->nodes = nodes;
+                ptr->nodesCapacity = capacity * size;
+            }
+        }
+        result = _tsearch_countedset_replace_with_sorted_ints(ptr, integers, counts, count);
+    }
+
+    free(integers);
+    free(counts);
+    return result;
+}
+
+
 size_t tsearch_countedset_get_count(const tsearch_countedset_ptr ptr)
 {
     return (ptr == NULL) ? 0 : ptr->count;
 }
 
 
+size_t tsearch_countedset_get_size(const tsearch_countedset_ptr ptr)
+{
+    if (ptr == NULL) { return 0; }
+    return sizeof(tsearch_countedset) + ptr->nodesCapacity + tsearch_bitmap_get_size(ptr->bitmap);
+}
+
+
 bool tsearch_countedset_contains_int(const tsearch_countedset_ptr ptr, const GNEInteger integer)
 {
+    if (ptr != NULL && ptr->bitmap != NULL) { return tsearch_bitmap_contains_int(ptr->bitmap, integer); }
     _tsearch_countedset_node *nodePtr = _tsearch_countedset_get_node_for_int(ptr, integer);
     return (nodePtr == NULL || nodePtr->count == 0) ? false : true;
 }
@@ -125,6 +300,7 @@ bool tsearch_countedset_contains_int(const tsearch_countedset_ptr ptr, const GNE
 size_t tsearch_countedset_get_count_for_int(const tsearch_countedset_ptr ptr, const GNEInteger integer)
 {
     if (ptr == NULL || ptr->nodes == NULL) { return 0; }
+    if (ptr->bitmap != NULL) { return tsearch_bitmap_get_count_for_int(ptr->bitmap, integer); }
     _tsearch_countedset_node *nodePtr = _tsearch_countedset_get_node_for_int(ptr, integer);
     return (nodePtr == NULL) ? 0 : nodePtr->count;
 }
@@ -147,31 +323,101 @@ result tsearch_countedset_copy_ints(const tsearch_countedset_ptr ptr, GNEInteger
 }
 
 
+result tsearch_countedset_copy_top_ints(const tsearch_countedset_ptr ptr, const size_t maxCount,
+                                        GNEInteger **outIntegers, size_t *outCount)
+{
+    if (ptr == NULL || ptr->nodes == NULL || outIntegers == NULL || outCount == NULL) { return failure; }
+
+    size_t integersCount = (maxCount < ptr->count) ? maxCount : ptr->count;
+    size_t capacity = (integersCount > 0) ? integersCount : 1;
+    _tsearch_countedset_top_ints topInts = { NULL, 0, integersCount };
+    topInts.heap = malloc(capacity * sizeof(_tsearch_countedset_ranked_int));
+    GNEInteger *integers = malloc(capacity * sizeof(GNEInteger));
+    if (topInts.heap == NULL || integers == NULL) {
+        free(topInts.heap);
+        free(integers);
+        *outCount = 0;
+        return failure;
+    }
+
+    if (integersCount > 0) {
+        if (ptr->bitmap != NULL) {
+            tsearch_bitmap_enumerate_ints(ptr->bitmap, &_tsearch_countedset_top_ints_add, &topInts);
+        } else {
+            size_t nodesCount = ptr->insertIndex;
+            _tsearch_countedset_node *nodes = ptr->nodes;
+            for (size_t i = 0; i < nodesCount; i++) {
+                if (nodes[i].count == 0) { continue; }
+                _tsearch_countedset_top_ints_add(nodes[i].integer, nodes[i].count, &topInts);
+            }
+        }
+    }
+
+    // Repeatedly moving the lowest-ranked integer to the end of the heap leaves the integers
+    // in descending order of their rank.
+    _tsearch_countedset_ranked_int *heap = topInts.heap;
+    for (size_t i = topInts.count; i > 1; i--) {
+        _tsearch_countedset_ranked_int lowest = heap[0];
+        heap[0] = heap[i - 1];
+        heap[i - 1] = lowest;
+        _tsearch_countedset_top_ints_sift_down(heap, i - 1, 0);
+    }
+    for (size_t i = 0; i < topInts.count; i++) {
+        integers[i] = heap[i].integer;
+    }
+    free(heap);
+
+    *outIntegers = integers;
+    *outCount = topInts.count;
+    return success;
+}
+
+
+result tsearch_countedset_copy_sorted_ints(const tsearch_countedset_ptr ptr, GNEInteger **outIntegers,
+                                           size_t **outCounts, size_t *outCount)
+{
+    if (ptr == NULL || ptr->nodes == NULL) { return failure; }
+    if (outIntegers == NULL || outCounts == NULL || outCount == NULL) { return failure; }
+    if (_tsearch_countedset_copy_sorted_ints(ptr, outIntegers, outCounts) == failure) {
+        *outCount = 0;
+        return failure;
+    }
+    *outCount = ptr->count;
+    return success;
+}
+
+
 result tsearch_countedset_add_int(const tsearch_countedset_ptr ptr, const GNEInteger integer)
 {
     return _tsearch_countedset_add_int(ptr, integer, 1);
 }
 
 
+result tsearch_countedset_add_int_with_count(const tsearch_countedset_ptr ptr, const GNEInteger integer,
+                                             const size_t count)
+{
+    if (count == 0) { return success; }
+    return _tsearch_countedset_add_int(ptr, integer, count);
+}
+
+
 result tsearch_countedset_remove_int(const tsearch_countedset_ptr ptr, const GNEInteger integer)
 {
-    if (ptr == NULL) { return failure; }
-    _tsearch_countedset_node *nodePtr = _tsearch_countedset_get_node_for_int(ptr, integer);
-    if (nodePtr == NULL || nodePtr->count == 0) { return success; }
-    nodePtr->count = 0;
-    ptr->count -= 1;
-    return success;
+    return _tsearch_countedset_subtract_int(ptr, integer, SIZE_MAX);
 }
 
 
 result tsearch_countedset_remove_all_ints(const tsearch_countedset_ptr ptr)
 {
     if (ptr == NULL) { return failure; }
-    size_t count = ptr->insertIndex;
-    for (size_t i = 0; i < count; i++) {
-        ptr->nodes[i].count = 0;
+    if (ptr->bitmap != NULL) {
+        tsearch_bitmap_free(ptr->bitmap);
+        ptr->bitmap = NULL;
+        ptr->nextDensityCheck = BITMAP_MIN_COUNT;
     }
+    // Every node would be a tombstone, so the tree is simply emptied and its nodes are reused.
     ptr->count = 0;
+    ptr->insertIndex = 0;
     return success;
 }
 
@@ -181,47 +427,99 @@ result tsearch_countedset_union(const tsearch_countedset_ptr ptr, const tsearch_
     if (ptr == NULL || ptr->nodes == NULL) { return failure; }
     if (otherPtr == NULL || otherPtr->nodes == NULL) { return success; }
 
-    size_t otherCount = otherPtr->insertIndex;
-    _tsearch_countedset_node *otherNodes = otherPtr->nodes;
-    for (size_t i = 0; i < otherCount; i++) {
-        if (otherNodes[i].count == 0) { continue; }
-        _tsearch_countedset_node otherValue = otherNodes[i];
-        int result = _tsearch_countedset_add_int(ptr, otherValue.integer, otherValue.count);
-        if (result == failure) { return failure; }
+    size_t count = ptr->count;
+    size_t otherCount = otherPtr->count;
+    if (otherCount == 0) { return success; }
+
+    if (ptr->bitmap != NULL && otherPtr->bitmap != NULL) {
+        int result = tsearch_bitmap_union(ptr->bitmap, otherPtr->bitmap);
+        ptr->count = tsearch_bitmap_get_count(ptr->bitmap);
+        return result;
     }
-    return success;
+
+    GNEInteger *integers = NULL, *otherIntegers = NULL, *unionIntegers = NULL;
+    size_t *counts = NULL, *otherCounts = NULL, *unionCounts = NULL;
+    size_t unionCount = 0;
+    int result = failure;
+
+    // If the other set is tiny, inserting its integers one at a time is cheaper than
+    // flattening both sets, merging them, and rebuilding this one.
+    if (count > 0 && _tsearch_countedset_should_probe(count, otherCount) == true) {
+        if (_tsearch_countedset_copy_sorted_ints(otherPtr, &otherIntegers, &otherCounts) == failure) { goto done; }
+        for (size_t i = 0; i < otherCount; i++) {
+            if (_tsearch_countedset_add_int(ptr, otherIntegers[i], otherCounts[i]) == failure) { goto done; }
+        }
+        result = success;
+        goto done;
+    }
+
+    if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { goto done; }
+    if (_tsearch_countedset_copy_sorted_ints(otherPtr, &otherIntegers, &otherCounts) == failure) { goto done; }
+    if (_tsearch_countedset_alloc_sorted_ints(count + otherCount, &unionIntegers, &unionCounts) == failure) {
+        goto done;
+    }
+    unionCount = tsearch_sortedints_union(integers, counts, count, otherIntegers, otherCounts, otherCount,
+                                          unionIntegers, unionCounts);
+    result = _tsearch_countedset_replace_with_sorted_ints(ptr, unionIntegers, unionCounts, unionCount);
+
+done:
+    free(integers);
+    free(counts);
+    free(otherIntegers);
+    free(otherCounts);
+    free(unionIntegers);
+    free(unionCounts);
+    return result;
 }
 
 
 result tsearch_countedset_intersect(const tsearch_countedset_ptr ptr, const tsearch_countedset_ptr otherPtr)
 {
     if (ptr == NULL || ptr->nodes == NULL) { return failure; }
-    if (otherPtr == NULL || otherPtr->nodes == NULL) {
+    if (otherPtr == NULL || otherPtr->nodes == NULL || otherPtr->count == 0) {
         return tsearch_countedset_remove_all_ints(ptr);
     }
 
-    size_t actualCount = ptr->insertIndex;
+    size_t count = ptr->count;
+    size_t otherCount = otherPtr->count;
+    if (count == 0) { return success; }
 
-    // Copy all of the counted set's values so that we can iterate over them
-    // while modifying the set.
-    _tsearch_countedset_node *nodesCopy = _tsearch_countedset_copy_nodes(ptr);
-    if (nodesCopy == NULL) { return failure; }
+    if (ptr->bitmap != NULL && otherPtr->bitmap != NULL) {
+        int result = tsearch_bitmap_intersect(ptr->bitmap, otherPtr->bitmap);
+        ptr->count = tsearch_bitmap_get_count(ptr->bitmap);
+        return result;
+    }
 
-    for (size_t i = 0; i < actualCount; i++) {
-        _tsearch_countedset_node node = nodesCopy[i];
-        if (node.count == 0) { continue; }
-        _tsearch_countedset_node *nodePtr = _tsearch_countedset_get_node_for_int(otherPtr, node.integer);
-        if (nodePtr == NULL || nodePtr->count == 0) {
-            int result = tsearch_countedset_remove_int(ptr, node.integer);
-            if (result == failure) { free(nodesCopy); return failure; }
-        } else {
-            size_t count = tsearch_countedset_get_count_for_int(otherPtr, node.integer);
-            int result = _tsearch_countedset_add_int(ptr, node.integer, count);
-            if (result == failure) { free(nodesCopy); return failure; }
-        }
+    GNEInteger *integers = NULL, *otherIntegers = NULL;
+    size_t *counts = NULL, *otherCounts = NULL;
+    size_t intersectionCount = 0;
+    int result = failure;
+
+    if (_tsearch_countedset_should_probe(count, otherCount) == true) {
+        // Look up each of the other set's integers in this set.
+        if (_tsearch_countedset_copy_sorted_ints(otherPtr, &otherIntegers, &otherCounts) == failure) { goto done; }
+        intersectionCount = _tsearch_countedset_intersect_probing(ptr, otherIntegers, otherCounts, otherCount);
+        result = _tsearch_countedset_replace_with_sorted_ints(ptr, otherIntegers, otherCounts, intersectionCount);
+    } else if (_tsearch_countedset_should_probe(otherCount, count) == true) {
+        // Look up each of this set's integers in the other set.
+        if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { goto done; }
+        intersectionCount = _tsearch_countedset_intersect_probing(otherPtr, integers, counts, count);
+        result = _tsearch_countedset_replace_with_sorted_ints(ptr, integers, counts, intersectionCount);
+    } else {
+        if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { goto done; }
+        if (_tsearch_countedset_copy_sorted_ints(otherPtr, &otherIntegers, &otherCounts) == failure) { goto done; }
+        intersectionCount = tsearch_sortedints_intersect(integers, counts, count,
+                                                         otherIntegers, otherCounts, otherCount,
+                                                         integers, counts);
+        result = _tsearch_countedset_replace_with_sorted_ints(ptr, integers, counts, intersectionCount);
     }
-    free(nodesCopy);
-    return success;
+
+done:
+    free(integers);
+    free(counts);
+    free(otherIntegers);
+    free(otherCounts);
+    return result;
 }
 
 
@@ -230,20 +528,141 @@ result tsearch_countedset_minus(const tsearch_countedset_ptr ptr, const tsearch_
     if (ptr == NULL || ptr->nodes == NULL) { return failure; }
     if (otherPtr == NULL || otherPtr->nodes == NULL) { return success; }
 
-    size_t otherUsedCount = otherPtr->insertIndex;
-    _tsearch_countedset_node *otherNodes = otherPtr->nodes;
-    for (size_t i = 0; i < otherUsedCount; i++) {
-        _tsearch_countedset_node otherValue = otherNodes[i];
-        _tsearch_countedset_node *nodePtr = _tsearch_countedset_get_node_for_int(ptr, otherValue.integer);
-        if (nodePtr == NULL) { continue; }
-        if (otherValue.count >= nodePtr->count) {
-            int result = tsearch_countedset_remove_int(ptr, otherValue.integer);
-            if (result == failure) { return failure; }
+    size_t count = ptr->count;
+    size_t otherCount = otherPtr->count;
+    if (count == 0 || otherCount == 0) { return success; }
+
+    if (ptr->bitmap != NULL && otherPtr->bitmap != NULL) {
+        int result = tsearch_bitmap_minus(ptr->bitmap, otherPtr->bitmap);
+        ptr->count = tsearch_bitmap_get_count(ptr->bitmap);
+        return result;
+    }
+
+    GNEInteger *integers = NULL, *otherIntegers = NULL;
+    size_t *counts = NULL, *otherCounts = NULL;
+    size_t differenceCount = 0;
+    int result = failure;
+
+    // If the other set is tiny, its integers are subtracted from this set in place.
+    if (_tsearch_countedset_should_probe(count, otherCount) == true) {
+        if (_tsearch_countedset_copy_sorted_ints(otherPtr, &otherIntegers, &otherCounts) == failure) { goto done; }
+        for (size_t i = 0; i < otherCount; i++) {
+            if (_tsearch_countedset_subtract_int(ptr, otherIntegers[i], otherCounts[i]) == failure) { goto done; }
+        }
+        result = success;
+        goto done;
+    }
+
+    if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { goto done; }
+    if (_tsearch_countedset_copy_sorted_ints(otherPtr, &otherIntegers, &otherCounts) == failure) { goto done; }
+    differenceCount = tsearch_sortedints_minus(integers, counts, count, otherIntegers, otherCounts, otherCount,
+                                               integers, counts);
+    result = _tsearch_countedset_replace_with_sorted_ints(ptr, integers, counts, differenceCount);
+
+done:
+    free(integers);
+    free(counts);
+    free(otherIntegers);
+    free(otherCounts);
+    return result;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Iterator
+// ------------------------------------------------------------------------------------------
+tsearch_countedset_iterator_ptr tsearch_countedset_iterator_init(const tsearch_countedset_ptr ptr)
+{
+    if (ptr == NULL || ptr->nodes == NULL) { return NULL; }
+
+    tsearch_countedset_iterator_ptr iteratorPtr = calloc(1, sizeof(tsearch_countedset_iterator));
+    if (iteratorPtr == NULL) { return NULL; }
+
+    iteratorPtr->countedSet = ptr;
+    tsearch_bitmap_cursor_init(&(iteratorPtr->cursor));
+    iteratorPtr->stackCount = 0;
+    iteratorPtr->index = (ptr->bitmap == NULL && ptr->insertIndex > 0) ? 0 : SIZE_MAX;
+    iteratorPtr->hasVisited = false;
+
+    return iteratorPtr;
+}
+
+
+void tsearch_countedset_iterator_free(const tsearch_countedset_iterator_ptr iteratorPtr)
+{
+    free(iteratorPtr);
+}
+
+
+bool tsearch_countedset_iterator_next(const tsearch_countedset_iterator_ptr iteratorPtr,
+                                      GNEInteger *outInteger, size_t *outCount)
+{
+    if (iteratorPtr == NULL || outInteger == NULL || outCount == NULL) { return false; }
+
+    tsearch_countedset_ptr ptr = iteratorPtr->countedSet;
+    if (ptr->bitmap != NULL) {
+        return tsearch_bitmap_cursor_next(ptr->bitmap, &(iteratorPtr->cursor), outInteger, outCount);
+    }
+
+    // Continue walking the tree in order where the last call left off, skipping removed integers.
+    _tsearch_countedset_node *nodes = ptr->nodes;
+    while (iteratorPtr->index != SIZE_MAX || iteratorPtr->stackCount > 0) {
+        while (iteratorPtr->index != SIZE_MAX) {
+            if (iteratorPtr->stackCount == MAX_TREE_HEIGHT) { return false; }
+            iteratorPtr->stack[iteratorPtr->stackCount] = iteratorPtr->index;
+            iteratorPtr->stackCount += 1;
+            iteratorPtr->index = nodes[iteratorPtr->index].left;
+        }
+        iteratorPtr->stackCount -= 1;
+        size_t index = iteratorPtr->stack[iteratorPtr->stackCount];
+        iteratorPtr->index = nodes[index].right;
+        if (nodes[index].count > 0) {
+            iteratorPtr->hasVisited = true;
+            iteratorPtr->lastInteger = nodes[index].integer;
+            *outInteger = nodes[index].integer;
+            *outCount = nodes[index].count;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+bool tsearch_countedset_iterator_advance_to(const tsearch_countedset_iterator_ptr iteratorPtr,
+                                            const GNEInteger target, GNEInteger *outInteger, size_t *outCount)
+{
+    if (iteratorPtr == NULL || outInteger == NULL || outCount == NULL) { return false; }
+
+    tsearch_countedset_ptr ptr = iteratorPtr->countedSet;
+    if (ptr->bitmap != NULL) {
+        return tsearch_bitmap_cursor_advance_to(ptr->bitmap, &(iteratorPtr->cursor), target, outInteger, outCount);
+    }
+
+    // The iterator never moves backwards.
+    if (iteratorPtr->hasVisited == true && target <= iteratorPtr->lastInteger) {
+        return tsearch_countedset_iterator_next(iteratorPtr, outInteger, outCount);
+    }
+    if (iteratorPtr->index == SIZE_MAX && iteratorPtr->stackCount == 0) { return false; }
+
+    // Descend from the root again to the first integer that is greater than or equal to the target.
+    // The nodes where the descent goes left are the ones whose integers and right subtrees still
+    // have to be visited. Any integers before the target are skipped entirely.
+    _tsearch_countedset_node *nodes = ptr->nodes;
+    iteratorPtr->stackCount = 0;
+    iteratorPtr->index = SIZE_MAX;
+    size_t index = (ptr->insertIndex > 0) ? 0 : SIZE_MAX;
+    while (index != SIZE_MAX) {
+        if (nodes[index].integer >= target) {
+            if (iteratorPtr->stackCount == MAX_TREE_HEIGHT) { return false; }
+            iteratorPtr->stack[iteratorPtr->stackCount] = index;
+            iteratorPtr->stackCount += 1;
+            index = nodes[index].left;
         } else {
-            nodePtr->count -= otherValue.count;
+            index = nodes[index].right;
         }
     }
-    return success;
+
+    return tsearch_countedset_iterator_next(iteratorPtr, outInteger, outCount);
 }
 
 
@@ -253,6 +672,21 @@ result tsearch_countedset_minus(const tsearch_countedset_ptr ptr, const tsearch_
 _tsearch_countedset_node * _tsearch_countedset_copy_nodes(const tsearch_countedset_ptr ptr)
 {
     if (ptr == NULL || ptr->nodes == NULL) { return NULL; }
+    if (ptr->bitmap != NULL) {
+        // The nodes are only used for sorting, so their links are left empty.
+        GNEInteger *integers = NULL;
+        size_t *counts = NULL;
+        if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { return NULL; }
+        _tsearch_countedset_node *nodesCopy = calloc((ptr->count > 0) ? ptr->count : 1,
+                                                     sizeof(_tsearch_countedset_node));
+        for (size_t i = 0; nodesCopy != NULL && i < ptr->count; i++) {
+            nodesCopy[i].integer = integers[i];
+            nodesCopy[i].count = counts[i];
+        }
+        free(integers);
+        free(counts);
+        return nodesCopy;
+    }
     size_t actualCount = ptr->insertIndex;
     size_t size = sizeof(_tsearch_countedset_node);
     _tsearch_countedset_node *nodesCopy = calloc(actualCount, size);
@@ -268,18 +702,24 @@ result _tsearch_countedset_copy_ints(const tsearch_countedset_ptr ptr, GNEIntege
     if (ptr == NULL || ptr->nodes == NULL) { return failure; }
     if (integers == NULL || integersCount == 0) { return failure; }
 
-    size_t nodesCount = ptr->insertIndex;
+    size_t nodesCount = (ptr->bitmap != NULL) ? ptr->count : ptr->insertIndex;
     size_t size = sizeof(_tsearch_countedset_node);
     if (integersCount > nodesCount) { return failure; }
 
     _tsearch_countedset_node *nodesCopy = _tsearch_countedset_copy_nodes(ptr);
     if (nodesCopy == NULL) { return failure; }
 
-    qsort(nodesCopy, nodesCount, size, &_tsearch_countedset_compare);
+    // Drop the nodes with zero counts so that they aren't sorted, too.
+    size_t liveCount = 0;
+    for (size_t i = 0; i < nodesCount; i++) {
+        if (nodesCopy[i].count == 0) { continue; }
+        nodesCopy[liveCount] = nodesCopy[i];
+        liveCount += 1;
+    }
+    if (integersCount > liveCount) { free(nodesCopy); return failure; }
+
+    qsort(nodesCopy, liveCount, size, &_tsearch_countedset_compare);
 
-    // The nodes are sorted in descending order. So, all of the nodes with zero counts
-    // are at the end of the array. The integers count only includes nodes with
-    // non-zero counts.
     for (size_t i = 0; i < integersCount; i++) {
         _tsearch_countedset_node value = nodesCopy[i];
         integers[i] = value.integer;
@@ -301,50 +741,169 @@ int _tsearch_countedset_compare(const void *valuePtr1, const void *valuePtr2)
 }
 
 
+/// Adds the integer to the top integers if there is room for it or if it ranks higher than the
+/// lowest-ranked of them.
+void _tsearch_countedset_top_ints_add(const GNEInteger integer, const size_t count, void *context)
+{
+    _tsearch_countedset_top_ints *topIntsPtr = (_tsearch_countedset_top_ints *)context;
+    if (topIntsPtr == NULL || topIntsPtr->maxCount == 0) { return; }
+
+    _tsearch_countedset_ranked_int *heap = topIntsPtr->heap;
+    _tsearch_countedset_ranked_int value = { integer, count };
+    if (topIntsPtr->count < topIntsPtr->maxCount) {
+        // Sift the new integer up from the end of the heap.
+        size_t index = topIntsPtr->count;
+        topIntsPtr->count += 1;
+        while (index > 0) {
+            size_t parentIndex = (index - 1) / 2;
+            if (_tsearch_countedset_ranks_higher(value, heap[parentIndex]) == true) { break; }
+            heap[index] = heap[parentIndex];
+            index = parentIndex;
+        }
+        heap[index] = value;
+    } else if (_tsearch_countedset_ranks_higher(value, heap[0]) == true) {
+        heap[0] = value;
+        _tsearch_countedset_top_ints_sift_down(heap, topIntsPtr->count, 0);
+    }
+}
+
+
+void _tsearch_countedset_top_ints_sift_down(_tsearch_countedset_ranked_int *heap, const size_t count,
+                                            size_t index)
+{
+    _tsearch_countedset_ranked_int value = heap[index];
+    while (true) {
+        size_t childIndex = (2 * index) + 1;
+        if (childIndex >= count) { break; }
+        size_t rightIndex = childIndex + 1;
+        if (rightIndex < count && _tsearch_countedset_ranks_higher(heap[childIndex], heap[rightIndex]) == true) {
+            childIndex = rightIndex;
+        }
+        if (_tsearch_countedset_ranks_higher(value, heap[childIndex]) == false) { break; }
+        heap[index] = heap[childIndex];
+        index = childIndex;
+    }
+    heap[index] = value;
+}
+
+
+/// Integers with larger counts rank higher. If their counts are equal, the smaller integer ranks higher.
+bool _tsearch_countedset_ranks_higher(const _tsearch_countedset_ranked_int value1,
+                                      const _tsearch_countedset_ranked_int value2)
+{
+    if (value1.count != value2.count) { return (value1.count > value2.count) ? true : false; }
+    return (value1.integer < value2.integer) ? true : false;
+}
+
+
 result _tsearch_countedset_add_int(const tsearch_countedset_ptr ptr,
                                    const GNEInteger newInteger,
                                    const size_t countToAdd)
 {
     if (ptr == NULL || ptr->nodes == NULL) { return failure; }
+    if (ptr->bitmap != NULL) {
+        int result = tsearch_bitmap_add_int(ptr->bitmap, newInteger, countToAdd);
+        ptr->count = tsearch_bitmap_get_count(ptr->bitmap);
+        return result;
+    }
+
+    size_t count = (ptr->ignoresCounts == true) ? 1 : countToAdd;
     if (ptr->insertIndex == 0) {
         size_t index = SIZE_MAX;
-        int result = _tsearch_countedset_node_init(ptr, newInteger, countToAdd, &index);
+        int result = _tsearch_countedset_node_init(ptr, newInteger, count, &index);
         if (result == failure || index == SIZE_MAX) { return failure; }
         return success;
     }
 
-    size_t parentIndex = SIZE_MAX;
-    size_t insertIndex = _tsearch_countedset_get_node_and_parent_idx_for_int_insert(ptr,
-                                                                                    newInteger,
-                                                                                    &parentIndex);
-    if (insertIndex == SIZE_MAX) { return failure; }
-
-    _tsearch_countedset_node *nodePtr = &(ptr->nodes[insertIndex]);
-    GNEInteger nodeInteger = nodePtr->integer;
-
-    if (nodeInteger == newInteger) {
-        size_t newCount = ((SIZE_MAX - nodePtr->count) >= countToAdd) ? (nodePtr->count + countToAdd) : SIZE_MAX;
-        nodePtr->count = newCount;
-        if (newCount == 1) {
-            ptr->count += 1;
+    // Remember the path from the root to the insertion point so that only the nodes
+    // on it need to be rebalanced afterwards.
+    size_t path[MAX_TREE_HEIGHT];
+    size_t pathLength = 0;
+
+    _tsearch_countedset_node *nodes = ptr->nodes;
+    size_t nextIndex = 0; // Start at root
+    do {
+        _tsearch_countedset_node *nodePtr = &(nodes[nextIndex]);
+        if (nodePtr->integer == newInteger) {
+            if (nodePtr->count == 0 && count > 0) { ptr->count += 1; }
+            size_t newCount = ((SIZE_MAX - nodePtr->count) >= count) ? (nodePtr->count + count) : SIZE_MAX;
+            nodePtr->count = (ptr->ignoresCounts == true && newCount > 0) ? 1 : newCount;
+            return success;
         }
-        return success;
-    }
+        if (pathLength == MAX_TREE_HEIGHT) { return failure; }
+        path[pathLength] = nextIndex;
+        pathLength += 1;
+        nextIndex = (newInteger < nodePtr->integer) ? nodePtr->left : nodePtr->right;
+    } while (nextIndex != SIZE_MAX);
 
     size_t index = SIZE_MAX;
-    int result = _tsearch_countedset_node_init(ptr, newInteger, countToAdd, &index);
+    int result = _tsearch_countedset_node_init(ptr, newInteger, count, &index);
     if (result == failure || index == SIZE_MAX) { return failure; }
-    nodePtr = &(ptr->nodes[insertIndex]); // If ptr->nodes was realloced, we need to refresh the pointer.
+    nodes = ptr->nodes; // If ptr->nodes was realloced, we need to refresh the pointer.
+
+    _tsearch_countedset_node *parentPtr = &(nodes[path[pathLength - 1]]);
+    if (newInteger < parentPtr->integer) { parentPtr->left = index; }
+    else { parentPtr->right = index; }
+
+    _tsearch_countedset_balance_path_after_insert(nodes, path, pathLength, newInteger);
+
+    // The tree is still valid if it isn't converted, so the conversion's result is ignored.
+    if (ptr->count >= ptr->nextDensityCheck) { _tsearch_countedset_convert_to_bitmap_if_dense(ptr); }
+    return success;
+}
 
-    if (newInteger < nodeInteger) { nodePtr->left = index; }
-    else { nodePtr->right = index; }
 
-    _tsearch_countedset_balance_node_at_idx(ptr->nodes, parentIndex);
+/// Subtracts from the integer's count. If the count reaches zero, the integer is removed.
+result _tsearch_countedset_subtract_int(const tsearch_countedset_ptr ptr, const GNEInteger integer,
+                                        const size_t countToSubtract)
+{
+    if (ptr == NULL) { return failure; }
+    if (ptr->bitmap != NULL) {
+        int result = tsearch_bitmap_subtract_int(ptr->bitmap, integer, countToSubtract);
+        ptr->count = tsearch_bitmap_get_count(ptr->bitmap);
+        return result;
+    }
 
+    _tsearch_countedset_node *nodePtr = _tsearch_countedset_get_node_for_int(ptr, integer);
+    if (nodePtr == NULL || nodePtr->count == 0) { return success; }
+    if (countToSubtract >= nodePtr->count) {
+        nodePtr->count = 0;
+        ptr->count -= 1;
+        // The tree is still valid if it isn't compacted, so the compaction's result is ignored.
+        if (_tsearch_countedset_should_compact(ptr) == true) { _tsearch_countedset_compact(ptr); }
+    } else {
+        nodePtr->count -= countToSubtract;
+    }
     return success;
 }
 
 
+/// Returns true if the tree is large enough and the percentage of its nodes whose count is zero
+/// is larger than the counted set's maximum.
+bool _tsearch_countedset_should_compact(const tsearch_countedset_ptr ptr)
+{
+    if (ptr == NULL || ptr->bitmap != NULL) { return false; }
+    size_t nodesCount = ptr->insertIndex;
+    if (nodesCount < COMPACTION_MIN_NODES) { return false; }
+    size_t tombstonesCount = nodesCount - ptr->count;
+    if (tombstonesCount == 0) { return false; }
+    return (tombstonesCount * 100 > nodesCount * ptr->maxTombstonePercentage) ? true : false;
+}
+
+
+/// Rebuilds the tree from its integers whose count is greater than zero.
+result _tsearch_countedset_compact(const tsearch_countedset_ptr ptr)
+{
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { return failure; }
+    int result = _tsearch_countedset_replace_with_sorted_ints(ptr, integers, counts, ptr->count);
+    free(integers);
+    free(counts);
+    return result;
+}
+
+
 /// Returns the exact node containing the specified integer or NULL if the integer isn't
 /// present in the counted set.
 _tsearch_countedset_node * _tsearch_countedset_get_node_for_int(const tsearch_countedset_ptr ptr,
@@ -361,14 +920,6 @@ _tsearch_countedset_node * _tsearch_countedset_get_node_for_int(const tsearch_co
 /// Returns the index for the node representing the specified integer or the parent node into which
 /// a new node should be inserted. Returns SIZE_MAX on failure.
 size_t _tsearch_countedset_get_node_idx_for_int_insert(const tsearch_countedset_ptr ptr, const GNEInteger integer)
-{
-    return _tsearch_countedset_get_node_and_parent_idx_for_int_insert(ptr, integer, NULL);
-}
-
-
-size_t _tsearch_countedset_get_node_and_parent_idx_for_int_insert(const tsearch_countedset_ptr ptr,
-                                                                  const GNEInteger integer,
-                                                                  size_t *outParentIndex)
 {
     if (ptr == NULL || ptr->nodes == NULL || ptr->insertIndex == 0) { return SIZE_MAX; }
 
@@ -376,7 +927,6 @@ size_t _tsearch_countedset_get_node_and_parent_idx_for_int_insert(const tsearch_
     size_t parentIndex = SIZE_MAX;
     size_t nextIndex = 0; // Start at root
     do {
-        if (outParentIndex != NULL) { *outParentIndex = parentIndex; }
         parentIndex = nextIndex;
         if (integer < nodes[parentIndex].integer) { nextIndex = nodes[parentIndex].left; }
         else if (integer > nodes[parentIndex].integer) { nextIndex = nodes[parentIndex].right; }
@@ -387,100 +937,360 @@ size_t _tsearch_countedset_get_node_and_parent_idx_for_int_insert(const tsearch_
 }
 
 
-int _tsearch_countedset_balance_node_at_idx(_tsearch_countedset_node *nodes, const size_t index)
+/// Walks back up the insertion path, updating each node's balance factor. Because a
+/// rotation restores the height the subtree had before the insert, the walk stops at the
+/// first rotation or at the first node whose subtree height didn't change.
+void _tsearch_countedset_balance_path_after_insert(_tsearch_countedset_node *nodes, const size_t *path,
+                                                   const size_t pathLength, const GNEInteger integer)
 {
-    if (nodes == NULL || index == SIZE_MAX) { return 0; }
-    int leftHeight = _tsearch_countedset_balance_node_at_idx(nodes, nodes[index].left);
-    int rightHeight = _tsearch_countedset_balance_node_at_idx(nodes, nodes[index].right);
-    int height = leftHeight - rightHeight;
-    if (abs(leftHeight - rightHeight) > 1) {
-        if (height < 0) {
-            _tsearch_countedset_rotate_right(nodes, index);
+    for (size_t i = pathLength; i > 0; i--) {
+        size_t index = path[i - 1];
+        _tsearch_countedset_node *nodePtr = &(nodes[index]);
+        nodePtr->balance += (integer < nodePtr->integer) ? LEFT_HEAVY : RIGHT_HEAVY;
+
+        if (nodePtr->balance == BALANCED) { return; }
+        if (nodePtr->balance == LEFT_HEAVY || nodePtr->balance == RIGHT_HEAVY) { continue; }
+
+        if (nodePtr->balance > LEFT_HEAVY) {
+            if (nodes[nodePtr->left].balance == LEFT_HEAVY) { _tsearch_countedset_rotate_right(nodes, index); }
+            else { _tsearch_countedset_rotate_left_right(nodes, index); }
         } else {
-            _tsearch_countedset_rotate_left(nodes, index);
+            if (nodes[nodePtr->right].balance == RIGHT_HEAVY) { _tsearch_countedset_rotate_left(nodes, index); }
+            else { _tsearch_countedset_rotate_right_left(nodes, index); }
         }
-        height = BALANCED;
+        return;
     }
-    nodes[index].balance = height;
-    return abs(height) + 1;
 }
 
 
-void _tsearch_countedset_rotate_left(_tsearch_countedset_node *nodes, const size_t index)
+// The rotations below keep the root of the rotated subtree at the same index, so the
+// parent's child index (and any path recorded above it) remains valid.
+
+
+void _tsearch_countedset_rotate_right(_tsearch_countedset_node *nodes, const size_t index)
 {
+    //     8         7
+    //   7    ==>  2   8
+    // 2
     _tsearch_countedset_node node = nodes[index];
     size_t childIndex = node.left;
     _tsearch_countedset_node childNode = nodes[childIndex];
-    size_t grandchildIndex = (childNode.balance > 0) ? childNode.left : childNode.right;
-    _tsearch_countedset_node grandchildNode = nodes[grandchildIndex];
-    if (childNode.balance > 0) {
-        //     8         7
-        //   7    ==>  2   8
-        // 2
-        nodes[index] = childNode;
-        nodes[index].left = grandchildIndex;
-        nodes[index].right = childIndex;
-        nodes[index].balance = BALANCED;
-
-        nodes[childIndex] = node;
-        nodes[childIndex].left = SIZE_MAX;
-        nodes[childIndex].balance = BALANCED;
-    } else {
-        //   8         7
-        // 2    ==>  2   8
-        //   7
-        nodes[index] = grandchildNode;
-        nodes[index].left = childIndex;
-        nodes[index].right = grandchildIndex;
-        nodes[index].balance = BALANCED;
 
-        nodes[grandchildIndex] = node;
-        nodes[grandchildIndex].left = SIZE_MAX;
-        nodes[grandchildIndex].balance = BALANCED;
+    nodes[index] = childNode;
+    nodes[index].right = childIndex;
+    nodes[index].balance = BALANCED;
 
-        nodes[childIndex].right = SIZE_MAX;
-        nodes[childIndex].balance = BALANCED;
-    }
+    nodes[childIndex] = node;
+    nodes[childIndex].left = childNode.right;
+    nodes[childIndex].balance = BALANCED;
 }
 
 
-void _tsearch_countedset_rotate_right(_tsearch_countedset_node *nodes, const size_t index)
+void _tsearch_countedset_rotate_left(_tsearch_countedset_node *nodes, const size_t index)
 {
+    // 2             7
+    //   7    ==>  2   8
+    //     8
     _tsearch_countedset_node node = nodes[index];
     size_t childIndex = node.right;
     _tsearch_countedset_node childNode = nodes[childIndex];
-    size_t grandchildIndex = (childNode.balance > 0) ? childNode.left : childNode.right;
+
+    nodes[index] = childNode;
+    nodes[index].left = childIndex;
+    nodes[index].balance = BALANCED;
+
+    nodes[childIndex] = node;
+    nodes[childIndex].right = childNode.left;
+    nodes[childIndex].balance = BALANCED;
+}
+
+
+void _tsearch_countedset_rotate_left_right(_tsearch_countedset_node *nodes, const size_t index)
+{
+    //   8         7
+    // 2    ==>  2   8
+    //   7
+    _tsearch_countedset_node node = nodes[index];
+    size_t childIndex = node.left;
+    size_t grandchildIndex = nodes[childIndex].right;
     _tsearch_countedset_node grandchildNode = nodes[grandchildIndex];
-    if (childNode.balance > 0) {
-        // 2           7
-        //   8  ==>  2   8
-        // 7
-        nodes[index] = grandchildNode;
-        nodes[index].left = grandchildIndex;
-        nodes[index].right = childIndex;
-        nodes[index].balance = BALANCED;
-
-        nodes[grandchildIndex] = node;
-        nodes[grandchildIndex].left = SIZE_MAX;
-        nodes[grandchildIndex].right = SIZE_MAX;
-        nodes[grandchildIndex].balance = BALANCED;
-
-        nodes[childIndex].left = SIZE_MAX;
-        nodes[childIndex].balance = BALANCED;
-    } else {
-        // 2             7
-        //   7    ==>  2   8
-        //     8
-        nodes[index] = childNode;
-        nodes[index].left = childIndex;
-        nodes[index].right = grandchildIndex;
-        nodes[index].balance = BALANCED;
-
-        nodes[childIndex] = node;
-        nodes[childIndex].left = SIZE_MAX;
-        nodes[childIndex].right = SIZE_MAX;
-        nodes[childIndex].balance = BALANCED;
+
+    nodes[childIndex].right = grandchildNode.left;
+    nodes[childIndex].balance = (grandchildNode.balance == RIGHT_HEAVY) ? LEFT_HEAVY : BALANCED;
+
+    nodes[grandchildIndex] = node;
+    nodes[grandchildIndex].left = grandchildNode.right;
+    nodes[grandchildIndex].balance = (grandchildNode.balance == LEFT_HEAVY) ? RIGHT_HEAVY : BALANCED;
+
+    nodes[index] = grandchildNode;
+    nodes[index].left = childIndex;
+    nodes[index].right = grandchildIndex;
+    nodes[index].balance = BALANCED;
+}
+
+
+void _tsearch_countedset_rotate_right_left(_tsearch_countedset_node *nodes, const size_t index)
+{
+    // 2           7
+    //   8  ==>  2   8
+    // 7
+    _tsearch_countedset_node node = nodes[index];
+    size_t childIndex = node.right;
+    size_t grandchildIndex = nodes[childIndex].left;
+    _tsearch_countedset_node grandchildNode = nodes[grandchildIndex];
+
+    nodes[childIndex].left = grandchildNode.right;
+    nodes[childIndex].balance = (grandchildNode.balance == LEFT_HEAVY) ? RIGHT_HEAVY : BALANCED;
+
+    nodes[grandchildIndex] = node;
+    nodes[grandchildIndex].right = grandchildNode.left;
+    nodes[grandchildIndex].balance = (grandchildNode.balance == RIGHT_HEAVY) ? LEFT_HEAVY : BALANCED;
+
+    nodes[index] = grandchildNode;
+    nodes[index].left = grandchildIndex;
+    nodes[index].right = childIndex;
+    nodes[index].balance = BALANCED;
+}
+
+
+/// Returns true if looking up each of the smaller set's integers in the larger set's tree
+/// (about smallCount * log2(largeCount) steps) is cheaper than merging both sets.
+bool _tsearch_countedset_should_probe(const size_t largeCount, const size_t smallCount)
+{
+    size_t height = _tsearch_countedset_get_balanced_height(largeCount);
+    if (height == 0) { return false; }
+    return (smallCount <= largeCount / height) ? true : false;
+}
+
+
+/// Returns the height of a perfectly balanced tree containing the specified number of nodes.
+size_t _tsearch_countedset_get_balanced_height(size_t count)
+{
+    size_t height = 0;
+    while (count > 0) { height += 1; count /= 2; }
+    return height;
+}
+
+
+result _tsearch_countedset_alloc_sorted_ints(const size_t count, GNEInteger **outIntegers, size_t **outCounts)
+{
+    if (outIntegers == NULL || outCounts == NULL) { return failure; }
+    size_t capacity = (count > 0) ? count : 1;
+    GNEInteger *integers = malloc(capacity * sizeof(GNEInteger));
+    size_t *counts = malloc(capacity * sizeof(size_t));
+    if (integers == NULL || counts == NULL) { free(integers); free(counts); return failure; }
+    *outIntegers = integers;
+    *outCounts = counts;
+    return success;
+}
+
+
+/// Copies the integers whose count > 0 and their counts into two newly-allocated arrays
+/// in ascending order. Both arrays have ptr->count entries and must be freed by the caller.
+result _tsearch_countedset_copy_sorted_ints(const tsearch_countedset_ptr ptr,
+                                            GNEInteger **outIntegers, size_t **outCounts)
+{
+    if (ptr == NULL || ptr->nodes == NULL) { return failure; }
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    if (_tsearch_countedset_alloc_sorted_ints(ptr->count, &integers, &counts) == failure) { return failure; }
+
+    if (ptr->bitmap != NULL) {
+        if (tsearch_bitmap_copy_sorted_ints(ptr->bitmap, integers, counts) == failure) {
+            free(integers);
+            free(counts);
+            return failure;
+        }
+        *outIntegers = integers;
+        *outCounts = counts;
+        return success;
+    }
+
+    // Walk the tree in order without recursing.
+    _tsearch_countedset_node *nodes = ptr->nodes;
+    size_t stack[MAX_TREE_HEIGHT];
+    size_t stackCount = 0;
+    size_t index = (ptr->insertIndex > 0) ? 0 : SIZE_MAX;
+    size_t integersCount = 0;
+    while (index != SIZE_MAX || stackCount > 0) {
+        while (index != SIZE_MAX) {
+            if (stackCount == MAX_TREE_HEIGHT) { free(integers); free(counts); return failure; }
+            stack[stackCount] = index;
+            stackCount += 1;
+            index = nodes[index].left;
+        }
+        stackCount -= 1;
+        index = stack[stackCount];
+        if (nodes[index].count > 0 && integersCount < ptr->count) {
+            integers[integersCount] = nodes[index].integer;
+            counts[integersCount] = nodes[index].count;
+            integersCount += 1;
+        }
+        index = nodes[index].right;
+    }
+
+    *outIntegers = integers;
+    *outCounts = counts;
+    return success;
+}
+
+
+/// Keeps the integers that are also present in the specified counted set, adding the set's counts
+/// to theirs. The kept integers are compacted to the front of the arrays. Returns the number of
+/// integers kept.
+size_t _tsearch_countedset_intersect_probing(const tsearch_countedset_ptr ptr, GNEInteger *integers,
+                                             size_t *counts, const size_t count)
+{
+    size_t intersectionCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t otherCount = tsearch_countedset_get_count_for_int(ptr, integers[i]);
+        if (otherCount == 0) { continue; }
+        size_t newCount = counts[i];
+        newCount = ((SIZE_MAX - newCount) >= otherCount) ? (newCount + otherCount) : SIZE_MAX;
+        integers[intersectionCount] = integers[i];
+        counts[intersectionCount] = newCount;
+        intersectionCount += 1;
+    }
+    return intersectionCount;
+}
+
+
+/// Replaces the contents of the counted set with the specified ascending integers. Dense integers
+/// are stored in a bitmap. Otherwise, the tree is rebuilt perfectly balanced and without any nodes
+/// whose count is zero.
+result _tsearch_countedset_replace_with_sorted_ints(const tsearch_countedset_ptr ptr, const GNEInteger *integers,
+                                                    const size_t *counts, const size_t count)
+{
+    if (ptr == NULL || ptr->nodes == NULL) { return failure; }
+    if (count > 0 && (integers == NULL || counts == NULL)) { return failure; }
+
+    if (count >= BITMAP_MIN_COUNT && _tsearch_countedset_is_dense(integers, count) == true) {
+        return _tsearch_countedset_replace_with_bitmap(ptr, integers, counts, count);
+    }
+
+    if (ptr->bitmap != NULL) {
+        tsearch_bitmap_free(ptr->bitmap);
+        ptr->bitmap = NULL;
+        ptr->nextDensityCheck = BITMAP_MIN_COUNT;
+    }
+
+    // Grow the buffer the same way inserting the integers one at a time would have.
+    size_t size = sizeof(_tsearch_countedset_node);
+    size_t capacity = ptr->nodesCapacity / size;
+    size_t newCapacity = (capacity > 0) ? capacity : 5;
+    while (newCapacity < count + 2) {
+        if (newCapacity > (SIZE_MAX / size) / 2) { return failure; }
+        newCapacity *= 2;
+    }
+    if (newCapacity != capacity) {
+        _tsearch_countedset_node *newNodes = realloc(ptr->nodes, newCapacity * size);
+        if (newNodes == NULL) { return failure; }
+        ptr->nodes = newNodes;
+        ptr->nodesCapacity = newCapacity * size;
+    }
+
+    size_t nextIndex = 0;
+    _tsearch_countedset_build_balanced_nodes(ptr->nodes, integers, counts, 0, count, &nextIndex);
+    if (ptr->ignoresCounts == true) {
+        for (size_t i = 0; i < count; i++) { ptr->nodes[i].count = 1; }
+    }
+    ptr->count = count;
+    ptr->insertIndex = count;
+    while (ptr->nextDensityCheck <= count && ptr->nextDensityCheck <= SIZE_MAX / 2) {
+        ptr->nextDensityCheck *= 2;
+    }
+    return success;
+}
+
+
+/// Writes the integers in [start, end) into the nodes as a perfectly balanced tree. The nodes are
+/// written in pre-order, so the root is always at the first index. Returns the root's index.
+size_t _tsearch_countedset_build_balanced_nodes(_tsearch_countedset_node *nodes, const GNEInteger *integers,
+                                                const size_t *counts, const size_t start, const size_t end,
+                                                size_t *nextIndex)
+{
+    if (start >= end) { return SIZE_MAX; }
+
+    size_t middle = start + ((end - start) / 2);
+    size_t index = *nextIndex;
+    *nextIndex += 1;
+
+    _tsearch_countedset_node *nodePtr = &(nodes[index]);
+    nodePtr->integer = integers[middle];
+    nodePtr->count = counts[middle];
+    nodePtr->left = _tsearch_countedset_build_balanced_nodes(nodes, integers, counts, start, middle, nextIndex);
+    nodePtr->right = _tsearch_countedset_build_balanced_nodes(nodes, integers, counts, middle + 1, end, nextIndex);
+
+    size_t leftHeight = _tsearch_countedset_get_balanced_height(middle - start);
+    size_t rightHeight = _tsearch_countedset_get_balanced_height(end - middle - 1);
+    nodePtr->balance = (leftHeight > rightHeight) ? LEFT_HEAVY : BALANCED;
+    return index;
+}
+
+
+/// Returns true if the ascending integers fill enough of the 65,536-integer chunks they touch
+/// to be stored more compactly in a bitmap than in a tree.
+bool _tsearch_countedset_is_dense(const GNEInteger *integers, const size_t count)
+{
+    if (integers == NULL || count == 0) { return false; }
+    size_t chunksCount = 1;
+    for (size_t i = 1; i < count; i++) {
+        if ((((uint64_t)integers[i - 1] ^ (uint64_t)integers[i]) >> 16) != 0) { chunksCount += 1; }
+    }
+    return (chunksCount <= count / BITMAP_MIN_INTEGERS_PER_CHUNK) ? true : false;
+}
+
+
+/// Moves the counted set's integers from its tree into a bitmap if they are dense. Otherwise,
+/// the next check is postponed until the counted set's count has doubled. Returns failure if
+/// the integers weren't moved.
+result _tsearch_countedset_convert_to_bitmap_if_dense(const tsearch_countedset_ptr ptr)
+{
+    if (ptr == NULL || ptr->nodes == NULL || ptr->bitmap != NULL) { return failure; }
+
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    if (_tsearch_countedset_copy_sorted_ints(ptr, &integers, &counts) == failure) { return failure; }
+
+    int result = failure;
+    size_t count = ptr->count;
+    if (_tsearch_countedset_is_dense(integers, count) == true) {
+        result = _tsearch_countedset_replace_with_bitmap(ptr, integers, counts, count);
+    }
+    if (result == failure) {
+        while (ptr->nextDensityCheck <= count && ptr->nextDensityCheck <= SIZE_MAX / 2) {
+            ptr->nextDensityCheck *= 2;
+        }
+    }
+    free(integers);
+    free(counts);
+    return result;
+}
+
+
+/// Moves the specified ascending integers into a new bitmap and releases the tree's nodes,
+/// keeping only as many as a new counted set has.
+result _tsearch_countedset_replace_with_bitmap(const tsearch_countedset_ptr ptr, const GNEInteger *integers,
+                                               const size_t *counts, const size_t count)
+{
+    if (ptr == NULL || ptr->nodes == NULL) { return failure; }
+    bool keepsCounts = (ptr->ignoresCounts == true) ? false : true;
+    tsearch_bitmap_ptr bitmap = tsearch_bitmap_init_with_sorted_ints(integers, counts, count, keepsCounts);
+    if (bitmap == NULL) { return failure; }
+
+    size_t capacity = 5 * sizeof(_tsearch_countedset_node);
+    if (ptr->nodesCapacity > capacity) {
+        _tsearch_countedset_node *nodes = realloc(ptr->nodes, capacity);
+        if (nodes != NULL) {
+            ptr->nodes = nodes;
+            ptr->nodesCapacity = capacity;
+        }
     }
+    tsearch_bitmap_free(ptr->bitmap);
+    ptr->bitmap = bitmap;
+    ptr->count = count;
+    ptr->insertIndex = 0;
+    return success;
 }
 
 
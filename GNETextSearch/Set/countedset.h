@@ -16,13 +16,37 @@ extern "C" {
 #endif
 
 typedef struct tsearch_countedset * tsearch_countedset_ptr;
+typedef struct tsearch_countedset_iterator * tsearch_countedset_iterator_ptr;
+
+// A counted set stores its integers in a balanced tree. Once it holds enough integers and they are
+// dense enough, it switches to storing them in a compressed bitmap, which uses far less memory and
+// turns unions and intersections with other dense sets into word-wide bitwise operations.
 
 tsearch_countedset_ptr tsearch_countedset_init(void);
+/// Creates a counted set whose integers all have a count of 1, no matter how many times they are
+/// added. Dense sets that ignore counts don't need to store counts at all.
+tsearch_countedset_ptr tsearch_countedset_init_ignoring_counts(void);
+/// Creates a counted set containing the specified integers, which must be unique and in ascending
+/// order, and their counts, which must be greater than zero. Returns NULL if the integers aren't valid.
+tsearch_countedset_ptr tsearch_countedset_init_with_sorted_ints(const GNEInteger *integers, const size_t *counts,
+                                                                const size_t count);
 tsearch_countedset_ptr tsearch_countedset_copy(const tsearch_countedset_ptr ptr);
 void tsearch_countedset_free(const tsearch_countedset_ptr ptr);
 
+/// Sets the percentage of removed integers (0–100) the counted set's tree may hold before it is
+/// automatically rebuilt without them. The default is 25. A percentage of 100 turns off automatic
+/// rebuilding.
+result tsearch_countedset_set_max_tombstone_percentage(const tsearch_countedset_ptr ptr, const size_t percentage);
+
+/// Rebuilds the counted set without any removed integers and releases all of the memory it
+/// doesn't need to hold its current integers.
+result tsearch_countedset_shrink_to_fit(const tsearch_countedset_ptr ptr);
+
 size_t tsearch_countedset_get_count(tsearch_countedset_ptr ptr);
 
+/// Returns the number of bytes used by the counted set.
+size_t tsearch_countedset_get_size(const tsearch_countedset_ptr ptr);
+
 /// Returns 1 if the counted set includes the integer, otherwise 0.
 bool tsearch_countedset_contains_int(const tsearch_countedset_ptr ptr, const GNEInteger integer);
 
@@ -34,9 +58,27 @@ size_t tsearch_countedset_get_count_for_int(const tsearch_countedset_ptr ptr, co
 /// pointer points at the array, which must be freed by the caller.
 result tsearch_countedset_copy_ints(const tsearch_countedset_ptr ptr, GNEInteger **outIntegers, size_t *outCount);
 
+/// Creates an array of the maxCount integers with the largest counts in descending order of their
+/// counts. Integers with equal counts are returned in ascending order. Only maxCount integers are
+/// kept while the counted set is scanned, so this is much cheaper than tsearch_countedset_copy_ints()
+/// when only the first few results are needed. The array must be freed by the caller.
+result tsearch_countedset_copy_top_ints(const tsearch_countedset_ptr ptr, const size_t maxCount,
+                                        GNEInteger **outIntegers, size_t *outCount);
+
+/// Creates arrays of all of the integers in the specified counted set and their counts in ascending
+/// order of the integers. On return, outIntegers and outCounts point at the arrays, which must be
+/// freed by the caller.
+result tsearch_countedset_copy_sorted_ints(const tsearch_countedset_ptr ptr, GNEInteger **outIntegers,
+                                           size_t **outCounts, size_t *outCount);
+
 /// Adds the specified integer to the counted set. Returns 1 if successful, otherwise 0.
 result tsearch_countedset_add_int(const tsearch_countedset_ptr ptr, const GNEInteger integer);
 
+/// Adds the specified integer to the counted set count times with a single lookup, which is the
+/// same as adding it count times. Returns 1 if successful, otherwise 0.
+result tsearch_countedset_add_int_with_count(const tsearch_countedset_ptr ptr, const GNEInteger integer,
+                                             const size_t count);
+
 /// Removes the specified integer from the counted set. Returns 1 if successful, otherwise 0.
 /// Success is unrelated to whether or not the integer exists in the counted set.
 result tsearch_countedset_remove_int(const tsearch_countedset_ptr ptr, const GNEInteger integer);
@@ -44,6 +86,22 @@ result tsearch_countedset_remove_int(const tsearch_countedset_ptr ptr, const GNE
 /// Removes all of the integers from the counted set.
 result tsearch_countedset_remove_all_ints(const tsearch_countedset_ptr ptr);
 
+/// Creates an iterator over the integers in the counted set in ascending order, which visits them
+/// one at a time without copying them. The counted set must not be changed while it's iterated.
+tsearch_countedset_iterator_ptr tsearch_countedset_iterator_init(const tsearch_countedset_ptr ptr);
+void tsearch_countedset_iterator_free(const tsearch_countedset_iterator_ptr iteratorPtr);
+
+/// Moves the iterator past the next integer and returns the integer and its count. Returns false
+/// if there aren't any more integers.
+bool tsearch_countedset_iterator_next(const tsearch_countedset_iterator_ptr iteratorPtr,
+                                      GNEInteger *outInteger, size_t *outCount);
+
+/// Moves the iterator past the next integer that is greater than or equal to the target and returns
+/// the integer and its count. The integers in between are skipped without being visited, so
+/// intersecting iterators can leapfrog each other. Returns false if there aren't any more integers.
+bool tsearch_countedset_iterator_advance_to(const tsearch_countedset_iterator_ptr iteratorPtr,
+                                            const GNEInteger target, GNEInteger *outInteger, size_t *outCount);
+
 /// Adds each integer and its count in the other counted set to specified set.
 result tsearch_countedset_union(const tsearch_countedset_ptr ptr, const tsearch_countedset_ptr otherPtr);
 
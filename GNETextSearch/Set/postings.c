@@ -0,0 +1,378 @@
+//
+//  postings.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "postings.h"
+#include "GNETextSearchPrivate.h"
+#include <string.h>
+
+// ------------------------------------------------------------------------------------------
+
+// A 64-bit value never needs more than 10 bytes when encoded as a varint.
+#define MAX_VARINT_LENGTH 10
+
+// The blocks have fixed-width fields so that the skip table can be serialized as is.
+typedef struct _tsearch_postings_block
+{
+    GNEInteger firstInteger;
+    uint64_t offset;
+} _tsearch_postings_block;
+
+
+typedef struct _tsearch_postings_serialized_header
+{
+    uint64_t count;
+    uint64_t blocksCount;
+    uint64_t bytesLength;
+} _tsearch_postings_serialized_header;
+
+
+typedef struct tsearch_postings
+{
+    const uint8_t *bytes;
+    size_t bytesLength;
+    const _tsearch_postings_block *blocks;
+    size_t blocksCount;
+    size_t count;
+    // Serialized postings lists read their bytes and blocks in place, so they aren't freed.
+    bool isSerialized;
+} tsearch_postings;
+
+// ------------------------------------------------------------------------------------------
+
+size_t _tsearch_postings_find_block(const tsearch_postings_ptr ptr, const GNEInteger integer);
+size_t _tsearch_postings_decode_block(const tsearch_postings_ptr ptr, const size_t blockIndex,
+                                      GNEInteger *outIntegers, size_t *outCounts);
+size_t _tsearch_postings_get_varint_length(uint64_t value);
+size_t _tsearch_postings_write_varint(uint8_t *bytes, uint64_t value);
+size_t _tsearch_postings_read_varint(const uint8_t *bytes, const uint8_t *end, uint64_t *outValue);
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Postings
+// ------------------------------------------------------------------------------------------
+tsearch_postings_ptr tsearch_postings_init_with_countedset(const tsearch_countedset_ptr countedSetPtr)
+{
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    size_t count = 0;
+    if (tsearch_countedset_copy_sorted_ints(countedSetPtr, &integers, &counts, &count) == failure) {
+        return NULL;
+    }
+    tsearch_postings_ptr ptr = tsearch_postings_init_with_sorted_ints(integers, counts, count);
+    free(integers);
+    free(counts);
+    return ptr;
+}
+
+
+tsearch_postings_ptr tsearch_postings_init_with_sorted_ints(const GNEInteger *integers, const size_t *counts,
+                                                            const size_t count)
+{
+    if (count > 0 && (integers == NULL || counts == NULL)) { return NULL; }
+
+    // Measure the encoded integers first so that the bytes can be allocated exactly once.
+    size_t bytesLength = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (counts[i] == 0) { return NULL; }
+        if (i % TSEARCH_POSTINGS_BLOCK_LENGTH != 0) {
+            if (integers[i - 1] >= integers[i]) { return NULL; }
+            uint64_t delta = (uint64_t)integers[i] - (uint64_t)integers[i - 1];
+            bytesLength += _tsearch_postings_get_varint_length(delta);
+        } else if (i > 0 && integers[i - 1] >= integers[i]) {
+            return NULL;
+        }
+        bytesLength += _tsearch_postings_get_varint_length((uint64_t)counts[i]);
+    }
+
+    tsearch_postings_ptr ptr = calloc(1, sizeof(tsearch_postings));
+    if (ptr == NULL) { return NULL; }
+
+    size_t blocksCount = (count + TSEARCH_POSTINGS_BLOCK_LENGTH - 1) / TSEARCH_POSTINGS_BLOCK_LENGTH;
+    uint8_t *bytes = malloc((bytesLength > 0) ? bytesLength : 1);
+    _tsearch_postings_block *blocks = calloc((blocksCount > 0) ? blocksCount : 1, sizeof(_tsearch_postings_block));
+    ptr->bytes = bytes;
+    ptr->blocks = blocks;
+    if (bytes == NULL || blocks == NULL) { tsearch_postings_free(ptr); return NULL; }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i % TSEARCH_POSTINGS_BLOCK_LENGTH == 0) {
+            _tsearch_postings_block *blockPtr = &(blocks[i / TSEARCH_POSTINGS_BLOCK_LENGTH]);
+            blockPtr->firstInteger = integers[i];
+            blockPtr->offset = offset;
+        } else {
+            uint64_t delta = (uint64_t)integers[i] - (uint64_t)integers[i - 1];
+            offset += _tsearch_postings_write_varint(&(bytes[offset]), delta);
+        }
+        offset += _tsearch_postings_write_varint(&(bytes[offset]), (uint64_t)counts[i]);
+    }
+
+    ptr->bytesLength = bytesLength;
+    ptr->blocksCount = blocksCount;
+    ptr->count = count;
+    return ptr;
+}
+
+
+tsearch_postings_ptr tsearch_postings_init_with_serialized(const void *bytes, const size_t length)
+{
+    const size_t headerLength = sizeof(_tsearch_postings_serialized_header);
+    if (bytes == NULL || length < headerLength) { return NULL; }
+    if (((uintptr_t)bytes % TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT) != 0) { return NULL; }
+
+    const _tsearch_postings_serialized_header *header = (const _tsearch_postings_serialized_header *)bytes;
+    const uint64_t blocksCount = (header->count + TSEARCH_POSTINGS_BLOCK_LENGTH - 1) / TSEARCH_POSTINGS_BLOCK_LENGTH;
+    if (header->count > SIZE_MAX - TSEARCH_POSTINGS_BLOCK_LENGTH || header->blocksCount != blocksCount) { return NULL; }
+    const size_t available = length - headerLength;
+    if (blocksCount > available / sizeof(_tsearch_postings_block)) { return NULL; }
+    const size_t blocksLength = (size_t)blocksCount * sizeof(_tsearch_postings_block);
+    if (header->bytesLength > available - blocksLength) { return NULL; }
+
+    // The blocks' offsets are checked so that lookups never start reading outside of the bytes.
+    const _tsearch_postings_block *blocks = (const _tsearch_postings_block *)((const uint8_t *)bytes + headerLength);
+    for (size_t i = 0; i < blocksCount; i++) {
+        if (blocks[i].offset > header->bytesLength) { return NULL; }
+    }
+
+    tsearch_postings_ptr ptr = calloc(1, sizeof(tsearch_postings));
+    if (ptr == NULL) { return NULL; }
+    ptr->bytes = (const uint8_t *)bytes + headerLength + blocksLength;
+    ptr->bytesLength = (size_t)header->bytesLength;
+    ptr->blocks = blocks;
+    ptr->blocksCount = (size_t)blocksCount;
+    ptr->count = (size_t)header->count;
+    ptr->isSerialized = true;
+    return ptr;
+}
+
+
+void tsearch_postings_free(const tsearch_postings_ptr ptr)
+{
+    if (ptr != NULL) {
+        if (ptr->isSerialized == false) {
+            free((void *)ptr->bytes);
+            free((void *)ptr->blocks);
+        }
+        ptr->bytes = NULL;
+        ptr->blocks = NULL;
+        ptr->bytesLength = 0;
+        ptr->blocksCount = 0;
+        ptr->count = 0;
+        free(ptr);
+    }
+}
+
+
+size_t tsearch_postings_get_count(const tsearch_postings_ptr ptr)
+{
+    return (ptr == NULL) ? 0 : ptr->count;
+}
+
+
+size_t tsearch_postings_get_size(const tsearch_postings_ptr ptr)
+{
+    if (ptr == NULL) { return 0; }
+    return sizeof(tsearch_postings) + ptr->bytesLength + (ptr->blocksCount * sizeof(_tsearch_postings_block));
+}
+
+
+size_t tsearch_postings_get_serialized_length(const tsearch_postings_ptr ptr)
+{
+    if (ptr == NULL) { return 0; }
+    size_t length = sizeof(_tsearch_postings_serialized_header) +
+                    (ptr->blocksCount * sizeof(_tsearch_postings_block)) + ptr->bytesLength;
+    size_t remainder = length % TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT;
+    return (remainder == 0) ? length : length + (TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT - remainder);
+}
+
+
+result tsearch_postings_serialize(const tsearch_postings_ptr ptr, void *bytes, const size_t length)
+{
+    if (ptr == NULL || bytes == NULL) { return failure; }
+    size_t serializedLength = tsearch_postings_get_serialized_length(ptr);
+    if (length < serializedLength) { return failure; }
+
+    _tsearch_postings_serialized_header header = {ptr->count, ptr->blocksCount, ptr->bytesLength};
+    uint8_t *destination = (uint8_t *)bytes;
+    size_t blocksLength = ptr->blocksCount * sizeof(_tsearch_postings_block);
+    memcpy(destination, &header, sizeof(header));
+    destination += sizeof(header);
+    if (blocksLength > 0) { memcpy(destination, ptr->blocks, blocksLength); }
+    destination += blocksLength;
+    if (ptr->bytesLength > 0) { memcpy(destination, ptr->bytes, ptr->bytesLength); }
+    destination += ptr->bytesLength;
+    memset(destination, 0, serializedLength - (size_t)(destination - (uint8_t *)bytes));
+    return success;
+}
+
+
+bool tsearch_postings_contains_int(const tsearch_postings_ptr ptr, const GNEInteger integer)
+{
+    return (tsearch_postings_get_count_for_int(ptr, integer) > 0) ? true : false;
+}
+
+
+size_t tsearch_postings_get_count_for_int(const tsearch_postings_ptr ptr, const GNEInteger integer)
+{
+    if (ptr == NULL || ptr->count == 0) { return 0; }
+    size_t blockIndex = _tsearch_postings_find_block(ptr, integer);
+    if (blockIndex == SIZE_MAX) { return 0; }
+
+    size_t blockLength = ptr->count - (blockIndex * TSEARCH_POSTINGS_BLOCK_LENGTH);
+    if (blockLength > TSEARCH_POSTINGS_BLOCK_LENGTH) { blockLength = TSEARCH_POSTINGS_BLOCK_LENGTH; }
+
+    const uint8_t *bytes = &(ptr->bytes[ptr->blocks[blockIndex].offset]);
+    const uint8_t *end = &(ptr->bytes[ptr->bytesLength]);
+    GNEInteger currentInteger = ptr->blocks[blockIndex].firstInteger;
+    for (size_t i = 0; i < blockLength; i++) {
+        uint64_t value = 0;
+        if (i > 0) {
+            bytes += _tsearch_postings_read_varint(bytes, end, &value);
+            currentInteger = (GNEInteger)((uint64_t)currentInteger + value);
+            if (currentInteger > integer) { return 0; }
+        }
+        bytes += _tsearch_postings_read_varint(bytes, end, &value);
+        if (currentInteger == integer) { return (size_t)value; }
+    }
+    return 0;
+}
+
+
+result tsearch_postings_copy_sorted_ints(const tsearch_postings_ptr ptr, GNEInteger **outIntegers,
+                                         size_t **outCounts, size_t *outCount)
+{
+    if (ptr == NULL || outIntegers == NULL || outCounts == NULL || outCount == NULL) { return failure; }
+
+    size_t count = ptr->count;
+    size_t capacity = (count > 0) ? count : 1;
+    GNEInteger *integers = malloc(capacity * sizeof(GNEInteger));
+    size_t *counts = malloc(capacity * sizeof(size_t));
+    if (integers == NULL || counts == NULL) {
+        free(integers);
+        free(counts);
+        *outCount = 0;
+        return failure;
+    }
+
+    *outIntegers = integers;
+    *outCounts = counts;
+    *outCount = tsearch_postings_write_sorted_ints(ptr, integers, counts);
+    return success;
+}
+
+
+size_t tsearch_postings_write_sorted_ints(const tsearch_postings_ptr ptr, GNEInteger *integers, size_t *counts)
+{
+    if (ptr == NULL || integers == NULL || counts == NULL) { return 0; }
+
+    size_t integersCount = 0;
+    for (size_t i = 0; i < ptr->blocksCount; i++) {
+        integersCount += _tsearch_postings_decode_block(ptr, i, &(integers[integersCount]),
+                                                        &(counts[integersCount]));
+    }
+    return integersCount;
+}
+
+
+tsearch_countedset_ptr tsearch_postings_copy_countedset(const tsearch_postings_ptr ptr)
+{
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    size_t count = 0;
+    if (tsearch_postings_copy_sorted_ints(ptr, &integers, &counts, &count) == failure) { return NULL; }
+    tsearch_countedset_ptr countedSetPtr = tsearch_countedset_init_with_sorted_ints(integers, counts, count);
+    free(integers);
+    free(counts);
+    return countedSetPtr;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Returns the index of the last block whose first integer is less than or equal to the specified
+/// integer. Returns SIZE_MAX if the integer is smaller than every integer in the postings list.
+size_t _tsearch_postings_find_block(const tsearch_postings_ptr ptr, const GNEInteger integer)
+{
+    if (ptr == NULL || ptr->blocksCount == 0) { return SIZE_MAX; }
+    if (integer < ptr->blocks[0].firstInteger) { return SIZE_MAX; }
+
+    size_t low = 0;
+    size_t high = ptr->blocksCount;
+    while (low + 1 < high) {
+        size_t middle = low + ((high - low) / 2);
+        if (ptr->blocks[middle].firstInteger <= integer) { low = middle; }
+        else { high = middle; }
+    }
+    return low;
+}
+
+
+/// Decodes all of the integers and counts in the specified block. The out arrays must have room
+/// for TSEARCH_POSTINGS_BLOCK_LENGTH integers. Returns the number of integers decoded.
+size_t _tsearch_postings_decode_block(const tsearch_postings_ptr ptr, const size_t blockIndex,
+                                      GNEInteger *outIntegers, size_t *outCounts)
+{
+    if (ptr == NULL || blockIndex >= ptr->blocksCount) { return 0; }
+
+    size_t blockLength = ptr->count - (blockIndex * TSEARCH_POSTINGS_BLOCK_LENGTH);
+    if (blockLength > TSEARCH_POSTINGS_BLOCK_LENGTH) { blockLength = TSEARCH_POSTINGS_BLOCK_LENGTH; }
+
+    const uint8_t *bytes = &(ptr->bytes[ptr->blocks[blockIndex].offset]);
+    const uint8_t *end = &(ptr->bytes[ptr->bytesLength]);
+    GNEInteger currentInteger = ptr->blocks[blockIndex].firstInteger;
+    for (size_t i = 0; i < blockLength; i++) {
+        uint64_t value = 0;
+        if (i > 0) {
+            bytes += _tsearch_postings_read_varint(bytes, end, &value);
+            currentInteger = (GNEInteger)((uint64_t)currentInteger + value);
+        }
+        bytes += _tsearch_postings_read_varint(bytes, end, &value);
+        outIntegers[i] = currentInteger;
+        outCounts[i] = (size_t)value;
+    }
+    return blockLength;
+}
+
+
+size_t _tsearch_postings_get_varint_length(uint64_t value)
+{
+    size_t length = 1;
+    while (value >= 0x80) { value >>= 7; length += 1; }
+    return length;
+}
+
+
+/// Writes the value seven bits at a time, starting with the least significant bits. The high
+/// bit of each byte is set if more bytes follow. Returns the number of bytes written.
+size_t _tsearch_postings_write_varint(uint8_t *bytes, uint64_t value)
+{
+    size_t length = 0;
+    while (value >= 0x80) {
+        bytes[length] = (uint8_t)(value | 0x80);
+        value >>= 7;
+        length += 1;
+    }
+    bytes[length] = (uint8_t)value;
+    return length + 1;
+}
+
+
+/// Reads a varint without reading past the specified end. Returns the number of bytes read.
+size_t _tsearch_postings_read_varint(const uint8_t *bytes, const uint8_t *end, uint64_t *outValue)
+{
+    uint64_t value = 0;
+    size_t length = 0;
+    while (bytes + length < end && length < MAX_VARINT_LENGTH) {
+        uint8_t byte = bytes[length];
+        value |= ((uint64_t)(byte & 0x7F)) << (7 * length);
+        length += 1;
+        if ((byte & 0x80) == 0) { break; }
+    }
+    *outValue = value;
+    return length;
+}
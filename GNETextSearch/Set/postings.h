@@ -0,0 +1,88 @@
+//
+//  postings.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_postings_h
+#define tsearch_postings_h
+
+#include "GNETextSearchPublic.h"
+#include "countedset.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A postings list is a frozen, compressed copy of a counted set. The integers are stored in
+// ascending order in blocks of up to TSEARCH_POSTINGS_BLOCK_LENGTH integers. Inside of a block,
+// each integer is stored as a varint-encoded delta from the previous integer, followed by its
+// varint-encoded count. A skip table holds each block's first integer and byte offset, so
+// lookups only decode a single block.
+//
+// A postings list can be serialized into a pointer-free copy, which can be stored in a file and
+// read in place, for example from memory mapped with mmap(). The copy starts with three uint64_t
+// values, the number of integers, the number of blocks, and the length of the encoded integers,
+// followed by the skip table, whose entries are an int64_t first integer and a uint64_t offset,
+// and the encoded integers. All of its values are in the host's byte order, and its length is
+// padded to a multiple of TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT bytes, so that serialized
+// postings lists can be stored one after another.
+
+#define TSEARCH_POSTINGS_BLOCK_LENGTH 128
+#define TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT 8
+
+typedef struct tsearch_postings * tsearch_postings_ptr;
+
+/// Creates a postings list containing all of the integers in the counted set and their counts.
+tsearch_postings_ptr tsearch_postings_init_with_countedset(const tsearch_countedset_ptr countedSetPtr);
+/// Creates a postings list containing the specified integers, which must be unique and in ascending
+/// order, and their counts, which must be greater than zero.
+tsearch_postings_ptr tsearch_postings_init_with_sorted_ints(const GNEInteger *integers, const size_t *counts,
+                                                            const size_t count);
+/// Creates a postings list that reads the serialized postings list in place instead of copying it.
+/// The bytes must be aligned to TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT bytes and must not be changed
+/// or freed before the postings list is freed. Returns NULL if the serialized postings list's
+/// header or skip table is invalid.
+tsearch_postings_ptr tsearch_postings_init_with_serialized(const void *bytes, const size_t length);
+void tsearch_postings_free(const tsearch_postings_ptr ptr);
+
+/// Returns the number of integers in the postings list.
+size_t tsearch_postings_get_count(const tsearch_postings_ptr ptr);
+
+/// Returns the number of bytes used by the postings list, including its skip table.
+size_t tsearch_postings_get_size(const tsearch_postings_ptr ptr);
+
+/// Returns the number of bytes needed to serialize the postings list.
+size_t tsearch_postings_get_serialized_length(const tsearch_postings_ptr ptr);
+
+/// Serializes the postings list into bytes, which must be at least
+/// tsearch_postings_get_serialized_length() bytes long. The padding is filled with zeros.
+result tsearch_postings_serialize(const tsearch_postings_ptr ptr, void *bytes, const size_t length);
+
+/// Returns true if the postings list includes the integer, otherwise false.
+bool tsearch_postings_contains_int(const tsearch_postings_ptr ptr, const GNEInteger integer);
+
+/// Returns the count for the specified integer. Returns 0 if the integer is not in the postings list.
+size_t tsearch_postings_get_count_for_int(const tsearch_postings_ptr ptr, const GNEInteger integer);
+
+/// Creates arrays of all of the integers in the postings list and their counts in ascending order
+/// of the integers. On return, outIntegers and outCounts point at the arrays, which must be freed
+/// by the caller.
+result tsearch_postings_copy_sorted_ints(const tsearch_postings_ptr ptr, GNEInteger **outIntegers,
+                                         size_t **outCounts, size_t *outCount);
+
+/// Writes all of the integers in the postings list and their counts into the arrays in ascending
+/// order of the integers. The arrays must have room for tsearch_postings_get_count() integers.
+/// Returns the number of integers written.
+size_t tsearch_postings_write_sorted_ints(const tsearch_postings_ptr ptr, GNEInteger *integers, size_t *counts);
+
+/// Creates a mutable counted set containing all of the integers in the postings list and their counts.
+tsearch_countedset_ptr tsearch_postings_copy_countedset(const tsearch_postings_ptr ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_postings_h */
@@ -0,0 +1,431 @@
+//
+//  sortedints.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "sortedints.h"
+#include "GNETextSearchPrivate.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define TSEARCH_SORTEDINTS_X86 1
+    #include <immintrin.h>
+#else
+    #define TSEARCH_SORTEDINTS_X86 0
+#endif
+
+// ------------------------------------------------------------------------------------------
+
+// When one array is at least this many times longer than the other, the kernels walk the
+// shorter array and gallop through the longer one instead of merging element by element.
+#define GALLOP_RATIO 32
+
+#define SIMD_NONE 0
+#define SIMD_SSE41 1
+#define SIMD_AVX2 2
+
+// ------------------------------------------------------------------------------------------
+
+int _tsearch_sortedints_get_simd_level(void);
+size_t _tsearch_sortedints_union_merging(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                         const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                         size_t i, size_t j, size_t k,
+                                         GNEInteger *outIntegers, size_t *outCounts);
+size_t _tsearch_sortedints_intersect_merging(const GNEInteger *integers1, const size_t *counts1,
+                                             const size_t count1,
+                                             const GNEInteger *integers2, const size_t *counts2,
+                                             const size_t count2,
+                                             size_t i, size_t j, size_t k,
+                                             GNEInteger *outIntegers, size_t *outCounts);
+size_t _tsearch_sortedints_intersect_galloping(const GNEInteger *shortIntegers, const size_t *shortCounts,
+                                               const size_t shortCount,
+                                               const GNEInteger *longIntegers, const size_t *longCounts,
+                                               const size_t longCount,
+                                               GNEInteger *outIntegers, size_t *outCounts);
+#if TSEARCH_SORTEDINTS_X86
+size_t _tsearch_sortedints_intersect_sse41(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                           const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                           GNEInteger *outIntegers, size_t *outCounts);
+size_t _tsearch_sortedints_intersect_avx2(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                          const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                          GNEInteger *outIntegers, size_t *outCounts);
+#endif
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Sorted Integers
+// ------------------------------------------------------------------------------------------
+size_t tsearch_sortedints_gallop(const GNEInteger *integers, const size_t count,
+                                 const size_t index, const GNEInteger target)
+{
+    if (integers == NULL || index >= count) { return count; }
+    if (integers[index] >= target) { return index; }
+
+    // Find a range [low, high] that contains the target by doubling the step size...
+    size_t low = index;
+    size_t step = 1;
+    size_t high = index + step;
+    while (high < count && integers[high] < target) {
+        low = high;
+        step *= 2;
+        high = ((count - index) > step) ? (index + step) : count;
+    }
+
+    // ...and then binary search inside of it. integers[low] is always less than the target.
+    while (low + 1 < high) {
+        size_t middle = low + ((high - low) / 2);
+        if (integers[middle] < target) { low = middle; }
+        else { high = middle; }
+    }
+    return high;
+}
+
+
+size_t tsearch_sortedints_union(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                GNEInteger *outIntegers, size_t *outCounts)
+{
+    if (outIntegers == NULL || outCounts == NULL) { return 0; }
+    return _tsearch_sortedints_union_merging(integers1, counts1, count1, integers2, counts2, count2,
+                                             0, 0, 0, outIntegers, outCounts);
+}
+
+
+size_t tsearch_sortedints_intersect(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                    const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                    GNEInteger *outIntegers, size_t *outCounts)
+{
+    if (outIntegers == NULL || outCounts == NULL) { return 0; }
+    if (count1 == 0 || count2 == 0) { return 0; }
+
+    if (count2 / GALLOP_RATIO >= count1) {
+        return _tsearch_sortedints_intersect_galloping(integers1, counts1, count1,
+                                                       integers2, counts2, count2,
+                                                       outIntegers, outCounts);
+    }
+    if (count1 / GALLOP_RATIO >= count2) {
+        return _tsearch_sortedints_intersect_galloping(integers2, counts2, count2,
+                                                       integers1, counts1, count1,
+                                                       outIntegers, outCounts);
+    }
+
+#if TSEARCH_SORTEDINTS_X86
+    int simdLevel = _tsearch_sortedints_get_simd_level();
+    if (simdLevel >= SIMD_AVX2) {
+        return _tsearch_sortedints_intersect_avx2(integers1, counts1, count1, integers2, counts2, count2,
+                                                  outIntegers, outCounts);
+    }
+    if (simdLevel >= SIMD_SSE41) {
+        return _tsearch_sortedints_intersect_sse41(integers1, counts1, count1, integers2, counts2, count2,
+                                                   outIntegers, outCounts);
+    }
+#endif
+    return _tsearch_sortedints_intersect_merging(integers1, counts1, count1, integers2, counts2, count2,
+                                                 0, 0, 0, outIntegers, outCounts);
+}
+
+
+size_t tsearch_sortedints_minus(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                GNEInteger *outIntegers, size_t *outCounts)
+{
+    if (outIntegers == NULL || outCounts == NULL) { return 0; }
+
+    bool shouldGallop = (count2 / GALLOP_RATIO >= count1) ? true : false;
+    size_t j = 0, k = 0;
+    for (size_t i = 0; i < count1; i++) {
+        GNEInteger integer = integers1[i];
+        size_t count = counts1[i];
+        if (shouldGallop == true) { j = tsearch_sortedints_gallop(integers2, count2, j, integer); }
+        else { while (j < count2 && integers2[j] < integer) { j += 1; } }
+
+        if (j < count2 && integers2[j] == integer) {
+            if (counts2[j] >= count) { continue; }
+            count -= counts2[j];
+        }
+        outIntegers[k] = integer;
+        outCounts[k] = count;
+        k += 1;
+    }
+    return k;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Returns the widest instruction set the kernels can use on the current CPU.
+int _tsearch_sortedints_get_simd_level(void)
+{
+#if TSEARCH_SORTEDINTS_X86
+    // Checking the CPU is cheap, but the answer never changes, so it's only done once.
+    // A race here is harmless because every thread computes the same value.
+    static volatile int simdLevel = -1;
+    if (simdLevel < 0) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) { simdLevel = SIMD_AVX2; }
+        else if (__builtin_cpu_supports("sse4.1")) { simdLevel = SIMD_SSE41; }
+        else { simdLevel = SIMD_NONE; }
+    }
+    return simdLevel;
+#else
+    return SIMD_NONE;
+#endif
+}
+
+
+/// Merges the arrays starting at integers1[i] and integers2[j], writing to outIntegers[k].
+size_t _tsearch_sortedints_union_merging(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                         const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                         size_t i, size_t j, size_t k,
+                                         GNEInteger *outIntegers, size_t *outCounts)
+{
+    while (i < count1 && j < count2) {
+        GNEInteger integer1 = integers1[i];
+        GNEInteger integer2 = integers2[j];
+        if (integer1 < integer2) {
+            outIntegers[k] = integer1;
+            outCounts[k] = counts1[i];
+            i += 1;
+        } else if (integer2 < integer1) {
+            outIntegers[k] = integer2;
+            outCounts[k] = counts2[j];
+            j += 1;
+        } else {
+            size_t count = counts1[i];
+            outIntegers[k] = integer1;
+            outCounts[k] = ((SIZE_MAX - count) >= counts2[j]) ? (count + counts2[j]) : SIZE_MAX;
+            i += 1;
+            j += 1;
+        }
+        k += 1;
+    }
+    for (; i < count1; i++, k++) {
+        outIntegers[k] = integers1[i];
+        outCounts[k] = counts1[i];
+    }
+    for (; j < count2; j++, k++) {
+        outIntegers[k] = integers2[j];
+        outCounts[k] = counts2[j];
+    }
+    return k;
+}
+
+
+/// Intersects the arrays starting at integers1[i] and integers2[j], writing to outIntegers[k].
+size_t _tsearch_sortedints_intersect_merging(const GNEInteger *integers1, const size_t *counts1,
+                                             const size_t count1,
+                                             const GNEInteger *integers2, const size_t *counts2,
+                                             const size_t count2,
+                                             size_t i, size_t j, size_t k,
+                                             GNEInteger *outIntegers, size_t *outCounts)
+{
+    while (i < count1 && j < count2) {
+        GNEInteger integer1 = integers1[i];
+        GNEInteger integer2 = integers2[j];
+        if (integer1 < integer2) { i += 1; }
+        else if (integer2 < integer1) { j += 1; }
+        else {
+            size_t count = counts1[i];
+            outIntegers[k] = integer1;
+            outCounts[k] = ((SIZE_MAX - count) >= counts2[j]) ? (count + counts2[j]) : SIZE_MAX;
+            i += 1;
+            j += 1;
+            k += 1;
+        }
+    }
+    return k;
+}
+
+
+/// Walks the short array and gallops through the long one. The output is in ascending order
+/// and is never ahead of the read position in either array, so it may overwrite either input.
+size_t _tsearch_sortedints_intersect_galloping(const GNEInteger *shortIntegers, const size_t *shortCounts,
+                                               const size_t shortCount,
+                                               const GNEInteger *longIntegers, const size_t *longCounts,
+                                               const size_t longCount,
+                                               GNEInteger *outIntegers, size_t *outCounts)
+{
+    size_t j = 0, k = 0;
+    for (size_t i = 0; i < shortCount && j < longCount; i++) {
+        GNEInteger integer = shortIntegers[i];
+        j = tsearch_sortedints_gallop(longIntegers, longCount, j, integer);
+        if (j < longCount && longIntegers[j] == integer) {
+            size_t count = shortCounts[i];
+            outIntegers[k] = integer;
+            outCounts[k] = ((SIZE_MAX - count) >= longCounts[j]) ? (count + longCounts[j]) : SIZE_MAX;
+            j += 1;
+            k += 1;
+        }
+    }
+    return k;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - SIMD
+// ------------------------------------------------------------------------------------------
+#if TSEARCH_SORTEDINTS_X86
+
+// The vector kernels compare a block of integers from each array against every rotation of
+// the other block. Because both arrays are sorted and unique, the nth match in the first block
+// pairs with the nth match in the second block, which lets the matching counts be found from
+// the two bit masks. After each comparison, the block with the smaller last integer is skipped.
+//
+// So that the output may alias the first array, the block from the first array is kept in a
+// register and its matches are buffered until the kernel moves past it. By then, every match
+// can be written without overwriting an integer that hasn't been read yet.
+
+TSEARCH_INLINE size_t _tsearch_sortedints_buffer_matches(const GNEInteger *integers1, const size_t *counts1,
+                                                         const size_t *counts2, const size_t i, const size_t j,
+                                                         unsigned int mask1, unsigned int mask2, size_t k,
+                                                         GNEInteger *outIntegers, size_t *outCounts)
+{
+    while (mask1 != 0 && mask2 != 0) {
+        size_t index1 = i + (size_t)__builtin_ctz(mask1);
+        size_t index2 = j + (size_t)__builtin_ctz(mask2);
+        size_t count = counts1[index1];
+        outIntegers[k] = integers1[index1];
+        outCounts[k] = ((SIZE_MAX - count) >= counts2[index2]) ? (count + counts2[index2]) : SIZE_MAX;
+        k += 1;
+        mask1 &= (mask1 - 1);
+        mask2 &= (mask2 - 1);
+    }
+    return k;
+}
+
+
+TSEARCH_INLINE size_t _tsearch_sortedints_flush_matches(const GNEInteger *bufferedIntegers,
+                                                        const size_t *bufferedCounts, const size_t bufferedCount,
+                                                        size_t k, GNEInteger *outIntegers, size_t *outCounts)
+{
+    for (size_t i = 0; i < bufferedCount; i++, k++) {
+        outIntegers[k] = bufferedIntegers[i];
+        outCounts[k] = bufferedCounts[i];
+    }
+    return k;
+}
+
+
+__attribute__((target("sse4.1")))
+size_t _tsearch_sortedints_intersect_sse41(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                           const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                           GNEInteger *outIntegers, size_t *outCounts)
+{
+    size_t i = 0, j = 0, k = 0;
+    if (count1 < 2 || count2 < 2) {
+        return _tsearch_sortedints_intersect_merging(integers1, counts1, count1, integers2, counts2, count2,
+                                                     i, j, k, outIntegers, outCounts);
+    }
+
+    GNEInteger bufferedIntegers[2];
+    size_t bufferedCounts[2];
+    size_t bufferedCount = 0;
+
+    __m128i block1 = _mm_loadu_si128((const __m128i *)(const void *)integers1);
+    __m128i swapped1 = _mm_shuffle_epi32(block1, 0x4E);
+    GNEInteger last1 = integers1[1];
+    GNEInteger last2 = integers2[1];
+    while (true) {
+        last2 = integers2[j + 1];
+        __m128i block2 = _mm_loadu_si128((const __m128i *)(const void *)&(integers2[j]));
+        __m128i swapped2 = _mm_shuffle_epi32(block2, 0x4E);
+        __m128i matches1 = _mm_or_si128(_mm_cmpeq_epi64(block1, block2), _mm_cmpeq_epi64(block1, swapped2));
+        unsigned int mask1 = (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(matches1));
+        if (mask1 != 0) {
+            __m128i matches2 = _mm_or_si128(_mm_cmpeq_epi64(block2, block1), _mm_cmpeq_epi64(block2, swapped1));
+            unsigned int mask2 = (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(matches2));
+            bufferedCount = _tsearch_sortedints_buffer_matches(integers1, counts1, counts2, i, j, mask1, mask2,
+                                                               bufferedCount, bufferedIntegers, bufferedCounts);
+        }
+
+        bool shouldAdvance1 = (last1 <= last2) ? true : false;
+        if (last2 <= last1) { j += 2; }
+        if (shouldAdvance1 == true) {
+            i += 2;
+            k = _tsearch_sortedints_flush_matches(bufferedIntegers, bufferedCounts, bufferedCount,
+                                                  k, outIntegers, outCounts);
+            bufferedCount = 0;
+            if (i + 2 > count1) { break; }
+            block1 = _mm_loadu_si128((const __m128i *)(const void *)&(integers1[i]));
+            swapped1 = _mm_shuffle_epi32(block1, 0x4E);
+            last1 = integers1[i + 1];
+        }
+        if (j + 2 > count2) { break; }
+    }
+
+    // The rest of the current block can only match integers greater than last2.
+    if (bufferedCount > 0) {
+        while (i < count1 && integers1[i] <= last2) { i += 1; }
+        k = _tsearch_sortedints_flush_matches(bufferedIntegers, bufferedCounts, bufferedCount,
+                                              k, outIntegers, outCounts);
+    }
+    return _tsearch_sortedints_intersect_merging(integers1, counts1, count1, integers2, counts2, count2,
+                                                 i, j, k, outIntegers, outCounts);
+}
+
+
+__attribute__((target("avx2")))
+size_t _tsearch_sortedints_intersect_avx2(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                          const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                          GNEInteger *outIntegers, size_t *outCounts)
+{
+    size_t i = 0, j = 0, k = 0;
+    if (count1 < 4 || count2 < 4) {
+        return _tsearch_sortedints_intersect_merging(integers1, counts1, count1, integers2, counts2, count2,
+                                                     i, j, k, outIntegers, outCounts);
+    }
+
+    GNEInteger bufferedIntegers[4];
+    size_t bufferedCounts[4];
+    size_t bufferedCount = 0;
+
+    __m256i block1 = _mm256_loadu_si256((const __m256i *)(const void *)integers1);
+    GNEInteger last1 = integers1[3];
+    GNEInteger last2 = integers2[3];
+    while (true) {
+        last2 = integers2[j + 3];
+        __m256i block2 = _mm256_loadu_si256((const __m256i *)(const void *)&(integers2[j]));
+        __m256i matches1 = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi64(block1, block2),
+                            _mm256_cmpeq_epi64(block1, _mm256_permute4x64_epi64(block2, 0x39))),
+            _mm256_or_si256(_mm256_cmpeq_epi64(block1, _mm256_permute4x64_epi64(block2, 0x4E)),
+                            _mm256_cmpeq_epi64(block1, _mm256_permute4x64_epi64(block2, 0x93))));
+        unsigned int mask1 = (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(matches1));
+        if (mask1 != 0) {
+            __m256i matches2 = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi64(block2, block1),
+                                _mm256_cmpeq_epi64(block2, _mm256_permute4x64_epi64(block1, 0x39))),
+                _mm256_or_si256(_mm256_cmpeq_epi64(block2, _mm256_permute4x64_epi64(block1, 0x4E)),
+                                _mm256_cmpeq_epi64(block2, _mm256_permute4x64_epi64(block1, 0x93))));
+            unsigned int mask2 = (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(matches2));
+            bufferedCount = _tsearch_sortedints_buffer_matches(integers1, counts1, counts2, i, j, mask1, mask2,
+                                                               bufferedCount, bufferedIntegers, bufferedCounts);
+        }
+
+        bool shouldAdvance1 = (last1 <= last2) ? true : false;
+        if (last2 <= last1) { j += 4; }
+        if (shouldAdvance1 == true) {
+            i += 4;
+            k = _tsearch_sortedints_flush_matches(bufferedIntegers, bufferedCounts, bufferedCount,
+                                                  k, outIntegers, outCounts);
+            bufferedCount = 0;
+            if (i + 4 > count1) { break; }
+            block1 = _mm256_loadu_si256((const __m256i *)(const void *)&(integers1[i]));
+            last1 = integers1[i + 3];
+        }
+        if (j + 4 > count2) { break; }
+    }
+
+    // The rest of the current block can only match integers greater than last2.
+    if (bufferedCount > 0) {
+        while (i < count1 && integers1[i] <= last2) { i += 1; }
+        k = _tsearch_sortedints_flush_matches(bufferedIntegers, bufferedCounts, bufferedCount,
+                                              k, outIntegers, outCounts);
+    }
+    return _tsearch_sortedints_intersect_merging(integers1, counts1, count1, integers2, counts2, count2,
+                                                 i, j, k, outIntegers, outCounts);
+}
+
+#endif
@@ -0,0 +1,53 @@
+//
+//  sortedints.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_sortedints_h
+#define tsearch_sortedints_h
+
+#include "GNETextSearchPublic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Set algebra kernels for ascending arrays of unique integers. Each integer has a matching
+// entry in a parallel counts array. All of the kernels run in O(count1 + count2) time. Unions
+// are a linear merge, while intersections and differences switch to galloping (exponential)
+// search when one array is much shorter than the other.
+// On x86, intersections use SSE4.1 or AVX2 when the CPU supports them.
+
+/// Returns the index of the first integer in integers[index..<count] that is greater than or
+/// equal to the target. Returns count if there isn't one.
+size_t tsearch_sortedints_gallop(const GNEInteger *integers, const size_t count,
+                                 const size_t index, const GNEInteger target);
+
+/// Writes every integer present in either array into outIntegers. The counts of integers present
+/// in both arrays are added together. The out arrays must have room for count1 + count2 integers
+/// and must not overlap the input arrays. Returns the number of integers written.
+size_t tsearch_sortedints_union(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                GNEInteger *outIntegers, size_t *outCounts);
+
+/// Writes every integer present in both arrays into outIntegers, adding their counts together.
+/// The out arrays may be the same as integers1 and counts1. Returns the number of integers written.
+size_t tsearch_sortedints_intersect(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                    const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                    GNEInteger *outIntegers, size_t *outCounts);
+
+/// Subtracts the counts in the second array from the counts in the first array and writes each
+/// integer whose count is still greater than zero into outIntegers. The out arrays may be the
+/// same as integers1 and counts1. Returns the number of integers written.
+size_t tsearch_sortedints_minus(const GNEInteger *integers1, const size_t *counts1, const size_t count1,
+                                const GNEInteger *integers2, const size_t *counts2, const size_t count2,
+                                GNEInteger *outIntegers, size_t *outCounts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_sortedints_h */
@@ -0,0 +1,201 @@
+//
+//  forwardindex.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "forwardindex.h"
+#include "GNETextSearchPrivate.h"
+
+// ------------------------------------------------------------------------------------------
+
+#define DOCUMENTS_INITIAL_CAPACITY 16
+#define DOCUMENTS_MAX_LOAD_PERCENTAGE 75
+#define TERMS_INITIAL_CAPACITY 4
+
+typedef struct _tsearch_forwardindex_document
+{
+    GNEInteger documentID;
+    uint32_t *terms; // NULL if the slot is empty.
+    uint32_t termsCount;
+    uint32_t termsCapacity;
+} _tsearch_forwardindex_document;
+
+
+typedef struct tsearch_forwardindex
+{
+    _tsearch_forwardindex_document *documents;
+    size_t count;
+    size_t capacity;
+} tsearch_forwardindex;
+
+// ------------------------------------------------------------------------------------------
+
+size_t _tsearch_forwardindex_find_slot(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID);
+result _tsearch_forwardindex_grow(const tsearch_forwardindex_ptr ptr);
+result _tsearch_forwardindex_document_add_term(_tsearch_forwardindex_document *documentPtr, const uint32_t term);
+
+
+TSEARCH_INLINE bool _tsearch_forwardindex_is_empty(const void *slot)
+{
+    return ((const _tsearch_forwardindex_document *)slot)->terms == NULL;
+}
+
+
+TSEARCH_INLINE size_t _tsearch_forwardindex_hash(const void *slot)
+{
+    return _tsearch_hash_uint64((uint64_t)((const _tsearch_forwardindex_document *)slot)->documentID);
+}
+
+
+TSEARCH_INLINE bool _tsearch_forwardindex_has_key(const void *slot, const void *key)
+{
+    return ((const _tsearch_forwardindex_document *)slot)->documentID == *(const GNEInteger *)key;
+}
+
+
+static const _tsearch_hashtable_type _tsearch_forwardindex_documents_type =
+{
+    sizeof(_tsearch_forwardindex_document),
+    _tsearch_forwardindex_is_empty,
+    _tsearch_forwardindex_hash,
+    _tsearch_forwardindex_has_key,
+};
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Forward Index
+// ------------------------------------------------------------------------------------------
+tsearch_forwardindex_ptr tsearch_forwardindex_init(void)
+{
+    tsearch_forwardindex_ptr ptr = calloc(1, sizeof(tsearch_forwardindex));
+    if (ptr == NULL) { return NULL; }
+
+    _tsearch_forwardindex_document *documents = calloc(DOCUMENTS_INITIAL_CAPACITY,
+                                                       sizeof(_tsearch_forwardindex_document));
+    if (documents == NULL) { free(ptr); return NULL; }
+
+    ptr->documents = documents;
+    ptr->count = 0;
+    ptr->capacity = DOCUMENTS_INITIAL_CAPACITY;
+
+    return ptr;
+}
+
+
+void tsearch_forwardindex_free(const tsearch_forwardindex_ptr ptr)
+{
+    if (ptr != NULL) {
+        for (size_t i = 0; i < ptr->capacity; i++) {
+            free(ptr->documents[i].terms);
+        }
+        free(ptr->documents);
+        ptr->documents = NULL;
+        ptr->count = 0;
+        ptr->capacity = 0;
+        free(ptr);
+    }
+}
+
+
+size_t tsearch_forwardindex_get_count(const tsearch_forwardindex_ptr ptr)
+{
+    return (ptr == NULL) ? 0 : ptr->count;
+}
+
+
+result tsearch_forwardindex_add_term(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID,
+                                     const uint32_t term)
+{
+    if (ptr == NULL) { return failure; }
+
+    size_t slot = _tsearch_forwardindex_find_slot(ptr, documentID);
+    if (ptr->documents[slot].terms == NULL) {
+        if ((ptr->count + 1) * 100 > ptr->capacity * DOCUMENTS_MAX_LOAD_PERCENTAGE) {
+            if (_tsearch_forwardindex_grow(ptr) == failure) { return failure; }
+            slot = _tsearch_forwardindex_find_slot(ptr, documentID);
+        }
+
+        uint32_t *terms = malloc(TERMS_INITIAL_CAPACITY * sizeof(uint32_t));
+        if (terms == NULL) { return failure; }
+
+        ptr->documents[slot] = (_tsearch_forwardindex_document){documentID, terms, 0, TERMS_INITIAL_CAPACITY};
+        ptr->count += 1;
+    }
+
+    return _tsearch_forwardindex_document_add_term(&(ptr->documents[slot]), term);
+}
+
+
+const uint32_t * tsearch_forwardindex_get_terms(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID,
+                                                size_t *outCount)
+{
+    if (outCount != NULL) { *outCount = 0; }
+    if (ptr == NULL || outCount == NULL) { return NULL; }
+
+    _tsearch_forwardindex_document *documentPtr = &(ptr->documents[_tsearch_forwardindex_find_slot(ptr, documentID)]);
+    if (documentPtr->terms == NULL) { return NULL; }
+
+    *outCount = documentPtr->termsCount;
+    return documentPtr->terms;
+}
+
+
+result tsearch_forwardindex_remove_document(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID)
+{
+    if (ptr == NULL) { return failure; }
+
+    size_t slot = _tsearch_forwardindex_find_slot(ptr, documentID);
+    if (ptr->documents[slot].terms == NULL) { return success; }
+
+    free(ptr->documents[slot].terms);
+    ptr->count -= 1;
+    _tsearch_hashtable_remove(&_tsearch_forwardindex_documents_type, ptr->documents, ptr->capacity, slot);
+
+    return success;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Returns the slot containing the document or, if the document isn't in the forward index,
+/// the empty slot where it belongs.
+size_t _tsearch_forwardindex_find_slot(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID)
+{
+    return _tsearch_hashtable_find_slot(&_tsearch_forwardindex_documents_type, ptr->documents, ptr->capacity,
+                                        _tsearch_hash_uint64((uint64_t)documentID), &documentID);
+}
+
+
+result _tsearch_forwardindex_grow(const tsearch_forwardindex_ptr ptr)
+{
+    _tsearch_forwardindex_document *documents = _tsearch_hashtable_copy_grown(&_tsearch_forwardindex_documents_type,
+                                                                              ptr->documents, ptr->capacity);
+    if (documents == NULL) { return failure; }
+
+    free(ptr->documents);
+    ptr->documents = documents;
+    ptr->capacity *= 2;
+
+    return success;
+}
+
+
+result _tsearch_forwardindex_document_add_term(_tsearch_forwardindex_document *documentPtr, const uint32_t term)
+{
+    if (documentPtr->termsCount == documentPtr->termsCapacity) {
+        size_t capacity = documentPtr->termsCapacity;
+        size_t size = _tsearch_next_buf_len(&capacity, sizeof(uint32_t));
+        if (capacity == documentPtr->termsCapacity || capacity > UINT32_MAX) { return failure; }
+        uint32_t *terms = realloc(documentPtr->terms, size);
+        if (terms == NULL) { return failure; }
+        documentPtr->terms = terms;
+        documentPtr->termsCapacity = (uint32_t)capacity;
+    }
+
+    documentPtr->terms[documentPtr->termsCount] = term;
+    documentPtr->termsCount += 1;
+    return success;
+}
@@ -0,0 +1,47 @@
+//
+//  forwardindex.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_forwardindex_h
+#define tsearch_forwardindex_h
+
+#include "GNETextSearchPublic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maps document IDs to the terms (the indexes of the words in a ternary tree) they contain, so
+// that a document can be removed without visiting every word in the tree. The documents are
+// kept in an open-addressing hash table and each document's terms in an unsorted array.
+
+typedef struct tsearch_forwardindex * tsearch_forwardindex_ptr;
+
+tsearch_forwardindex_ptr tsearch_forwardindex_init(void);
+void tsearch_forwardindex_free(const tsearch_forwardindex_ptr ptr);
+
+/// Returns the number of documents in the forward index.
+size_t tsearch_forwardindex_get_count(const tsearch_forwardindex_ptr ptr);
+
+/// Adds the term to the document's terms. The caller is responsible for only adding each
+/// term to a document once.
+result tsearch_forwardindex_add_term(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID,
+                                     const uint32_t term);
+
+/// Returns the document's terms, which are valid until the forward index is next changed, or NULL
+/// if the document isn't in the forward index.
+const uint32_t * tsearch_forwardindex_get_terms(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID,
+                                                size_t *outCount);
+
+/// Removes the document and its terms. Success is unrelated to whether or not the document exists.
+result tsearch_forwardindex_remove_document(const tsearch_forwardindex_ptr ptr, const GNEInteger documentID);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_forwardindex_h */
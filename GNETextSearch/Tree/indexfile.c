@@ -0,0 +1,820 @@
+//
+//  indexfile.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "indexfile.h"
+#include "postings.h"
+#include "sortedints.h"
+#include "stringbuf.h"
+#include "GNETextSearchPrivate.h"
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    #define TSEARCH_INDEXFILE_MMAP 0
+#else
+    #define TSEARCH_INDEXFILE_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// ------------------------------------------------------------------------------------------
+
+#define INDEXFILE_MAGIC "GNETSIDX"
+#define INDEXFILE_MAGIC_LENGTH 8
+#define INDEXFILE_VERSION 1
+// Reads as a different value on a host with a different byte order.
+#define INDEXFILE_BYTE_ORDER_MARK 0x01020304
+#define INDEXFILE_TEMPORARY_SUFFIX ".tmp"
+
+#define NONE UINT32_MAX
+
+#define LINK_ROOT 0
+#define LINK_LOWER 1
+#define LINK_HIGHER 2
+#define LINK_SAME 3
+
+// Every section starts at an offset that's a multiple of 8 bytes, so its values can be read in
+// place. The header, nodes, and terms are all multiples of 8 bytes long.
+typedef struct _tsearch_indexfile_header
+{
+    char magic[INDEXFILE_MAGIC_LENGTH];
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint64_t fileLength;
+    uint64_t nodesOffset;
+    uint64_t nodesCount;
+    uint64_t termsOffset;
+    uint64_t termsCount;
+    uint64_t postingsOffset;
+    uint64_t postingsLength;
+    uint32_t nodesChecksum;
+    uint32_t termsChecksum;
+    uint32_t postingsChecksum;
+    uint32_t headerChecksum; // The checksum of the header with this set to 0.
+} _tsearch_indexfile_header;
+
+
+// A node's equal child is always the next node, and its lower and higher children always come
+// after it, so searches move forward through the nodes and can't go in circles, even in a
+// damaged file.
+typedef struct _tsearch_indexfile_node
+{
+    uint32_t lower;
+    uint32_t higher;
+    uint32_t term;
+    uint8_t character;
+    uint8_t hasSame;
+    uint8_t reserved[2];
+} _tsearch_indexfile_node;
+
+
+// The offset is from the start of the postings section.
+typedef struct _tsearch_indexfile_term
+{
+    uint64_t offset;
+    uint64_t length;
+} _tsearch_indexfile_term;
+
+
+typedef struct tsearch_indexfile
+{
+    const uint8_t *bytes;
+    size_t length;
+    bool isMapped;
+    const _tsearch_indexfile_header *header;
+    const _tsearch_indexfile_node *nodes;
+    size_t nodesCount;
+    const _tsearch_indexfile_term *terms;
+    size_t termsCount;
+    const uint8_t *postings;
+    size_t postingsLength;
+} tsearch_indexfile;
+
+
+typedef struct _tsearch_indexfile_word
+{
+    size_t offset;
+    const char *characters;
+    tsearch_countedset_ptr documentIDs; // Owned by the tree.
+} _tsearch_indexfile_word;
+
+
+// The words from first to end, which all share their first depth characters, whose node is
+// linked to the parent node.
+typedef struct _tsearch_indexfile_frame
+{
+    size_t first;
+    size_t end;
+    size_t depth;
+    uint32_t parent;
+    uint8_t link;
+} _tsearch_indexfile_frame;
+
+// ------------------------------------------------------------------------------------------
+
+result _tsearch_indexfile_collect_words(const tsearch_ternarytree_ptr treePtr, _tsearch_indexfile_word **outWords,
+                                        size_t *outCount, const char **outCharacters);
+result _tsearch_indexfile_build_nodes(const _tsearch_indexfile_word *words, const size_t count,
+                                      const size_t charactersCount, _tsearch_indexfile_node **outNodes,
+                                      size_t *outCount);
+result _tsearch_indexfile_push_frame(_tsearch_indexfile_frame **frames, size_t *count, size_t *capacity,
+                                     const _tsearch_indexfile_frame frame);
+size_t _tsearch_indexfile_find_character(const _tsearch_indexfile_word *words, size_t first, size_t end,
+                                         const size_t depth, const unsigned int character);
+result _tsearch_indexfile_write_file(const char *path, const _tsearch_indexfile_word *words, const size_t count,
+                                     const _tsearch_indexfile_node *nodes, const size_t nodesCount);
+result _tsearch_indexfile_write_postings(FILE *file, const _tsearch_indexfile_word *words, const size_t count,
+                                         _tsearch_indexfile_term *terms, _tsearch_indexfile_header *header);
+result _tsearch_indexfile_load(const tsearch_indexfile_ptr ptr, const char *path);
+result _tsearch_indexfile_read_header(const tsearch_indexfile_ptr ptr);
+bool _tsearch_indexfile_is_valid_section(const tsearch_indexfile_ptr ptr, const uint64_t offset,
+                                         const uint64_t count, const size_t itemSize);
+uint32_t _tsearch_indexfile_search(const tsearch_indexfile_ptr ptr, const char *target);
+uint32_t _tsearch_indexfile_find_first_term(const tsearch_indexfile_ptr ptr, uint32_t index);
+uint32_t _tsearch_indexfile_find_last_term(const tsearch_indexfile_ptr ptr, uint32_t index);
+tsearch_postings_ptr _tsearch_indexfile_copy_postings(const tsearch_indexfile_ptr ptr, const uint32_t term);
+tsearch_countedset_ptr _tsearch_indexfile_copy_merged_results(const tsearch_indexfile_ptr ptr,
+                                                              const uint32_t firstTerm, const uint32_t lastTerm);
+uint32_t _tsearch_indexfile_update_checksum(uint32_t checksum, const void *bytes, const size_t length);
+int _tsearch_indexfile_compare_words(const void *word1, const void *word2);
+
+// ------------------------------------------------------------------------------------------
+
+
+// The lookup table of CRC-32 (ISO-HDLC), the checksum used by zip and PNG files.
+static const uint32_t _tsearch_indexfile_checksum_table[256] =
+{
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D,
+};
+
+
+TSEARCH_INLINE uint32_t _tsearch_indexfile_get_next_node(const tsearch_indexfile_ptr ptr, const uint32_t index,
+                                                         const uint32_t next)
+{
+    return (next != NONE && next > index && next < ptr->nodesCount) ? next : NONE;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Index File
+// ------------------------------------------------------------------------------------------
+result tsearch_indexfile_write(const tsearch_ternarytree_ptr treePtr, const char *path)
+{
+    if (treePtr == NULL || path == NULL) { return failure; }
+
+    _tsearch_indexfile_word *words = NULL;
+    size_t count = 0;
+    const char *characters = NULL;
+    _tsearch_indexfile_node *nodes = NULL;
+    size_t nodesCount = 0;
+
+    result ret = _tsearch_indexfile_collect_words(treePtr, &words, &count, &characters);
+    if (ret == success) {
+        // Each word ends with a null character, which doesn't need a node.
+        size_t charactersCount = 0;
+        for (size_t i = 0; i < count; i++) { charactersCount += strlen(words[i].characters); }
+        ret = _tsearch_indexfile_build_nodes(words, count, charactersCount, &nodes, &nodesCount);
+    }
+    if (ret == success) { ret = _tsearch_indexfile_write_file(path, words, count, nodes, nodesCount); }
+
+    free(nodes);
+    free(words);
+    free((void *)characters);
+    return ret;
+}
+
+
+tsearch_indexfile_ptr tsearch_indexfile_open(const char *path)
+{
+    if (path == NULL) { return NULL; }
+
+    tsearch_indexfile_ptr ptr = calloc(1, sizeof(tsearch_indexfile));
+    if (ptr == NULL) { return NULL; }
+
+    if (_tsearch_indexfile_load(ptr, path) == failure || _tsearch_indexfile_read_header(ptr) == failure) {
+        tsearch_indexfile_close(ptr);
+        return NULL;
+    }
+    return ptr;
+}
+
+
+void tsearch_indexfile_close(const tsearch_indexfile_ptr ptr)
+{
+    if (ptr != NULL) {
+#if TSEARCH_INDEXFILE_MMAP
+        if (ptr->isMapped == true) { munmap((void *)ptr->bytes, ptr->length); }
+#endif
+        if (ptr->isMapped == false) { free((void *)ptr->bytes); }
+        ptr->bytes = NULL;
+        ptr->length = 0;
+        ptr->header = NULL;
+        ptr->nodes = NULL;
+        ptr->terms = NULL;
+        ptr->postings = NULL;
+        free(ptr);
+    }
+}
+
+
+result tsearch_indexfile_verify(const tsearch_indexfile_ptr ptr)
+{
+    if (ptr == NULL) { return failure; }
+    const _tsearch_indexfile_header *header = ptr->header;
+    if (_tsearch_indexfile_update_checksum(0, ptr->nodes, ptr->nodesCount * sizeof(_tsearch_indexfile_node)) !=
+        header->nodesChecksum)
+    {
+        return failure;
+    }
+    if (_tsearch_indexfile_update_checksum(0, ptr->terms, ptr->termsCount * sizeof(_tsearch_indexfile_term)) !=
+        header->termsChecksum)
+    {
+        return failure;
+    }
+    if (_tsearch_indexfile_update_checksum(0, ptr->postings, ptr->postingsLength) != header->postingsChecksum) {
+        return failure;
+    }
+    return success;
+}
+
+
+size_t tsearch_indexfile_get_count(const tsearch_indexfile_ptr ptr)
+{
+    return (ptr == NULL) ? 0 : ptr->termsCount;
+}
+
+
+tsearch_countedset_ptr tsearch_indexfile_copy_search_results(const tsearch_indexfile_ptr ptr, const char *target)
+{
+    if (ptr == NULL || target == NULL) { return NULL; }
+    uint32_t index = _tsearch_indexfile_search(ptr, target);
+    if (index == NONE) { return NULL; }
+
+    tsearch_postings_ptr postings = _tsearch_indexfile_copy_postings(ptr, ptr->nodes[index].term);
+    tsearch_countedset_ptr resultsPtr = tsearch_postings_copy_countedset(postings);
+    tsearch_postings_free(postings);
+    if (resultsPtr != NULL && tsearch_countedset_get_count(resultsPtr) == 0) {
+        tsearch_countedset_free(resultsPtr);
+        resultsPtr = NULL;
+    }
+    return resultsPtr;
+}
+
+
+tsearch_countedset_ptr tsearch_indexfile_copy_prefix_search_results(const tsearch_indexfile_ptr ptr,
+                                                                    const char *prefix)
+{
+    if (ptr == NULL || prefix == NULL) { return NULL; }
+    uint32_t index = _tsearch_indexfile_search(ptr, prefix);
+    if (index == NONE) { return NULL; }
+
+    // The terms are numbered in the order of the words, so the words beginning with the prefix
+    // are the terms from the prefix's own term, or the first term below it, to the last term below it.
+    const _tsearch_indexfile_node *node = &(ptr->nodes[index]);
+    uint32_t next = (node->hasSame != 0) ? _tsearch_indexfile_get_next_node(ptr, index, index + 1) : NONE;
+    uint32_t firstTerm = (node->term != NONE) ? node->term : _tsearch_indexfile_find_first_term(ptr, next);
+    uint32_t lastTerm = (next != NONE) ? _tsearch_indexfile_find_last_term(ptr, next) : node->term;
+    if (firstTerm == NONE || lastTerm == NONE || firstTerm > lastTerm) { return NULL; }
+
+    return _tsearch_indexfile_copy_merged_results(ptr, firstTerm, lastTerm);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Writing
+// ------------------------------------------------------------------------------------------
+/// Copies the tree's words, which are sorted in the byte order of their characters, and keeps
+/// their document IDs.
+result _tsearch_indexfile_collect_words(const tsearch_ternarytree_ptr treePtr, _tsearch_indexfile_word **outWords,
+                                        size_t *outCount, const char **outCharacters)
+{
+    tsearch_ternarytree_iterator_ptr iteratorPtr = tsearch_ternarytree_iterator_init(treePtr, "");
+    tsearch_stringbuf_ptr charactersPtr = tsearch_stringbuf_init();
+    _tsearch_indexfile_word *words = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+
+    result ret = (iteratorPtr == NULL || charactersPtr == NULL) ? failure : success;
+    const char *word = NULL;
+    size_t length = 0;
+    tsearch_countedset_ptr documentIDs = NULL;
+    while (ret == success && tsearch_ternarytree_iterator_next(iteratorPtr, &word, &length, &documentIDs) == true) {
+        if (count == capacity) {
+            size_t newCapacity = (capacity == 0) ? 64 : capacity;
+            size_t size = (capacity == 0) ? newCapacity * sizeof(_tsearch_indexfile_word) :
+                          _tsearch_next_buf_len(&newCapacity, sizeof(_tsearch_indexfile_word));
+            _tsearch_indexfile_word *newWords = (newCapacity > capacity) ? realloc(words, size) : NULL;
+            if (newWords == NULL) { ret = failure; break; }
+            words = newWords;
+            capacity = newCapacity;
+        }
+        words[count] = (_tsearch_indexfile_word){tsearch_stringbuf_get_len(charactersPtr), NULL, documentIDs};
+        count += 1;
+        ret = tsearch_stringbuf_append_cstring(charactersPtr, word, length);
+        if (ret == success) { ret = tsearch_stringbuf_append_char(charactersPtr, '\0'); }
+    }
+    if (ret == success && count >= NONE) { ret = failure; }
+
+    const char *characters = (ret == success) ? tsearch_stringbuf_copy_cstring(charactersPtr) : NULL;
+    tsearch_ternarytree_iterator_free(iteratorPtr);
+    tsearch_stringbuf_free(charactersPtr);
+    if (characters == NULL) { free(words); return failure; }
+
+    for (size_t i = 0; i < count; i++) { words[i].characters = characters + words[i].offset; }
+    if (count > 1) { qsort(words, count, sizeof(_tsearch_indexfile_word), &_tsearch_indexfile_compare_words); }
+
+    *outWords = words;
+    *outCount = count;
+    *outCharacters = characters;
+    return success;
+}
+
+
+/// Builds a balanced ternary tree of the sorted words in depth-first order. The node for a range
+/// of words is the median word's character, which splits the range into the words before, with,
+/// and after that character, which are the node's lower, equal, and higher children. The term of
+/// the first word with the character is the node's term if that word ends with it.
+result _tsearch_indexfile_build_nodes(const _tsearch_indexfile_word *words, const size_t count,
+                                      const size_t charactersCount, _tsearch_indexfile_node **outNodes,
+                                      size_t *outCount)
+{
+    // A word never needs more nodes than it has characters.
+    if (charactersCount >= NONE) { return failure; }
+    _tsearch_indexfile_node *nodes = malloc(((charactersCount > 0) ? charactersCount : 1) *
+                                            sizeof(_tsearch_indexfile_node));
+    if (nodes == NULL) { return failure; }
+
+    _tsearch_indexfile_frame *frames = NULL;
+    size_t framesCount = 0;
+    size_t framesCapacity = 0;
+    size_t nodesCount = 0;
+    result ret = success;
+    if (count > 0) {
+        ret = _tsearch_indexfile_push_frame(&frames, &framesCount, &framesCapacity,
+                                            (_tsearch_indexfile_frame){0, count, 0, NONE, LINK_ROOT});
+    }
+
+    while (ret == success && framesCount > 0) {
+        framesCount -= 1;
+        const _tsearch_indexfile_frame frame = frames[framesCount];
+        const size_t median = frame.first + ((frame.end - frame.first) / 2);
+        const unsigned int character = (uint8_t)words[median].characters[frame.depth];
+        const size_t equalFirst = _tsearch_indexfile_find_character(words, frame.first, median, frame.depth,
+                                                                    character);
+        const size_t equalEnd = _tsearch_indexfile_find_character(words, median, frame.end, frame.depth,
+                                                                  character + 1);
+
+        if (nodesCount == charactersCount) { ret = failure; break; }
+        const uint32_t index = (uint32_t)nodesCount;
+        nodes[index] = (_tsearch_indexfile_node){NONE, NONE, NONE, (uint8_t)character, 0, {0, 0}};
+        nodesCount += 1;
+        if (frame.link == LINK_LOWER) { nodes[frame.parent].lower = index; }
+        else if (frame.link == LINK_HIGHER) { nodes[frame.parent].higher = index; }
+        else if (frame.link == LINK_SAME) { nodes[frame.parent].hasSame = 1; }
+
+        // Shorter words come first, so only the first word with the character can end with it.
+        size_t sameFirst = equalFirst;
+        if (words[equalFirst].characters[frame.depth + 1] == '\0') {
+            nodes[index].term = (uint32_t)equalFirst;
+            sameFirst += 1;
+        }
+
+        // The equal child is pushed last, so that it's built next and comes right after the node.
+        if (ret == success && equalEnd < frame.end) {
+            ret = _tsearch_indexfile_push_frame(&frames, &framesCount, &framesCapacity,
+                                                (_tsearch_indexfile_frame){equalEnd, frame.end, frame.depth,
+                                                                           index, LINK_HIGHER});
+        }
+        if (ret == success && frame.first < equalFirst) {
+            ret = _tsearch_indexfile_push_frame(&frames, &framesCount, &framesCapacity,
+                                                (_tsearch_indexfile_frame){frame.first, equalFirst, frame.depth,
+                                                                           index, LINK_LOWER});
+        }
+        if (ret == success && sameFirst < equalEnd) {
+            ret = _tsearch_indexfile_push_frame(&frames, &framesCount, &framesCapacity,
+                                                (_tsearch_indexfile_frame){sameFirst, equalEnd, frame.depth + 1,
+                                                                           index, LINK_SAME});
+        }
+    }
+    free(frames);
+
+    if (ret == failure) { free(nodes); return failure; }
+    *outNodes = nodes;
+    *outCount = nodesCount;
+    return success;
+}
+
+
+result _tsearch_indexfile_push_frame(_tsearch_indexfile_frame **frames, size_t *count, size_t *capacity,
+                                     const _tsearch_indexfile_frame frame)
+{
+    if (*count == *capacity) {
+        size_t newCapacity = (*capacity == 0) ? 16 : *capacity;
+        size_t size = (*capacity == 0) ? newCapacity * sizeof(_tsearch_indexfile_frame) :
+                      _tsearch_next_buf_len(&newCapacity, sizeof(_tsearch_indexfile_frame));
+        if (newCapacity == *capacity) { return failure; }
+        _tsearch_indexfile_frame *newFrames = realloc(*frames, size);
+        if (newFrames == NULL) { return failure; }
+        *frames = newFrames;
+        *capacity = newCapacity;
+    }
+    (*frames)[*count] = frame;
+    *count += 1;
+    return success;
+}
+
+
+/// Returns the index of the first word from first to end whose character at depth isn't less
+/// than the character, or end if there isn't one. The words must all be longer than depth.
+size_t _tsearch_indexfile_find_character(const _tsearch_indexfile_word *words, size_t first, size_t end,
+                                         const size_t depth, const unsigned int character)
+{
+    while (first < end) {
+        const size_t middle = first + ((end - first) / 2);
+        if ((uint8_t)words[middle].characters[depth] < character) { first = middle + 1; }
+        else { end = middle; }
+    }
+    return first;
+}
+
+
+/// Writes the file next to the path and moves it to the path once it's complete. The postings
+/// are written first, after the space for the header, nodes, and terms, since the terms hold the
+/// postings' offsets.
+result _tsearch_indexfile_write_file(const char *path, const _tsearch_indexfile_word *words, const size_t count,
+                                     const _tsearch_indexfile_node *nodes, const size_t nodesCount)
+{
+    size_t pathLength = strlen(path);
+    char *temporaryPath = malloc(pathLength + sizeof(INDEXFILE_TEMPORARY_SUFFIX));
+    _tsearch_indexfile_term *terms = calloc((count > 0) ? count : 1, sizeof(_tsearch_indexfile_term));
+    if (temporaryPath == NULL || terms == NULL) { free(temporaryPath); free(terms); return failure; }
+    memcpy(temporaryPath, path, pathLength);
+    memcpy(temporaryPath + pathLength, INDEXFILE_TEMPORARY_SUFFIX, sizeof(INDEXFILE_TEMPORARY_SUFFIX));
+
+    FILE *file = fopen(temporaryPath, "wb");
+    if (file == NULL) { free(temporaryPath); free(terms); return failure; }
+
+    _tsearch_indexfile_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, INDEXFILE_MAGIC, INDEXFILE_MAGIC_LENGTH);
+    header.version = INDEXFILE_VERSION;
+    header.byteOrderMark = INDEXFILE_BYTE_ORDER_MARK;
+    header.nodesOffset = sizeof(_tsearch_indexfile_header);
+    header.nodesCount = nodesCount;
+    header.termsOffset = header.nodesOffset + (nodesCount * sizeof(_tsearch_indexfile_node));
+    header.termsCount = count;
+    header.postingsOffset = header.termsOffset + (count * sizeof(_tsearch_indexfile_term));
+
+    result ret = _tsearch_indexfile_write_postings(file, words, count, terms, &header);
+    if (ret == success) {
+        header.fileLength = header.postingsOffset + header.postingsLength;
+        header.nodesChecksum = _tsearch_indexfile_update_checksum(0, nodes,
+                                                                  nodesCount * sizeof(_tsearch_indexfile_node));
+        header.termsChecksum = _tsearch_indexfile_update_checksum(0, terms, count * sizeof(_tsearch_indexfile_term));
+        header.headerChecksum = _tsearch_indexfile_update_checksum(0, &header, sizeof(header));
+        if (fseek(file, 0, SEEK_SET) != 0 ||
+            fwrite(&header, sizeof(header), 1, file) != 1 ||
+            fwrite(nodes, sizeof(_tsearch_indexfile_node), nodesCount, file) != nodesCount ||
+            fwrite(terms, sizeof(_tsearch_indexfile_term), count, file) != count)
+        {
+            ret = failure;
+        }
+    }
+
+    if (fclose(file) != 0) { ret = failure; }
+    if (ret == success && rename(temporaryPath, path) != 0) { ret = failure; }
+    if (ret == failure) { remove(temporaryPath); }
+    free(temporaryPath);
+    free(terms);
+    return ret;
+}
+
+
+/// Writes the serialized postings of each word, one after another, filling in the terms and the
+/// header's postings length and checksum.
+result _tsearch_indexfile_write_postings(FILE *file, const _tsearch_indexfile_word *words, const size_t count,
+                                         _tsearch_indexfile_term *terms, _tsearch_indexfile_header *header)
+{
+    if (header->postingsOffset > LONG_MAX) { return failure; }
+    if (fseek(file, (long)header->postingsOffset, SEEK_SET) != 0) { return failure; }
+
+    uint8_t *buffer = NULL;
+    size_t bufferLength = 0;
+    uint64_t offset = 0;
+    uint32_t checksum = 0;
+    result ret = success;
+    for (size_t i = 0; i < count && ret == success; i++) {
+        tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(words[i].documentIDs);
+        if (postings == NULL) { ret = failure; break; }
+        size_t length = tsearch_postings_get_serialized_length(postings);
+        if (length > bufferLength) {
+            uint8_t *newBuffer = realloc(buffer, length);
+            if (newBuffer != NULL) {
+                buffer = newBuffer;
+                bufferLength = length;
+            }
+        }
+        ret = (length <= bufferLength) ? tsearch_postings_serialize(postings, buffer, length) : failure;
+        tsearch_postings_free(postings);
+        if (ret == success && fwrite(buffer, 1, length, file) != length) { ret = failure; }
+        if (ret == success) {
+            checksum = _tsearch_indexfile_update_checksum(checksum, buffer, length);
+            terms[i] = (_tsearch_indexfile_term){offset, length};
+            offset += length;
+        }
+    }
+    free(buffer);
+
+    header->postingsLength = offset;
+    header->postingsChecksum = checksum;
+    return ret;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Reading
+// ------------------------------------------------------------------------------------------
+/// Maps the file into memory, or reads it into memory where mmap() isn't available.
+result _tsearch_indexfile_load(const tsearch_indexfile_ptr ptr, const char *path)
+{
+#if TSEARCH_INDEXFILE_MMAP
+    int descriptor = open(path, O_RDONLY);
+    if (descriptor < 0) { return failure; }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size <= 0 || (uint64_t)status.st_size > SIZE_MAX) {
+        close(descriptor);
+        return failure;
+    }
+    // The mapping keeps its own reference to the file, so the descriptor isn't needed anymore.
+    void *bytes = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (bytes == MAP_FAILED) { return failure; }
+    ptr->bytes = bytes;
+    ptr->length = (size_t)status.st_size;
+    ptr->isMapped = true;
+    return success;
+#else
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) { return failure; }
+    long length = (fseek(file, 0, SEEK_END) == 0) ? ftell(file) : -1;
+    uint8_t *bytes = (length > 0 && fseek(file, 0, SEEK_SET) == 0) ? malloc((size_t)length) : NULL;
+    if (bytes == NULL || fread(bytes, 1, (size_t)length, file) != (size_t)length) {
+        free(bytes);
+        fclose(file);
+        return failure;
+    }
+    fclose(file);
+    ptr->bytes = bytes;
+    ptr->length = (size_t)length;
+    ptr->isMapped = false;
+    return success;
+#endif
+}
+
+
+/// Checks the header and that every section is inside of the file.
+result _tsearch_indexfile_read_header(const tsearch_indexfile_ptr ptr)
+{
+    if (ptr->length < sizeof(_tsearch_indexfile_header)) { return failure; }
+    const _tsearch_indexfile_header *header = (const _tsearch_indexfile_header *)ptr->bytes;
+    if (memcmp(header->magic, INDEXFILE_MAGIC, INDEXFILE_MAGIC_LENGTH) != 0) { return failure; }
+    if (header->version != INDEXFILE_VERSION || header->byteOrderMark != INDEXFILE_BYTE_ORDER_MARK) {
+        return failure;
+    }
+
+    _tsearch_indexfile_header copy = *header;
+    copy.headerChecksum = 0;
+    if (_tsearch_indexfile_update_checksum(0, &copy, sizeof(copy)) != header->headerChecksum) { return failure; }
+    if (header->fileLength != ptr->length) { return failure; }
+    if (header->nodesCount >= NONE || header->termsCount >= NONE) { return failure; }
+    if (_tsearch_indexfile_is_valid_section(ptr, header->nodesOffset, header->nodesCount,
+                                            sizeof(_tsearch_indexfile_node)) == false ||
+        _tsearch_indexfile_is_valid_section(ptr, header->termsOffset, header->termsCount,
+                                            sizeof(_tsearch_indexfile_term)) == false ||
+        _tsearch_indexfile_is_valid_section(ptr, header->postingsOffset, header->postingsLength, 1) == false)
+    {
+        return failure;
+    }
+
+    ptr->header = header;
+    ptr->nodes = (const _tsearch_indexfile_node *)(ptr->bytes + header->nodesOffset);
+    ptr->nodesCount = (size_t)header->nodesCount;
+    ptr->terms = (const _tsearch_indexfile_term *)(ptr->bytes + header->termsOffset);
+    ptr->termsCount = (size_t)header->termsCount;
+    ptr->postings = ptr->bytes + header->postingsOffset;
+    ptr->postingsLength = (size_t)header->postingsLength;
+    return success;
+}
+
+
+bool _tsearch_indexfile_is_valid_section(const tsearch_indexfile_ptr ptr, const uint64_t offset,
+                                         const uint64_t count, const size_t itemSize)
+{
+    if (offset % TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT != 0 || offset > ptr->length) { return false; }
+    return (count <= (ptr->length - offset) / itemSize) ? true : false;
+}
+
+
+/// Returns the index of the node for the target's last character if the target is a word in the
+/// index file, otherwise NONE.
+uint32_t _tsearch_indexfile_search(const tsearch_indexfile_ptr ptr, const char *target)
+{
+    if (ptr->nodesCount == 0 || target[0] == '\0') { return NONE; }
+
+    uint32_t index = 0;
+    const char *character = target;
+    while (index != NONE) {
+        const _tsearch_indexfile_node *node = &(ptr->nodes[index]);
+        const uint8_t value = (uint8_t)*character;
+        uint32_t next = NONE;
+        if (value < node->character) { next = node->lower; }
+        else if (value > node->character) { next = node->higher; }
+        else {
+            character += 1;
+            if (*character == '\0') { return (node->term < ptr->termsCount || node->hasSame != 0) ? index : NONE; }
+            if (node->hasSame != 0) { next = index + 1; }
+        }
+        index = _tsearch_indexfile_get_next_node(ptr, index, next);
+    }
+    return NONE;
+}
+
+
+/// Returns the first term below the specified node, which is its lowest word, or NONE if it's
+/// damaged.
+uint32_t _tsearch_indexfile_find_first_term(const tsearch_indexfile_ptr ptr, uint32_t index)
+{
+    while (index != NONE) {
+        const _tsearch_indexfile_node *node = &(ptr->nodes[index]);
+        uint32_t next = NONE;
+        if (node->lower != NONE) { next = node->lower; }
+        else if (node->term != NONE) { return (node->term < ptr->termsCount) ? node->term : NONE; }
+        else if (node->hasSame != 0) { next = index + 1; }
+        index = _tsearch_indexfile_get_next_node(ptr, index, next);
+    }
+    return NONE;
+}
+
+
+/// Returns the last term below the specified node, which is its highest word, or NONE if it's
+/// damaged.
+uint32_t _tsearch_indexfile_find_last_term(const tsearch_indexfile_ptr ptr, uint32_t index)
+{
+    while (index != NONE) {
+        const _tsearch_indexfile_node *node = &(ptr->nodes[index]);
+        uint32_t next = NONE;
+        if (node->higher != NONE) { next = node->higher; }
+        else if (node->hasSame != 0) { next = index + 1; }
+        else { return (node->term < ptr->termsCount) ? node->term : NONE; }
+        index = _tsearch_indexfile_get_next_node(ptr, index, next);
+    }
+    return NONE;
+}
+
+
+/// Returns a postings list that reads the term's serialized postings in place.
+tsearch_postings_ptr _tsearch_indexfile_copy_postings(const tsearch_indexfile_ptr ptr, const uint32_t term)
+{
+    if (term >= ptr->termsCount) { return NULL; }
+    const _tsearch_indexfile_term *termPtr = &(ptr->terms[term]);
+    if (termPtr->offset > ptr->postingsLength || termPtr->length > ptr->postingsLength - termPtr->offset) {
+        return NULL;
+    }
+    return tsearch_postings_init_with_serialized(ptr->postings + termPtr->offset, (size_t)termPtr->length);
+}
+
+
+/// Returns a tsearch_countedset_ptr with the document IDs of the terms from the first to the last
+/// term, or NULL if there aren't any. Each term's document IDs are already sorted, so instead of
+/// being added to the results one at a time, they're decoded into one array as sorted runs, which
+/// are merged in pairs, like a merge sort does, until only one run is left.
+tsearch_countedset_ptr _tsearch_indexfile_copy_merged_results(const tsearch_indexfile_ptr ptr,
+                                                              const uint32_t firstTerm, const uint32_t lastTerm)
+{
+    size_t termsCount = (size_t)(lastTerm - firstTerm) + 1;
+    tsearch_postings_ptr *postings = calloc(termsCount, sizeof(tsearch_postings_ptr));
+    size_t *runStarts = malloc((termsCount + 1) * sizeof(size_t));
+    GNEInteger *integers[2] = {NULL, NULL};
+    size_t *counts[2] = {NULL, NULL};
+    tsearch_countedset_ptr resultsPtr = NULL;
+    if (postings == NULL || runStarts == NULL) { goto done; }
+
+    size_t count = 0;
+    for (size_t i = 0; i < termsCount; i++) {
+        postings[i] = _tsearch_indexfile_copy_postings(ptr, firstTerm + (uint32_t)i);
+        if (postings[i] == NULL) { goto done; }
+        count += tsearch_postings_get_count(postings[i]);
+    }
+    if (count == 0 || count > SIZE_MAX / sizeof(GNEInteger) || count > SIZE_MAX / sizeof(size_t)) { goto done; }
+
+    for (size_t i = 0; i < 2; i++) {
+        integers[i] = malloc(count * sizeof(GNEInteger));
+        counts[i] = malloc(count * sizeof(size_t));
+        if (integers[i] == NULL || counts[i] == NULL) { goto done; }
+    }
+
+    size_t runsCount = termsCount;
+    runStarts[0] = 0;
+    for (size_t i = 0; i < runsCount; i++) {
+        runStarts[i + 1] = runStarts[i] + tsearch_postings_write_sorted_ints(postings[i], integers[0] + runStarts[i],
+                                                                             counts[0] + runStarts[i]);
+    }
+
+    // Each pass merges the pairs of runs in one pair of arrays into the other, where the runs
+    // start over from the beginning, so the starts of the merged runs replace the old ones.
+    size_t source = 0;
+    while (runsCount > 1) {
+        size_t destination = 1 - source;
+        size_t length = 0;
+        for (size_t i = 0; i < runsCount; i += 2) {
+            size_t start = runStarts[i];
+            size_t middle = runStarts[i + 1];
+            size_t end = (i + 2 <= runsCount) ? runStarts[i + 2] : middle;
+            runStarts[i / 2] = length;
+            length += tsearch_sortedints_union(integers[source] + start, counts[source] + start, middle - start,
+                                               integers[source] + middle, counts[source] + middle, end - middle,
+                                               integers[destination] + length, counts[destination] + length);
+        }
+        runsCount = (runsCount + 1) / 2;
+        runStarts[runsCount] = length;
+        source = destination;
+    }
+
+    resultsPtr = tsearch_countedset_init_with_sorted_ints(integers[source], counts[source], runStarts[1]);
+
+done:
+    for (size_t i = 0; postings != NULL && i < termsCount; i++) {
+        tsearch_postings_free(postings[i]);
+    }
+    free(postings);
+    free(runStarts);
+    for (size_t i = 0; i < 2; i++) {
+        free(integers[i]);
+        free(counts[i]);
+    }
+    return resultsPtr;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Continues the CRC-32 checksum of the previous bytes with the specified bytes. The checksum of
+/// no bytes is 0.
+uint32_t _tsearch_indexfile_update_checksum(uint32_t checksum, const void *bytes, const size_t length)
+{
+    const uint8_t *values = (const uint8_t *)bytes;
+    checksum = ~checksum;
+    for (size_t i = 0; i < length; i++) {
+        checksum = _tsearch_indexfile_checksum_table[(checksum ^ values[i]) & 0xFF] ^ (checksum >> 8);
+    }
+    return ~checksum;
+}
+
+
+/// Orders words by the byte values of their characters, which doesn't depend on whether or not
+/// char is signed, so that a file reads the same on every host.
+int _tsearch_indexfile_compare_words(const void *word1, const void *word2)
+{
+    return strcmp(((const _tsearch_indexfile_word *)word1)->characters,
+                  ((const _tsearch_indexfile_word *)word2)->characters);
+}
@@ -0,0 +1,66 @@
+//
+//  indexfile.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_indexfile_h
+#define tsearch_indexfile_h
+
+#include "GNETextSearchPublic.h"
+#include "countedset.h"
+#include "ternarytree.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// An index file is a pointer-free copy of a tree's words and their document IDs, which is searched
+// in place from memory mapped with mmap(), so opening one only reads its header, and processes that
+// open the same file share its pages. A file starts with a versioned header, which has the offsets
+// of three sections and a checksum of each of them:
+//
+// 1. The nodes of a balanced ternary tree of the words, in depth-first order, with each node's
+//    equal child right after it and its lower and higher children as indexes of later nodes.
+// 2. The terms, one for each word in the byte order of the words, which hold the offsets and
+//    lengths of the words' postings.
+// 3. The serialized postings lists (see postings.h) of the words' document IDs and their counts.
+//
+// All of the values are in the byte order of the host that wrote the file, and opening a file
+// written by a host with a different byte order fails.
+
+typedef struct tsearch_indexfile * tsearch_indexfile_ptr;
+
+/// Writes the words in the tree and their document IDs to an index file at the path. The file is
+/// written next to the path first and then moved into place, so index files opened at the path
+/// aren't changed and the file is never partially written.
+result tsearch_indexfile_write(const tsearch_ternarytree_ptr treePtr, const char *path);
+
+/// Opens the index file at the path. Returns NULL if the file can't be read, isn't an index file,
+/// has a version or byte order that can't be read, or has a damaged header. The sections' checksums
+/// aren't checked, since that reads the whole file, but searches never read outside of the file.
+tsearch_indexfile_ptr tsearch_indexfile_open(const char *path);
+void tsearch_indexfile_close(const tsearch_indexfile_ptr ptr);
+
+/// Returns success if the checksums of the index file's sections match their contents.
+result tsearch_indexfile_verify(const tsearch_indexfile_ptr ptr);
+
+/// Returns the number of words in the index file.
+size_t tsearch_indexfile_get_count(const tsearch_indexfile_ptr ptr);
+
+/// Returns a tsearch_countedset_ptr with the IDs of the documents containing the target word, or
+/// NULL if there aren't any. The caller is responsible for calling tsearch_countedset_free().
+tsearch_countedset_ptr tsearch_indexfile_copy_search_results(const tsearch_indexfile_ptr ptr, const char *target);
+
+/// Returns a tsearch_countedset_ptr with the IDs of the documents containing words beginning with
+/// the prefix, or NULL if there aren't any. The caller is responsible for calling tsearch_countedset_free().
+tsearch_countedset_ptr tsearch_indexfile_copy_prefix_search_results(const tsearch_indexfile_ptr ptr,
+                                                                    const char *prefix);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_indexfile_h */
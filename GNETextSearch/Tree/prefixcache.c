@@ -0,0 +1,296 @@
+//
+//  prefixcache.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "prefixcache.h"
+#include "GNETextSearchPrivate.h"
+
+// ------------------------------------------------------------------------------------------
+
+#define ENTRIES_INITIAL_CAPACITY 16
+#define ENTRIES_MAX_LOAD_PERCENTAGE 75
+
+typedef struct _tsearch_prefixcache_entry
+{
+    uint32_t key; // The prefix's length and characters packed together or 0 if the slot is empty.
+    size_t lastUse;
+    size_t size;
+    tsearch_countedset_ptr results;
+} _tsearch_prefixcache_entry;
+
+
+typedef struct tsearch_prefixcache
+{
+    _tsearch_prefixcache_entry *entries;
+    size_t count;
+    size_t capacity;
+    size_t size;
+    size_t budget;
+    size_t clock; // Incremented every time an entry is used.
+} tsearch_prefixcache;
+
+// ------------------------------------------------------------------------------------------
+
+uint32_t _tsearch_prefixcache_make_key(const char *prefix, const size_t length);
+size_t _tsearch_prefixcache_find_slot(const tsearch_prefixcache_ptr ptr, const uint32_t key);
+result _tsearch_prefixcache_grow(const tsearch_prefixcache_ptr ptr);
+void _tsearch_prefixcache_update_size(const tsearch_prefixcache_ptr ptr, _tsearch_prefixcache_entry *entryPtr);
+void _tsearch_prefixcache_evict(const tsearch_prefixcache_ptr ptr, const size_t slot);
+void _tsearch_prefixcache_evict_to_budget(const tsearch_prefixcache_ptr ptr);
+
+
+TSEARCH_INLINE bool _tsearch_prefixcache_is_empty(const void *slot)
+{
+    return ((const _tsearch_prefixcache_entry *)slot)->key == 0;
+}
+
+
+TSEARCH_INLINE size_t _tsearch_prefixcache_hash(const void *slot)
+{
+    return _tsearch_hash_uint32(((const _tsearch_prefixcache_entry *)slot)->key);
+}
+
+
+TSEARCH_INLINE bool _tsearch_prefixcache_has_key(const void *slot, const void *key)
+{
+    return ((const _tsearch_prefixcache_entry *)slot)->key == *(const uint32_t *)key;
+}
+
+
+static const _tsearch_hashtable_type _tsearch_prefixcache_entries_type =
+{
+    sizeof(_tsearch_prefixcache_entry),
+    _tsearch_prefixcache_is_empty,
+    _tsearch_prefixcache_hash,
+    _tsearch_prefixcache_has_key,
+};
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Prefix Cache
+// ------------------------------------------------------------------------------------------
+tsearch_prefixcache_ptr tsearch_prefixcache_init(const size_t budget)
+{
+    tsearch_prefixcache_ptr ptr = calloc(1, sizeof(tsearch_prefixcache));
+    if (ptr == NULL) { return NULL; }
+
+    _tsearch_prefixcache_entry *entries = calloc(ENTRIES_INITIAL_CAPACITY, sizeof(_tsearch_prefixcache_entry));
+    if (entries == NULL) { free(ptr); return NULL; }
+
+    ptr->entries = entries;
+    ptr->count = 0;
+    ptr->capacity = ENTRIES_INITIAL_CAPACITY;
+    ptr->size = 0;
+    ptr->budget = budget;
+    ptr->clock = 0;
+
+    return ptr;
+}
+
+
+void tsearch_prefixcache_free(const tsearch_prefixcache_ptr ptr)
+{
+    if (ptr != NULL) {
+        for (size_t i = 0; i < ptr->capacity; i++) {
+            tsearch_countedset_free(ptr->entries[i].results);
+        }
+        free(ptr->entries);
+        ptr->entries = NULL;
+        ptr->count = 0;
+        ptr->capacity = 0;
+        ptr->size = 0;
+        free(ptr);
+    }
+}
+
+
+void tsearch_prefixcache_set_budget(const tsearch_prefixcache_ptr ptr, const size_t budget)
+{
+    if (ptr == NULL) { return; }
+    ptr->budget = budget;
+    _tsearch_prefixcache_evict_to_budget(ptr);
+}
+
+
+size_t tsearch_prefixcache_get_size(const tsearch_prefixcache_ptr ptr)
+{
+    return (ptr == NULL) ? 0 : ptr->size;
+}
+
+
+tsearch_countedset_ptr tsearch_prefixcache_get_results(const tsearch_prefixcache_ptr ptr, const char *prefix,
+                                                       const size_t length)
+{
+    if (ptr == NULL || prefix == NULL) { return NULL; }
+
+    uint32_t key = _tsearch_prefixcache_make_key(prefix, length);
+    if (key == 0) { return NULL; }
+
+    _tsearch_prefixcache_entry *entryPtr = &(ptr->entries[_tsearch_prefixcache_find_slot(ptr, key)]);
+    if (entryPtr->key == 0) { return NULL; }
+
+    ptr->clock += 1;
+    entryPtr->lastUse = ptr->clock;
+    return entryPtr->results;
+}
+
+
+result tsearch_prefixcache_add_results(const tsearch_prefixcache_ptr ptr, const char *prefix,
+                                       const size_t length, const tsearch_countedset_ptr results)
+{
+    if (ptr == NULL || prefix == NULL || results == NULL) { return failure; }
+
+    uint32_t key = _tsearch_prefixcache_make_key(prefix, length);
+    if (key == 0) { return success; }
+
+    size_t slot = _tsearch_prefixcache_find_slot(ptr, key);
+    if (ptr->entries[slot].key != 0) { return success; }
+
+    size_t size = tsearch_countedset_get_size(results);
+    if (size > ptr->budget) { return success; }
+
+    if ((ptr->count + 1) * 100 > ptr->capacity * ENTRIES_MAX_LOAD_PERCENTAGE) {
+        if (_tsearch_prefixcache_grow(ptr) == failure) { return failure; }
+        slot = _tsearch_prefixcache_find_slot(ptr, key);
+    }
+
+    tsearch_countedset_ptr resultsCopy = tsearch_countedset_copy(results);
+    if (resultsCopy == NULL) { return failure; }
+
+    ptr->clock += 1;
+    ptr->entries[slot] = (_tsearch_prefixcache_entry){key, ptr->clock, size, resultsCopy};
+    ptr->count += 1;
+    ptr->size += size;
+
+    // The new results were used last, so they're only evicted if nothing else is left.
+    _tsearch_prefixcache_evict_to_budget(ptr);
+    return success;
+}
+
+
+void tsearch_prefixcache_add_document(const tsearch_prefixcache_ptr ptr, const char *word,
+                                      const GNEInteger documentID, const size_t count)
+{
+    if (ptr == NULL || word == NULL || ptr->count == 0) { return; }
+
+    for (size_t length = 1; length <= TSEARCH_PREFIXCACHE_MAX_PREFIX_LENGTH && word[length - 1] != '\0'; length++) {
+        size_t slot = _tsearch_prefixcache_find_slot(ptr, _tsearch_prefixcache_make_key(word, length));
+        _tsearch_prefixcache_entry *entryPtr = &(ptr->entries[slot]);
+        if (entryPtr->key == 0) { continue; }
+
+        // Results that are missing the document can't be kept.
+        if (tsearch_countedset_add_int_with_count(entryPtr->results, documentID, count) == failure) {
+            _tsearch_prefixcache_evict(ptr, slot);
+        } else {
+            _tsearch_prefixcache_update_size(ptr, entryPtr);
+        }
+    }
+    _tsearch_prefixcache_evict_to_budget(ptr);
+}
+
+
+void tsearch_prefixcache_remove_document(const tsearch_prefixcache_ptr ptr, const GNEInteger documentID)
+{
+    if (ptr == NULL) { return; }
+
+    size_t slot = 0;
+    while (slot < ptr->capacity) {
+        _tsearch_prefixcache_entry *entryPtr = &(ptr->entries[slot]);
+        if (entryPtr->key != 0 && tsearch_countedset_remove_int(entryPtr->results, documentID) == failure) {
+            // Evicting shifts a following entry into the slot, which then needs to be checked.
+            _tsearch_prefixcache_evict(ptr, slot);
+            continue;
+        }
+        if (entryPtr->key != 0) { _tsearch_prefixcache_update_size(ptr, entryPtr); }
+        slot += 1;
+    }
+}
+
+
+void tsearch_prefixcache_remove_all_results(const tsearch_prefixcache_ptr ptr)
+{
+    if (ptr == NULL) { return; }
+
+    for (size_t i = 0; i < ptr->capacity; i++) {
+        tsearch_countedset_free(ptr->entries[i].results);
+        ptr->entries[i] = (_tsearch_prefixcache_entry){0, 0, 0, NULL};
+    }
+    ptr->count = 0;
+    ptr->size = 0;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Returns the prefix's length and characters packed into a key or 0 if the prefix is empty or
+/// too long to be cached.
+uint32_t _tsearch_prefixcache_make_key(const char *prefix, const size_t length)
+{
+    if (length == 0 || length > TSEARCH_PREFIXCACHE_MAX_PREFIX_LENGTH) { return 0; }
+
+    uint32_t key = (uint32_t)length;
+    for (size_t i = 0; i < length; i++) {
+        key |= (uint32_t)(unsigned char)prefix[i] << (8 * (i + 1));
+    }
+    return key;
+}
+
+
+/// Returns the slot containing the key or, if the key isn't in the cache, the empty slot where
+/// it belongs.
+size_t _tsearch_prefixcache_find_slot(const tsearch_prefixcache_ptr ptr, const uint32_t key)
+{
+    return _tsearch_hashtable_find_slot(&_tsearch_prefixcache_entries_type, ptr->entries, ptr->capacity,
+                                        _tsearch_hash_uint32(key), &key);
+}
+
+
+result _tsearch_prefixcache_grow(const tsearch_prefixcache_ptr ptr)
+{
+    _tsearch_prefixcache_entry *entries = _tsearch_hashtable_copy_grown(&_tsearch_prefixcache_entries_type,
+                                                                        ptr->entries, ptr->capacity);
+    if (entries == NULL) { return failure; }
+
+    free(ptr->entries);
+    ptr->entries = entries;
+    ptr->capacity *= 2;
+
+    return success;
+}
+
+
+void _tsearch_prefixcache_update_size(const tsearch_prefixcache_ptr ptr, _tsearch_prefixcache_entry *entryPtr)
+{
+    size_t size = tsearch_countedset_get_size(entryPtr->results);
+    ptr->size = ptr->size - entryPtr->size + size;
+    entryPtr->size = size;
+}
+
+
+void _tsearch_prefixcache_evict(const tsearch_prefixcache_ptr ptr, const size_t slot)
+{
+    tsearch_countedset_free(ptr->entries[slot].results);
+    ptr->size -= ptr->entries[slot].size;
+    ptr->count -= 1;
+    _tsearch_hashtable_remove(&_tsearch_prefixcache_entries_type, ptr->entries, ptr->capacity, slot);
+}
+
+
+/// Evicts the least recently used results until the rest fit in the budget.
+void _tsearch_prefixcache_evict_to_budget(const tsearch_prefixcache_ptr ptr)
+{
+    while (ptr->size > ptr->budget && ptr->count > 0) {
+        size_t leastRecentSlot = SIZE_MAX;
+        for (size_t i = 0; i < ptr->capacity; i++) {
+            if (ptr->entries[i].key == 0) { continue; }
+            if (leastRecentSlot == SIZE_MAX || ptr->entries[i].lastUse < ptr->entries[leastRecentSlot].lastUse) {
+                leastRecentSlot = i;
+            }
+        }
+        _tsearch_prefixcache_evict(ptr, leastRecentSlot);
+    }
+}
@@ -0,0 +1,62 @@
+//
+//  prefixcache.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_prefixcache_h
+#define tsearch_prefixcache_h
+
+#include "countedset.h"
+#include "GNETextSearchPublic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Keeps the results of recent searches for short prefixes, which would otherwise union the
+// document IDs of most of a ternary tree's words every time. The cached results are updated as
+// documents are added and removed, so they never have to be recomputed. When the cached results
+// use more than the cache's budget, the least recently used results are evicted.
+
+#define TSEARCH_PREFIXCACHE_MAX_PREFIX_LENGTH 3
+
+typedef struct tsearch_prefixcache * tsearch_prefixcache_ptr;
+
+tsearch_prefixcache_ptr tsearch_prefixcache_init(const size_t budget);
+void tsearch_prefixcache_free(const tsearch_prefixcache_ptr ptr);
+
+/// Sets the maximum number of bytes the cached results may use, evicting results until they fit.
+void tsearch_prefixcache_set_budget(const tsearch_prefixcache_ptr ptr, const size_t budget);
+
+/// Returns the number of bytes used by the cached results.
+size_t tsearch_prefixcache_get_size(const tsearch_prefixcache_ptr ptr);
+
+/// Returns the cached results for the prefix, which are owned by the cache and valid until it is
+/// next changed, or NULL if they aren't cached.
+tsearch_countedset_ptr tsearch_prefixcache_get_results(const tsearch_prefixcache_ptr ptr, const char *prefix,
+                                                       const size_t length);
+
+/// Caches a copy of the results for the prefix if the prefix is short enough and the copy fits in
+/// the cache's budget.
+result tsearch_prefixcache_add_results(const tsearch_prefixcache_ptr ptr, const char *prefix,
+                                       const size_t length, const tsearch_countedset_ptr results);
+
+/// Adds the document to the cached results of the word's prefixes count times, once for each
+/// time the word was inserted for it.
+void tsearch_prefixcache_add_document(const tsearch_prefixcache_ptr ptr, const char *word,
+                                      const GNEInteger documentID, const size_t count);
+
+/// Removes the document from all of the cached results.
+void tsearch_prefixcache_remove_document(const tsearch_prefixcache_ptr ptr, const GNEInteger documentID);
+
+/// Evicts all of the cached results.
+void tsearch_prefixcache_remove_all_results(const tsearch_prefixcache_ptr ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_prefixcache_h */
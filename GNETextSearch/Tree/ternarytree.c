@@ -8,68 +8,477 @@
 
 #include "ternarytree.h"
 #include "stringbuf.h"
+#include "tokenize.h"
+#include "forwardindex.h"
+#include "trigramindex.h"
+#include "prefixcache.h"
 #include "GNETextSearchPrivate.h"
 #include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    #define TSEARCH_TERNARYTREE_THREADS 0
+#else
+    #define TSEARCH_TERNARYTREE_THREADS 1
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
 
 // ------------------------------------------------------------------------------------------
 
-typedef int callback_signal;
-#define callback_continue 0
-#define callback_stop 1
-typedef callback_signal(*reverse_search_func)(const char character, const size_t index, const void *context);
+// Nodes are allocated from slabs of SLAB_LENGTH nodes, which are never moved once allocated.
+// Nodes refer to each other by their 32-bit index in the tree, so a node's slab is found by
+// shifting its index and its position in the slab by masking its index. Each slab also holds
+// its nodes' maximum frequencies, apart from the nodes so that searches don't load them.
+#define SLAB_SHIFT 10
+#define SLAB_LENGTH (1U << SLAB_SHIFT)
+#define SLAB_MASK (SLAB_LENGTH - 1)
+#define NULL_INDEX UINT32_MAX
+
+#define DEFAULT_MAX_EMPTY_TERM_PERCENTAGE 25
+#define COMPACTION_MIN_TERMS 64
+#define DEFAULT_PREFIX_CACHE_BUDGET (8 * 1024 * 1024)
+
+#define STACK_BUFFER_LENGTH 64
+#define WORD_BUFFER_LENGTH 64
+#define TOKENS_BUFFER_LENGTH 64 // Must be a power of two.
+#define TOKENS_MAX_LOAD_PERCENTAGE 75
+
+// Bulk builds only use more threads than one if each thread gets enough postings to be worth it.
+#define BULK_MAX_THREADS 8
+#define BULK_MIN_POSTINGS_PER_THREAD 16384
+
+// Frame flags
+#define FRAME_VISIT 1 // The node's lower subtree has already been pushed, so the node is next.
+#define FRAME_LOWER 2
+#define FRAME_SAME 3
+#define FRAME_HIGHER 4
+
+typedef struct _tsearch_ternarytree_node
+{
+    char character;
+    uint32_t lower, same, higher;
+    uint32_t term; // The index of the word's document IDs in the tree's terms or NULL_INDEX.
+} _tsearch_ternarytree_node;
+
+
+typedef struct _tsearch_ternarytree_slab
+{
+    _tsearch_ternarytree_node nodes[SLAB_LENGTH];
+    // The largest number of documents containing any word in each node's subtrees, including the
+    // node's own word. Removing documents doesn't lower them until the tree is compacted, so
+    // they're only upper bounds.
+    uint32_t maxFrequencies[SLAB_LENGTH];
+} _tsearch_ternarytree_slab;
+
+
+typedef struct tsearch_ternarytree
+{
+    _tsearch_ternarytree_slab **slabs;
+    size_t slabsCount;
+    size_t slabsCapacity;
+    uint32_t nodesCount;
+    uint32_t root; // Index 0 unless the tree is empty.
+    uint32_t reverseRoot; // The root of the reversed words, which share the words' terms.
+    bool indexesSuffixes;
+    tsearch_countedset_ptr *terms; // Terms released by compaction are NULL until they're reused.
+    size_t termsCount;
+    size_t termsCapacity;
+    uint32_t *freeTerms;
+    size_t freeTermsCount;
+    size_t freeTermsCapacity;
+    size_t emptyTermsCount; // The number of terms whose document IDs have all been removed.
+    size_t maxEmptyTermPercentage;
+    tsearch_forwardindex_ptr forwardIndex; // NULL unless the tree was created with a forward index.
+    tsearch_trigramindex_ptr trigramIndex; // NULL unless created with the tsearch_ternarytree_trigram_index option.
+    // NULL unless the tree was created with the tsearch_ternarytree_prefix_cache option.
+    tsearch_prefixcache_ptr prefixCache;
+} tsearch_ternarytree;
+
+
+// Walks keep the nodes they still have to visit on one of these instead of recursing, so a
+// degenerate tree can't overflow the call stack. What a frame's flag and value mean depends
+// on the walk. The first STACK_BUFFER_LENGTH frames live in the stack itself, so most walks
+// never allocate.
+typedef struct _tsearch_ternarytree_frame
+{
+    uint32_t index;
+    uint32_t flag;
+    size_t value;
+} _tsearch_ternarytree_frame;
+
+
+typedef struct _tsearch_ternarytree_stack
+{
+    _tsearch_ternarytree_frame *frames;
+    size_t count;
+    size_t capacity;
+    _tsearch_ternarytree_frame buffer[STACK_BUFFER_LENGTH];
+} _tsearch_ternarytree_stack;
+
+
+// Because nodes don't point back to their parents, walks that need the words they pass
+// through build them up in one of these as they descend.
+typedef struct _tsearch_ternarytree_word
+{
+    char *characters;
+    size_t length;
+    size_t capacity;
+    char buffer[WORD_BUFFER_LENGTH];
+} _tsearch_ternarytree_word;
+
+// Iterators keep the state of an enumeration of the words between calls.
+typedef struct tsearch_ternarytree_iterator
+{
+    tsearch_ternarytree_ptr tree;
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_word word;
+} tsearch_ternarytree_iterator;
+
+typedef result(*_tsearch_ternarytree_word_func)(const char *word, const size_t length, const uint32_t term,
+                                                void *context);
+
+
+// The words that still have document IDs, which compaction collects in sorted order before
+// rebuilding the tree. Each word is followed by a null terminator in the characters.
+typedef struct _tsearch_ternarytree_live_word
+{
+    size_t offset;
+    uint32_t term;
+} _tsearch_ternarytree_live_word;
+
+
+typedef struct _tsearch_ternarytree_live_words
+{
+    tsearch_stringbuf_ptr characters;
+    _tsearch_ternarytree_live_word *words;
+    size_t count;
+    size_t capacity;
+} _tsearch_ternarytree_live_words;
+
+
+// Indexing a document counts its distinct words in an open-addressing hash table before adding
+// any of them to the tree. The words are the ranges of the tokens in the document, so they're
+// never copied. The capacity is always a power of two, so a word's home slot is found by
+// masking its hash. The first TOKENS_BUFFER_LENGTH slots live in the table itself.
+typedef struct _tsearch_ternarytree_token
+{
+    size_t location;
+    size_t length;
+    size_t count; // 0 if the slot is empty.
+    uint64_t hash;
+} _tsearch_ternarytree_token;
+
+
+typedef struct _tsearch_ternarytree_tokens
+{
+    const char *document;
+    _tsearch_ternarytree_token *slots;
+    size_t count;
+    size_t capacity;
+    bool hasFailed;
+    _tsearch_ternarytree_token buffer[TOKENS_BUFFER_LENGTH];
+} _tsearch_ternarytree_tokens;
+
+
+// Bulk builds split sorting the postings and building the words' document IDs into jobs, which
+// run on their own threads. Sorting jobs sort or merge the postings from start to end, where
+// merging jobs merge the runs before and after the middle from the source into the destination.
+// Building jobs build the document IDs of the groups of postings from start to end.
+typedef struct _tsearch_ternarytree_bulk_job
+{
+    tsearch_ternarytree_posting *source;
+    tsearch_ternarytree_posting *destination;
+    size_t start;
+    size_t middle;
+    size_t end;
+    const size_t *groupStarts;
+    tsearch_countedset_ptr *terms;
+    result ret;
+} _tsearch_ternarytree_bulk_job;
+
+typedef void *(*_tsearch_ternarytree_bulk_job_func)(void *job);
+
+
+// Completion searches visit the most frequent candidates first by keeping them in a max-heap. A
+// candidate is either a word, ranked by the number of documents containing it, or a subtree,
+// ranked by its root's maximum frequency. Candidates share the characters of their paths through
+// the steps, each of which points back to the step for the previous character, so a candidate
+// only has to remember the step for its path's last character.
+typedef struct _tsearch_ternarytree_candidate
+{
+    uint32_t index;
+    uint32_t frequency;
+    bool isWord;
+    size_t step; // The step for the last character of the word or of the path to the subtree or SIZE_MAX.
+    size_t length;
+} _tsearch_ternarytree_candidate;
+
+
+typedef struct _tsearch_ternarytree_step
+{
+    size_t previous;
+    char character;
+} _tsearch_ternarytree_step;
 
-typedef struct _tsearch_string_search
+
+typedef struct _tsearch_ternarytree_candidates
 {
-    const char *string;
-    const size_t length;
-    size_t currentIndex;
-    bool didMatch;
-} _tsearch_string_search;
+    _tsearch_ternarytree_candidate *heap;
+    size_t heapCount;
+    size_t heapCapacity;
+    _tsearch_ternarytree_step *steps;
+    size_t stepsCount;
+    size_t stepsCapacity;
+    _tsearch_ternarytree_candidate *words; // The completions found so far, most frequent first.
+    size_t wordsCount;
+    size_t wordsCapacity;
+} _tsearch_ternarytree_candidates;
 
 // ------------------------------------------------------------------------------------------
 
-tsearch_ternarytree_ptr _tsearch_ternarytree_search(const tsearch_ternarytree_ptr ptr, const char *target);
-result _tsearch_ternarytree_copy_words_from_node(const tsearch_ternarytree_ptr ptr, tsearch_countedset_ptr results);
-result _tsearch_ternarytree_find_partial_match(const tsearch_ternarytree_ptr ptr, const char *target, const size_t length,
-                                               size_t currentIndex, tsearch_countedset_ptr results);
+result _tsearch_ternarytree_insert_word(const tsearch_ternarytree_ptr ptr, const char *word, const size_t length,
+                                       const GNEInteger documentID, const size_t count);
+uint32_t _tsearch_ternarytree_search(const tsearch_ternarytree_ptr ptr, const uint32_t root, const char *target);
+uint32_t _tsearch_ternarytree_add_word(const tsearch_ternarytree_ptr ptr, uint32_t *rootPtr, const char *word,
+                                       _tsearch_ternarytree_stack *path);
+tsearch_countedset_ptr _tsearch_ternarytree_copy_prefix_search_results(const tsearch_ternarytree_ptr ptr,
+                                                                       const uint32_t root, const char *prefix);
+result _tsearch_ternarytree_copy_words_from_node(const tsearch_ternarytree_ptr ptr, const uint32_t index,
+                                                 tsearch_countedset_ptr results);
+result _tsearch_ternarytree_find_partial_match(const tsearch_ternarytree_ptr ptr, const char *target,
+                                               const size_t length, tsearch_countedset_ptr results);
 result _tsearch_ternarytree_find_suffix(const tsearch_ternarytree_ptr ptr, const char *suffix,
                                         const size_t length, tsearch_countedset_ptr results);
-result _tsearch_ternarytree_reverse_search_from_node(tsearch_ternarytree_ptr ptr, reverse_search_func callback,
-                                                     void *context);
-result _tsearch_ternarytree_copy_contents(tsearch_ternarytree_ptr ptr, tsearch_stringbuf_ptr contentsPtr);
-result _tsearch_ternarytree_copy_word(const tsearch_ternarytree_ptr ptr, const tsearch_stringbuf_ptr contentsPtr);
-callback_signal _tsearch_ternarytree_suffix_search_callback(const char character,
-                                                            const size_t index, const void *context);
-callback_signal _tsearch_ternarytree_copy_word_callback(const char character,
-                                                        const size_t index, const void *context);
-result _tsearch_ternarytree_is_leaf(const tsearch_ternarytree_ptr ptr);
-size_t _tsearch_ternarytree_get_word_len(const tsearch_ternarytree_ptr ptr);
-bool _tsearch_ternarytree_has_valid_document_ids(const tsearch_ternarytree_ptr ptr);
+result _tsearch_ternarytree_find_fuzzy_matches(const tsearch_ternarytree_ptr ptr, const char *target,
+                                               const size_t maxEdits, tsearch_countedset_ptr results);
+result _tsearch_ternarytree_find_completions(const tsearch_ternarytree_ptr ptr, const char *prefix,
+                                             const size_t maxCount, _tsearch_ternarytree_candidates *candidates);
+tsearch_ternarytree_completion * _tsearch_ternarytree_pack_words(const _tsearch_ternarytree_candidates *candidates);
+void _tsearch_ternarytree_raise_max_frequencies(const tsearch_ternarytree_ptr ptr,
+                                                const _tsearch_ternarytree_stack *path, const uint32_t frequency);
+void _tsearch_ternarytree_update_max_frequencies(const tsearch_ternarytree_ptr ptr);
+result _tsearch_ternarytree_enumerate_words(const tsearch_ternarytree_ptr ptr, const uint32_t root,
+                                            _tsearch_ternarytree_word_func func, void *context);
+result _tsearch_ternarytree_append_word(const char *word, const size_t length, const uint32_t term, void *context);
+result _tsearch_ternarytree_add_live_word(const char *word, const size_t length, const uint32_t term, void *context);
+result _tsearch_ternarytree_rebuild_balanced(const tsearch_ternarytree_ptr ptr, const uint32_t root,
+                                             const tsearch_ternarytree_ptr balancedPtr, uint32_t *balancedRootPtr);
+result _tsearch_ternarytree_add_balanced_words(const tsearch_ternarytree_ptr ptr, uint32_t *rootPtr,
+                                               const _tsearch_ternarytree_live_words *liveWords,
+                                               const char *characters);
+result _tsearch_ternarytree_copy_nodes(const tsearch_ternarytree_ptr ptr, const uint32_t root,
+                                       const tsearch_ternarytree_ptr compactPtr, uint32_t *compactRootPtr);
+bool _tsearch_ternarytree_should_compact(const tsearch_ternarytree_ptr ptr);
+result _tsearch_ternarytree_sort_postings(tsearch_ternarytree_posting *postings, const size_t count);
+result _tsearch_ternarytree_group_postings(const tsearch_ternarytree_posting *postings, const size_t count,
+                                           size_t **outGroupStarts, size_t *outGroupsCount);
+result _tsearch_ternarytree_build_terms(const tsearch_ternarytree_ptr ptr, tsearch_ternarytree_posting *postings,
+                                        const size_t count, const size_t *groupStarts, const size_t groupsCount);
+result _tsearch_ternarytree_build_words(const tsearch_ternarytree_ptr ptr, const tsearch_ternarytree_posting *postings,
+                                        const size_t *groupStarts, const size_t groupsCount);
+result _tsearch_ternarytree_build_reversed_words(const _tsearch_ternarytree_live_words *liveWords,
+                                                 const char *characters,
+                                                 _tsearch_ternarytree_live_words *reversedWords,
+                                                 const char **outReversedCharacters);
+void * _tsearch_ternarytree_sort_job(void *context);
+void * _tsearch_ternarytree_merge_job(void *context);
+void * _tsearch_ternarytree_build_terms_job(void *context);
+void _tsearch_ternarytree_run_jobs(_tsearch_ternarytree_bulk_job_func func, _tsearch_ternarytree_bulk_job *jobs,
+                                   const size_t count);
+size_t _tsearch_ternarytree_get_threads_count(const size_t count);
+int _tsearch_ternarytree_compare_postings(const void *posting1, const void *posting2);
+result _tsearch_ternarytree_release_empty_terms(const tsearch_ternarytree_ptr ptr);
+bool _tsearch_ternarytree_is_leaf(const _tsearch_ternarytree_node *nodePtr);
+bool _tsearch_ternarytree_has_valid_document_ids(const tsearch_ternarytree_ptr ptr,
+                                                 const _tsearch_ternarytree_node *nodePtr);
+uint32_t _tsearch_ternarytree_node_init(const tsearch_ternarytree_ptr ptr, const char character);
+uint32_t _tsearch_ternarytree_term_init(const tsearch_ternarytree_ptr ptr);
+void _tsearch_ternarytree_stack_init(_tsearch_ternarytree_stack *stack);
+void _tsearch_ternarytree_stack_free(_tsearch_ternarytree_stack *stack);
+result _tsearch_ternarytree_stack_push(_tsearch_ternarytree_stack *stack, const uint32_t index,
+                                       const uint32_t flag, const size_t value);
+result _tsearch_ternarytree_stack_push_children(_tsearch_ternarytree_stack *stack,
+                                                const _tsearch_ternarytree_node *nodePtr,
+                                                const size_t siblingsValue, const size_t sameValue);
+bool _tsearch_ternarytree_stack_pop(_tsearch_ternarytree_stack *stack, _tsearch_ternarytree_frame *outFrame);
+void _tsearch_ternarytree_word_init(_tsearch_ternarytree_word *word);
+void _tsearch_ternarytree_word_free(_tsearch_ternarytree_word *word);
+result _tsearch_ternarytree_word_set_char(_tsearch_ternarytree_word *word, const size_t position,
+                                          const char character);
+result _tsearch_ternarytree_word_set_reversed(_tsearch_ternarytree_word *word, const char *characters,
+                                              const size_t length);
+result _tsearch_ternarytree_word_set(_tsearch_ternarytree_word *word, const char *characters, const size_t length);
+void _tsearch_ternarytree_tokens_init(_tsearch_ternarytree_tokens *tokens, const char *document);
+void _tsearch_ternarytree_tokens_free(_tsearch_ternarytree_tokens *tokens);
+void _tsearch_ternarytree_tokens_add(const char *string, const tsearch_range range, const void *context);
+size_t _tsearch_ternarytree_tokens_find_slot(const _tsearch_ternarytree_tokens *tokens, const uint64_t hash,
+                                             const char *word, const size_t length);
+result _tsearch_ternarytree_tokens_grow(_tsearch_ternarytree_tokens *tokens);
+void _tsearch_ternarytree_candidates_init(_tsearch_ternarytree_candidates *candidates);
+void _tsearch_ternarytree_candidates_free(_tsearch_ternarytree_candidates *candidates);
+result _tsearch_ternarytree_candidates_push(_tsearch_ternarytree_candidates *candidates,
+                                            const _tsearch_ternarytree_candidate candidate);
+bool _tsearch_ternarytree_candidates_pop(_tsearch_ternarytree_candidates *candidates,
+                                         _tsearch_ternarytree_candidate *outCandidate);
+result _tsearch_ternarytree_candidates_add_step(_tsearch_ternarytree_candidates *candidates, const size_t previous,
+                                                const char character, size_t *outStep);
+result _tsearch_ternarytree_reserve(void **itemsPtr, size_t *capacityPtr, const size_t count, const size_t itemSize);
+
+
+TSEARCH_INLINE _tsearch_ternarytree_node * _tsearch_ternarytree_get_node(const tsearch_ternarytree_ptr ptr,
+                                                                         const uint32_t index)
+{
+    if (ptr == NULL || index == NULL_INDEX || index >= ptr->nodesCount) { return NULL; }
+    return &(ptr->slabs[index >> SLAB_SHIFT]->nodes[index & SLAB_MASK]);
+}
+
+
+TSEARCH_INLINE uint32_t _tsearch_ternarytree_get_max_frequency(const tsearch_ternarytree_ptr ptr, const uint32_t index)
+{
+    if (ptr == NULL || index == NULL_INDEX || index >= ptr->nodesCount) { return 0; }
+    return ptr->slabs[index >> SLAB_SHIFT]->maxFrequencies[index & SLAB_MASK];
+}
+
+
+TSEARCH_INLINE uint32_t _tsearch_ternarytree_get_frequency(const tsearch_ternarytree_ptr ptr,
+                                                           const _tsearch_ternarytree_node *nodePtr)
+{
+    if (nodePtr == NULL || nodePtr->term == NULL_INDEX) { return 0; }
+    size_t frequency = tsearch_countedset_get_count(ptr->terms[nodePtr->term]);
+    return (frequency > UINT32_MAX) ? UINT32_MAX : (uint32_t)frequency;
+}
+
+
+/// Returns true if the first candidate should be visited before the second. Words come before
+/// subtrees with the same frequency, because the subtrees can't contain more frequent words.
+TSEARCH_INLINE bool _tsearch_ternarytree_candidate_precedes(const _tsearch_ternarytree_candidate first,
+                                                            const _tsearch_ternarytree_candidate second)
+{
+    if (first.frequency != second.frequency) { return first.frequency > second.frequency; }
+    return (first.isWord == true && second.isWord == false);
+}
+
+
+/// Returns the 64-bit FNV-1a hash of the word's characters.
+TSEARCH_INLINE uint64_t _tsearch_ternarytree_hash(const char *word, const size_t length)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)word[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+
+TSEARCH_INLINE tsearch_countedset_ptr _tsearch_ternarytree_get_document_ids(const tsearch_ternarytree_ptr ptr,
+                                                                          const _tsearch_ternarytree_node *nodePtr)
+{
+    if (nodePtr == NULL || nodePtr->term == NULL_INDEX) { return NULL; }
+    return ptr->terms[nodePtr->term];
+}
 
 // ------------------------------------------------------------------------------------------
 #pragma mark - Tree
 // ------------------------------------------------------------------------------------------
-typedef struct tsearch_ternarytree_node
+tsearch_ternarytree_ptr tsearch_ternarytree_init(void)
 {
-    char character;
-    tsearch_ternarytree_ptr parent;
-    tsearch_ternarytree_ptr lower, same, higher;
-    tsearch_countedset_ptr documentIDs;
-} tsearch_ternarytree_node;
+    tsearch_ternarytree_ptr ptr = calloc(1, sizeof(tsearch_ternarytree));
+    if (ptr == NULL) { return ptr; }
 
+    size_t capacity = 4;
+    _tsearch_ternarytree_slab **slabs = calloc(capacity, sizeof(_tsearch_ternarytree_slab *));
+    if (slabs == NULL) { free(ptr); return NULL; }
+
+    tsearch_countedset_ptr *terms = calloc(capacity, sizeof(tsearch_countedset_ptr));
+    if (terms == NULL) { free(slabs); free(ptr); return NULL; }
+
+    ptr->slabs = slabs;
+    ptr->slabsCount = 0;
+    ptr->slabsCapacity = capacity;
+    ptr->nodesCount = 0;
+    ptr->root = NULL_INDEX;
+    ptr->reverseRoot = NULL_INDEX;
+    ptr->indexesSuffixes = false;
+    ptr->terms = terms;
+    ptr->termsCount = 0;
+    ptr->termsCapacity = capacity;
+    ptr->freeTerms = NULL;
+    ptr->freeTermsCount = 0;
+    ptr->freeTermsCapacity = 0;
+    ptr->emptyTermsCount = 0;
+    ptr->maxEmptyTermPercentage = DEFAULT_MAX_EMPTY_TERM_PERCENTAGE;
+    ptr->forwardIndex = NULL;
+    ptr->trigramIndex = NULL;
+    ptr->prefixCache = NULL;
 
-tsearch_ternarytree_ptr tsearch_ternarytree_init(void)
+    return ptr;
+}
+
+
+tsearch_ternarytree_ptr tsearch_ternarytree_init_with_forward_index(void)
 {
-    tsearch_ternarytree_ptr ptr = calloc(1, sizeof(tsearch_ternarytree_node));
-    if (ptr == NULL) { return ptr; }
+    return tsearch_ternarytree_init_with_options(tsearch_ternarytree_forward_index);
+}
+
+
+tsearch_ternarytree_ptr tsearch_ternarytree_init_with_options(const tsearch_ternarytree_options options)
+{
+    tsearch_ternarytree_ptr ptr = tsearch_ternarytree_init();
+    if (ptr == NULL) { return NULL; }
+
+    if ((options & tsearch_ternarytree_forward_index) != 0) {
+        ptr->forwardIndex = tsearch_forwardindex_init();
+        if (ptr->forwardIndex == NULL) { tsearch_ternarytree_free(ptr); return NULL; }
+    }
+    if ((options & tsearch_ternarytree_trigram_index) != 0) {
+        ptr->trigramIndex = tsearch_trigramindex_init();
+        if (ptr->trigramIndex == NULL) { tsearch_ternarytree_free(ptr); return NULL; }
+    }
+    if ((options & tsearch_ternarytree_prefix_cache) != 0) {
+        ptr->prefixCache = tsearch_prefixcache_init(DEFAULT_PREFIX_CACHE_BUDGET);
+        if (ptr->prefixCache == NULL) { tsearch_ternarytree_free(ptr); return NULL; }
+    }
+    ptr->indexesSuffixes = ((options & tsearch_ternarytree_suffix_index) != 0) ? true : false;
+
+    return ptr;
+}
+
 
-    ptr->character = '\0';
-    ptr->parent = NULL;
-    ptr->lower = NULL;
-    ptr->same = NULL;
-    ptr->higher = NULL;
-    ptr->documentIDs = NULL;
+tsearch_ternarytree_ptr tsearch_ternarytree_init_with_postings(const tsearch_ternarytree_posting *postings,
+                                                               const size_t count,
+                                                               const tsearch_ternarytree_options options)
+{
+    if (count > 0 && postings == NULL) { return NULL; }
+    if (count > SIZE_MAX / sizeof(tsearch_ternarytree_posting)) { return NULL; }
+
+    tsearch_ternarytree_ptr ptr = tsearch_ternarytree_init_with_options(options);
+    if (ptr == NULL) { return NULL; }
+
+    // Postings without words are skipped, just like tsearch_ternarytree_insert() skips them.
+    tsearch_ternarytree_posting *sorted = malloc((count > 0 ? count : 1) * sizeof(tsearch_ternarytree_posting));
+    if (sorted == NULL) { tsearch_ternarytree_free(ptr); return NULL; }
+    size_t sortedCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (postings[i].word == NULL || postings[i].word[0] == '\0') { continue; }
+        sorted[sortedCount] = postings[i];
+        sortedCount += 1;
+    }
 
+    // Once the postings are sorted, each word's document IDs are built in one pass over its
+    // postings, and the words are added median first, so the tree is balanced even if the postings
+    // were sorted by word.
+    size_t *groupStarts = NULL;
+    size_t groupsCount = 0;
+    result ret = _tsearch_ternarytree_sort_postings(sorted, sortedCount);
+    if (ret == success) { ret = _tsearch_ternarytree_group_postings(sorted, sortedCount, &groupStarts, &groupsCount); }
+    if (ret == success) { ret = _tsearch_ternarytree_build_terms(ptr, sorted, sortedCount, groupStarts, groupsCount); }
+    if (ret == success) { ret = _tsearch_ternarytree_build_words(ptr, sorted, groupStarts, groupsCount); }
+    free(groupStarts);
+    free(sorted);
+
+    if (ret == failure) { tsearch_ternarytree_free(ptr); return NULL; }
     return ptr;
 }
 
@@ -77,12 +486,33 @@ tsearch_ternarytree_ptr tsearch_ternarytree_init(void)
 void tsearch_ternarytree_free(const tsearch_ternarytree_ptr ptr)
 {
     if (ptr != NULL) {
-        ptr->parent = NULL;
-        tsearch_ternarytree_free(ptr->lower);
-        tsearch_ternarytree_free(ptr->same);
-        tsearch_ternarytree_free(ptr->higher);
-        tsearch_countedset_free(ptr->documentIDs);
-        ptr->documentIDs = NULL;
+        for (size_t i = 0; i < ptr->termsCount; i++) {
+            tsearch_countedset_free(ptr->terms[i]);
+        }
+        free(ptr->terms);
+        ptr->terms = NULL;
+        ptr->termsCount = 0;
+        ptr->termsCapacity = 0;
+        free(ptr->freeTerms);
+        ptr->freeTerms = NULL;
+        ptr->freeTermsCount = 0;
+        ptr->freeTermsCapacity = 0;
+        tsearch_forwardindex_free(ptr->forwardIndex);
+        ptr->forwardIndex = NULL;
+        tsearch_trigramindex_free(ptr->trigramIndex);
+        ptr->trigramIndex = NULL;
+        tsearch_prefixcache_free(ptr->prefixCache);
+        ptr->prefixCache = NULL;
+        for (size_t i = 0; i < ptr->slabsCount; i++) {
+            free(ptr->slabs[i]);
+        }
+        free(ptr->slabs);
+        ptr->slabs = NULL;
+        ptr->slabsCount = 0;
+        ptr->slabsCapacity = 0;
+        ptr->nodesCount = 0;
+        ptr->root = NULL_INDEX;
+        ptr->reverseRoot = NULL_INDEX;
         free(ptr);
     }
 }
@@ -99,25 +529,35 @@ tsearch_ternarytree_ptr tsearch_ternarytree_insert(tsearch_ternarytree_ptr ptr,
         if (ptr == NULL) { return ptr; }
     }
 
-    if (ptr->character == '\0') { ptr->character = *newCharacter; } // tsearch_ternarytree_init()
+    _tsearch_ternarytree_insert_word(ptr, newCharacter, strlen(newCharacter), documentID, 1);
+    return ptr;
+}
+
 
-    if (*newCharacter < ptr->character) {
-        ptr->lower = tsearch_ternarytree_insert(ptr->lower, newCharacter, documentID);
-        ptr->lower->parent = ptr;
-    } else if (*newCharacter == ptr->character) {
-        if ('\0' == *(newCharacter + 1)) {
-            if (ptr->documentIDs == NULL) { ptr->documentIDs = tsearch_countedset_init(); }
-            tsearch_countedset_add_int(ptr->documentIDs, documentID);
-        } else {
-            ptr->same = tsearch_ternarytree_insert(ptr->same, (newCharacter + 1), documentID);
-            ptr->same->parent = ptr;
+result tsearch_ternarytree_index_document(const tsearch_ternarytree_ptr ptr, const char *document,
+                                          const GNEInteger documentID)
+{
+    if (ptr == NULL || document == NULL) { return failure; }
+
+    _tsearch_ternarytree_tokens tokens;
+    _tsearch_ternarytree_tokens_init(&tokens, document);
+    result ret = tsearch_cstring_tokenize_bytes(document, _tsearch_ternarytree_tokens_add, &tokens);
+    if (tokens.hasFailed == true) { ret = failure; }
+
+    _tsearch_ternarytree_word word;
+    _tsearch_ternarytree_word_init(&word);
+    for (size_t i = 0; i < tokens.capacity && ret == success; i++) {
+        const _tsearch_ternarytree_token token = tokens.slots[i];
+        if (token.count == 0) { continue; }
+        ret = _tsearch_ternarytree_word_set(&word, document + token.location, token.length);
+        if (ret == success) {
+            ret = _tsearch_ternarytree_insert_word(ptr, word.characters, token.length, documentID, token.count);
         }
-    } else {
-        ptr->higher = tsearch_ternarytree_insert(ptr->higher, newCharacter, documentID);
-        ptr->higher->parent = ptr;
     }
+    _tsearch_ternarytree_word_free(&word);
+    _tsearch_ternarytree_tokens_free(&tokens);
 
-    return ptr;
+    return ret;
 }
 
 
@@ -125,48 +565,136 @@ result tsearch_ternarytree_remove(const tsearch_ternarytree_ptr ptr, const GNEIn
 {
     if (ptr == NULL) { return success; }
 
-    if (_tsearch_ternarytree_has_valid_document_ids(ptr) == true) {
-        if (tsearch_countedset_remove_int(ptr->documentIDs, documentID) == failure) {
-            return failure;
+    result ret = success;
+    if (ptr->forwardIndex != NULL) {
+        size_t count = 0;
+        const uint32_t *terms = tsearch_forwardindex_get_terms(ptr->forwardIndex, documentID, &count);
+        for (size_t i = 0; i < count && ret == success; i++) {
+            tsearch_countedset_ptr documentIDs = ptr->terms[terms[i]];
+            ret = tsearch_countedset_remove_int(documentIDs, documentID);
+            if (tsearch_countedset_get_count(documentIDs) == 0) { ptr->emptyTermsCount += 1; }
+        }
+        if (ret == success) { ret = tsearch_forwardindex_remove_document(ptr->forwardIndex, documentID); }
+    } else {
+        // Every word's document IDs are in the terms table, so there's no need to walk the tree.
+        for (size_t i = 0; i < ptr->termsCount && ret == success; i++) {
+            tsearch_countedset_ptr documentIDs = ptr->terms[i];
+            if (tsearch_countedset_get_count(documentIDs) == 0) { continue; }
+            ret = tsearch_countedset_remove_int(documentIDs, documentID);
+            if (tsearch_countedset_get_count(documentIDs) == 0) { ptr->emptyTermsCount += 1; }
         }
     }
 
-    if (tsearch_ternarytree_remove(ptr->lower, documentID) == failure) { return failure; }
-    if (tsearch_ternarytree_remove(ptr->same, documentID) == failure) { return failure; }
-    return tsearch_ternarytree_remove(ptr->higher, documentID);
+    // If the document couldn't be removed from every word, it can't be known which cached
+    // results still contain it.
+    if (ret == success) {
+        tsearch_prefixcache_remove_document(ptr->prefixCache, documentID);
+    } else {
+        tsearch_prefixcache_remove_all_results(ptr->prefixCache);
+    }
+
+    // The tree is still valid if it isn't compacted, so the compaction's result is ignored.
+    if (ret == success && _tsearch_ternarytree_should_compact(ptr) == true) { tsearch_ternarytree_compact(ptr); }
+    return ret;
 }
 
 
-tsearch_countedset_ptr tsearch_ternarytree_copy_search_results(const tsearch_ternarytree_ptr ptr, const char *target)
+result tsearch_ternarytree_set_max_empty_term_percentage(const tsearch_ternarytree_ptr ptr, const size_t percentage)
 {
-    tsearch_ternarytree_ptr foundPtr = _tsearch_ternarytree_search(ptr, target);
-    bool hasResults = _tsearch_ternarytree_has_valid_document_ids(foundPtr);
-    return (hasResults == true) ? tsearch_countedset_copy(foundPtr->documentIDs) : NULL;
+    if (ptr == NULL || percentage > 100) { return failure; }
+    ptr->maxEmptyTermPercentage = percentage;
+    if (_tsearch_ternarytree_should_compact(ptr) == true) { return tsearch_ternarytree_compact(ptr); }
+    return success;
 }
 
 
-tsearch_countedset_ptr tsearch_ternarytree_copy_prefix_search_results(const tsearch_ternarytree_ptr ptr, const char *prefix)
+result tsearch_ternarytree_set_prefix_cache_budget(const tsearch_ternarytree_ptr ptr, const size_t budget)
 {
-    tsearch_ternarytree_ptr foundPtr = _tsearch_ternarytree_search(ptr, prefix);
-    if (foundPtr == NULL) { return NULL; }
+    if (ptr == NULL || ptr->prefixCache == NULL) { return failure; }
+    tsearch_prefixcache_set_budget(ptr->prefixCache, budget);
+    return success;
+}
 
-    tsearch_countedset_ptr resultsPtr = tsearch_countedset_init();
-    if (resultsPtr == NULL) { return NULL; }
 
-    if (_tsearch_ternarytree_has_valid_document_ids(foundPtr) == true) {
-        tsearch_countedset_union(resultsPtr, foundPtr->documentIDs);
+result tsearch_ternarytree_compact(const tsearch_ternarytree_ptr ptr)
+{
+    if (ptr == NULL) { return failure; }
+    if (ptr->nodesCount == 0) { return success; }
+
+    // The words that still have document IDs are collected in sorted order and added to a new
+    // tree, each range's median word first, so that the new tree is balanced even if the words
+    // were originally inserted in order. Then the new tree's nodes are laid out depth first. The
+    // reversed words are rebuilt the same way and laid out after the words.
+    tsearch_ternarytree_ptr balancedPtr = tsearch_ternarytree_init();
+    tsearch_ternarytree_ptr compactPtr = tsearch_ternarytree_init();
+    result ret = (balancedPtr == NULL || compactPtr == NULL) ? failure : success;
+    if (ret == success) {
+        ret = _tsearch_ternarytree_rebuild_balanced(ptr, ptr->root, balancedPtr, &(balancedPtr->root));
+    }
+    if (ret == success && ptr->indexesSuffixes == true) {
+        ret = _tsearch_ternarytree_rebuild_balanced(ptr, ptr->reverseRoot, balancedPtr, &(balancedPtr->reverseRoot));
+    }
+    if (ret == success) {
+        ret = _tsearch_ternarytree_copy_nodes(balancedPtr, balancedPtr->root, compactPtr, &(compactPtr->root));
+    }
+    if (ret == success) {
+        ret = _tsearch_ternarytree_copy_nodes(balancedPtr, balancedPtr->reverseRoot, compactPtr,
+                                              &(compactPtr->reverseRoot));
     }
 
-    if (_tsearch_ternarytree_copy_words_from_node(foundPtr->same, resultsPtr) == failure) {
-        tsearch_countedset_free(resultsPtr);
-        return NULL;
+    if (ret == success) {
+        for (size_t i = 0; i < ptr->slabsCount; i++) {
+            free(ptr->slabs[i]);
+        }
+        free(ptr->slabs);
+        ptr->slabs = compactPtr->slabs;
+        ptr->slabsCount = compactPtr->slabsCount;
+        ptr->slabsCapacity = compactPtr->slabsCapacity;
+        ptr->nodesCount = compactPtr->nodesCount;
+        ptr->root = compactPtr->root;
+        ptr->reverseRoot = compactPtr->reverseRoot;
+
+        compactPtr->slabs = NULL;
+        compactPtr->slabsCount = 0;
+        compactPtr->nodesCount = 0;
+
+        // The compacted nodes start without maximum frequencies, and the old ones were only upper
+        // bounds anyway.
+        _tsearch_ternarytree_update_max_frequencies(ptr);
+
+        // No node refers to a term without document IDs anymore.
+        ret = _tsearch_ternarytree_release_empty_terms(ptr);
     }
 
-    if (tsearch_countedset_get_count(resultsPtr) == 0) {
-        tsearch_countedset_free(resultsPtr);
-        resultsPtr = NULL;
+    tsearch_ternarytree_free(compactPtr);
+    tsearch_ternarytree_free(balancedPtr);
+
+    return ret;
+}
+
+
+tsearch_countedset_ptr tsearch_ternarytree_copy_search_results(const tsearch_ternarytree_ptr ptr, const char *target)
+{
+    if (ptr == NULL) { return NULL; }
+    uint32_t foundIndex = _tsearch_ternarytree_search(ptr, ptr->root, target);
+    _tsearch_ternarytree_node *foundPtr = _tsearch_ternarytree_get_node(ptr, foundIndex);
+    bool hasResults = _tsearch_ternarytree_has_valid_document_ids(ptr, foundPtr);
+    return (hasResults == true) ? tsearch_countedset_copy(_tsearch_ternarytree_get_document_ids(ptr, foundPtr)) : NULL;
+}
+
+
+tsearch_countedset_ptr tsearch_ternarytree_copy_prefix_search_results(const tsearch_ternarytree_ptr ptr, const char *prefix)
+{
+    if (ptr == NULL || prefix == NULL) { return NULL; }
+
+    size_t length = strlen(prefix);
+    tsearch_countedset_ptr cachedResults = tsearch_prefixcache_get_results(ptr->prefixCache, prefix, length);
+    if (cachedResults != NULL) {
+        return (tsearch_countedset_get_count(cachedResults) > 0) ? tsearch_countedset_copy(cachedResults) : NULL;
     }
 
+    tsearch_countedset_ptr resultsPtr = _tsearch_ternarytree_copy_prefix_search_results(ptr, ptr->root, prefix);
+    if (resultsPtr != NULL) { tsearch_prefixcache_add_results(ptr->prefixCache, prefix, length, resultsPtr); }
     return resultsPtr;
 }
 
@@ -181,7 +709,18 @@ tsearch_countedset_ptr tsearch_ternarytree_copy_partial_search_results(const tse
     tsearch_countedset_ptr resultsPtr = tsearch_countedset_init();
     if (resultsPtr == NULL) { return  NULL; }
 
-    _tsearch_ternarytree_find_partial_match(ptr, target, length, 0, resultsPtr);
+    if (ptr->trigramIndex != NULL) {
+        size_t count = 0;
+        uint32_t *terms = tsearch_trigramindex_copy_matching_terms(ptr->trigramIndex, target, length, &count);
+        for (size_t i = 0; i < count; i++) {
+            tsearch_countedset_ptr documentIDs = ptr->terms[terms[i]];
+            if (tsearch_countedset_get_count(documentIDs) == 0) { continue; }
+            if (tsearch_countedset_union(resultsPtr, documentIDs) == failure) { break; }
+        }
+        free(terms);
+    } else {
+        _tsearch_ternarytree_find_partial_match(ptr, target, length, resultsPtr);
+    }
 
     if (tsearch_countedset_get_count(resultsPtr) == 0) {
         tsearch_countedset_free(resultsPtr);
@@ -197,7 +736,20 @@ tsearch_countedset_ptr tsearch_ternarytree_copy_suffix_search_results(const tsea
                                                                       const size_t length)
 {
     if (ptr == NULL) { return NULL; }
-    if (suffix == NULL) { return NULL; }
+    if (suffix == NULL || length == 0) { return NULL; }
+
+    // The words ending with the suffix are the reversed words beginning with the reversed suffix.
+    if (ptr->indexesSuffixes == true) {
+        _tsearch_ternarytree_word reversedSuffix;
+        _tsearch_ternarytree_word_init(&reversedSuffix);
+        tsearch_countedset_ptr resultsPtr = NULL;
+        if (_tsearch_ternarytree_word_set_reversed(&reversedSuffix, suffix, length) == success) {
+            resultsPtr = _tsearch_ternarytree_copy_prefix_search_results(ptr, ptr->reverseRoot,
+                                                                         reversedSuffix.characters);
+        }
+        _tsearch_ternarytree_word_free(&reversedSuffix);
+        return resultsPtr;
+    }
 
     tsearch_countedset_ptr resultsPtr = tsearch_countedset_init();
     if (resultsPtr == NULL) { return NULL; }
@@ -213,13 +765,154 @@ tsearch_countedset_ptr tsearch_ternarytree_copy_suffix_search_results(const tsea
 }
 
 
+tsearch_countedset_ptr tsearch_ternarytree_copy_fuzzy_search_results(const tsearch_ternarytree_ptr ptr,
+                                                                     const char *target,
+                                                                     const size_t maxEdits)
+{
+    if (ptr == NULL) { return NULL; }
+    if (target == NULL || *target == '\0') { return NULL; }
+
+    tsearch_countedset_ptr resultsPtr = tsearch_countedset_init();
+    if (resultsPtr == NULL) { return NULL; }
+
+    if (_tsearch_ternarytree_find_fuzzy_matches(ptr, target, maxEdits, resultsPtr) == failure ||
+        tsearch_countedset_get_count(resultsPtr) == 0)
+    {
+        tsearch_countedset_free(resultsPtr);
+        resultsPtr = NULL;
+    }
+
+    return resultsPtr;
+}
+
+
+result tsearch_ternarytree_copy_completions(const tsearch_ternarytree_ptr ptr, const char *prefix,
+                                           const size_t maxCount, tsearch_ternarytree_completion **outCompletions,
+                                           size_t *outCount)
+{
+    if (ptr == NULL || prefix == NULL || outCompletions == NULL || outCount == NULL) { return failure; }
+    *outCompletions = NULL;
+    *outCount = 0;
+
+    _tsearch_ternarytree_candidates candidates;
+    _tsearch_ternarytree_candidates_init(&candidates);
+
+    result ret = _tsearch_ternarytree_find_completions(ptr, prefix, maxCount, &candidates);
+    if (ret == success && candidates.wordsCount > 0) {
+        *outCompletions = _tsearch_ternarytree_pack_words(&candidates);
+        if (*outCompletions == NULL) {
+            ret = failure;
+        } else {
+            *outCount = candidates.wordsCount;
+        }
+    }
+
+    _tsearch_ternarytree_candidates_free(&candidates);
+    return ret;
+}
+
+
+tsearch_ternarytree_iterator_ptr tsearch_ternarytree_iterator_init(const tsearch_ternarytree_ptr ptr,
+                                                                   const char *prefix)
+{
+    if (ptr == NULL || prefix == NULL) { return NULL; }
+
+    tsearch_ternarytree_iterator_ptr iteratorPtr = calloc(1, sizeof(tsearch_ternarytree_iterator));
+    if (iteratorPtr == NULL) { return NULL; }
+
+    iteratorPtr->tree = ptr;
+    _tsearch_ternarytree_stack_init(&(iteratorPtr->stack));
+    _tsearch_ternarytree_word_init(&(iteratorPtr->word));
+
+    // The prefix's node is visited first, but not its lower and higher subtrees, which contain
+    // words that don't begin with the prefix.
+    result ret = success;
+    if (*prefix == '\0') {
+        ret = _tsearch_ternarytree_stack_push(&(iteratorPtr->stack), ptr->root, 0, 0);
+    } else {
+        uint32_t index = _tsearch_ternarytree_search(ptr, ptr->root, prefix);
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, index);
+        size_t length = strlen(prefix);
+        for (size_t i = 0; i + 1 < length && nodePtr != NULL && ret == success; i++) {
+            ret = _tsearch_ternarytree_word_set_char(&(iteratorPtr->word), i, prefix[i]);
+        }
+        if (nodePtr != NULL && ret == success) {
+            ret = _tsearch_ternarytree_stack_push(&(iteratorPtr->stack), nodePtr->same, 0, length);
+        }
+        if (nodePtr != NULL && ret == success) {
+            ret = _tsearch_ternarytree_stack_push(&(iteratorPtr->stack), index, FRAME_VISIT, length - 1);
+        }
+    }
+
+    if (ret == failure) {
+        tsearch_ternarytree_iterator_free(iteratorPtr);
+        return NULL;
+    }
+    return iteratorPtr;
+}
+
+
+void tsearch_ternarytree_iterator_free(const tsearch_ternarytree_iterator_ptr iteratorPtr)
+{
+    if (iteratorPtr != NULL) {
+        _tsearch_ternarytree_stack_free(&(iteratorPtr->stack));
+        _tsearch_ternarytree_word_free(&(iteratorPtr->word));
+        iteratorPtr->tree = NULL;
+        free(iteratorPtr);
+    }
+}
+
+
+bool tsearch_ternarytree_iterator_next(const tsearch_ternarytree_iterator_ptr iteratorPtr, const char **outWord,
+                                       size_t *outLength, tsearch_countedset_ptr *outDocumentIDs)
+{
+    if (iteratorPtr == NULL || outWord == NULL || outLength == NULL || outDocumentIDs == NULL) { return false; }
+
+    // This is the same walk as _tsearch_ternarytree_enumerate_words(), paused at each word.
+    tsearch_ternarytree_ptr ptr = iteratorPtr->tree;
+    _tsearch_ternarytree_stack *stack = &(iteratorPtr->stack);
+    _tsearch_ternarytree_word *word = &(iteratorPtr->word);
+    _tsearch_ternarytree_frame frame;
+    result ret = success;
+    while (ret == success && _tsearch_ternarytree_stack_pop(stack, &frame) == true) {
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, frame.index);
+        if (nodePtr == NULL) { continue; }
+
+        size_t depth = frame.value;
+        if (frame.flag != FRAME_VISIT) {
+            ret = _tsearch_ternarytree_stack_push(stack, nodePtr->higher, 0, depth);
+            if (ret == success) { ret = _tsearch_ternarytree_stack_push(stack, nodePtr->same, 0, depth + 1); }
+            if (ret == success) { ret = _tsearch_ternarytree_stack_push(stack, frame.index, FRAME_VISIT, depth); }
+            if (ret == success) { ret = _tsearch_ternarytree_stack_push(stack, nodePtr->lower, 0, depth); }
+            continue;
+        }
+
+        ret = _tsearch_ternarytree_word_set_char(word, depth, nodePtr->character);
+        if (ret == success && _tsearch_ternarytree_has_valid_document_ids(ptr, nodePtr) == true) {
+            // The null terminator isn't part of the word, so it's overwritten by the next character.
+            ret = _tsearch_ternarytree_word_set_char(word, depth + 1, '\0');
+            if (ret == failure) { break; }
+            word->length = depth + 1;
+            *outWord = word->characters;
+            *outLength = word->length;
+            *outDocumentIDs = _tsearch_ternarytree_get_document_ids(ptr, nodePtr);
+            return true;
+        }
+    }
+
+    // The iterator can't continue after a failure, because part of the walk is missing.
+    stack->count = 0;
+    return false;
+}
+
+
 result tsearch_ternarytree_copy_contents(tsearch_ternarytree_ptr ptr, char **outResults, size_t *outLength)
 {
     if (ptr == NULL || outResults == NULL || outLength == NULL) { return failure; }
 
     tsearch_stringbuf_ptr contentsPtr = tsearch_stringbuf_init();
 
-    int ret = _tsearch_ternarytree_copy_contents(ptr, contentsPtr);
+    int ret = _tsearch_ternarytree_enumerate_words(ptr, ptr->root, _tsearch_ternarytree_append_word, contentsPtr);
     if (ret == success) {
         *outResults = (char *)tsearch_stringbuf_copy_cstring(contentsPtr);
         *outLength = tsearch_stringbuf_get_len(contentsPtr);
@@ -250,187 +943,726 @@ void tsearch_ternarytree_print(tsearch_ternarytree_ptr ptr)
 // ------------------------------------------------------------------------------------------
 #pragma mark - Private
 // ------------------------------------------------------------------------------------------
-tsearch_ternarytree_ptr _tsearch_ternarytree_search(const tsearch_ternarytree_ptr ptr, const char *target)
+/// Adds the document ID to the word's document IDs count times, adding the word to the tree and
+/// to its optional indexes if it's new. The word must be null-terminated after length characters.
+result _tsearch_ternarytree_insert_word(const tsearch_ternarytree_ptr ptr, const char *word, const size_t length,
+                                       const GNEInteger documentID, const size_t count)
 {
-    if (ptr == NULL) { return NULL; }
+    _tsearch_ternarytree_stack path;
+    _tsearch_ternarytree_stack_init(&path);
+    uint32_t index = _tsearch_ternarytree_add_word(ptr, &(ptr->root), word, &path);
+    _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, index);
+    if (nodePtr == NULL) { _tsearch_ternarytree_stack_free(&path); return failure; }
+
+    bool isNewTerm = false;
+    if (nodePtr->term == NULL_INDEX) {
+        uint32_t term = _tsearch_ternarytree_term_init(ptr);
+        if (term == NULL_INDEX) { _tsearch_ternarytree_stack_free(&path); return failure; }
+        nodePtr->term = term;
+        isNewTerm = true;
+
+        if (ptr->indexesSuffixes == true) {
+            _tsearch_ternarytree_word reversedWord;
+            _tsearch_ternarytree_word_init(&reversedWord);
+            uint32_t reversedIndex = NULL_INDEX;
+            if (_tsearch_ternarytree_word_set_reversed(&reversedWord, word, length) == success) {
+                reversedIndex = _tsearch_ternarytree_add_word(ptr, &(ptr->reverseRoot), reversedWord.characters,
+                                                              NULL);
+            }
+            _tsearch_ternarytree_word_free(&reversedWord);
+            if (reversedIndex == NULL_INDEX) { _tsearch_ternarytree_stack_free(&path); return failure; }
+
+            // Adding the reversed word may have allocated a new slab, but nodePtr is still valid
+            // because slabs never move.
+            _tsearch_ternarytree_get_node(ptr, reversedIndex)->term = term;
+        }
 
-    const char targetCharacter = *target;
+        // Partial searches would miss the word, so they walk the tree from now on instead.
+        if (ptr->trigramIndex != NULL &&
+            tsearch_trigramindex_add_term(ptr->trigramIndex, term, word, length) == failure)
+        {
+            tsearch_trigramindex_free(ptr->trigramIndex);
+            ptr->trigramIndex = NULL;
+        }
+    }
 
-    if (targetCharacter != '\0' && targetCharacter < ptr->character) {
-        return _tsearch_ternarytree_search(ptr->lower, target);
-    } else if (targetCharacter != '\0' && targetCharacter > ptr->character) {
-        return _tsearch_ternarytree_search(ptr->higher, target);
-    } else {
-        if (*(target + 1) == '\0') { return ptr; }
-        else { return _tsearch_ternarytree_search(ptr->same, ++target); }
+    tsearch_countedset_ptr documentIDs = ptr->terms[nodePtr->term];
+    size_t documentsCount = tsearch_countedset_get_count(documentIDs);
+    bool isNewDocument = (ptr->forwardIndex != NULL &&
+                          tsearch_countedset_contains_int(documentIDs, documentID) == false);
+    result ret = tsearch_countedset_add_int_with_count(documentIDs, documentID, count);
+    uint32_t frequency = _tsearch_ternarytree_get_frequency(ptr, nodePtr);
+    if (frequency > documentsCount) { _tsearch_ternarytree_raise_max_frequencies(ptr, &path, frequency); }
+    _tsearch_ternarytree_stack_free(&path);
+    if (ret == failure) { return failure; }
+    // Removals would miss the word, so they sweep every term from now on instead.
+    if (isNewDocument == true &&
+        tsearch_forwardindex_add_term(ptr->forwardIndex, documentID, nodePtr->term) == failure)
+    {
+        tsearch_forwardindex_free(ptr->forwardIndex);
+        ptr->forwardIndex = NULL;
     }
-}
+    tsearch_prefixcache_add_document(ptr->prefixCache, word, documentID, count);
 
+    // The word's documents had all been removed, so its term is no longer empty.
+    if (isNewTerm == false && documentsCount == 0 && ptr->emptyTermsCount > 0) {
+        ptr->emptyTermsCount -= 1;
+    }
 
-result _tsearch_ternarytree_copy_words_from_node(const tsearch_ternarytree_ptr ptr, tsearch_countedset_ptr results)
-{
-    if (ptr == NULL) { return success; }
+    return success;
+}
 
-    if (_tsearch_ternarytree_copy_words_from_node(ptr->lower, results) == failure) { return failure; }
 
-    if (_tsearch_ternarytree_has_valid_document_ids(ptr) == true) {
-        if (tsearch_countedset_union(results, ptr->documentIDs) == failure) { return failure; }
+/// Returns the index of the node for the target's last character or NULL_INDEX if the target
+/// isn't below the specified root.
+uint32_t _tsearch_ternarytree_search(const tsearch_ternarytree_ptr ptr, const uint32_t root, const char *target)
+{
+    if (ptr == NULL || target == NULL || *target == '\0') { return NULL_INDEX; }
+
+    uint32_t index = root;
+    _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, index);
+    while (nodePtr != NULL) {
+        const char targetCharacter = *target;
+        if (targetCharacter < nodePtr->character) {
+            index = nodePtr->lower;
+        } else if (targetCharacter > nodePtr->character) {
+            index = nodePtr->higher;
+        } else {
+            if (*(target + 1) == '\0') { return index; }
+            target += 1;
+            index = nodePtr->same;
+        }
+        nodePtr = _tsearch_ternarytree_get_node(ptr, index);
     }
-
-    if (_tsearch_ternarytree_copy_words_from_node(ptr->same, results) == failure) { return failure; }
-    return _tsearch_ternarytree_copy_words_from_node(ptr->higher, results);
+    return NULL_INDEX;
 }
 
 
-result _tsearch_ternarytree_find_partial_match(const tsearch_ternarytree_ptr ptr, const char *target, const size_t length,
-                                               size_t currentIndex, tsearch_countedset_ptr results)
+/// Returns the document IDs of the words below the specified root that begin with the prefix.
+tsearch_countedset_ptr _tsearch_ternarytree_copy_prefix_search_results(const tsearch_ternarytree_ptr ptr,
+                                                                       const uint32_t root, const char *prefix)
 {
-    if (ptr == NULL) { return success; }
-    if (results == NULL) { return failure; }
+    _tsearch_ternarytree_node *foundPtr = _tsearch_ternarytree_get_node(ptr, _tsearch_ternarytree_search(ptr, root,
+                                                                                                          prefix));
+    if (foundPtr == NULL) { return NULL; }
 
-    if (_tsearch_ternarytree_find_partial_match(ptr->lower, target, length, currentIndex, results) == failure) { return failure; }
-    if (_tsearch_ternarytree_find_partial_match(ptr->higher, target, length, currentIndex, results) == failure) { return failure; }
+    tsearch_countedset_ptr resultsPtr = tsearch_countedset_init();
+    if (resultsPtr == NULL) { return NULL; }
 
-    if (currentIndex == (length - 1) && ptr->character == target[currentIndex]) {
-        if (_tsearch_ternarytree_has_valid_document_ids(ptr) == true) {
-            tsearch_countedset_union(results, ptr->documentIDs);
-        }
-        return _tsearch_ternarytree_copy_words_from_node(ptr->same, results);
+    if (_tsearch_ternarytree_has_valid_document_ids(ptr, foundPtr) == true) {
+        tsearch_countedset_union(resultsPtr, _tsearch_ternarytree_get_document_ids(ptr, foundPtr));
+    }
+
+    if (_tsearch_ternarytree_copy_words_from_node(ptr, foundPtr->same, resultsPtr) == failure) {
+        tsearch_countedset_free(resultsPtr);
+        return NULL;
     }
 
-    size_t nextIndex = 0;
-    if (ptr->character == target[currentIndex]) {
-        nextIndex = currentIndex + 1;
-    } else if (ptr->character == target[0]) {
-        nextIndex = 1;
+    if (tsearch_countedset_get_count(resultsPtr) == 0) {
+        tsearch_countedset_free(resultsPtr);
+        resultsPtr = NULL;
     }
-    return _tsearch_ternarytree_find_partial_match(ptr->same, target, length, nextIndex, results);
+
+    return resultsPtr;
 }
 
 
-result _tsearch_ternarytree_find_suffix(const tsearch_ternarytree_ptr ptr, const char *suffix,
-                                        const size_t length, tsearch_countedset_ptr results)
+/// Returns the index of the node for the word's last character, adding nodes for any of the
+/// word's characters that aren't below the specified root yet, or NULL_INDEX on failure. Creates
+/// the root if it's NULL_INDEX. If path isn't NULL, the index of every node on the way to the
+/// word's last node, including it, is pushed onto it.
+uint32_t _tsearch_ternarytree_add_word(const tsearch_ternarytree_ptr ptr, uint32_t *rootPtr, const char *word,
+                                       _tsearch_ternarytree_stack *path)
 {
-    if (ptr == NULL) { return success; }
-    if (results == NULL) { return failure; }
+    if (ptr == NULL || word == NULL || *word == '\0') { return NULL_INDEX; }
+    if (*rootPtr == NULL_INDEX) {
+        uint32_t root = _tsearch_ternarytree_node_init(ptr, *word);
+        if (root == NULL_INDEX) { return NULL_INDEX; }
+        *rootPtr = root;
+    }
 
-    if (_tsearch_ternarytree_find_suffix(ptr->lower, suffix, length, results) == failure) { return failure; }
+    // Because slabs never move, the node pointers stay valid while new nodes are added. The
+    // nodes for the rest of a new word are added one after the other, so its same chain is
+    // contiguous.
+    uint32_t index = *rootPtr;
+    while (true) {
+        if (path != NULL && _tsearch_ternarytree_stack_push(path, index, 0, 0) == failure) { return NULL_INDEX; }
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, index);
+        uint32_t *nextIndexPtr = NULL;
+        if (*word < nodePtr->character) {
+            nextIndexPtr = &(nodePtr->lower);
+        } else if (*word > nodePtr->character) {
+            nextIndexPtr = &(nodePtr->higher);
+        } else if ('\0' == *(word + 1)) {
+            return index;
+        } else {
+            word += 1;
+            nextIndexPtr = &(nodePtr->same);
+        }
 
-    if (_tsearch_ternarytree_has_valid_document_ids(ptr) == true &&
-        ptr->character == suffix[length - 1]) {
-        _tsearch_string_search search = (_tsearch_string_search){suffix, length, length - 1, true};
-        _tsearch_ternarytree_reverse_search_from_node(ptr,
-                                                      _tsearch_ternarytree_suffix_search_callback,
-                                                      &search);
-        if (search.didMatch == true) {
-            tsearch_countedset_union(results, ptr->documentIDs);
+        if (*nextIndexPtr == NULL_INDEX) {
+            uint32_t newIndex = _tsearch_ternarytree_node_init(ptr, *word);
+            if (newIndex == NULL_INDEX) { return NULL_INDEX; }
+            *nextIndexPtr = newIndex;
         }
+        index = *nextIndexPtr;
     }
-
-    if (_tsearch_ternarytree_find_suffix(ptr->same, suffix, length, results) == failure) { return failure; }
-    return _tsearch_ternarytree_find_suffix(ptr->higher, suffix, length, results);
 }
 
 
-result _tsearch_ternarytree_reverse_search_from_node(tsearch_ternarytree_ptr ptr,
-                                                     reverse_search_func callback,
-                                                     void *context)
+result _tsearch_ternarytree_copy_words_from_node(const tsearch_ternarytree_ptr ptr, const uint32_t index,
+                                                 tsearch_countedset_ptr results)
 {
-    if (ptr == NULL) { return success; }
-    if (callback == NULL) { return failure; }
-
-    size_t wordLength = _tsearch_ternarytree_get_word_len(ptr);
-    if (wordLength == 0) { return success; }
-    size_t characterIndex = wordLength - 1;
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_stack_init(&stack);
 
-    if (callback(ptr->character, characterIndex, context) == callback_stop) { return success; }
-    characterIndex -= 1;
+    _tsearch_ternarytree_frame frame;
+    result ret = _tsearch_ternarytree_stack_push(&stack, index, 0, 0);
+    while (ret == success && _tsearch_ternarytree_stack_pop(&stack, &frame) == true) {
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, frame.index);
+        if (nodePtr == NULL) { continue; }
 
-    while (ptr != NULL) {
-        if (ptr->parent != NULL && ptr->parent->same == ptr) {
-            if (callback(ptr->parent->character, characterIndex, context) == callback_stop) { break; }
-            if (characterIndex == 0) { break; }
-            characterIndex -= 1;
+        if (_tsearch_ternarytree_has_valid_document_ids(ptr, nodePtr) == true) {
+            ret = tsearch_countedset_union(results, _tsearch_ternarytree_get_document_ids(ptr, nodePtr));
         }
-        ptr = ptr->parent;
+        if (ret == success) { ret = _tsearch_ternarytree_stack_push_children(&stack, nodePtr, 0, 0); }
     }
-    return success;
+
+    _tsearch_ternarytree_stack_free(&stack);
+    return ret;
 }
 
 
-result _tsearch_ternarytree_copy_contents(tsearch_ternarytree_ptr ptr, tsearch_stringbuf_ptr contentsPtr)
+/// Adds the document IDs of every word containing the target to the results. Each frame's value is
+/// the number of the target's characters matched by the end of the node's ancestors' characters.
+/// On a mismatch, the failures table, as in the Knuth-Morris-Pratt algorithm, gives the longest
+/// part of the target that is still matched, so overlapping targets like "aab" in "aaab" are found.
+/// Once the whole target has been matched, every word below the match contains it.
+result _tsearch_ternarytree_find_partial_match(const tsearch_ternarytree_ptr ptr, const char *target,
+                                               const size_t length, tsearch_countedset_ptr results)
 {
-    if (contentsPtr == NULL) { return failure; }
-    if (ptr == NULL) { return success; }
+    if (results == NULL) { return failure; }
+    if (length == 0) { return success; }
+
+    size_t failuresBuffer[WORD_BUFFER_LENGTH];
+    size_t *failures = (length <= WORD_BUFFER_LENGTH) ? failuresBuffer : malloc(length * sizeof(size_t));
+    if (failures == NULL) { return failure; }
+    failures[0] = 0;
+    for (size_t i = 1, matchedCount = 0; i < length; i++) {
+        while (matchedCount > 0 && target[i] != target[matchedCount]) { matchedCount = failures[matchedCount - 1]; }
+        if (target[i] == target[matchedCount]) { matchedCount += 1; }
+        failures[i] = matchedCount;
+    }
 
-    if (_tsearch_ternarytree_copy_contents(ptr->lower, contentsPtr) == failure) { return failure; }
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_stack_init(&stack);
+
+    _tsearch_ternarytree_frame frame;
+    result ret = _tsearch_ternarytree_stack_push(&stack, ptr->root, 0, 0);
+    while (ret == success && _tsearch_ternarytree_stack_pop(&stack, &frame) == true) {
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, frame.index);
+        if (nodePtr == NULL) { continue; }
+
+        size_t matchedCount = frame.value;
+        if (matchedCount < length) {
+            while (matchedCount > 0 && nodePtr->character != target[matchedCount]) {
+                matchedCount = failures[matchedCount - 1];
+            }
+            if (nodePtr->character == target[matchedCount]) { matchedCount += 1; }
+        }
 
-    // We've found the end of a word. Append it to the results array.
-    if (_tsearch_ternarytree_has_valid_document_ids(ptr) == true) {
-        if (_tsearch_ternarytree_copy_word(ptr, contentsPtr) == failure) { return failure; }
+        if (matchedCount == length && _tsearch_ternarytree_has_valid_document_ids(ptr, nodePtr) == true) {
+            ret = tsearch_countedset_union(results, _tsearch_ternarytree_get_document_ids(ptr, nodePtr));
+        }
+        if (ret == success) {
+            ret = _tsearch_ternarytree_stack_push_children(&stack, nodePtr, frame.value, matchedCount);
+        }
     }
 
-    if (_tsearch_ternarytree_copy_contents(ptr->same, contentsPtr) == failure) { return failure; }
-    return _tsearch_ternarytree_copy_contents(ptr->higher, contentsPtr);
+    _tsearch_ternarytree_stack_free(&stack);
+    if (failures != failuresBuffer) { free(failures); }
+    return ret;
 }
 
 
-result _tsearch_ternarytree_copy_word(const tsearch_ternarytree_ptr ptr, const tsearch_stringbuf_ptr contentsPtr)
+/// Adds the document IDs of every word ending with the suffix to the results. Each frame's value
+/// is the node's depth, which is where its character goes in the word.
+result _tsearch_ternarytree_find_suffix(const tsearch_ternarytree_ptr ptr, const char *suffix,
+                                        const size_t length, tsearch_countedset_ptr results)
 {
-    if (ptr == NULL) { return success; }
-
-    size_t wordLength = _tsearch_ternarytree_get_word_len(ptr) + 1; // Add one for the newline.
-    if (wordLength == 1) { return success; }
-    char *word = calloc((wordLength), sizeof(char));
-    word[wordLength - 1] = '\n';
-
-    _tsearch_ternarytree_reverse_search_from_node(ptr, _tsearch_ternarytree_copy_word_callback, word);
+    if (results == NULL) { return failure; }
 
-    int ret = tsearch_stringbuf_append_cstring(contentsPtr, word, wordLength);
-    free(word);
+    _tsearch_ternarytree_word word;
+    _tsearch_ternarytree_word_init(&word);
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_stack_init(&stack);
+
+    _tsearch_ternarytree_frame frame;
+    result ret = _tsearch_ternarytree_stack_push(&stack, ptr->root, 0, 0);
+    while (ret == success && _tsearch_ternarytree_stack_pop(&stack, &frame) == true) {
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, frame.index);
+        if (nodePtr == NULL) { continue; }
+
+        size_t depth = frame.value;
+        ret = _tsearch_ternarytree_word_set_char(&word, depth, nodePtr->character);
+        if (ret == failure) { break; }
+
+        if (_tsearch_ternarytree_has_valid_document_ids(ptr, nodePtr) == true && word.length >= length &&
+            memcmp(word.characters + word.length - length, suffix, length) == 0)
+        {
+            ret = tsearch_countedset_union(results, _tsearch_ternarytree_get_document_ids(ptr, nodePtr));
+        }
+        if (ret == success) { ret = _tsearch_ternarytree_stack_push_children(&stack, nodePtr, depth, depth + 1); }
+    }
 
+    _tsearch_ternarytree_stack_free(&stack);
+    _tsearch_ternarytree_word_free(&word);
     return ret;
 }
 
 
-callback_signal _tsearch_ternarytree_suffix_search_callback(const char character,
-                                                            const size_t index,
-                                                            const void *context)
+/// Adds the document IDs of every word within maxEdits insertions, deletions, or substitutions of
+/// the target to the results. Row d of the rows holds the edit distances between the first d
+/// characters of the current path and each prefix of the target, as in the Wagner-Fischer
+/// algorithm. Each frame's value is the node's depth, so its row is computed from the row above
+/// it, which its siblings share. A node's same subtree is skipped once its row's smallest
+/// distance is larger than maxEdits, because descending can only make the distances larger.
+result _tsearch_ternarytree_find_fuzzy_matches(const tsearch_ternarytree_ptr ptr, const char *target,
+                                               const size_t maxEdits, tsearch_countedset_ptr results)
 {
-    if (context == NULL) { return callback_stop; }
-    _tsearch_string_search *search = (_tsearch_string_search *)context;
-    size_t currentIndex = search->currentIndex;
-    char target = search->string[currentIndex];
-    if (character == target) {
-        if (currentIndex > 0) {
-            search->currentIndex = currentIndex - 1;
-            return callback_continue;
-        } else {
-            return callback_stop;
+    if (results == NULL) { return failure; }
+
+    size_t length = strlen(target);
+    size_t rowLength = length + 1;
+    size_t rowsCapacity = rowLength + 1;
+    if (rowLength > SIZE_MAX / sizeof(size_t) / rowsCapacity) { return failure; }
+    size_t *rows = malloc(rowsCapacity * rowLength * sizeof(size_t));
+    if (rows == NULL) { return failure; }
+    for (size_t i = 0; i < rowLength; i++) { rows[i] = i; }
+
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_stack_init(&stack);
+
+    _tsearch_ternarytree_frame frame;
+    result ret = _tsearch_ternarytree_stack_push(&stack, ptr->root, 0, 0);
+    while (ret == success && _tsearch_ternarytree_stack_pop(&stack, &frame) == true) {
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, frame.index);
+        if (nodePtr == NULL) { continue; }
+
+        size_t depth = frame.value;
+        if (depth + 1 == rowsCapacity) {
+            size_t capacity = rowsCapacity;
+            _tsearch_next_buf_len(&capacity, rowLength * sizeof(size_t));
+            size_t *nextRows = NULL;
+            if (capacity > rowsCapacity) { nextRows = realloc(rows, capacity * rowLength * sizeof(size_t)); }
+            if (nextRows == NULL) { ret = failure; break; }
+            rows = nextRows;
+            rowsCapacity = capacity;
         }
+
+        const size_t *aboveRow = rows + (depth * rowLength);
+        size_t *row = rows + ((depth + 1) * rowLength);
+        row[0] = depth + 1;
+        size_t minDistance = row[0];
+        for (size_t i = 1; i < rowLength; i++) {
+            size_t substitution = aboveRow[i - 1] + ((target[i - 1] == nodePtr->character) ? 0 : 1);
+            size_t deletion = aboveRow[i] + 1;
+            size_t insertion = row[i - 1] + 1;
+            size_t distance = (substitution < deletion) ? substitution : deletion;
+            row[i] = (insertion < distance) ? insertion : distance;
+            if (row[i] < minDistance) { minDistance = row[i]; }
+        }
+
+        if (row[length] <= maxEdits && _tsearch_ternarytree_has_valid_document_ids(ptr, nodePtr) == true) {
+            ret = tsearch_countedset_union(results, _tsearch_ternarytree_get_document_ids(ptr, nodePtr));
+        }
+        if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->higher, 0, depth); }
+        if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->lower, 0, depth); }
+        if (ret == success && minDistance <= maxEdits) {
+            ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->same, 0, depth + 1);
+        }
+    }
+
+    _tsearch_ternarytree_stack_free(&stack);
+    free(rows);
+    return ret;
+}
+
+
+/// Adds the most frequent words beginning with the prefix to the candidates' words, at most
+/// maxCount of them. Words are only added once no remaining subtree could contain a more frequent
+/// word, and subtrees without any documents are never visited.
+result _tsearch_ternarytree_find_completions(const tsearch_ternarytree_ptr ptr, const char *prefix,
+                                             const size_t maxCount, _tsearch_ternarytree_candidates *candidates)
+{
+    if (maxCount == 0) { return success; }
+
+    result ret = success;
+    if (*prefix == '\0') {
+        uint32_t frequency = _tsearch_ternarytree_get_max_frequency(ptr, ptr->root);
+        ret = _tsearch_ternarytree_candidates_push(candidates, (_tsearch_ternarytree_candidate){
+            ptr->root, frequency, false, SIZE_MAX, 0});
     } else {
-        search->didMatch = false;
-        return callback_stop;
+        uint32_t index = _tsearch_ternarytree_search(ptr, ptr->root, prefix);
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, index);
+        if (nodePtr == NULL) { return success; }
+
+        size_t step = SIZE_MAX;
+        size_t length = 0;
+        for (; prefix[length] != '\0' && ret == success; length++) {
+            ret = _tsearch_ternarytree_candidates_add_step(candidates, step, prefix[length], &step);
+        }
+        if (ret == success) {
+            uint32_t frequency = _tsearch_ternarytree_get_frequency(ptr, nodePtr);
+            ret = _tsearch_ternarytree_candidates_push(candidates, (_tsearch_ternarytree_candidate){
+                index, frequency, true, step, length});
+        }
+        if (ret == success) {
+            uint32_t frequency = _tsearch_ternarytree_get_max_frequency(ptr, nodePtr->same);
+            ret = _tsearch_ternarytree_candidates_push(candidates, (_tsearch_ternarytree_candidate){
+                nodePtr->same, frequency, false, step, length});
+        }
+    }
+
+    _tsearch_ternarytree_candidate candidate;
+    while (ret == success && candidates->wordsCount < maxCount &&
+           _tsearch_ternarytree_candidates_pop(candidates, &candidate) == true)
+    {
+        if (candidate.isWord == true) {
+            ret = _tsearch_ternarytree_reserve((void **)&(candidates->words), &(candidates->wordsCapacity),
+                                               candidates->wordsCount, sizeof(_tsearch_ternarytree_candidate));
+            if (ret == success) {
+                candidates->words[candidates->wordsCount] = candidate;
+                candidates->wordsCount += 1;
+            }
+            continue;
+        }
+
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, candidate.index);
+        if (nodePtr == NULL) { continue; }
+
+        // The lower and higher subtrees share the node's path, while the node's word and its same
+        // subtree extend it with the node's character.
+        size_t step = SIZE_MAX;
+        ret = _tsearch_ternarytree_candidates_add_step(candidates, candidate.step, nodePtr->character, &step);
+        if (ret == success) {
+            uint32_t frequency = _tsearch_ternarytree_get_frequency(ptr, nodePtr);
+            ret = _tsearch_ternarytree_candidates_push(candidates, (_tsearch_ternarytree_candidate){
+                candidate.index, frequency, true, step, candidate.length + 1});
+        }
+        if (ret == success) {
+            uint32_t frequency = _tsearch_ternarytree_get_max_frequency(ptr, nodePtr->lower);
+            ret = _tsearch_ternarytree_candidates_push(candidates, (_tsearch_ternarytree_candidate){
+                nodePtr->lower, frequency, false, candidate.step, candidate.length});
+        }
+        if (ret == success) {
+            uint32_t frequency = _tsearch_ternarytree_get_max_frequency(ptr, nodePtr->higher);
+            ret = _tsearch_ternarytree_candidates_push(candidates, (_tsearch_ternarytree_candidate){
+                nodePtr->higher, frequency, false, candidate.step, candidate.length});
+        }
+        if (ret == success) {
+            uint32_t frequency = _tsearch_ternarytree_get_max_frequency(ptr, nodePtr->same);
+            ret = _tsearch_ternarytree_candidates_push(candidates, (_tsearch_ternarytree_candidate){
+                nodePtr->same, frequency, false, step, candidate.length + 1});
+        }
+    }
+
+    return ret;
+}
+
+
+/// Packs the candidates' words into completions in a single block, with the words' characters
+/// following the completions, so that the caller only has to free the block.
+tsearch_ternarytree_completion * _tsearch_ternarytree_pack_words(const _tsearch_ternarytree_candidates *candidates)
+{
+    size_t count = candidates->wordsCount;
+    if (count > SIZE_MAX / sizeof(tsearch_ternarytree_completion)) { return NULL; }
+    size_t size = count * sizeof(tsearch_ternarytree_completion);
+    for (size_t i = 0; i < count; i++) {
+        size_t length = candidates->words[i].length;
+        if (length >= SIZE_MAX - size) { return NULL; }
+        size += length + 1;
+    }
+
+    tsearch_ternarytree_completion *completions = malloc(size);
+    if (completions == NULL) { return NULL; }
+
+    char *characters = (char *)(completions + count);
+    for (size_t i = 0; i < count; i++) {
+        _tsearch_ternarytree_candidate word = candidates->words[i];
+        characters[word.length] = '\0';
+        size_t step = word.step;
+        for (size_t position = word.length; position > 0; position--) {
+            characters[position - 1] = candidates->steps[step].character;
+            step = candidates->steps[step].previous;
+        }
+        completions[i] = (tsearch_ternarytree_completion){characters, word.frequency};
+        characters += word.length + 1;
+    }
+
+    return completions;
+}
+
+
+/// Raises the maximum frequency of every node on the path to the frequency.
+void _tsearch_ternarytree_raise_max_frequencies(const tsearch_ternarytree_ptr ptr,
+                                                const _tsearch_ternarytree_stack *path, const uint32_t frequency)
+{
+    for (size_t i = 0; i < path->count; i++) {
+        uint32_t index = path->frames[i].index;
+        uint32_t *maxFrequencyPtr = &(ptr->slabs[index >> SLAB_SHIFT]->maxFrequencies[index & SLAB_MASK]);
+        if (*maxFrequencyPtr < frequency) { *maxFrequencyPtr = frequency; }
+    }
+}
+
+
+/// Sets every node's maximum frequency to the exact number of documents containing the most
+/// frequent word in its subtrees. Compacted nodes are laid out depth first, so every node's
+/// children come after it and have already been updated when it is reached.
+void _tsearch_ternarytree_update_max_frequencies(const tsearch_ternarytree_ptr ptr)
+{
+    for (uint32_t index = ptr->nodesCount; index > 0; index--) {
+        _tsearch_ternarytree_slab *slab = ptr->slabs[(index - 1) >> SLAB_SHIFT];
+        _tsearch_ternarytree_node *nodePtr = &(slab->nodes[(index - 1) & SLAB_MASK]);
+        uint32_t maxFrequency = _tsearch_ternarytree_get_frequency(ptr, nodePtr);
+        uint32_t childFrequencies[3] = {
+            _tsearch_ternarytree_get_max_frequency(ptr, nodePtr->lower),
+            _tsearch_ternarytree_get_max_frequency(ptr, nodePtr->same),
+            _tsearch_ternarytree_get_max_frequency(ptr, nodePtr->higher)
+        };
+        for (size_t i = 0; i < 3; i++) {
+            if (childFrequencies[i] > maxFrequency) { maxFrequency = childFrequencies[i]; }
+        }
+        slab->maxFrequencies[(index - 1) & SLAB_MASK] = maxFrequency;
+    }
+}
+
+
+/// Calls the function with every word below the specified root that has document IDs in sorted order, so each
+/// node is visited after its lower subtree and before its same and higher subtrees. Each frame's
+/// value is the node's depth.
+result _tsearch_ternarytree_enumerate_words(const tsearch_ternarytree_ptr ptr, const uint32_t root,
+                                            _tsearch_ternarytree_word_func func, void *context)
+{
+    if (func == NULL) { return failure; }
+
+    _tsearch_ternarytree_word word;
+    _tsearch_ternarytree_word_init(&word);
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_stack_init(&stack);
+
+    _tsearch_ternarytree_frame frame;
+    result ret = _tsearch_ternarytree_stack_push(&stack, root, 0, 0);
+    while (ret == success && _tsearch_ternarytree_stack_pop(&stack, &frame) == true) {
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, frame.index);
+        if (nodePtr == NULL) { continue; }
+
+        size_t depth = frame.value;
+        if (frame.flag != FRAME_VISIT) {
+            ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->higher, 0, depth);
+            if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->same, 0, depth + 1); }
+            if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, frame.index, FRAME_VISIT, depth); }
+            if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->lower, 0, depth); }
+            continue;
+        }
+
+        ret = _tsearch_ternarytree_word_set_char(&word, depth, nodePtr->character);
+        if (ret == failure) { break; }
+
+        // We've found the end of a word.
+        if (_tsearch_ternarytree_has_valid_document_ids(ptr, nodePtr) == true) {
+            ret = func(word.characters, word.length, nodePtr->term, context);
+        }
+    }
+
+    _tsearch_ternarytree_stack_free(&stack);
+    _tsearch_ternarytree_word_free(&word);
+    return ret;
+}
+
+
+result _tsearch_ternarytree_append_word(const char *word, const size_t length, const uint32_t term, void *context)
+{
+    (void)term;
+    tsearch_stringbuf_ptr contentsPtr = (tsearch_stringbuf_ptr)context;
+    if (tsearch_stringbuf_append_cstring(contentsPtr, word, length) == failure) { return failure; }
+    return tsearch_stringbuf_append_char(contentsPtr, '\n');
+}
+
+
+result _tsearch_ternarytree_add_live_word(const char *word, const size_t length, const uint32_t term, void *context)
+{
+    _tsearch_ternarytree_live_words *liveWords = (_tsearch_ternarytree_live_words *)context;
+
+    if (liveWords->count == liveWords->capacity) {
+        size_t capacity = (liveWords->capacity == 0) ? 16 : liveWords->capacity;
+        size_t size = (liveWords->capacity == 0) ? capacity * sizeof(_tsearch_ternarytree_live_word) :
+                      _tsearch_next_buf_len(&capacity, sizeof(_tsearch_ternarytree_live_word));
+        if (capacity == liveWords->capacity) { return failure; }
+        _tsearch_ternarytree_live_word *words = realloc(liveWords->words, size);
+        if (words == NULL) { return failure; }
+        liveWords->words = words;
+        liveWords->capacity = capacity;
+    }
+
+    size_t offset = tsearch_stringbuf_get_len(liveWords->characters);
+    if (tsearch_stringbuf_append_cstring(liveWords->characters, word, length) == failure) { return failure; }
+    if (tsearch_stringbuf_append_char(liveWords->characters, '\0') == failure) { return failure; }
+
+    liveWords->words[liveWords->count] = (_tsearch_ternarytree_live_word){offset, term};
+    liveWords->count += 1;
+    return success;
+}
+
+
+/// Collects the live words below the specified root and adds them to the balanced tree below the
+/// balanced root.
+result _tsearch_ternarytree_rebuild_balanced(const tsearch_ternarytree_ptr ptr, const uint32_t root,
+                                             const tsearch_ternarytree_ptr balancedPtr, uint32_t *balancedRootPtr)
+{
+    _tsearch_ternarytree_live_words liveWords = {tsearch_stringbuf_init(), NULL, 0, 0};
+    if (liveWords.characters == NULL) { return failure; }
+
+    const char *characters = NULL;
+    result ret = _tsearch_ternarytree_enumerate_words(ptr, root, _tsearch_ternarytree_add_live_word, &liveWords);
+    if (ret == success && liveWords.count > 0) {
+        characters = tsearch_stringbuf_copy_cstring(liveWords.characters);
+        if (characters == NULL) { ret = failure; }
+    }
+    if (ret == success) {
+        ret = _tsearch_ternarytree_add_balanced_words(balancedPtr, balancedRootPtr, &liveWords, characters);
+    }
+
+    free((void *)characters);
+    free(liveWords.words);
+    tsearch_stringbuf_free(liveWords.characters);
+    return ret;
+}
+
+
+/// Adds the sorted live words below the specified root and points their nodes to their terms. The median of
+/// each range of words is added before the rest of the range, which keeps the tree balanced.
+/// Each frame's index is the start of a range and its value is the end of the range.
+result _tsearch_ternarytree_add_balanced_words(const tsearch_ternarytree_ptr ptr, uint32_t *rootPtr,
+                                               const _tsearch_ternarytree_live_words *liveWords,
+                                               const char *characters)
+{
+    if (liveWords->count == 0) { return success; }
+
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_stack_init(&stack);
+
+    _tsearch_ternarytree_frame frame;
+    result ret = _tsearch_ternarytree_stack_push(&stack, 0, 0, liveWords->count);
+    while (ret == success && _tsearch_ternarytree_stack_pop(&stack, &frame) == true) {
+        size_t start = frame.index, end = frame.value;
+        if (start >= end) { continue; }
+        size_t median = start + ((end - start) / 2);
+
+        _tsearch_ternarytree_live_word liveWord = liveWords->words[median];
+        uint32_t index = _tsearch_ternarytree_add_word(ptr, rootPtr, characters + liveWord.offset, NULL);
+        if (index == NULL_INDEX) { ret = failure; break; }
+        _tsearch_ternarytree_get_node(ptr, index)->term = liveWord.term;
+
+        ret = _tsearch_ternarytree_stack_push(&stack, (uint32_t)(median + 1), 0, end);
+        if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, (uint32_t)start, 0, median); }
+    }
+
+    _tsearch_ternarytree_stack_free(&stack);
+    return ret;
+}
+
+
+/// Appends copies of the nodes below the specified root to the compact tree and sets the compact
+/// root to the copy of the root. Copying each node's same child right
+/// after the node puts it at the next index. Each frame's flag is the link from the copied parent,
+/// whose index is the frame's value.
+result _tsearch_ternarytree_copy_nodes(const tsearch_ternarytree_ptr ptr, const uint32_t root,
+                                       const tsearch_ternarytree_ptr compactPtr, uint32_t *compactRootPtr)
+{
+    _tsearch_ternarytree_stack stack;
+    _tsearch_ternarytree_stack_init(&stack);
+
+    _tsearch_ternarytree_frame frame;
+    result ret = _tsearch_ternarytree_stack_push(&stack, root, 0, NULL_INDEX);
+    while (ret == success && _tsearch_ternarytree_stack_pop(&stack, &frame) == true) {
+        _tsearch_ternarytree_node *nodePtr = _tsearch_ternarytree_get_node(ptr, frame.index);
+        if (nodePtr == NULL) { continue; }
+
+        uint32_t compactIndex = _tsearch_ternarytree_node_init(compactPtr, nodePtr->character);
+        if (compactIndex == NULL_INDEX) { ret = failure; break; }
+        _tsearch_ternarytree_get_node(compactPtr, compactIndex)->term = nodePtr->term;
+
+        _tsearch_ternarytree_node *parentPtr = _tsearch_ternarytree_get_node(compactPtr, (uint32_t)frame.value);
+        if (parentPtr == NULL) {
+            *compactRootPtr = compactIndex;
+        } else if (frame.flag == FRAME_LOWER) {
+            parentPtr->lower = compactIndex;
+        } else if (frame.flag == FRAME_SAME) {
+            parentPtr->same = compactIndex;
+        } else if (frame.flag == FRAME_HIGHER) {
+            parentPtr->higher = compactIndex;
+        }
+
+        ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->higher, FRAME_HIGHER, compactIndex);
+        if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->lower, FRAME_LOWER, compactIndex); }
+        if (ret == success) { ret = _tsearch_ternarytree_stack_push(&stack, nodePtr->same, FRAME_SAME, compactIndex); }
     }
+
+    _tsearch_ternarytree_stack_free(&stack);
+    return ret;
 }
 
 
-callback_signal _tsearch_ternarytree_copy_word_callback(const char character,
-                                                        const size_t index,
-                                                        const void *context)
+/// Returns true if the tree has enough terms and the percentage of them whose document IDs have all
+/// been removed is larger than the tree's maximum.
+bool _tsearch_ternarytree_should_compact(const tsearch_ternarytree_ptr ptr)
 {
-    if (context == NULL) { return callback_stop; }
-    char *word = (char *)context;
-    word[index] = character;
-    return callback_continue;
+    if (ptr == NULL || ptr->emptyTermsCount == 0) { return false; }
+    size_t termsCount = ptr->termsCount - ptr->freeTermsCount;
+    if (termsCount < COMPACTION_MIN_TERMS) { return false; }
+    return (ptr->emptyTermsCount * 100 > termsCount * ptr->maxEmptyTermPercentage) ? true : false;
+}
+
+
+/// Frees the document IDs of the terms that don't have any left and adds the terms to the free
+/// list, so that they're reused by new words. No node may refer to an empty term.
+result _tsearch_ternarytree_release_empty_terms(const tsearch_ternarytree_ptr ptr)
+{
+    size_t emptyCount = 0;
+    for (size_t i = 0; i < ptr->termsCount; i++) {
+        if (ptr->terms[i] != NULL && tsearch_countedset_get_count(ptr->terms[i]) == 0) { emptyCount += 1; }
+    }
+
+    // Reserve room for all of the empty terms first, so that either all or none of them are released.
+    size_t capacity = ptr->freeTermsCount + emptyCount;
+    if (capacity > ptr->freeTermsCapacity) {
+        uint32_t *freeTerms = realloc(ptr->freeTerms, capacity * sizeof(uint32_t));
+        if (freeTerms == NULL) { return failure; }
+        ptr->freeTerms = freeTerms;
+        ptr->freeTermsCapacity = capacity;
+    }
+
+    for (size_t i = 0; i < ptr->termsCount; i++) {
+        if (ptr->terms[i] == NULL || tsearch_countedset_get_count(ptr->terms[i]) > 0) { continue; }
+        tsearch_countedset_free(ptr->terms[i]);
+        ptr->terms[i] = NULL;
+        tsearch_trigramindex_remove_term(ptr->trigramIndex, (uint32_t)i);
+        ptr->freeTerms[ptr->freeTermsCount] = (uint32_t)i;
+        ptr->freeTermsCount += 1;
+    }
+    ptr->emptyTermsCount = 0;
+
+    return success;
 }
 
 
-/// Returns true if the specified pointer is a leaf node (i.e., its lower, same, and
-/// higher pointers are NULL), otherwise false.
-result _tsearch_ternarytree_is_leaf(const tsearch_ternarytree_ptr ptr)
+/// Returns true if the specified node is a leaf node (i.e., its lower, same, and
+/// higher indexes are NULL_INDEX), otherwise false.
+bool _tsearch_ternarytree_is_leaf(const _tsearch_ternarytree_node *nodePtr)
 {
-    if (ptr != NULL && ptr->lower == NULL && ptr->same == NULL && ptr->higher == NULL)
+    if (nodePtr != NULL && nodePtr->lower == NULL_INDEX && nodePtr->same == NULL_INDEX &&
+        nodePtr->higher == NULL_INDEX)
     {
         return true;
     }
@@ -438,28 +1670,780 @@ result _tsearch_ternarytree_is_leaf(const tsearch_ternarytree_ptr ptr)
 }
 
 
-/// Returns the length of the beginning at the specified pointer.
-/// The length does NOT include the trailing null terminator.
-size_t _tsearch_ternarytree_get_word_len(const tsearch_ternarytree_ptr ptr)
+/// Return true if the specified node contains one or more document IDs, otherwise false;
+bool _tsearch_ternarytree_has_valid_document_ids(const tsearch_ternarytree_ptr ptr,
+                                                 const _tsearch_ternarytree_node *nodePtr)
 {
-    if (ptr == NULL || ptr->documentIDs == NULL) { return 0; }
-    tsearch_ternarytree_ptr wordPtr = ptr;
-    size_t length = 1;
+    tsearch_countedset_ptr documentIDs = _tsearch_ternarytree_get_document_ids(ptr, nodePtr);
+    if (documentIDs == NULL) { return false; }
+    return (tsearch_countedset_get_count(documentIDs) > 0) ? true : false;
+}
 
-    while (wordPtr != NULL) {
-        if (wordPtr->parent != NULL && wordPtr->parent->same == wordPtr) {
-            length = length + 1;
+
+/// Appends a new node to the tree, allocating a new slab if the last one is full. Returns the
+/// new node's index or NULL_INDEX on failure.
+uint32_t _tsearch_ternarytree_node_init(const tsearch_ternarytree_ptr ptr, const char character)
+{
+    if (ptr == NULL || ptr->nodesCount == NULL_INDEX) { return NULL_INDEX; }
+
+    uint32_t index = ptr->nodesCount;
+    size_t slabIndex = index >> SLAB_SHIFT;
+    if (slabIndex == ptr->slabsCount) {
+        if (ptr->slabsCount == ptr->slabsCapacity) {
+            size_t capacity = ptr->slabsCapacity;
+            size_t size = _tsearch_next_buf_len(&capacity, sizeof(_tsearch_ternarytree_slab *));
+            if (capacity == ptr->slabsCapacity) { return NULL_INDEX; }
+            _tsearch_ternarytree_slab **slabs = realloc(ptr->slabs, size);
+            if (slabs == NULL) { return NULL_INDEX; }
+            ptr->slabs = slabs;
+            ptr->slabsCapacity = capacity;
         }
-        wordPtr = wordPtr->parent;
+        _tsearch_ternarytree_slab *slab = malloc(sizeof(_tsearch_ternarytree_slab));
+        if (slab == NULL) { return NULL_INDEX; }
+        ptr->slabs[slabIndex] = slab;
+        ptr->slabsCount += 1;
     }
 
-    return length;
+    _tsearch_ternarytree_slab *slab = ptr->slabs[slabIndex];
+    _tsearch_ternarytree_node *nodePtr = &(slab->nodes[index & SLAB_MASK]);
+    nodePtr->character = character;
+    nodePtr->lower = NULL_INDEX;
+    nodePtr->same = NULL_INDEX;
+    nodePtr->higher = NULL_INDEX;
+    nodePtr->term = NULL_INDEX;
+    slab->maxFrequencies[index & SLAB_MASK] = 0;
+    ptr->nodesCount += 1;
+    return index;
 }
 
 
-/// Return true if the specified node contains one or more document IDs, otherwise false;
-bool _tsearch_ternarytree_has_valid_document_ids(const tsearch_ternarytree_ptr ptr)
+/// Adds an empty set of document IDs to the tree's terms, reusing a released term if there is
+/// one. Returns the new term's index or NULL_INDEX on failure.
+uint32_t _tsearch_ternarytree_term_init(const tsearch_ternarytree_ptr ptr)
+{
+    if (ptr == NULL) { return NULL_INDEX; }
+
+    if (ptr->freeTermsCount > 0) {
+        tsearch_countedset_ptr documentIDs = tsearch_countedset_init();
+        if (documentIDs == NULL) { return NULL_INDEX; }
+        ptr->freeTermsCount -= 1;
+        uint32_t term = ptr->freeTerms[ptr->freeTermsCount];
+        ptr->terms[term] = documentIDs;
+        return term;
+    }
+
+    if (ptr->termsCount >= NULL_INDEX) { return NULL_INDEX; }
+
+    if (ptr->termsCount == ptr->termsCapacity) {
+        size_t capacity = ptr->termsCapacity;
+        size_t size = _tsearch_next_buf_len(&capacity, sizeof(tsearch_countedset_ptr));
+        if (capacity == ptr->termsCapacity) { return NULL_INDEX; }
+        tsearch_countedset_ptr *terms = realloc(ptr->terms, size);
+        if (terms == NULL) { return NULL_INDEX; }
+        ptr->terms = terms;
+        ptr->termsCapacity = capacity;
+    }
+
+    tsearch_countedset_ptr documentIDs = tsearch_countedset_init();
+    if (documentIDs == NULL) { return NULL_INDEX; }
+
+    uint32_t term = (uint32_t)ptr->termsCount;
+    ptr->terms[term] = documentIDs;
+    ptr->termsCount += 1;
+    return term;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Bulk Build
+// ------------------------------------------------------------------------------------------
+/// Sorts the postings by word and then by document ID. Each thread sorts an equal share of the
+/// postings, and then the sorted runs are merged in pairs, with each merge on its own thread,
+/// until only one run is left.
+result _tsearch_ternarytree_sort_postings(tsearch_ternarytree_posting *postings, const size_t count)
 {
-    if (ptr == NULL || ptr->documentIDs == NULL) { return false; }
-    return (tsearch_countedset_get_count(ptr->documentIDs) > 0) ? true : false;
+    const size_t size = sizeof(tsearch_ternarytree_posting);
+    size_t threadsCount = _tsearch_ternarytree_get_threads_count(count);
+    tsearch_ternarytree_posting *scratch = (threadsCount > 1) ? malloc(count * size) : NULL;
+    if (scratch == NULL) {
+        if (count > 1) { qsort(postings, count, size, &_tsearch_ternarytree_compare_postings); }
+        return success;
+    }
+
+    _tsearch_ternarytree_bulk_job jobs[BULK_MAX_THREADS];
+    size_t bounds[BULK_MAX_THREADS + 1];
+    for (size_t i = 0; i < threadsCount; i++) {
+        bounds[i] = count * i / threadsCount;
+        jobs[i] = (_tsearch_ternarytree_bulk_job){postings, NULL, bounds[i], 0, count * (i + 1) / threadsCount,
+                                                  NULL, NULL, success};
+    }
+    bounds[threadsCount] = count;
+    _tsearch_ternarytree_run_jobs(_tsearch_ternarytree_sort_job, jobs, threadsCount);
+
+    tsearch_ternarytree_posting *source = postings;
+    tsearch_ternarytree_posting *destination = scratch;
+    size_t runsCount = threadsCount;
+    while (runsCount > 1) {
+        size_t jobsCount = 0;
+        for (size_t i = 0; i < runsCount; i += 2) {
+            // The last run is copied on its own if there's an odd number of runs.
+            size_t middle = bounds[i + 1];
+            size_t end = (i + 1 < runsCount) ? bounds[i + 2] : middle;
+            jobs[jobsCount] = (_tsearch_ternarytree_bulk_job){source, destination, bounds[i], middle, end,
+                                                              NULL, NULL, success};
+            jobsCount += 1;
+        }
+        _tsearch_ternarytree_run_jobs(_tsearch_ternarytree_merge_job, jobs, jobsCount);
+
+        for (size_t i = 0; i < jobsCount; i++) { bounds[i + 1] = jobs[i].end; }
+        runsCount = jobsCount;
+        tsearch_ternarytree_posting *swap = source;
+        source = destination;
+        destination = swap;
+    }
+
+    if (source != postings) { memcpy(postings, source, count * size); }
+    free(scratch);
+    return success;
+}
+
+
+/// Finds the first posting of each word in the sorted postings. The group starts end with the
+/// number of postings, so that the postings of group i are from groupStarts[i] to groupStarts[i + 1].
+result _tsearch_ternarytree_group_postings(const tsearch_ternarytree_posting *postings, const size_t count,
+                                           size_t **outGroupStarts, size_t *outGroupsCount)
+{
+    size_t groupsCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i == 0 || strcmp(postings[i - 1].word, postings[i].word) != 0) { groupsCount += 1; }
+    }
+    if (groupsCount >= NULL_INDEX) { return failure; }
+
+    size_t *groupStarts = malloc((groupsCount + 1) * sizeof(size_t));
+    if (groupStarts == NULL) { return failure; }
+    size_t group = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i == 0 || strcmp(postings[i - 1].word, postings[i].word) != 0) {
+            groupStarts[group] = i;
+            group += 1;
+        }
+    }
+    groupStarts[groupsCount] = count;
+
+    *outGroupStarts = groupStarts;
+    *outGroupsCount = groupsCount;
+    return success;
+}
+
+
+/// Builds the document IDs of each group of postings, whose term is the group's index, in one pass
+/// over its postings. Each thread builds the groups of an equal share of the postings. Then each
+/// document is added to the forward index.
+result _tsearch_ternarytree_build_terms(const tsearch_ternarytree_ptr ptr, tsearch_ternarytree_posting *postings,
+                                        const size_t count, const size_t *groupStarts, const size_t groupsCount)
+{
+    if (groupsCount > ptr->termsCapacity) {
+        tsearch_countedset_ptr *terms = realloc(ptr->terms, groupsCount * sizeof(tsearch_countedset_ptr));
+        if (terms == NULL) { return failure; }
+        ptr->terms = terms;
+        ptr->termsCapacity = groupsCount;
+    }
+    // Terms that couldn't be built are NULL, which the tree frees without trouble.
+    memset(ptr->terms, 0, groupsCount * sizeof(tsearch_countedset_ptr));
+    ptr->termsCount = groupsCount;
+
+    size_t threadsCount = _tsearch_ternarytree_get_threads_count(count);
+    if (threadsCount > groupsCount) { threadsCount = (groupsCount > 0) ? groupsCount : 1; }
+    _tsearch_ternarytree_bulk_job jobs[BULK_MAX_THREADS];
+    size_t group = 0;
+    for (size_t i = 0; i < threadsCount; i++) {
+        size_t start = group;
+        size_t shareEnd = count * (i + 1) / threadsCount;
+        while (group < groupsCount && (groupStarts[group] < shareEnd || i + 1 == threadsCount)) { group += 1; }
+        jobs[i] = (_tsearch_ternarytree_bulk_job){postings, NULL, start, 0, group, groupStarts, ptr->terms, success};
+    }
+    _tsearch_ternarytree_run_jobs(_tsearch_ternarytree_build_terms_job, jobs, threadsCount);
+    for (size_t i = 0; i < threadsCount; i++) {
+        if (jobs[i].ret == failure) { return failure; }
+    }
+
+    if (ptr->forwardIndex == NULL) { return success; }
+    for (size_t term = 0; term < groupsCount; term++) {
+        for (size_t i = groupStarts[term]; i < groupStarts[term + 1]; i++) {
+            if (i > groupStarts[term] && postings[i - 1].documentID == postings[i].documentID) { continue; }
+            if (tsearch_forwardindex_add_term(ptr->forwardIndex, postings[i].documentID, (uint32_t)term) == failure) {
+                return failure;
+            }
+        }
+    }
+    return success;
+}
+
+
+/// Adds the words of the groups to the tree the same way tsearch_ternarytree_compact() rebuilds it:
+/// the sorted words are added to a balanced tree, each range's median word first, and then the
+/// balanced tree's nodes are copied into the tree depth first.
+result _tsearch_ternarytree_build_words(const tsearch_ternarytree_ptr ptr, const tsearch_ternarytree_posting *postings,
+                                        const size_t *groupStarts, const size_t groupsCount)
+{
+    if (groupsCount == 0) { return success; }
+
+    _tsearch_ternarytree_live_words liveWords = {tsearch_stringbuf_init(), NULL, 0, 0};
+    _tsearch_ternarytree_live_words reversedWords = {NULL, NULL, 0, 0};
+    tsearch_ternarytree_ptr balancedPtr = tsearch_ternarytree_init();
+    const char *characters = NULL;
+    const char *reversedCharacters = NULL;
+
+    result ret = (liveWords.characters == NULL || balancedPtr == NULL) ? failure : success;
+    for (size_t term = 0; term < groupsCount && ret == success; term++) {
+        const char *word = postings[groupStarts[term]].word;
+        ret = _tsearch_ternarytree_add_live_word(word, strlen(word), (uint32_t)term, &liveWords);
+    }
+    if (ret == success) {
+        characters = tsearch_stringbuf_copy_cstring(liveWords.characters);
+        if (characters == NULL) { ret = failure; }
+    }
+    if (ret == success) {
+        ret = _tsearch_ternarytree_add_balanced_words(balancedPtr, &(balancedPtr->root), &liveWords, characters);
+    }
+    if (ret == success && ptr->indexesSuffixes == true) {
+        ret = _tsearch_ternarytree_build_reversed_words(&liveWords, characters, &reversedWords, &reversedCharacters);
+        if (ret == success) {
+            ret = _tsearch_ternarytree_add_balanced_words(balancedPtr, &(balancedPtr->reverseRoot), &reversedWords,
+                                                          reversedCharacters);
+        }
+    }
+    if (ret == success) {
+        ret = _tsearch_ternarytree_copy_nodes(balancedPtr, balancedPtr->root, ptr, &(ptr->root));
+    }
+    if (ret == success) {
+        ret = _tsearch_ternarytree_copy_nodes(balancedPtr, balancedPtr->reverseRoot, ptr, &(ptr->reverseRoot));
+    }
+    if (ret == success) { _tsearch_ternarytree_update_max_frequencies(ptr); }
+
+    // Partial searches walk the tree instead if the trigram index can't be built.
+    for (size_t i = 0; i < liveWords.count && ret == success && ptr->trigramIndex != NULL; i++) {
+        const char *word = characters + liveWords.words[i].offset;
+        if (tsearch_trigramindex_add_term(ptr->trigramIndex, liveWords.words[i].term, word, strlen(word)) == failure) {
+            tsearch_trigramindex_free(ptr->trigramIndex);
+            ptr->trigramIndex = NULL;
+        }
+    }
+
+    free((void *)characters);
+    free((void *)reversedCharacters);
+    free(liveWords.words);
+    free(reversedWords.words);
+    tsearch_stringbuf_free(liveWords.characters);
+    tsearch_stringbuf_free(reversedWords.characters);
+    tsearch_ternarytree_free(balancedPtr);
+    return ret;
+}
+
+
+/// Collects the reversed live words in sorted order, so that they can be added to the tree of
+/// reversed words.
+result _tsearch_ternarytree_build_reversed_words(const _tsearch_ternarytree_live_words *liveWords,
+                                                 const char *characters,
+                                                 _tsearch_ternarytree_live_words *reversedWords,
+                                                 const char **outReversedCharacters)
+{
+    reversedWords->characters = tsearch_stringbuf_init();
+    if (reversedWords->characters == NULL) { return failure; }
+
+    _tsearch_ternarytree_word reversedWord;
+    _tsearch_ternarytree_word_init(&reversedWord);
+    result ret = success;
+    for (size_t i = 0; i < liveWords->count && ret == success; i++) {
+        const char *word = characters + liveWords->words[i].offset;
+        size_t length = strlen(word);
+        ret = _tsearch_ternarytree_word_set_reversed(&reversedWord, word, length);
+        if (ret == success) {
+            ret = _tsearch_ternarytree_add_live_word(reversedWord.characters, length, liveWords->words[i].term,
+                                                     reversedWords);
+        }
+    }
+    _tsearch_ternarytree_word_free(&reversedWord);
+    if (ret == failure) { return failure; }
+
+    const char *reversedCharacters = tsearch_stringbuf_copy_cstring(reversedWords->characters);
+    if (reversedCharacters == NULL) { return failure; }
+
+    // The reversed words are sorted like postings, whose document IDs are the words' terms.
+    tsearch_ternarytree_posting *sorted = malloc(reversedWords->count * sizeof(tsearch_ternarytree_posting));
+    if (sorted == NULL) { free((void *)reversedCharacters); return failure; }
+    for (size_t i = 0; i < reversedWords->count; i++) {
+        const _tsearch_ternarytree_live_word liveWord = reversedWords->words[i];
+        sorted[i] = (tsearch_ternarytree_posting){reversedCharacters + liveWord.offset, liveWord.term};
+    }
+    _tsearch_ternarytree_sort_postings(sorted, reversedWords->count);
+    for (size_t i = 0; i < reversedWords->count; i++) {
+        size_t offset = (size_t)(sorted[i].word - reversedCharacters);
+        reversedWords->words[i] = (_tsearch_ternarytree_live_word){offset, (uint32_t)sorted[i].documentID};
+    }
+    free(sorted);
+
+    *outReversedCharacters = reversedCharacters;
+    return success;
+}
+
+
+void * _tsearch_ternarytree_sort_job(void *context)
+{
+    _tsearch_ternarytree_bulk_job *job = (_tsearch_ternarytree_bulk_job *)context;
+    if (job->end - job->start > 1) {
+        qsort(job->source + job->start, job->end - job->start, sizeof(tsearch_ternarytree_posting),
+              &_tsearch_ternarytree_compare_postings);
+    }
+    return NULL;
+}
+
+
+void * _tsearch_ternarytree_merge_job(void *context)
+{
+    _tsearch_ternarytree_bulk_job *job = (_tsearch_ternarytree_bulk_job *)context;
+    const tsearch_ternarytree_posting *source = job->source;
+    size_t first = job->start, second = job->middle, index = job->start;
+    while (first < job->middle && second < job->end) {
+        if (_tsearch_ternarytree_compare_postings(&(source[second]), &(source[first])) < 0) {
+            job->destination[index++] = source[second++];
+        } else {
+            job->destination[index++] = source[first++];
+        }
+    }
+    while (first < job->middle) { job->destination[index++] = source[first++]; }
+    while (second < job->end) { job->destination[index++] = source[second++]; }
+    return NULL;
+}
+
+
+/// Builds the document IDs of the job's groups, counting the postings of each document.
+void * _tsearch_ternarytree_build_terms_job(void *context)
+{
+    _tsearch_ternarytree_bulk_job *job = (_tsearch_ternarytree_bulk_job *)context;
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    size_t capacity = 0;
+
+    for (size_t group = job->start; group < job->end && job->ret == success; group++) {
+        const size_t first = job->groupStarts[group], last = job->groupStarts[group + 1];
+        if (last - first > capacity) {
+            GNEInteger *newIntegers = realloc(integers, (last - first) * sizeof(GNEInteger));
+            if (newIntegers != NULL) { integers = newIntegers; }
+            size_t *newCounts = realloc(counts, (last - first) * sizeof(size_t));
+            if (newCounts != NULL) { counts = newCounts; }
+            if (newIntegers == NULL || newCounts == NULL) { job->ret = failure; break; }
+            capacity = last - first;
+        }
+
+        size_t count = 0;
+        for (size_t i = first; i < last; i++) {
+            const GNEInteger documentID = job->source[i].documentID;
+            if (count > 0 && integers[count - 1] == documentID) { counts[count - 1] += 1; continue; }
+            integers[count] = documentID;
+            counts[count] = 1;
+            count += 1;
+        }
+        job->terms[group] = tsearch_countedset_init_with_sorted_ints(integers, counts, count);
+        if (job->terms[group] == NULL) { job->ret = failure; }
+    }
+
+    free(integers);
+    free(counts);
+    return NULL;
+}
+
+
+/// Runs each job on its own thread, except for the first, which runs on the calling thread, and
+/// waits for all of them to finish. A job whose thread can't be started runs on the calling thread.
+void _tsearch_ternarytree_run_jobs(_tsearch_ternarytree_bulk_job_func func, _tsearch_ternarytree_bulk_job *jobs,
+                                   const size_t count)
+{
+#if TSEARCH_TERNARYTREE_THREADS
+    pthread_t threads[BULK_MAX_THREADS];
+    bool isRunning[BULK_MAX_THREADS];
+    for (size_t i = 1; i < count; i++) {
+        isRunning[i] = (pthread_create(&(threads[i]), NULL, func, &(jobs[i])) == 0) ? true : false;
+        if (isRunning[i] == false) { func(&(jobs[i])); }
+    }
+    if (count > 0) { func(&(jobs[0])); }
+    for (size_t i = 1; i < count; i++) {
+        if (isRunning[i] == true) { pthread_join(threads[i], NULL); }
+    }
+#else
+    for (size_t i = 0; i < count; i++) { func(&(jobs[i])); }
+#endif
+}
+
+
+/// Returns the number of threads to split the work for the number of postings between.
+size_t _tsearch_ternarytree_get_threads_count(const size_t count)
+{
+#if TSEARCH_TERNARYTREE_THREADS
+    long processorsCount = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t threadsCount = count / BULK_MIN_POSTINGS_PER_THREAD;
+    if (processorsCount > 0 && threadsCount > (size_t)processorsCount) { threadsCount = (size_t)processorsCount; }
+    if (threadsCount > BULK_MAX_THREADS) { threadsCount = BULK_MAX_THREADS; }
+    return (threadsCount > 0) ? threadsCount : 1;
+#else
+    return 1;
+#endif
+}
+
+
+/// Orders postings by their words, comparing characters the same way the tree does, and then by
+/// their document IDs.
+int _tsearch_ternarytree_compare_postings(const void *posting1, const void *posting2)
+{
+    const tsearch_ternarytree_posting *first = (const tsearch_ternarytree_posting *)posting1;
+    const tsearch_ternarytree_posting *second = (const tsearch_ternarytree_posting *)posting2;
+    const char *word1 = first->word, *word2 = second->word;
+    while (*word1 != '\0' && *word1 == *word2) {
+        word1 += 1;
+        word2 += 1;
+    }
+    if (*word1 != *word2) {
+        // The end of a word comes before any character, even those that are negative.
+        if (*word1 == '\0') { return -1; }
+        if (*word2 == '\0') { return 1; }
+        return (*word1 < *word2) ? -1 : 1;
+    }
+    if (first->documentID == second->documentID) { return 0; }
+    return (first->documentID < second->documentID) ? -1 : 1;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Scratch Buffers
+// ------------------------------------------------------------------------------------------
+void _tsearch_ternarytree_stack_init(_tsearch_ternarytree_stack *stack)
+{
+    stack->frames = stack->buffer;
+    stack->count = 0;
+    stack->capacity = STACK_BUFFER_LENGTH;
+}
+
+
+void _tsearch_ternarytree_stack_free(_tsearch_ternarytree_stack *stack)
+{
+    if (stack->frames != stack->buffer) { free(stack->frames); }
+    stack->frames = stack->buffer;
+    stack->count = 0;
+    stack->capacity = STACK_BUFFER_LENGTH;
+}
+
+
+/// Pushes a frame for the node at the specified index onto the stack. Does nothing if the index
+/// is NULL_INDEX.
+result _tsearch_ternarytree_stack_push(_tsearch_ternarytree_stack *stack, const uint32_t index,
+                                       const uint32_t flag, const size_t value)
+{
+    if (index == NULL_INDEX) { return success; }
+
+    if (stack->count == stack->capacity) {
+        size_t capacity = stack->capacity;
+        size_t size = _tsearch_next_buf_len(&capacity, sizeof(_tsearch_ternarytree_frame));
+        if (capacity == stack->capacity) { return failure; }
+        _tsearch_ternarytree_frame *frames = NULL;
+        if (stack->frames == stack->buffer) {
+            frames = malloc(size);
+            if (frames != NULL) { memcpy(frames, stack->buffer, stack->count * sizeof(_tsearch_ternarytree_frame)); }
+        } else {
+            frames = realloc(stack->frames, size);
+        }
+        if (frames == NULL) { return failure; }
+        stack->frames = frames;
+        stack->capacity = capacity;
+    }
+
+    stack->frames[stack->count] = (_tsearch_ternarytree_frame){index, flag, value};
+    stack->count += 1;
+    return success;
+}
+
+
+/// Pushes frames for the node's higher, lower, and same children, in that order, so that the
+/// walk continues down the node's same chain first.
+result _tsearch_ternarytree_stack_push_children(_tsearch_ternarytree_stack *stack,
+                                                const _tsearch_ternarytree_node *nodePtr,
+                                                const size_t siblingsValue, const size_t sameValue)
+{
+    if (_tsearch_ternarytree_stack_push(stack, nodePtr->higher, 0, siblingsValue) == failure) { return failure; }
+    if (_tsearch_ternarytree_stack_push(stack, nodePtr->lower, 0, siblingsValue) == failure) { return failure; }
+    return _tsearch_ternarytree_stack_push(stack, nodePtr->same, 0, sameValue);
+}
+
+
+bool _tsearch_ternarytree_stack_pop(_tsearch_ternarytree_stack *stack, _tsearch_ternarytree_frame *outFrame)
+{
+    if (stack->count == 0) { return false; }
+    stack->count -= 1;
+    *outFrame = stack->frames[stack->count];
+    return true;
+}
+
+
+void _tsearch_ternarytree_word_init(_tsearch_ternarytree_word *word)
+{
+    word->characters = word->buffer;
+    word->length = 0;
+    word->capacity = WORD_BUFFER_LENGTH;
+}
+
+
+void _tsearch_ternarytree_word_free(_tsearch_ternarytree_word *word)
+{
+    if (word->characters != word->buffer) { free(word->characters); }
+    word->characters = word->buffer;
+    word->length = 0;
+    word->capacity = WORD_BUFFER_LENGTH;
+}
+
+
+/// Sets the character at the specified position and truncates the word after it.
+result _tsearch_ternarytree_word_set_char(_tsearch_ternarytree_word *word, const size_t position,
+                                          const char character)
+{
+    if (position > word->length) { return failure; }
+
+    if (position == word->capacity) {
+        size_t capacity = word->capacity;
+        size_t size = _tsearch_next_buf_len(&capacity, sizeof(char));
+        if (capacity == word->capacity) { return failure; }
+        char *characters = NULL;
+        if (word->characters == word->buffer) {
+            characters = malloc(size);
+            if (characters != NULL) { memcpy(characters, word->buffer, word->length); }
+        } else {
+            characters = realloc(word->characters, size);
+        }
+        if (characters == NULL) { return failure; }
+        word->characters = characters;
+        word->capacity = capacity;
+    }
+
+    word->characters[position] = character;
+    word->length = position + 1;
+    return success;
+}
+
+
+/// Sets the word to the first length characters in reverse order followed by a NUL, so that it
+/// can be added to or searched for in the tree of reversed words.
+result _tsearch_ternarytree_word_set_reversed(_tsearch_ternarytree_word *word, const char *characters,
+                                              const size_t length)
+{
+    for (size_t i = 0; i < length; i++) {
+        if (_tsearch_ternarytree_word_set_char(word, i, characters[length - 1 - i]) == failure) { return failure; }
+    }
+    return _tsearch_ternarytree_word_set_char(word, length, '\0');
+}
+
+
+/// Sets the word to the first length characters followed by a NUL.
+result _tsearch_ternarytree_word_set(_tsearch_ternarytree_word *word, const char *characters, const size_t length)
+{
+    // Only words that don't fit in the current capacity need to grow it a character at a time.
+    if (length >= word->capacity) {
+        word->length = 0;
+        for (size_t i = 0; i < length; i++) {
+            if (_tsearch_ternarytree_word_set_char(word, i, characters[i]) == failure) { return failure; }
+        }
+        return _tsearch_ternarytree_word_set_char(word, length, '\0');
+    }
+    memcpy(word->characters, characters, length);
+    word->characters[length] = '\0';
+    word->length = length + 1;
+    return success;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Document Tokens
+// ------------------------------------------------------------------------------------------
+void _tsearch_ternarytree_tokens_init(_tsearch_ternarytree_tokens *tokens, const char *document)
+{
+    tokens->document = document;
+    tokens->slots = tokens->buffer;
+    tokens->count = 0;
+    tokens->capacity = TOKENS_BUFFER_LENGTH;
+    tokens->hasFailed = false;
+    memset(tokens->buffer, 0, sizeof(tokens->buffer));
+}
+
+
+void _tsearch_ternarytree_tokens_free(_tsearch_ternarytree_tokens *tokens)
+{
+    if (tokens->slots != tokens->buffer) { free(tokens->slots); }
+    tokens->slots = tokens->buffer;
+    tokens->count = 0;
+    tokens->capacity = TOKENS_BUFFER_LENGTH;
+}
+
+
+/// Counts another occurrence of the token's word. Called by the tokenizer, which can't be stopped,
+/// so a failure to grow the table is recorded and the rest of the tokens are ignored.
+void _tsearch_ternarytree_tokens_add(const char *string, const tsearch_range range, const void *context)
+{
+    _tsearch_ternarytree_tokens *tokens = (_tsearch_ternarytree_tokens *)context;
+    if (tokens->hasFailed == true) { return; }
+
+    const char *word = string + range.location;
+    const uint64_t hash = _tsearch_ternarytree_hash(word, range.length);
+    size_t slot = _tsearch_ternarytree_tokens_find_slot(tokens, hash, word, range.length);
+    if (tokens->slots[slot].count == 0) {
+        if ((tokens->count + 1) * 100 > tokens->capacity * TOKENS_MAX_LOAD_PERCENTAGE) {
+            if (_tsearch_ternarytree_tokens_grow(tokens) == failure) { tokens->hasFailed = true; return; }
+            slot = _tsearch_ternarytree_tokens_find_slot(tokens, hash, word, range.length);
+        }
+        tokens->slots[slot] = (_tsearch_ternarytree_token){range.location, range.length, 0, hash};
+        tokens->count += 1;
+    }
+    tokens->slots[slot].count += 1;
+}
+
+
+/// Returns the slot holding the word or the empty slot where it belongs.
+size_t _tsearch_ternarytree_tokens_find_slot(const _tsearch_ternarytree_tokens *tokens, const uint64_t hash,
+                                             const char *word, const size_t length)
+{
+    const size_t mask = tokens->capacity - 1;
+    size_t slot = (size_t)hash & mask;
+    while (true) {
+        const _tsearch_ternarytree_token *tokenPtr = &(tokens->slots[slot]);
+        if (tokenPtr->count == 0) { return slot; }
+        if (tokenPtr->hash == hash && tokenPtr->length == length &&
+            memcmp(tokens->document + tokenPtr->location, word, length) == 0)
+        {
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+
+result _tsearch_ternarytree_tokens_grow(_tsearch_ternarytree_tokens *tokens)
+{
+    if (tokens->capacity > SIZE_MAX / 2 / sizeof(_tsearch_ternarytree_token)) { return failure; }
+    const size_t capacity = tokens->capacity * 2;
+    _tsearch_ternarytree_token *slots = calloc(capacity, sizeof(_tsearch_ternarytree_token));
+    if (slots == NULL) { return failure; }
+
+    // The words are already distinct, so each one goes in the first empty slot from its home slot.
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < tokens->capacity; i++) {
+        const _tsearch_ternarytree_token token = tokens->slots[i];
+        if (token.count == 0) { continue; }
+        size_t slot = (size_t)token.hash & mask;
+        while (slots[slot].count != 0) { slot = (slot + 1) & mask; }
+        slots[slot] = token;
+    }
+
+    if (tokens->slots != tokens->buffer) { free(tokens->slots); }
+    tokens->slots = slots;
+    tokens->capacity = capacity;
+    return success;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Completion Candidates
+// ------------------------------------------------------------------------------------------
+void _tsearch_ternarytree_candidates_init(_tsearch_ternarytree_candidates *candidates)
+{
+    *candidates = (_tsearch_ternarytree_candidates){NULL, 0, 0, NULL, 0, 0, NULL, 0, 0};
+}
+
+
+void _tsearch_ternarytree_candidates_free(_tsearch_ternarytree_candidates *candidates)
+{
+    free(candidates->heap);
+    free(candidates->steps);
+    free(candidates->words);
+    _tsearch_ternarytree_candidates_init(candidates);
+}
+
+
+/// Adds the candidate to the heap unless it's a word without documents or a subtree without any.
+result _tsearch_ternarytree_candidates_push(_tsearch_ternarytree_candidates *candidates,
+                                            const _tsearch_ternarytree_candidate candidate)
+{
+    if (candidate.frequency == 0) { return success; }
+
+    result ret = _tsearch_ternarytree_reserve((void **)&(candidates->heap), &(candidates->heapCapacity),
+                                              candidates->heapCount, sizeof(_tsearch_ternarytree_candidate));
+    if (ret == failure) { return failure; }
+
+    _tsearch_ternarytree_candidate *heap = candidates->heap;
+    size_t position = candidates->heapCount;
+    candidates->heapCount += 1;
+    while (position > 0) {
+        size_t parent = (position - 1) / 2;
+        if (_tsearch_ternarytree_candidate_precedes(candidate, heap[parent]) == false) { break; }
+        heap[position] = heap[parent];
+        position = parent;
+    }
+    heap[position] = candidate;
+
+    return success;
+}
+
+
+bool _tsearch_ternarytree_candidates_pop(_tsearch_ternarytree_candidates *candidates,
+                                         _tsearch_ternarytree_candidate *outCandidate)
+{
+    if (candidates->heapCount == 0) { return false; }
+
+    _tsearch_ternarytree_candidate *heap = candidates->heap;
+    *outCandidate = heap[0];
+    candidates->heapCount -= 1;
+
+    size_t count = candidates->heapCount;
+    _tsearch_ternarytree_candidate last = heap[count];
+    size_t position = 0;
+    while (true) {
+        size_t child = position * 2 + 1;
+        if (child >= count) { break; }
+        if (child + 1 < count && _tsearch_ternarytree_candidate_precedes(heap[child + 1], heap[child]) == true) {
+            child += 1;
+        }
+        if (_tsearch_ternarytree_candidate_precedes(heap[child], last) == false) { break; }
+        heap[position] = heap[child];
+        position = child;
+    }
+    heap[position] = last;
+
+    return true;
+}
+
+
+result _tsearch_ternarytree_candidates_add_step(_tsearch_ternarytree_candidates *candidates, const size_t previous,
+                                                const char character, size_t *outStep)
+{
+    result ret = _tsearch_ternarytree_reserve((void **)&(candidates->steps), &(candidates->stepsCapacity),
+                                              candidates->stepsCount, sizeof(_tsearch_ternarytree_step));
+    if (ret == failure) { return failure; }
+
+    candidates->steps[candidates->stepsCount] = (_tsearch_ternarytree_step){previous, character};
+    *outStep = candidates->stepsCount;
+    candidates->stepsCount += 1;
+    return success;
+}
+
+
+/// Grows the items so that they have room for at least one more item than the count.
+result _tsearch_ternarytree_reserve(void **itemsPtr, size_t *capacityPtr, const size_t count, const size_t itemSize)
+{
+    if (count < *capacityPtr) { return success; }
+
+    size_t capacity = (*capacityPtr == 0) ? 16 : *capacityPtr;
+    size_t size = (*capacityPtr == 0) ? capacity * itemSize : _tsearch_next_buf_len(&capacity, itemSize);
+    if (capacity == *capacityPtr) { return failure; }
+
+    void *items = realloc(*itemsPtr, size);
+    if (items == NULL) { return failure; }
+    *itemsPtr = items;
+    *capacityPtr = capacity;
+
+    return success;
 }
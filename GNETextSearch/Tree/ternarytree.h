@@ -16,14 +16,79 @@
 extern "C" {
 #endif
 
-typedef struct tsearch_ternarytree_node *tsearch_ternarytree_ptr;
+typedef struct tsearch_ternarytree *tsearch_ternarytree_ptr;
+typedef struct tsearch_ternarytree_iterator *tsearch_ternarytree_iterator_ptr;
+
+/// The optional indexes a tree can keep in addition to its words, which can be combined.
+typedef enum
+{
+    /// Keeps track of the words inserted for each document, so that tsearch_ternarytree_remove()
+    /// only has to visit the document's words instead of every word.
+    tsearch_ternarytree_forward_index = 1 << 0,
+    /// Keeps a second tree of the reversed words, which shares the words' document IDs, so that a
+    /// suffix search is a prefix search of the reversed words instead of a walk of every word.
+    tsearch_ternarytree_suffix_index = 1 << 1,
+    /// Keeps the words containing each three-character sequence, so that a partial search only
+    /// compares the target with the words containing all of its sequences instead of every word.
+    tsearch_ternarytree_trigram_index = 1 << 2,
+    /// Keeps the results of recent searches for prefixes of up to three characters, which are kept
+    /// up to date as documents are inserted and removed, until they use more than the cache's
+    /// budget. The default budget is 8 MB.
+    tsearch_ternarytree_prefix_cache = 1 << 3,
+} tsearch_ternarytree_options;
+
+/// A word beginning with a prefix and the number of documents containing it.
+typedef struct tsearch_ternarytree_completion
+{
+    const char *word;
+    size_t frequency;
+} tsearch_ternarytree_completion;
+
+/// A word and the ID of a document containing it.
+typedef struct tsearch_ternarytree_posting
+{
+    const char *word;
+    GNEInteger documentID;
+} tsearch_ternarytree_posting;
 
 tsearch_ternarytree_ptr tsearch_ternarytree_init(void);
+/// Same as tsearch_ternarytree_init_with_options(tsearch_ternarytree_forward_index).
+tsearch_ternarytree_ptr tsearch_ternarytree_init_with_forward_index(void);
+/// Creates a tree that keeps the specified optional indexes.
+tsearch_ternarytree_ptr tsearch_ternarytree_init_with_options(const tsearch_ternarytree_options options);
+/// Same as inserting each posting into an empty tree with the specified optional indexes, except
+/// that the tree is balanced. The postings' words are copied.
+tsearch_ternarytree_ptr tsearch_ternarytree_init_with_postings(const tsearch_ternarytree_posting *postings,
+                                                               const size_t count,
+                                                               const tsearch_ternarytree_options options);
 void tsearch_ternarytree_free(const tsearch_ternarytree_ptr ptr);
 tsearch_ternarytree_ptr tsearch_ternarytree_insert(tsearch_ternarytree_ptr ptr,
                                                    const char *newCharacter, const GNEInteger documentID);
+
+/// Tokenizes the null-terminated UTF-8 document with tsearch_cstring_tokenize_bytes() and inserts
+/// each of its words for the document, which is the same as calling tsearch_ternarytree_insert() for
+/// every occurrence of every word. The words are counted first, straight from the document's bytes,
+/// so the tree is only walked and a word's document IDs are only updated once per distinct word.
+result tsearch_ternarytree_index_document(const tsearch_ternarytree_ptr ptr, const char *document,
+                                          const GNEInteger documentID);
 result tsearch_ternarytree_remove(const tsearch_ternarytree_ptr ptr, const GNEInteger documentID);
 
+/// Sets the percentage of words (0–100) whose documents have all been removed that the tree may
+/// hold before it is automatically compacted. The default is 25. A percentage of 100 turns off
+/// automatic compaction.
+result tsearch_ternarytree_set_max_empty_term_percentage(const tsearch_ternarytree_ptr ptr, const size_t percentage);
+
+/// Sets the maximum number of bytes used by the cached prefix search results of a tree created with
+/// the tsearch_ternarytree_prefix_cache option, evicting the least recently used results until the
+/// rest fit. Returns failure if the tree doesn't have a prefix cache.
+result tsearch_ternarytree_set_prefix_cache_budget(const tsearch_ternarytree_ptr ptr, const size_t budget);
+
+/// Rebuilds the tree without the words whose documents have all been removed and releases their
+/// nodes and document IDs. The rebuilt tree is balanced and its nodes are laid out in depth-first
+/// order, so that each node's same child immediately follows it, which keeps searches on as few
+/// cache lines as possible. Words inserted after compacting are appended at the end.
+result tsearch_ternarytree_compact(const tsearch_ternarytree_ptr ptr);
+
 /// Returns a GNEIntegerCountedSet with the IDs of the documents containing the target. The caller is
 /// responsible for calling tsearch_countedset_free().
 tsearch_countedset_ptr tsearch_ternarytree_copy_search_results(const tsearch_ternarytree_ptr ptr, const char *target);
@@ -44,6 +109,36 @@ tsearch_countedset_ptr tsearch_ternarytree_copy_suffix_search_results(const tsea
                                                                       const char *suffix,
                                                                       const size_t length);
 
+/// Returns a tsearch_countedset_ptr with the IDs of the documents containing words that can be turned
+/// into the target with at most maxEdits insertions, deletions, or substitutions of single bytes.
+/// The caller is responsible for calling tsearch_countedset_free().
+tsearch_countedset_ptr tsearch_ternarytree_copy_fuzzy_search_results(const tsearch_ternarytree_ptr ptr,
+                                                                     const char *target,
+                                                                     const size_t maxEdits);
+
+/// Copies up to maxCount of the words beginning with the prefix into outCompletions, ordered from
+/// the word contained in the most documents to the least. Words contained in the same number of
+/// documents are in no particular order. An empty prefix completes every word in the tree. The
+/// completions and their words are a single block, which must be freed by the caller with free().
+result tsearch_ternarytree_copy_completions(const tsearch_ternarytree_ptr ptr, const char *prefix,
+                                           const size_t maxCount, tsearch_ternarytree_completion **outCompletions,
+                                           size_t *outCount);
+
+/// Creates an iterator over the words beginning with the prefix in the order of their characters,
+/// which visits them one at a time instead of copying them. An empty prefix iterates every word.
+/// The tree must not be changed while it's iterated.
+tsearch_ternarytree_iterator_ptr tsearch_ternarytree_iterator_init(const tsearch_ternarytree_ptr ptr,
+                                                                   const char *prefix);
+void tsearch_ternarytree_iterator_free(const tsearch_ternarytree_iterator_ptr iteratorPtr);
+
+/// Moves the iterator to the next word contained in any documents. On return, outWord points at the
+/// null-terminated word, which is owned by the iterator and only valid until the next call, and
+/// outDocumentIDs points at the word's document IDs, which are owned by the tree and can be iterated
+/// with tsearch_countedset_iterator_init(). Returns false if there aren't any more words or if the
+/// iterator couldn't continue.
+bool tsearch_ternarytree_iterator_next(const tsearch_ternarytree_iterator_ptr iteratorPtr, const char **outWord,
+                                       size_t *outLength, tsearch_countedset_ptr *outDocumentIDs);
+
 /// Copies all words contained in the tree into outResults (which much be freed by the caller).
 result tsearch_ternarytree_copy_contents(const tsearch_ternarytree_ptr ptr, char **outResults, size_t *outLength);
 
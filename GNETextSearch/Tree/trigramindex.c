@@ -0,0 +1,393 @@
+//
+//  trigramindex.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "trigramindex.h"
+#include "GNETextSearchPrivate.h"
+#include <string.h>
+
+// ------------------------------------------------------------------------------------------
+
+#define TRIGRAM_LENGTH 3
+
+// Trigrams are never removed from the trigrams table, only their terms.
+#define TRIGRAMS_INITIAL_CAPACITY 64
+#define TRIGRAMS_MAX_LOAD_PERCENTAGE 75
+#define TERMS_INITIAL_CAPACITY 4
+#define WORDS_INITIAL_CAPACITY 16
+
+typedef struct _tsearch_trigramindex_trigram
+{
+    uint32_t trigram;
+    uint32_t *terms; // NULL if the slot is empty.
+    uint32_t termsCount;
+    uint32_t termsCapacity;
+} _tsearch_trigramindex_trigram;
+
+
+typedef struct _tsearch_trigramindex_word
+{
+    char *characters; // NULL if the term isn't in the index.
+    size_t length;
+} _tsearch_trigramindex_word;
+
+
+typedef struct tsearch_trigramindex
+{
+    _tsearch_trigramindex_trigram *trigrams;
+    size_t trigramsCount;
+    size_t trigramsCapacity;
+    _tsearch_trigramindex_word *words; // Indexed by term.
+    size_t wordsCapacity;
+} tsearch_trigramindex;
+
+// ------------------------------------------------------------------------------------------
+
+size_t _tsearch_trigramindex_find_slot(const tsearch_trigramindex_ptr ptr, const uint32_t trigram);
+_tsearch_trigramindex_trigram * _tsearch_trigramindex_get_trigram(const tsearch_trigramindex_ptr ptr,
+                                                                  const uint32_t trigram);
+result _tsearch_trigramindex_grow_trigrams(const tsearch_trigramindex_ptr ptr);
+result _tsearch_trigramindex_grow_words(const tsearch_trigramindex_ptr ptr, const uint32_t term);
+result _tsearch_trigramindex_trigram_add_term(const tsearch_trigramindex_ptr ptr, const uint32_t trigram,
+                                              const uint32_t term);
+uint32_t * _tsearch_trigramindex_copy_all_matching_terms(const tsearch_trigramindex_ptr ptr, const char *target,
+                                                         const size_t length, size_t *outCount);
+uint32_t _tsearch_trigramindex_find_term(const uint32_t *terms, const uint32_t count, const uint32_t term);
+bool _tsearch_trigramindex_word_contains(const _tsearch_trigramindex_word *wordPtr, const char *target,
+                                         const size_t length);
+
+
+TSEARCH_INLINE uint32_t _tsearch_trigramindex_make_trigram(const char *characters)
+{
+    return ((uint32_t)(unsigned char)characters[0] << 16) | ((uint32_t)(unsigned char)characters[1] << 8) |
+           (uint32_t)(unsigned char)characters[2];
+}
+
+
+TSEARCH_INLINE bool _tsearch_trigramindex_is_empty(const void *slot)
+{
+    return ((const _tsearch_trigramindex_trigram *)slot)->terms == NULL;
+}
+
+
+TSEARCH_INLINE size_t _tsearch_trigramindex_hash(const void *slot)
+{
+    return _tsearch_hash_uint32(((const _tsearch_trigramindex_trigram *)slot)->trigram);
+}
+
+
+TSEARCH_INLINE bool _tsearch_trigramindex_has_key(const void *slot, const void *key)
+{
+    return ((const _tsearch_trigramindex_trigram *)slot)->trigram == *(const uint32_t *)key;
+}
+
+
+static const _tsearch_hashtable_type _tsearch_trigramindex_trigrams_type =
+{
+    sizeof(_tsearch_trigramindex_trigram),
+    _tsearch_trigramindex_is_empty,
+    _tsearch_trigramindex_hash,
+    _tsearch_trigramindex_has_key,
+};
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Trigram Index
+// ------------------------------------------------------------------------------------------
+tsearch_trigramindex_ptr tsearch_trigramindex_init(void)
+{
+    tsearch_trigramindex_ptr ptr = calloc(1, sizeof(tsearch_trigramindex));
+    if (ptr == NULL) { return NULL; }
+
+    _tsearch_trigramindex_trigram *trigrams = calloc(TRIGRAMS_INITIAL_CAPACITY, sizeof(_tsearch_trigramindex_trigram));
+    if (trigrams == NULL) { free(ptr); return NULL; }
+
+    _tsearch_trigramindex_word *words = calloc(WORDS_INITIAL_CAPACITY, sizeof(_tsearch_trigramindex_word));
+    if (words == NULL) { free(trigrams); free(ptr); return NULL; }
+
+    ptr->trigrams = trigrams;
+    ptr->trigramsCount = 0;
+    ptr->trigramsCapacity = TRIGRAMS_INITIAL_CAPACITY;
+    ptr->words = words;
+    ptr->wordsCapacity = WORDS_INITIAL_CAPACITY;
+
+    return ptr;
+}
+
+
+void tsearch_trigramindex_free(const tsearch_trigramindex_ptr ptr)
+{
+    if (ptr != NULL) {
+        for (size_t i = 0; i < ptr->trigramsCapacity; i++) {
+            free(ptr->trigrams[i].terms);
+        }
+        free(ptr->trigrams);
+        ptr->trigrams = NULL;
+        ptr->trigramsCount = 0;
+        ptr->trigramsCapacity = 0;
+        for (size_t i = 0; i < ptr->wordsCapacity; i++) {
+            free(ptr->words[i].characters);
+        }
+        free(ptr->words);
+        ptr->words = NULL;
+        ptr->wordsCapacity = 0;
+        free(ptr);
+    }
+}
+
+
+result tsearch_trigramindex_add_term(const tsearch_trigramindex_ptr ptr, const uint32_t term,
+                                     const char *word, const size_t length)
+{
+    if (ptr == NULL || word == NULL) { return failure; }
+    if (term >= ptr->wordsCapacity && _tsearch_trigramindex_grow_words(ptr, term) == failure) { return failure; }
+    if (ptr->words[term].characters != NULL) { return failure; }
+
+    char *characters = malloc(length + 1);
+    if (characters == NULL) { return failure; }
+    memcpy(characters, word, length);
+    characters[length] = '\0';
+    ptr->words[term] = (_tsearch_trigramindex_word){characters, length};
+
+    for (size_t i = 0; i + TRIGRAM_LENGTH <= length; i++) {
+        uint32_t trigram = _tsearch_trigramindex_make_trigram(word + i);
+        if (_tsearch_trigramindex_trigram_add_term(ptr, trigram, term) == failure) {
+            // Removing the term takes it out of the trigrams it was already added to.
+            tsearch_trigramindex_remove_term(ptr, term);
+            return failure;
+        }
+    }
+
+    return success;
+}
+
+
+void tsearch_trigramindex_remove_term(const tsearch_trigramindex_ptr ptr, const uint32_t term)
+{
+    if (ptr == NULL || term >= ptr->wordsCapacity || ptr->words[term].characters == NULL) { return; }
+
+    _tsearch_trigramindex_word word = ptr->words[term];
+    for (size_t i = 0; i + TRIGRAM_LENGTH <= word.length; i++) {
+        _tsearch_trigramindex_trigram *trigramPtr = _tsearch_trigramindex_get_trigram(ptr,
+                                                        _tsearch_trigramindex_make_trigram(word.characters + i));
+        if (trigramPtr == NULL) { continue; }
+
+        uint32_t position = _tsearch_trigramindex_find_term(trigramPtr->terms, trigramPtr->termsCount, term);
+        if (position == trigramPtr->termsCount || trigramPtr->terms[position] != term) { continue; }
+        memmove(trigramPtr->terms + position, trigramPtr->terms + position + 1,
+                (trigramPtr->termsCount - position - 1) * sizeof(uint32_t));
+        trigramPtr->termsCount -= 1;
+    }
+
+    free(word.characters);
+    ptr->words[term] = (_tsearch_trigramindex_word){NULL, 0};
+}
+
+
+uint32_t * tsearch_trigramindex_copy_matching_terms(const tsearch_trigramindex_ptr ptr, const char *target,
+                                                    const size_t length, size_t *outCount)
+{
+    if (outCount != NULL) { *outCount = 0; }
+    if (ptr == NULL || target == NULL || length == 0 || outCount == NULL) { return NULL; }
+    if (length < TRIGRAM_LENGTH) { return _tsearch_trigramindex_copy_all_matching_terms(ptr, target, length, outCount); }
+
+    // Every word containing the target contains all of its trigrams, so the candidates are the
+    // terms of the target's rarest trigram that all of its other trigrams also have.
+    _tsearch_trigramindex_trigram *rarestPtr = NULL;
+    for (size_t i = 0; i + TRIGRAM_LENGTH <= length; i++) {
+        _tsearch_trigramindex_trigram *trigramPtr = _tsearch_trigramindex_get_trigram(ptr,
+                                                        _tsearch_trigramindex_make_trigram(target + i));
+        if (trigramPtr == NULL || trigramPtr->termsCount == 0) { return NULL; }
+        if (rarestPtr == NULL || trigramPtr->termsCount < rarestPtr->termsCount) { rarestPtr = trigramPtr; }
+    }
+
+    uint32_t *terms = malloc(rarestPtr->termsCount * sizeof(uint32_t));
+    if (terms == NULL) { return NULL; }
+    memcpy(terms, rarestPtr->terms, rarestPtr->termsCount * sizeof(uint32_t));
+    size_t count = rarestPtr->termsCount;
+
+    for (size_t i = 0; i + TRIGRAM_LENGTH <= length && count > 0; i++) {
+        _tsearch_trigramindex_trigram *trigramPtr = _tsearch_trigramindex_get_trigram(ptr,
+                                                        _tsearch_trigramindex_make_trigram(target + i));
+        if (trigramPtr == rarestPtr) { continue; }
+
+        size_t intersectionCount = 0;
+        for (size_t j = 0; j < count; j++) {
+            uint32_t position = _tsearch_trigramindex_find_term(trigramPtr->terms, trigramPtr->termsCount, terms[j]);
+            if (position < trigramPtr->termsCount && trigramPtr->terms[position] == terms[j]) {
+                terms[intersectionCount] = terms[j];
+                intersectionCount += 1;
+            }
+        }
+        count = intersectionCount;
+    }
+
+    // Having all of the target's trigrams doesn't mean having them in the target's order.
+    size_t matchesCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (_tsearch_trigramindex_word_contains(&(ptr->words[terms[i]]), target, length) == true) {
+            terms[matchesCount] = terms[i];
+            matchesCount += 1;
+        }
+    }
+
+    if (matchesCount == 0) { free(terms); return NULL; }
+    *outCount = matchesCount;
+    return terms;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Returns the slot containing the trigram or, if the trigram isn't in the index, the empty slot
+/// where it belongs.
+size_t _tsearch_trigramindex_find_slot(const tsearch_trigramindex_ptr ptr, const uint32_t trigram)
+{
+    return _tsearch_hashtable_find_slot(&_tsearch_trigramindex_trigrams_type, ptr->trigrams, ptr->trigramsCapacity,
+                                        _tsearch_hash_uint32(trigram), &trigram);
+}
+
+
+_tsearch_trigramindex_trigram * _tsearch_trigramindex_get_trigram(const tsearch_trigramindex_ptr ptr,
+                                                                  const uint32_t trigram)
+{
+    _tsearch_trigramindex_trigram *trigramPtr = &(ptr->trigrams[_tsearch_trigramindex_find_slot(ptr, trigram)]);
+    return (trigramPtr->terms == NULL) ? NULL : trigramPtr;
+}
+
+
+result _tsearch_trigramindex_grow_trigrams(const tsearch_trigramindex_ptr ptr)
+{
+    _tsearch_trigramindex_trigram *trigrams = _tsearch_hashtable_copy_grown(&_tsearch_trigramindex_trigrams_type,
+                                                                            ptr->trigrams, ptr->trigramsCapacity);
+    if (trigrams == NULL) { return failure; }
+
+    free(ptr->trigrams);
+    ptr->trigrams = trigrams;
+    ptr->trigramsCapacity *= 2;
+
+    return success;
+}
+
+
+/// Grows the words so that the term fits.
+result _tsearch_trigramindex_grow_words(const tsearch_trigramindex_ptr ptr, const uint32_t term)
+{
+    size_t capacity = ptr->wordsCapacity;
+    while (capacity <= term) {
+        size_t previousCapacity = capacity;
+        _tsearch_next_buf_len(&capacity, sizeof(_tsearch_trigramindex_word));
+        if (capacity == previousCapacity) { return failure; }
+    }
+
+    _tsearch_trigramindex_word *words = realloc(ptr->words, capacity * sizeof(_tsearch_trigramindex_word));
+    if (words == NULL) { return failure; }
+    memset(words + ptr->wordsCapacity, 0, (capacity - ptr->wordsCapacity) * sizeof(_tsearch_trigramindex_word));
+    ptr->words = words;
+    ptr->wordsCapacity = capacity;
+
+    return success;
+}
+
+
+/// Inserts the term into the trigram's sorted terms, adding the trigram if it's new. Does
+/// nothing if the trigram already has the term, which happens when a word repeats a trigram.
+result _tsearch_trigramindex_trigram_add_term(const tsearch_trigramindex_ptr ptr, const uint32_t trigram,
+                                              const uint32_t term)
+{
+    size_t slot = _tsearch_trigramindex_find_slot(ptr, trigram);
+    if (ptr->trigrams[slot].terms == NULL) {
+        if ((ptr->trigramsCount + 1) * 100 > ptr->trigramsCapacity * TRIGRAMS_MAX_LOAD_PERCENTAGE) {
+            if (_tsearch_trigramindex_grow_trigrams(ptr) == failure) { return failure; }
+            slot = _tsearch_trigramindex_find_slot(ptr, trigram);
+        }
+
+        uint32_t *terms = malloc(TERMS_INITIAL_CAPACITY * sizeof(uint32_t));
+        if (terms == NULL) { return failure; }
+
+        ptr->trigrams[slot] = (_tsearch_trigramindex_trigram){trigram, terms, 0, TERMS_INITIAL_CAPACITY};
+        ptr->trigramsCount += 1;
+    }
+
+    _tsearch_trigramindex_trigram *trigramPtr = &(ptr->trigrams[slot]);
+    uint32_t position = _tsearch_trigramindex_find_term(trigramPtr->terms, trigramPtr->termsCount, term);
+    if (position < trigramPtr->termsCount && trigramPtr->terms[position] == term) { return success; }
+
+    if (trigramPtr->termsCount == trigramPtr->termsCapacity) {
+        size_t capacity = trigramPtr->termsCapacity;
+        size_t size = _tsearch_next_buf_len(&capacity, sizeof(uint32_t));
+        if (capacity == trigramPtr->termsCapacity || capacity > UINT32_MAX) { return failure; }
+        uint32_t *terms = realloc(trigramPtr->terms, size);
+        if (terms == NULL) { return failure; }
+        trigramPtr->terms = terms;
+        trigramPtr->termsCapacity = (uint32_t)capacity;
+    }
+
+    // New terms are usually larger than all of the others, so this rarely moves anything.
+    memmove(trigramPtr->terms + position + 1, trigramPtr->terms + position,
+            (trigramPtr->termsCount - position) * sizeof(uint32_t));
+    trigramPtr->terms[position] = term;
+    trigramPtr->termsCount += 1;
+    return success;
+}
+
+
+/// Compares the target with every word, for targets too short to have a trigram.
+uint32_t * _tsearch_trigramindex_copy_all_matching_terms(const tsearch_trigramindex_ptr ptr, const char *target,
+                                                         const size_t length, size_t *outCount)
+{
+    uint32_t *terms = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+    for (size_t term = 0; term < ptr->wordsCapacity; term++) {
+        if (_tsearch_trigramindex_word_contains(&(ptr->words[term]), target, length) == false) { continue; }
+
+        if (count == capacity) {
+            size_t nextCapacity = (capacity == 0) ? 16 : capacity;
+            size_t size = (capacity == 0) ? nextCapacity * sizeof(uint32_t) :
+                          _tsearch_next_buf_len(&nextCapacity, sizeof(uint32_t));
+            uint32_t *nextTerms = (nextCapacity == capacity) ? NULL : realloc(terms, size);
+            if (nextTerms == NULL) { free(terms); return NULL; }
+            terms = nextTerms;
+            capacity = nextCapacity;
+        }
+        terms[count] = (uint32_t)term;
+        count += 1;
+    }
+
+    *outCount = count;
+    return terms;
+}
+
+
+/// Returns the position of the first of the sorted terms that isn't smaller than the term.
+uint32_t _tsearch_trigramindex_find_term(const uint32_t *terms, const uint32_t count, const uint32_t term)
+{
+    uint32_t low = 0, high = count;
+    while (low < high) {
+        uint32_t middle = low + ((high - low) / 2);
+        if (terms[middle] < term) { low = middle + 1; } else { high = middle; }
+    }
+    return low;
+}
+
+
+bool _tsearch_trigramindex_word_contains(const _tsearch_trigramindex_word *wordPtr, const char *target,
+                                         const size_t length)
+{
+    if (wordPtr->characters == NULL || wordPtr->length < length) { return false; }
+
+    const char *characters = wordPtr->characters;
+    const char *last = characters + (wordPtr->length - length);
+    while (characters <= last) {
+        characters = memchr(characters, target[0], (size_t)(last - characters) + 1);
+        if (characters == NULL) { return false; }
+        if (memcmp(characters, target, length) == 0) { return true; }
+        characters += 1;
+    }
+    return false;
+}
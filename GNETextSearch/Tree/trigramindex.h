@@ -0,0 +1,45 @@
+//
+//  trigramindex.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_trigramindex_h
+#define tsearch_trigramindex_h
+
+#include "GNETextSearchPublic.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maps each three-byte sequence (trigram) to the terms (the indexes of the words in a ternary
+// tree) whose words contain it, so that the words containing a target can be found by
+// intersecting the target's trigrams' terms instead of visiting every word. The terms of each
+// trigram are kept sorted, and a copy of each term's word is kept to verify the candidates.
+
+typedef struct tsearch_trigramindex * tsearch_trigramindex_ptr;
+
+tsearch_trigramindex_ptr tsearch_trigramindex_init(void);
+void tsearch_trigramindex_free(const tsearch_trigramindex_ptr ptr);
+
+/// Adds the term's word to the index. The term must not already be in the index.
+result tsearch_trigramindex_add_term(const tsearch_trigramindex_ptr ptr, const uint32_t term,
+                                     const char *word, const size_t length);
+
+/// Removes the term and its word from the index. Does nothing if the term isn't in the index.
+void tsearch_trigramindex_remove_term(const tsearch_trigramindex_ptr ptr, const uint32_t term);
+
+/// Returns the sorted terms whose words contain the target, which the caller is responsible for
+/// freeing, or NULL if there aren't any or on failure. Targets shorter than a trigram are compared
+/// with every word.
+uint32_t * tsearch_trigramindex_copy_matching_terms(const tsearch_trigramindex_ptr ptr, const char *target,
+                                                    const size_t length, size_t *outCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_trigramindex_h */
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+#  generate_normalize.py
+#  GNETextSearch
+#
+#  Created by Anthony Drendel on 10/17/26.
+#  Copyright © 2026 Gone East LLC. All rights reserved.
+#
+#  Generates normalize_data.c, the simple case folding, normalization quick check, decomposition,
+#  and composition tables used by the tokenizer's normalized mode, from the files of the Unicode
+#  Character Database:
+#
+#      generate_normalize.py <UCD directory> <Unicode version> > normalize_data.c
+#
+#  The directory must contain UnicodeData.txt, CaseFolding.txt, and DerivedNormalizationProps.txt.
+#
+
+import os
+import re
+import sys
+
+# Must match the TSEARCH_NORMALIZE_* flags in normalize.h.
+COMBINING_CLASS_MASK = 0xFF
+NFC_QUICK_CHECK_NO = 0x100
+NFKC_QUICK_CHECK_NO = 0x200
+CANONICAL_DECOMPOSITION = 0x400
+COMPATIBILITY_DECOMPOSITION = 0x800
+
+# Must match TSEARCH_NORMALIZE_BLOCK_SHIFT in normalize.h.
+BLOCK_SHIFT = 7
+CODE_POINT_COUNT = 0x110000
+
+# The Hangul syllables are decomposed and composed algorithmically.
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+
+def read_lines(directory, name):
+    """Yields the fields of each line of a UCD file without its comment."""
+    with open(os.path.join(directory, name), encoding='utf-8') as f:
+        for line in f:
+            line = line.split('#', 1)[0].strip()
+            if line:
+                yield [field.strip() for field in line.split(';')]
+
+
+def read_range(field):
+    first, _, last = field.partition('..')
+    return int(first, 16), int(last or first, 16)
+
+
+def read_unicode_data(directory):
+    combiningClasses = {}
+    decompositions = {}
+    for fields in read_lines(directory, 'UnicodeData.txt'):
+        codePoint = int(fields[0], 16)
+        if HANGUL_FIRST <= codePoint <= HANGUL_LAST:
+            continue
+        if int(fields[3]) != 0:
+            combiningClasses[codePoint] = int(fields[3])
+        if fields[5]:
+            mapping = fields[5].split()
+            isCompatibility = mapping[0].startswith('<')
+            if isCompatibility:
+                mapping = mapping[1:]
+            decompositions[codePoint] = (isCompatibility, [int(value, 16) for value in mapping])
+    return combiningClasses, decompositions
+
+
+def read_case_folding(directory):
+    folding = {}
+    for fields in read_lines(directory, 'CaseFolding.txt'):
+        # C and S are the simple case foldings. F and T are full and Turkic foldings.
+        if fields[1] in ('C', 'S'):
+            folding[int(fields[0], 16)] = int(fields[2], 16)
+    return folding
+
+
+def read_normalization_props(directory):
+    quickCheckNo = {'NFC_QC': set(), 'NFKC_QC': set()}
+    exclusions = set()
+    for fields in read_lines(directory, 'DerivedNormalizationProps.txt'):
+        first, last = read_range(fields[0])
+        if fields[1] in quickCheckNo and fields[2] in ('N', 'M'):
+            quickCheckNo[fields[1]].update(range(first, last + 1))
+        elif fields[1] == 'Full_Composition_Exclusion':
+            exclusions.update(range(first, last + 1))
+    return quickCheckNo['NFC_QC'], quickCheckNo['NFKC_QC'], exclusions
+
+
+def build_stages(values, blockLength):
+    stage1 = []
+    stage2 = []
+    blockIndexes = {}
+    for start in range(0, len(values), blockLength):
+        block = tuple(values[start:start + blockLength])
+        if block not in blockIndexes:
+            blockIndexes[block] = len(blockIndexes)
+            stage2.extend(block)
+        stage1.append(blockIndexes[block])
+    assert len(blockIndexes) <= 256, 'Block indexes must fit in a uint8_t.'
+    return stage1, stage2
+
+
+def format_table(values, perLine=32):
+    lines = []
+    for start in range(0, len(values), perLine):
+        row = ','.join('%d' % value for value in values[start:start + perLine])
+        lines.append('    %s,' % row)
+    return '\n'.join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: generate_normalize.py <UCD directory> <Unicode version> > normalize_data.c')
+    directory, version = sys.argv[1], sys.argv[2]
+    combiningClasses, decompositions = read_unicode_data(directory)
+    folding = read_case_folding(directory)
+    nfcQuickCheckNo, nfkcQuickCheckNo, exclusions = read_normalization_props(directory)
+
+    properties = [0] * CODE_POINT_COUNT
+    for codePoint, combiningClass in combiningClasses.items():
+        properties[codePoint] |= combiningClass
+    for codePoint in nfcQuickCheckNo:
+        properties[codePoint] |= NFC_QUICK_CHECK_NO
+    for codePoint in nfkcQuickCheckNo:
+        properties[codePoint] |= NFKC_QUICK_CHECK_NO
+    for codePoint, (isCompatibility, _) in decompositions.items():
+        properties[codePoint] |= COMPATIBILITY_DECOMPOSITION if isCompatibility else CANONICAL_DECOMPOSITION
+    propertyIndexes, propertyBlocks = build_stages(properties, 1 << BLOCK_SHIFT)
+
+    deltas = [0] * CODE_POINT_COUNT
+    for codePoint, folded in folding.items():
+        deltas[codePoint] = folded - codePoint
+    foldIndexes, foldBlocks = build_stages(deltas, 1 << BLOCK_SHIFT)
+
+    # Each decomposition is one level of the mapping, which is applied recursively.
+    decompositionEntries = []
+    mappings = []
+    for codePoint in sorted(decompositions):
+        isCompatibility, mapping = decompositions[codePoint]
+        decompositionEntries.append('    {%d,%d,%d,%d},' % (codePoint, len(mappings), len(mapping),
+                                                           1 if isCompatibility else 0))
+        mappings.extend(mapping)
+    assert len(mappings) < 0x10000, 'Mapping offsets must fit in a uint16_t.'
+
+    # The primary composites are the canonical pairs that aren't excluded from composition.
+    compositions = []
+    for codePoint, (isCompatibility, mapping) in decompositions.items():
+        if isCompatibility is False and len(mapping) == 2 and codePoint not in exclusions:
+            compositions.append((mapping[0], mapping[1], codePoint))
+    compositionEntries = ['    {%d,%d,%d},' % composition for composition in sorted(compositions)]
+
+    print('''//
+//  normalize_data.c
+//  GNETextSearch
+//
+//  Generated by generate_normalize.py from the Unicode Character Database %s. Don't edit.
+//
+
+#include "normalize.h"
+
+
+// The index of each block of %d code points' properties in tsearch_normalize_property_blocks.
+const uint8_t tsearch_normalize_property_block_indexes[%d] =
+{
+%s
+};
+
+
+// The distinct blocks of properties.
+const uint16_t tsearch_normalize_property_blocks[%d] =
+{
+%s
+};
+
+
+// The index of each block of %d code points' case folding deltas in tsearch_normalize_fold_blocks.
+const uint8_t tsearch_normalize_fold_block_indexes[%d] =
+{
+%s
+};
+
+
+// The distinct blocks of the differences between the code points and their simple case foldings.
+const int32_t tsearch_normalize_fold_blocks[%d] =
+{
+%s
+};
+
+
+const tsearch_normalize_decomposition tsearch_normalize_decompositions[%d] =
+{
+%s
+};
+const size_t tsearch_normalize_decomposition_count = %d;
+
+
+const uint32_t tsearch_normalize_decomposition_mappings[%d] =
+{
+%s
+};
+
+
+const tsearch_normalize_composition tsearch_normalize_compositions[%d] =
+{
+%s
+};
+const size_t tsearch_normalize_composition_count = %d;''' % (version,
+         1 << BLOCK_SHIFT, len(propertyIndexes), format_table(propertyIndexes),
+         len(propertyBlocks), format_table(propertyBlocks, 16),
+         1 << BLOCK_SHIFT, len(foldIndexes), format_table(foldIndexes),
+         len(foldBlocks), format_table(foldBlocks, 16),
+         len(decompositionEntries), '\n'.join(decompositionEntries), len(decompositionEntries),
+         len(mappings), format_table(mappings, 16),
+         len(compositionEntries), '\n'.join(compositionEntries), len(compositionEntries)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+#
+#  generate_wordbreak.py
+#  GNETextSearch
+#
+#  Created by Anthony Drendel on 10/17/26.
+#  Copyright © 2026 Gone East LLC. All rights reserved.
+#
+#  Generates wordbreak.c, the two-stage lookup tables of the Unicode word break properties used by
+#  the tokenizer, from the files of the Unicode Character Database:
+#
+#      generate_wordbreak.py <UCD directory> <Unicode version> > wordbreak.c
+#
+#  The directory must contain WordBreakProperty.txt (from auxiliary/), emoji-data.txt (from emoji/),
+#  PropList.txt, Scripts.txt, and LineBreak.txt.
+#
+
+import os
+import re
+import sys
+
+# Must match the order of tsearch_wordbreak_property in wordbreak.h.
+PROPERTIES = [
+    'Other', 'CR', 'LF', 'Newline', 'Extend', 'ZWJ', 'Regional_Indicator', 'Format', 'Katakana',
+    'Hebrew_Letter', 'ALetter', 'Single_Quote', 'Double_Quote', 'MidNumLet', 'MidLetter', 'MidNum',
+    'Numeric', 'ExtendNumLet', 'WSegSpace', 'Spaceless',
+]
+EXTENDED_PICTOGRAPHIC = 0x20
+
+# Must match TSEARCH_WORDBREAK_BLOCK_SHIFT in wordbreak.h.
+BLOCK_SHIFT = 7
+CODE_POINT_COUNT = 0x110000
+
+
+def read_ranges(directory, name):
+    """Yields the first code point, last code point, and value of each line of a UCD file."""
+    pattern = re.compile(r'^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*([^#\s]+)')
+    with open(os.path.join(directory, name), encoding='utf-8') as f:
+        for line in f:
+            match = pattern.match(line)
+            if match is None:
+                continue
+            first = int(match.group(1), 16)
+            last = int(match.group(2), 16) if match.group(2) else first
+            yield first, last, match.group(3)
+
+
+def build_properties(directory):
+    properties = [PROPERTIES.index('Other')] * CODE_POINT_COUNT
+    for first, last, value in read_ranges(directory, 'WordBreakProperty.txt'):
+        for codePoint in range(first, last + 1):
+            properties[codePoint] = PROPERTIES.index(value)
+
+    # Ideographs, Hiragana, and the letters of the scripts written without spaces between words
+    # (Line_Break=SA) are Other, which would make each of them a word of its own. Without the
+    # dictionaries needed to find the words in them, the tokenizer keeps runs of them together.
+    spaceless = set()
+    for first, last, value in read_ranges(directory, 'PropList.txt'):
+        if value == 'Ideographic':
+            spaceless.update(range(first, last + 1))
+    for first, last, value in read_ranges(directory, 'Scripts.txt'):
+        if value == 'Hiragana':
+            spaceless.update(range(first, last + 1))
+    for first, last, value in read_ranges(directory, 'LineBreak.txt'):
+        if value == 'SA':
+            spaceless.update(range(first, last + 1))
+    for codePoint in spaceless:
+        if properties[codePoint] == PROPERTIES.index('Other'):
+            properties[codePoint] = PROPERTIES.index('Spaceless')
+
+    for first, last, value in read_ranges(directory, 'emoji-data.txt'):
+        if value == 'Extended_Pictographic':
+            for codePoint in range(first, last + 1):
+                properties[codePoint] |= EXTENDED_PICTOGRAPHIC
+
+    return properties
+
+
+def build_stages(properties):
+    blockLength = 1 << BLOCK_SHIFT
+    stage1 = []
+    stage2 = []
+    blockIndexes = {}
+    for start in range(0, CODE_POINT_COUNT, blockLength):
+        block = tuple(properties[start:start + blockLength])
+        if block not in blockIndexes:
+            blockIndexes[block] = len(blockIndexes)
+            stage2.extend(block)
+        stage1.append(blockIndexes[block])
+    assert len(blockIndexes) <= 256, 'Block indexes must fit in a uint8_t.'
+    return stage1, stage2
+
+
+def format_table(values):
+    lines = []
+    for start in range(0, len(values), 32):
+        row = ','.join('%d' % value for value in values[start:start + 32])
+        lines.append('    %s,' % row)
+    return '\n'.join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: generate_wordbreak.py <UCD directory> <Unicode version> > wordbreak.c')
+    directory, version = sys.argv[1], sys.argv[2]
+    stage1, stage2 = build_stages(build_properties(directory))
+
+    print('''//
+//  wordbreak.c
+//  GNETextSearch
+//
+//  Generated by generate_wordbreak.py from the Unicode Character Database %s. Don't edit.
+//
+
+#include "wordbreak.h"
+
+
+// The index of each block of %d code points' properties in tsearch_wordbreak_blocks.
+const uint8_t tsearch_wordbreak_block_indexes[%d] =
+{
+%s
+};
+
+
+// The distinct blocks of properties.
+const uint8_t tsearch_wordbreak_blocks[%d] =
+{
+%s
+};''' % (version, 1 << BLOCK_SHIFT, len(stage1), format_table(stage1), len(stage2), format_table(stage2)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,236 @@
+//
+//  normalize.c
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#include "normalize.h"
+#include "GNETextSearchPrivate.h"
+
+// The Hangul syllables are decomposed and composed algorithmically, as described in section 3.12
+// of the Unicode Standard.
+#define HANGUL_S_BASE 0xAC00
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_T_BASE 0x11A7
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+#define NO_COMPOSITE 0
+#define MIN_BUFFER_LENGTH 16
+
+// ------------------------------------------------------------------------------------------
+
+result _tsearch_normalize_decompose(const uint32_t codePoint, const bool isCompatibility,
+                                    uint32_t **outCodePoints, size_t *capacity, size_t *length);
+result _tsearch_normalize_append(const uint32_t codePoint, uint32_t **outCodePoints, size_t *capacity,
+                                 size_t *length);
+void _tsearch_normalize_reorder(uint32_t *codePoints, const size_t length);
+size_t _tsearch_normalize_compose(uint32_t *codePoints, const size_t length);
+const tsearch_normalize_decomposition * _tsearch_normalize_find_decomposition(const uint32_t codePoint);
+uint32_t _tsearch_normalize_find_composite(const uint32_t first, const uint32_t second);
+
+// ------------------------------------------------------------------------------------------
+
+
+TSEARCH_INLINE uint8_t _tsearch_normalize_get_combining_class(const uint32_t codePoint)
+{
+    return (uint8_t)(tsearch_normalize_get_properties(codePoint) & TSEARCH_NORMALIZE_COMBINING_CLASS_MASK);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Normalize
+// ------------------------------------------------------------------------------------------
+result tsearch_normalize_code_points(const uint32_t *codePoints, const size_t length,
+                                     const tsearch_normalize_options options, uint32_t **outCodePoints,
+                                     size_t *outCapacity, size_t *outLength)
+{
+    if (codePoints == NULL || outCodePoints == NULL || outCapacity == NULL || outLength == NULL) { return failure; }
+
+    const bool isComposing = ((options & (tsearch_normalize_nfc | tsearch_normalize_nfkc)) != 0);
+    const bool isCompatibility = ((options & tsearch_normalize_nfkc) != 0);
+
+    size_t count = 0;
+    for (size_t i = 0; i < length; i++) {
+        result ret = (isComposing == true) ?
+            _tsearch_normalize_decompose(codePoints[i], isCompatibility, outCodePoints, outCapacity, &count) :
+            _tsearch_normalize_append(codePoints[i], outCodePoints, outCapacity, &count);
+        if (ret == failure) { return failure; }
+    }
+
+    if (isComposing == true) {
+        _tsearch_normalize_reorder(*outCodePoints, count);
+        count = _tsearch_normalize_compose(*outCodePoints, count);
+    }
+    if ((options & tsearch_normalize_fold_case) != 0) {
+        uint32_t *normalized = *outCodePoints;
+        for (size_t i = 0; i < count; i++) { normalized[i] = tsearch_normalize_get_case_folding(normalized[i]); }
+    }
+
+    *outLength = count;
+    return success;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+/// Appends the full decomposition of the code point, which is found by decomposing each code
+/// point of its decomposition until none of them can be decomposed any further.
+result _tsearch_normalize_decompose(const uint32_t codePoint, const bool isCompatibility,
+                                    uint32_t **outCodePoints, size_t *capacity, size_t *length)
+{
+    if (codePoint >= HANGUL_S_BASE && codePoint < HANGUL_S_BASE + HANGUL_S_COUNT) {
+        const uint32_t index = codePoint - HANGUL_S_BASE;
+        const uint32_t trailing = index % HANGUL_T_COUNT;
+        const uint32_t leading = HANGUL_L_BASE + index / HANGUL_N_COUNT;
+        const uint32_t vowel = HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+        if (_tsearch_normalize_append(leading, outCodePoints, capacity, length) == failure ||
+            _tsearch_normalize_append(vowel, outCodePoints, capacity, length) == failure)
+        {
+            return failure;
+        }
+        if (trailing == 0) { return success; }
+        return _tsearch_normalize_append(HANGUL_T_BASE + trailing, outCodePoints, capacity, length);
+    }
+
+    uint16_t flags = TSEARCH_NORMALIZE_CANONICAL_DECOMPOSITION;
+    if (isCompatibility == true) { flags |= TSEARCH_NORMALIZE_COMPATIBILITY_DECOMPOSITION; }
+    const tsearch_normalize_decomposition *decomposition = NULL;
+    if ((tsearch_normalize_get_properties(codePoint) & flags) != 0) {
+        decomposition = _tsearch_normalize_find_decomposition(codePoint);
+    }
+    if (decomposition == NULL) { return _tsearch_normalize_append(codePoint, outCodePoints, capacity, length); }
+
+    const uint32_t *mapping = tsearch_normalize_decomposition_mappings + decomposition->offset;
+    for (size_t i = 0; i < decomposition->length; i++) {
+        if (_tsearch_normalize_decompose(mapping[i], isCompatibility, outCodePoints, capacity, length) == failure) {
+            return failure;
+        }
+    }
+    return success;
+}
+
+
+result _tsearch_normalize_append(const uint32_t codePoint, uint32_t **outCodePoints, size_t *capacity,
+                                 size_t *length)
+{
+    if (*outCodePoints == NULL || *length == *capacity) {
+        size_t newCapacity = MIN_BUFFER_LENGTH;
+        size_t bufferLength = newCapacity * sizeof(uint32_t);
+        if (*outCodePoints != NULL && *capacity >= MIN_BUFFER_LENGTH) {
+            newCapacity = *capacity;
+            bufferLength = _tsearch_next_buf_len(&newCapacity, sizeof(uint32_t));
+            if (newCapacity == *capacity) { return failure; }
+        }
+        uint32_t *codePoints = realloc(*outCodePoints, bufferLength);
+        if (codePoints == NULL) { return failure; }
+        *outCodePoints = codePoints;
+        *capacity = newCapacity;
+    }
+    (*outCodePoints)[*length] = codePoint;
+    *length += 1;
+    return success;
+}
+
+
+/// Puts the code points in canonical order, which sorts each run of non-starters by their
+/// canonical combining classes without changing the order of those with the same class.
+void _tsearch_normalize_reorder(uint32_t *codePoints, const size_t length)
+{
+    for (size_t i = 1; i < length; i++) {
+        const uint32_t codePoint = codePoints[i];
+        const uint8_t combiningClass = _tsearch_normalize_get_combining_class(codePoint);
+        if (combiningClass == 0) { continue; }
+
+        // Starters have a combining class of 0, so this never moves a code point past a starter.
+        size_t j = i;
+        while (j > 0 && _tsearch_normalize_get_combining_class(codePoints[j - 1]) > combiningClass) {
+            codePoints[j] = codePoints[j - 1];
+            j--;
+        }
+        codePoints[j] = codePoint;
+    }
+}
+
+
+/// Composes the canonically ordered code points in place and returns their new length. Each code
+/// point is combined with the last starter before it, unless another code point between them has
+/// the same or a higher combining class, which blocks it.
+size_t _tsearch_normalize_compose(uint32_t *codePoints, const size_t length)
+{
+    if (length == 0) { return 0; }
+
+    size_t starterIndex = 0;
+    // A combining class of 256 blocks the code points after a leading non-starter from composing.
+    uint32_t lastCombiningClass = _tsearch_normalize_get_combining_class(codePoints[0]);
+    if (lastCombiningClass != 0) { lastCombiningClass = 256; }
+
+    size_t count = 1;
+    for (size_t i = 1; i < length; i++) {
+        const uint32_t codePoint = codePoints[i];
+        const uint32_t combiningClass = _tsearch_normalize_get_combining_class(codePoint);
+        const uint32_t composite = _tsearch_normalize_find_composite(codePoints[starterIndex], codePoint);
+        if (composite != NO_COMPOSITE && (lastCombiningClass < combiningClass || lastCombiningClass == 0)) {
+            codePoints[starterIndex] = composite;
+            continue;
+        }
+        if (combiningClass == 0) { starterIndex = count; }
+        lastCombiningClass = combiningClass;
+        codePoints[count] = codePoint;
+        count++;
+    }
+    return count;
+}
+
+
+const tsearch_normalize_decomposition * _tsearch_normalize_find_decomposition(const uint32_t codePoint)
+{
+    size_t low = 0;
+    size_t high = tsearch_normalize_decomposition_count;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        const tsearch_normalize_decomposition *decomposition = &(tsearch_normalize_decompositions[middle]);
+        if (decomposition->codePoint == codePoint) { return decomposition; }
+        if (decomposition->codePoint < codePoint) { low = middle + 1; }
+        else { high = middle; }
+    }
+    return NULL;
+}
+
+
+/// Returns the primary composite of the two code points, or NO_COMPOSITE if they don't have one.
+uint32_t _tsearch_normalize_find_composite(const uint32_t first, const uint32_t second)
+{
+    if (first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT &&
+        second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT)
+    {
+        const uint32_t index = (first - HANGUL_L_BASE) * HANGUL_N_COUNT + (second - HANGUL_V_BASE) * HANGUL_T_COUNT;
+        return HANGUL_S_BASE + index;
+    }
+    if (first >= HANGUL_S_BASE && first < HANGUL_S_BASE + HANGUL_S_COUNT &&
+        ((first - HANGUL_S_BASE) % HANGUL_T_COUNT) == 0 &&
+        second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT)
+    {
+        return first + (second - HANGUL_T_BASE);
+    }
+
+    const uint64_t key = ((uint64_t)first << 32) | second;
+    size_t low = 0;
+    size_t high = tsearch_normalize_composition_count;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        const tsearch_normalize_composition *composition = &(tsearch_normalize_compositions[middle]);
+        const uint64_t middleKey = ((uint64_t)composition->first << 32) | composition->second;
+        if (middleKey == key) { return composition->composite; }
+        if (middleKey < key) { low = middle + 1; }
+        else { high = middle; }
+    }
+    return NO_COMPOSITE;
+}
@@ -0,0 +1,121 @@
+//
+//  normalize.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_normalize_h
+#define tsearch_normalize_h
+
+#include "GNETextSearchPublic.h"
+
+#ifndef TSEARCH_INLINE
+    #if defined(_MSC_VER) && !defined(__cplusplus)
+        #define TSEARCH_INLINE __inline
+    #else
+        #define TSEARCH_INLINE static inline
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Unicode simple case folding and the normalization forms of Unicode Standard Annex #15
+// (http://www.unicode.org/reports/tr15/). The tables are generated by generate_normalize.py,
+// which must be run again to update them for a new version of Unicode.
+
+/// The stages applied to text by tsearch_normalize_code_points() and the tokenizer's normalized
+/// mode, which can be combined.
+typedef enum
+{
+    /// Folds the case of each code point with its simple case folding from CaseFolding.txt.
+    tsearch_normalize_fold_case = 1 << 0,
+    /// Normalizes the text to Normalization Form C, which composes canonically equivalent
+    /// sequences, like "e" followed by a combining acute accent, into the same code points.
+    tsearch_normalize_nfc = 1 << 1,
+    /// Normalizes the text to Normalization Form KC, which also replaces compatibility characters,
+    /// like ligatures and full-width letters, with their ordinary equivalents. Takes precedence
+    /// over tsearch_normalize_nfc.
+    tsearch_normalize_nfkc = 1 << 2,
+} tsearch_normalize_options;
+
+/// The canonical combining class is in the low byte of a code point's properties.
+#define TSEARCH_NORMALIZE_COMBINING_CLASS_MASK 0xFF
+/// Set if the code point's NFC_Quick_Check or NFKC_Quick_Check is No or Maybe, so that text
+/// containing it may not be normalized.
+#define TSEARCH_NORMALIZE_NFC_QUICK_CHECK_NO 0x100
+#define TSEARCH_NORMALIZE_NFKC_QUICK_CHECK_NO 0x200
+/// Set if the code point has a canonical or compatibility decomposition.
+#define TSEARCH_NORMALIZE_CANONICAL_DECOMPOSITION 0x400
+#define TSEARCH_NORMALIZE_COMPATIBILITY_DECOMPOSITION 0x800
+
+/// Code points are looked up in blocks of 1 << TSEARCH_NORMALIZE_BLOCK_SHIFT, which must match
+/// BLOCK_SHIFT in generate_normalize.py.
+#define TSEARCH_NORMALIZE_BLOCK_SHIFT 7
+#define TSEARCH_NORMALIZE_MAX_CODE_POINT 0x10FFFF
+
+/// One level of a code point's decomposition, which is the length code points starting at offset
+/// in tsearch_normalize_decomposition_mappings.
+typedef struct tsearch_normalize_decomposition
+{
+    uint32_t codePoint;
+    uint16_t offset;
+    uint8_t length;
+    uint8_t isCompatibility;
+} tsearch_normalize_decomposition;
+
+/// A pair of code points and the primary composite they are composed into.
+typedef struct tsearch_normalize_composition
+{
+    uint32_t first;
+    uint32_t second;
+    uint32_t composite;
+} tsearch_normalize_composition;
+
+extern const uint8_t tsearch_normalize_property_block_indexes[];
+extern const uint16_t tsearch_normalize_property_blocks[];
+extern const uint8_t tsearch_normalize_fold_block_indexes[];
+extern const int32_t tsearch_normalize_fold_blocks[];
+/// Sorted by code point.
+extern const tsearch_normalize_decomposition tsearch_normalize_decompositions[];
+extern const size_t tsearch_normalize_decomposition_count;
+extern const uint32_t tsearch_normalize_decomposition_mappings[];
+/// Sorted by the first and then the second code point.
+extern const tsearch_normalize_composition tsearch_normalize_compositions[];
+extern const size_t tsearch_normalize_composition_count;
+
+/// Returns the code point's canonical combining class combined with the TSEARCH_NORMALIZE_* flags.
+TSEARCH_INLINE uint16_t tsearch_normalize_get_properties(const uint32_t codePoint)
+{
+    if (codePoint > TSEARCH_NORMALIZE_MAX_CODE_POINT) { return 0; }
+    const uint32_t blockIndex = tsearch_normalize_property_block_indexes[codePoint >> TSEARCH_NORMALIZE_BLOCK_SHIFT];
+    const uint32_t mask = (1 << TSEARCH_NORMALIZE_BLOCK_SHIFT) - 1;
+    return tsearch_normalize_property_blocks[(blockIndex << TSEARCH_NORMALIZE_BLOCK_SHIFT) | (codePoint & mask)];
+}
+
+/// Returns the code point's simple case folding, or the code point if it doesn't have one.
+TSEARCH_INLINE uint32_t tsearch_normalize_get_case_folding(const uint32_t codePoint)
+{
+    if (codePoint > TSEARCH_NORMALIZE_MAX_CODE_POINT) { return codePoint; }
+    const uint32_t blockIndex = tsearch_normalize_fold_block_indexes[codePoint >> TSEARCH_NORMALIZE_BLOCK_SHIFT];
+    const uint32_t mask = (1 << TSEARCH_NORMALIZE_BLOCK_SHIFT) - 1;
+    const uint32_t index = (blockIndex << TSEARCH_NORMALIZE_BLOCK_SHIFT) | (codePoint & mask);
+    return (uint32_t)((int32_t)codePoint + tsearch_normalize_fold_blocks[index]);
+}
+
+/// Normalizes the code points to the form in options, folding the case of the normalized code points
+/// if options contains tsearch_normalize_fold_case, and stores them in outCodePoints, which is grown
+/// with realloc() if it is shorter than the normalized code points. outCodePoints must be NULL or
+/// a buffer allocated with malloc() of outCapacity code points, which the caller must free.
+result tsearch_normalize_code_points(const uint32_t *codePoints, const size_t length,
+                                     const tsearch_normalize_options options, uint32_t **outCodePoints,
+                                     size_t *outCapacity, size_t *outLength);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_normalize_h */
@@ -0,0 +1,9371 @@
+//
+//  normalize_data.c
+//  GNETextSearch
+//
+//  Generated by generate_normalize.py from the Unicode Character Database 14.0.0. Don't edit.
+//
+
+#include "normalize.h"
+
+
+// The index of each block of 128 code points' properties in tsearch_normalize_property_blocks.
+const uint8_t tsearch_normalize_property_block_indexes[8704] =
+{
+    0,1,2,3,4,5,6,7,8,9,0,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,
+    31,32,33,34,0,0,35,0,0,0,0,0,0,0,36,37,0,38,39,0,40,41,42,43,44,45,46,47,48,49,50,51,
+    52,53,54,55,56,57,58,0,59,60,0,0,0,0,0,0,0,0,0,0,61,62,0,0,63,64,65,66,0,67,68,69,
+    70,71,72,73,74,68,68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,75,76,77,78,79,80,81,82,0,83,84,85,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,86,87,88,89,90,68,68,91,92,93,94,95,96,
+    0,0,0,97,0,98,99,0,0,0,0,0,0,0,0,100,0,0,0,0,101,102,0,0,0,0,103,0,0,104,105,106,
+    107,108,109,110,111,112,113,0,114,115,0,116,117,118,119,0,120,0,121,122,123,124,0,0,117,0,125,126,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,0,0,0,129,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,131,132,133,0,0,0,134,135,136,68,68,137,68,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    139,0,128,0,0,140,0,0,0,0,0,0,0,0,0,0,0,141,142,0,0,0,0,0,0,0,0,0,143,144,0,0,
+    0,0,145,146,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,86,86,86,149,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+
+// The distinct blocks of properties.
+const uint16_t tsearch_normalize_property_blocks[19200] =
+{
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,0,0,0,0,0,0,0,2560,0,2560,0,0,0,0,2560,
+    0,0,2560,2560,2560,2560,0,0,2560,2560,2560,0,2560,2560,2560,0,
+    1024,1024,1024,1024,1024,1024,0,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    0,1024,1024,1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,0,0,
+    1024,1024,1024,1024,1024,1024,0,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    0,1024,1024,1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,0,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    0,0,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,0,2560,2560,1024,1024,1024,1024,0,1024,1024,1024,1024,1024,1024,2560,
+    2560,0,0,1024,1024,1024,1024,1024,1024,2560,0,0,1024,1024,1024,1024,
+    1024,1024,0,0,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1024,1024,0,0,0,0,0,0,0,0,0,0,0,0,0,1024,
+    1024,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,0,1024,1024,
+    1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,2560,2560,2560,1024,1024,0,0,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,0,0,1024,1024,
+    0,0,0,0,0,0,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,2560,2560,2560,2560,2560,2560,0,0,
+    2560,2560,2560,2560,2560,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    998,998,998,998,998,230,998,998,998,998,998,998,998,230,230,998,
+    230,998,230,998,998,232,220,220,220,220,232,984,220,220,220,220,
+    220,202,202,988,988,988,988,970,970,220,220,220,220,988,988,220,
+    988,988,220,220,1,1,1,1,769,220,220,220,220,230,230,230,
+    2022,2022,998,2022,2022,1008,230,220,220,220,230,230,230,220,220,0,
+    230,230,230,220,220,220,220,230,232,220,220,230,233,234,234,233,
+    234,234,233,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    0,0,0,0,1792,0,0,0,0,0,2560,0,0,0,1792,0,
+    0,0,0,0,2560,1536,1024,1792,1024,1024,1024,0,1024,0,1024,1024,
+    1024,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1024,1024,1024,1024,1024,1024,
+    1024,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1024,1024,1024,1024,1024,0,
+    2560,2560,2560,1536,1536,2560,2560,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,0,2560,2560,0,0,0,2560,0,0,0,0,0,0,
+    1024,1024,0,1024,0,0,0,1024,0,0,0,0,1024,1024,1024,0,
+    0,0,0,0,0,0,0,0,0,1024,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1024,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1024,1024,0,1024,0,0,0,1024,0,0,0,0,1024,1024,1024,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1024,1024,0,0,0,0,0,0,0,0,
+    0,0,0,230,230,230,230,230,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1024,1024,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1024,1024,1024,1024,0,0,1024,1024,0,0,1024,1024,1024,1024,1024,1024,
+    0,0,1024,1024,1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,0,0,1024,1024,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,2560,0,0,0,0,0,0,0,0,
+    0,220,230,230,230,230,220,230,230,230,222,220,230,230,230,230,
+    230,230,220,220,220,220,220,220,230,230,220,230,230,222,228,230,
+    10,11,12,13,14,15,16,17,18,19,19,20,21,22,0,23,
+    0,24,25,0,230,220,0,18,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,230,30,31,32,0,0,0,0,0,
+    0,0,1024,1024,1024,1024,1024,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,27,28,29,30,31,
+    32,33,34,998,998,988,220,230,230,230,230,230,220,230,230,220,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    35,0,0,0,0,2560,2560,2560,2560,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1024,0,1024,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1024,0,0,230,230,230,230,230,230,230,0,0,230,
+    230,230,230,220,230,0,0,230,230,0,220,230,230,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,220,230,230,220,230,230,220,220,220,230,220,220,230,220,230,
+    230,230,220,230,220,230,220,230,220,230,230,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,
+    230,230,220,230,0,0,0,0,0,0,0,0,0,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,230,230,230,230,0,230,230,230,230,230,
+    230,230,230,230,0,230,230,230,0,230,230,230,230,230,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,220,220,220,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,230,220,220,220,230,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,220,
+    220,220,220,220,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,0,220,230,230,220,230,230,220,230,230,230,220,220,220,
+    27,28,29,230,230,230,220,230,230,220,220,230,230,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1024,0,0,0,0,0,0,
+    0,1024,0,0,1024,0,0,0,0,0,0,0,775,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,230,220,230,230,0,0,0,1792,1792,1792,1792,1792,1792,1792,1792,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7,0,768,0,
+    0,0,0,0,0,0,0,0,0,0,0,1024,1024,9,0,0,
+    0,0,0,0,0,0,0,768,0,0,0,0,1792,1792,0,1792,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1792,0,0,1792,0,0,0,0,0,7,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,1792,1792,1792,0,0,1792,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7,0,768,0,
+    0,0,0,0,0,0,0,0,1024,0,0,1024,1024,9,0,0,
+    0,0,0,0,0,0,768,768,0,0,0,0,1792,1792,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1024,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,768,0,
+    0,0,0,0,0,0,0,0,0,0,1024,1024,1024,9,0,0,
+    0,0,0,0,0,0,0,768,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+    0,0,0,0,0,0,0,0,1024,0,0,0,0,9,0,0,
+    0,0,0,0,0,84,859,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+    1024,0,768,0,0,0,0,1024,1024,0,1024,1024,0,9,0,0,
+    0,0,0,0,0,768,768,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,9,9,0,768,0,
+    0,0,0,0,0,0,0,0,0,0,1024,1024,1024,9,0,0,
+    0,0,0,0,0,0,0,768,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,777,0,0,0,0,768,
+    0,0,0,0,0,0,0,0,0,0,1024,0,1024,1024,1024,768,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,2560,0,0,0,0,103,103,9,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,107,107,107,107,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,2560,0,0,0,0,118,118,9,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,122,122,122,122,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,2560,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,0,0,0,
+    0,0,0,0,0,0,0,0,220,220,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,220,0,220,0,216,0,0,0,0,0,0,
+    0,0,0,1792,0,0,0,0,0,0,0,0,0,1792,0,0,
+    0,0,1792,0,0,0,0,1792,0,0,0,0,1792,0,0,0,
+    0,0,0,0,0,0,0,0,0,1792,0,0,0,0,0,0,
+    0,129,130,1792,132,1792,1792,2560,1792,2560,130,130,130,130,0,0,
+    130,1792,230,230,9,0,230,230,0,0,0,0,0,0,0,0,
+    0,0,0,1792,0,0,0,0,0,0,0,0,0,1792,0,0,
+    0,0,1792,0,0,0,0,1792,0,0,0,0,1792,0,0,0,
+    0,0,0,0,0,0,0,0,0,1792,0,0,0,0,0,0,
+    0,0,0,0,0,0,220,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1024,0,0,0,0,0,0,0,768,0,
+    0,0,0,0,0,0,0,7,0,9,9,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+    768,768,768,768,768,768,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,768,768,768,768,768,768,768,768,
+    768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,768,
+    768,768,768,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,9,0,0,0,0,0,0,0,0,0,0,230,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,228,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,222,230,220,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,230,220,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,230,230,230,230,230,230,230,230,0,0,220,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,220,220,220,220,220,220,230,230,220,0,220,
+    220,230,230,220,220,230,230,230,230,230,220,230,230,230,230,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1024,0,1024,0,1024,0,1024,0,1024,0,
+    0,0,1024,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,7,768,0,0,0,0,0,1024,0,1024,0,0,
+    1024,1024,0,1024,9,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,230,220,230,230,230,
+    230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,
+    0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,0,1,220,220,220,220,220,230,230,220,220,220,220,
+    230,0,1,1,1,1,1,1,1,0,0,0,0,220,0,0,
+    0,0,0,0,230,0,0,0,230,230,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,2560,2560,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,2560,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    230,230,220,230,230,230,230,230,230,230,220,230,230,234,214,220,
+    202,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,232,228,228,220,218,230,233,220,230,220,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,2560,1536,0,0,0,0,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,0,0,0,0,0,0,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,1024,0,0,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,0,0,1024,1024,1024,1024,1024,1024,0,0,
+    1024,1024,1024,1024,1024,1024,1024,1024,0,1024,0,1024,0,1024,0,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1792,1024,1792,1024,1792,1024,1792,1024,1792,1024,1792,1024,1792,0,0,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,1024,
+    1024,1024,1024,1024,1024,0,1024,1024,1024,1024,1024,1792,1024,2560,1792,2560,
+    2560,1536,1024,1024,1024,0,1024,1024,1024,1792,1024,1792,1024,1536,1536,1536,
+    1024,1024,1024,1792,0,0,1024,1024,1024,1024,1024,1792,0,1536,1536,1536,
+    1024,1024,1024,1792,1024,1024,1024,1024,1024,1024,1024,1792,1024,1536,1792,1792,
+    0,0,1024,1024,1024,0,1024,1024,1024,1792,1024,1792,1024,1792,2560,0,
+    1792,1792,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,
+    0,2560,0,0,0,0,0,2560,0,0,0,0,0,0,0,0,
+    0,0,0,0,2560,2560,2560,0,0,0,0,0,0,0,0,2560,
+    0,0,0,2560,2560,0,2560,2560,0,0,0,0,2560,0,2560,0,
+    0,0,0,0,0,0,0,2560,2560,2560,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,2560,0,0,0,0,0,0,0,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,0,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,
+    0,0,0,0,0,0,0,0,2560,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,1,1,230,230,230,230,1,1,1,230,230,0,0,0,
+    0,230,0,0,0,1,1,230,220,230,1,1,220,220,220,220,
+    230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,0,2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,0,2560,2560,0,0,2560,2560,2560,2560,2560,0,0,
+    2560,2560,2560,0,2560,0,1792,0,2560,0,1792,1792,2560,2560,0,2560,
+    2560,2560,0,2560,2560,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,2560,
+    2560,0,0,0,0,2560,2560,2560,2560,2560,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    0,0,0,0,0,0,0,0,0,2560,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1024,1024,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1024,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1024,1024,1024,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1024,0,0,0,0,1024,0,0,1024,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1024,0,1024,0,0,0,0,0,2560,2560,0,2560,
+    2560,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1024,0,0,1024,0,0,1024,0,1024,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1024,0,1024,0,0,0,0,0,0,0,0,0,0,1024,1024,1024,
+    1024,1024,0,0,1024,1024,0,0,1024,1024,0,0,0,0,0,0,
+    1024,1024,0,0,1024,1024,0,0,1024,1024,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1024,1024,1024,1024,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1024,1024,1024,1024,0,0,0,0,0,0,1024,1024,1024,1024,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,1792,1792,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,2560,2560,2560,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1792,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,2560,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,
+    230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,2560,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,218,228,232,222,224,224,
+    0,0,0,0,0,0,2560,0,2560,2560,2560,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1024,0,1024,0,
+    1024,0,1024,0,1024,0,1024,0,1024,0,1024,0,1024,0,1024,0,
+    1024,0,1024,0,0,1024,0,1024,0,1024,0,0,0,0,0,0,
+    1024,1024,0,1024,1024,0,1024,1024,0,1024,1024,0,1024,1024,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1024,0,0,0,0,776,776,2560,2560,0,1024,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,1024,0,1024,0,
+    1024,0,1024,0,1024,0,1024,0,1024,0,1024,0,1024,0,1024,0,
+    1024,0,1024,0,0,1024,0,1024,0,1024,0,0,0,0,0,0,
+    1024,1024,0,1024,1024,0,1024,1024,0,1024,1024,0,1024,1024,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1024,0,0,1024,1024,1024,1024,0,0,0,1024,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,
+    0,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,
+    0,0,0,0,230,230,230,230,230,230,230,230,230,230,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,2560,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,2560,2560,2560,0,0,0,2560,2560,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+    230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,220,220,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,0,230,230,220,0,0,230,230,0,0,0,0,0,230,230,
+    0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,2560,2560,2560,2560,
+    0,0,0,0,0,0,0,0,0,2560,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,0,0,
+    1792,0,1792,0,0,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,0,
+    1792,0,1792,0,0,1792,1792,0,0,0,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,0,0,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,0,0,0,
+    0,0,0,2560,2560,2560,2560,2560,0,0,0,0,0,1792,26,1792,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,0,1792,1792,1792,1792,1792,0,1792,0,
+    1792,1792,0,1792,1792,0,1792,1792,1792,1792,1792,1792,1792,1792,1792,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    0,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,220,220,220,220,220,220,220,230,230,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,0,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,0,0,0,0,
+    2560,2560,2560,0,2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,
+    0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,
+    0,0,2560,2560,2560,2560,2560,2560,0,0,2560,2560,2560,2560,2560,2560,
+    0,0,2560,2560,2560,2560,2560,2560,0,0,2560,2560,2560,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,230,230,230,230,230,0,0,0,0,0,
+    0,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,230,1,220,0,0,0,0,9,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,230,220,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,230,230,230,230,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,230,230,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,220,220,230,230,230,220,230,220,220,220,
+    220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,230,220,230,220,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1024,0,1024,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1024,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,775,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,768,0,0,0,0,0,0,1024,1024,
+    0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,7,9,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,7,7,0,768,0,
+    0,0,0,0,0,0,0,0,0,0,0,1024,1024,9,0,0,
+    0,0,0,0,0,0,0,768,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,0,
+    230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,9,0,0,0,7,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    768,0,0,0,0,0,0,0,0,0,768,1024,1024,768,1024,0,
+    0,0,9,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,768,
+    0,0,0,0,0,0,0,0,0,0,1024,1024,0,0,0,9,
+    7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,7,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    768,0,0,0,0,0,0,0,1024,0,0,0,0,9,9,0,
+    0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,7,0,9,9,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    6,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1792,1792,
+    1792,1792,1792,1792,1792,216,216,1,1,1,0,0,0,226,216,216,
+    216,216,216,0,0,0,0,0,0,0,0,220,220,220,220,220,
+    220,220,220,0,0,230,230,230,230,230,220,220,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,230,230,230,230,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1792,1792,1792,1792,1792,
+    1792,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,2560,2560,
+    0,0,2560,0,0,2560,2560,0,0,2560,2560,2560,2560,0,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,2560,0,2560,2560,2560,
+    2560,2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,0,0,2560,2560,2560,
+    2560,2560,2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,0,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,0,
+    2560,2560,2560,2560,2560,0,2560,0,0,0,2560,2560,2560,2560,2560,2560,
+    2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,0,0,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    230,230,230,230,230,230,230,0,230,230,230,230,230,230,230,230,
+    230,230,230,230,230,230,230,230,230,0,0,230,230,230,230,230,
+    230,230,0,230,230,0,230,230,230,230,230,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    220,220,220,220,220,220,220,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,230,230,230,230,230,230,7,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,0,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    0,2560,2560,0,2560,0,0,2560,0,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,0,2560,2560,2560,2560,0,2560,0,2560,0,0,0,0,
+    0,0,2560,0,0,0,0,2560,0,2560,0,2560,0,2560,2560,2560,
+    0,2560,2560,0,2560,0,0,2560,0,2560,0,2560,0,2560,0,2560,
+    0,2560,2560,0,2560,0,0,2560,2560,2560,2560,0,2560,2560,2560,2560,
+    2560,2560,2560,0,2560,2560,2560,2560,0,2560,2560,2560,2560,0,2560,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,
+    0,2560,2560,2560,0,2560,2560,2560,2560,2560,0,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,2560,2560,2560,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,0,
+    2560,2560,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    2560,2560,2560,2560,2560,2560,2560,2560,2560,2560,0,0,0,0,0,0,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,
+    1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,1792,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+
+// The index of each block of 128 code points' case folding deltas in tsearch_normalize_fold_blocks.
+const uint8_t tsearch_normalize_fold_block_indexes[8704] =
+{
+    0,1,2,3,4,5,6,7,8,9,10,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,11,5,5,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,5,5,14,15,16,17,
+    5,5,18,19,5,5,5,5,5,20,5,5,5,5,5,5,5,5,5,5,5,5,5,5,21,22,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,23,24,25,26,5,5,5,5,5,5,27,28,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,29,5,
+    5,5,5,5,5,5,5,5,30,31,32,33,5,5,5,5,5,5,5,5,5,5,5,5,5,34,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,35,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,36,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,37,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+    5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+};
+
+
+// The distinct blocks of the differences between the code points and their simple case foldings.
+const int32_t tsearch_normalize_fold_blocks[4864] =
+{
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,775,0,0,0,0,0,0,0,0,0,0,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,0,32,32,32,32,32,32,32,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,
+    0,1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,-121,1,0,1,0,1,0,-268,
+    0,210,1,0,1,0,206,1,0,205,205,1,0,0,79,202,
+    203,1,0,205,207,0,211,209,1,0,0,0,211,213,0,214,
+    1,0,1,0,1,0,218,1,0,218,0,0,1,0,218,1,
+    0,217,217,1,0,1,0,219,1,0,0,0,1,0,0,0,
+    0,0,0,0,2,1,0,2,1,0,2,1,0,1,0,1,
+    0,1,0,1,0,1,0,1,0,1,0,1,0,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,2,1,0,1,0,-97,-56,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    -130,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,0,0,0,0,0,0,10795,1,0,-163,10792,0,
+    0,1,0,-195,69,71,1,0,1,0,1,0,1,0,1,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,116,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,116,
+    0,0,0,0,0,0,38,0,37,37,37,0,64,0,63,63,
+    0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,0,32,32,32,32,32,32,32,32,32,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,8,
+    -30,-25,0,0,0,-15,-22,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    -54,-48,0,0,-60,-64,0,1,0,-7,1,0,0,-130,-130,-130,
+    80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,0,0,0,0,0,0,0,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    15,1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,
+    7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,7264,
+    7264,7264,7264,7264,7264,7264,0,7264,0,0,0,0,0,7264,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+    -6222,-6221,-6212,-6210,-6210,-6211,-6204,-6180,35267,0,0,0,0,0,0,0,
+    -3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,
+    -3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,
+    -3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,-3008,0,0,-3008,-3008,-3008,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,0,0,0,0,0,-58,0,0,-7615,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+    0,0,0,0,0,0,0,0,0,-8,0,-8,0,-8,0,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+    0,0,0,0,0,0,0,0,-8,-8,-74,-74,-9,0,-7173,0,
+    0,0,0,0,0,0,0,0,-86,-86,-86,-86,-9,0,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-100,-100,0,0,0,0,
+    0,0,0,0,0,0,0,0,-8,-8,-112,-112,-7,0,0,0,
+    0,0,0,0,0,0,0,0,-128,-128,-126,-126,-9,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,-7517,0,0,0,-8383,-8262,0,0,0,0,
+    0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,-10743,-3814,-10727,0,0,1,0,1,0,1,0,-10780,-10749,-10783,
+    -10782,0,1,0,0,1,0,0,0,0,0,0,0,0,-10815,-10815,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,0,0,0,0,0,0,0,1,0,1,0,0,
+    0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+    0,0,0,0,0,0,0,0,0,1,0,1,0,-35332,1,0,
+    1,0,1,0,1,0,1,0,0,0,0,1,0,-42280,0,0,
+    1,0,1,0,0,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,0,1,0,1,0,-42308,-42319,-42315,-42305,-42308,0,
+    -42258,-42282,-42261,928,1,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,-48,-42307,-35384,1,0,1,0,0,0,0,0,0,
+    1,0,0,0,0,0,1,0,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    -38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,-38864,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,40,40,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,
+    40,40,40,40,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    39,39,39,39,39,39,39,39,39,39,39,0,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,0,39,39,39,39,
+    39,39,39,0,39,39,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+
+const tsearch_normalize_decomposition tsearch_normalize_decompositions[5795] =
+{
+    {160,0,1,1},
+    {168,1,2,1},
+    {170,3,1,1},
+    {175,4,2,1},
+    {178,6,1,1},
+    {179,7,1,1},
+    {180,8,2,1},
+    {181,10,1,1},
+    {184,11,2,1},
+    {185,13,1,1},
+    {186,14,1,1},
+    {188,15,3,1},
+    {189,18,3,1},
+    {190,21,3,1},
+    {192,24,2,0},
+    {193,26,2,0},
+    {194,28,2,0},
+    {195,30,2,0},
+    {196,32,2,0},
+    {197,34,2,0},
+    {199,36,2,0},
+    {200,38,2,0},
+    {201,40,2,0},
+    {202,42,2,0},
+    {203,44,2,0},
+    {204,46,2,0},
+    {205,48,2,0},
+    {206,50,2,0},
+    {207,52,2,0},
+    {209,54,2,0},
+    {210,56,2,0},
+    {211,58,2,0},
+    {212,60,2,0},
+    {213,62,2,0},
+    {214,64,2,0},
+    {217,66,2,0},
+    {218,68,2,0},
+    {219,70,2,0},
+    {220,72,2,0},
+    {221,74,2,0},
+    {224,76,2,0},
+    {225,78,2,0},
+    {226,80,2,0},
+    {227,82,2,0},
+    {228,84,2,0},
+    {229,86,2,0},
+    {231,88,2,0},
+    {232,90,2,0},
+    {233,92,2,0},
+    {234,94,2,0},
+    {235,96,2,0},
+    {236,98,2,0},
+    {237,100,2,0},
+    {238,102,2,0},
+    {239,104,2,0},
+    {241,106,2,0},
+    {242,108,2,0},
+    {243,110,2,0},
+    {244,112,2,0},
+    {245,114,2,0},
+    {246,116,2,0},
+    {249,118,2,0},
+    {250,120,2,0},
+    {251,122,2,0},
+    {252,124,2,0},
+    {253,126,2,0},
+    {255,128,2,0},
+    {256,130,2,0},
+    {257,132,2,0},
+    {258,134,2,0},
+    {259,136,2,0},
+    {260,138,2,0},
+    {261,140,2,0},
+    {262,142,2,0},
+    {263,144,2,0},
+    {264,146,2,0},
+    {265,148,2,0},
+    {266,150,2,0},
+    {267,152,2,0},
+    {268,154,2,0},
+    {269,156,2,0},
+    {270,158,2,0},
+    {271,160,2,0},
+    {274,162,2,0},
+    {275,164,2,0},
+    {276,166,2,0},
+    {277,168,2,0},
+    {278,170,2,0},
+    {279,172,2,0},
+    {280,174,2,0},
+    {281,176,2,0},
+    {282,178,2,0},
+    {283,180,2,0},
+    {284,182,2,0},
+    {285,184,2,0},
+    {286,186,2,0},
+    {287,188,2,0},
+    {288,190,2,0},
+    {289,192,2,0},
+    {290,194,2,0},
+    {291,196,2,0},
+    {292,198,2,0},
+    {293,200,2,0},
+    {296,202,2,0},
+    {297,204,2,0},
+    {298,206,2,0},
+    {299,208,2,0},
+    {300,210,2,0},
+    {301,212,2,0},
+    {302,214,2,0},
+    {303,216,2,0},
+    {304,218,2,0},
+    {306,220,2,1},
+    {307,222,2,1},
+    {308,224,2,0},
+    {309,226,2,0},
+    {310,228,2,0},
+    {311,230,2,0},
+    {313,232,2,0},
+    {314,234,2,0},
+    {315,236,2,0},
+    {316,238,2,0},
+    {317,240,2,0},
+    {318,242,2,0},
+    {319,244,2,1},
+    {320,246,2,1},
+    {323,248,2,0},
+    {324,250,2,0},
+    {325,252,2,0},
+    {326,254,2,0},
+    {327,256,2,0},
+    {328,258,2,0},
+    {329,260,2,1},
+    {332,262,2,0},
+    {333,264,2,0},
+    {334,266,2,0},
+    {335,268,2,0},
+    {336,270,2,0},
+    {337,272,2,0},
+    {340,274,2,0},
+    {341,276,2,0},
+    {342,278,2,0},
+    {343,280,2,0},
+    {344,282,2,0},
+    {345,284,2,0},
+    {346,286,2,0},
+    {347,288,2,0},
+    {348,290,2,0},
+    {349,292,2,0},
+    {350,294,2,0},
+    {351,296,2,0},
+    {352,298,2,0},
+    {353,300,2,0},
+    {354,302,2,0},
+    {355,304,2,0},
+    {356,306,2,0},
+    {357,308,2,0},
+    {360,310,2,0},
+    {361,312,2,0},
+    {362,314,2,0},
+    {363,316,2,0},
+    {364,318,2,0},
+    {365,320,2,0},
+    {366,322,2,0},
+    {367,324,2,0},
+    {368,326,2,0},
+    {369,328,2,0},
+    {370,330,2,0},
+    {371,332,2,0},
+    {372,334,2,0},
+    {373,336,2,0},
+    {374,338,2,0},
+    {375,340,2,0},
+    {376,342,2,0},
+    {377,344,2,0},
+    {378,346,2,0},
+    {379,348,2,0},
+    {380,350,2,0},
+    {381,352,2,0},
+    {382,354,2,0},
+    {383,356,1,1},
+    {416,357,2,0},
+    {417,359,2,0},
+    {431,361,2,0},
+    {432,363,2,0},
+    {452,365,2,1},
+    {453,367,2,1},
+    {454,369,2,1},
+    {455,371,2,1},
+    {456,373,2,1},
+    {457,375,2,1},
+    {458,377,2,1},
+    {459,379,2,1},
+    {460,381,2,1},
+    {461,383,2,0},
+    {462,385,2,0},
+    {463,387,2,0},
+    {464,389,2,0},
+    {465,391,2,0},
+    {466,393,2,0},
+    {467,395,2,0},
+    {468,397,2,0},
+    {469,399,2,0},
+    {470,401,2,0},
+    {471,403,2,0},
+    {472,405,2,0},
+    {473,407,2,0},
+    {474,409,2,0},
+    {475,411,2,0},
+    {476,413,2,0},
+    {478,415,2,0},
+    {479,417,2,0},
+    {480,419,2,0},
+    {481,421,2,0},
+    {482,423,2,0},
+    {483,425,2,0},
+    {486,427,2,0},
+    {487,429,2,0},
+    {488,431,2,0},
+    {489,433,2,0},
+    {490,435,2,0},
+    {491,437,2,0},
+    {492,439,2,0},
+    {493,441,2,0},
+    {494,443,2,0},
+    {495,445,2,0},
+    {496,447,2,0},
+    {497,449,2,1},
+    {498,451,2,1},
+    {499,453,2,1},
+    {500,455,2,0},
+    {501,457,2,0},
+    {504,459,2,0},
+    {505,461,2,0},
+    {506,463,2,0},
+    {507,465,2,0},
+    {508,467,2,0},
+    {509,469,2,0},
+    {510,471,2,0},
+    {511,473,2,0},
+    {512,475,2,0},
+    {513,477,2,0},
+    {514,479,2,0},
+    {515,481,2,0},
+    {516,483,2,0},
+    {517,485,2,0},
+    {518,487,2,0},
+    {519,489,2,0},
+    {520,491,2,0},
+    {521,493,2,0},
+    {522,495,2,0},
+    {523,497,2,0},
+    {524,499,2,0},
+    {525,501,2,0},
+    {526,503,2,0},
+    {527,505,2,0},
+    {528,507,2,0},
+    {529,509,2,0},
+    {530,511,2,0},
+    {531,513,2,0},
+    {532,515,2,0},
+    {533,517,2,0},
+    {534,519,2,0},
+    {535,521,2,0},
+    {536,523,2,0},
+    {537,525,2,0},
+    {538,527,2,0},
+    {539,529,2,0},
+    {542,531,2,0},
+    {543,533,2,0},
+    {550,535,2,0},
+    {551,537,2,0},
+    {552,539,2,0},
+    {553,541,2,0},
+    {554,543,2,0},
+    {555,545,2,0},
+    {556,547,2,0},
+    {557,549,2,0},
+    {558,551,2,0},
+    {559,553,2,0},
+    {560,555,2,0},
+    {561,557,2,0},
+    {562,559,2,0},
+    {563,561,2,0},
+    {688,563,1,1},
+    {689,564,1,1},
+    {690,565,1,1},
+    {691,566,1,1},
+    {692,567,1,1},
+    {693,568,1,1},
+    {694,569,1,1},
+    {695,570,1,1},
+    {696,571,1,1},
+    {728,572,2,1},
+    {729,574,2,1},
+    {730,576,2,1},
+    {731,578,2,1},
+    {732,580,2,1},
+    {733,582,2,1},
+    {736,584,1,1},
+    {737,585,1,1},
+    {738,586,1,1},
+    {739,587,1,1},
+    {740,588,1,1},
+    {832,589,1,0},
+    {833,590,1,0},
+    {835,591,1,0},
+    {836,592,2,0},
+    {884,594,1,0},
+    {890,595,2,1},
+    {894,597,1,0},
+    {900,598,2,1},
+    {901,600,2,0},
+    {902,602,2,0},
+    {903,604,1,0},
+    {904,605,2,0},
+    {905,607,2,0},
+    {906,609,2,0},
+    {908,611,2,0},
+    {910,613,2,0},
+    {911,615,2,0},
+    {912,617,2,0},
+    {938,619,2,0},
+    {939,621,2,0},
+    {940,623,2,0},
+    {941,625,2,0},
+    {942,627,2,0},
+    {943,629,2,0},
+    {944,631,2,0},
+    {970,633,2,0},
+    {971,635,2,0},
+    {972,637,2,0},
+    {973,639,2,0},
+    {974,641,2,0},
+    {976,643,1,1},
+    {977,644,1,1},
+    {978,645,1,1},
+    {979,646,2,0},
+    {980,648,2,0},
+    {981,650,1,1},
+    {982,651,1,1},
+    {1008,652,1,1},
+    {1009,653,1,1},
+    {1010,654,1,1},
+    {1012,655,1,1},
+    {1013,656,1,1},
+    {1017,657,1,1},
+    {1024,658,2,0},
+    {1025,660,2,0},
+    {1027,662,2,0},
+    {1031,664,2,0},
+    {1036,666,2,0},
+    {1037,668,2,0},
+    {1038,670,2,0},
+    {1049,672,2,0},
+    {1081,674,2,0},
+    {1104,676,2,0},
+    {1105,678,2,0},
+    {1107,680,2,0},
+    {1111,682,2,0},
+    {1116,684,2,0},
+    {1117,686,2,0},
+    {1118,688,2,0},
+    {1142,690,2,0},
+    {1143,692,2,0},
+    {1217,694,2,0},
+    {1218,696,2,0},
+    {1232,698,2,0},
+    {1233,700,2,0},
+    {1234,702,2,0},
+    {1235,704,2,0},
+    {1238,706,2,0},
+    {1239,708,2,0},
+    {1242,710,2,0},
+    {1243,712,2,0},
+    {1244,714,2,0},
+    {1245,716,2,0},
+    {1246,718,2,0},
+    {1247,720,2,0},
+    {1250,722,2,0},
+    {1251,724,2,0},
+    {1252,726,2,0},
+    {1253,728,2,0},
+    {1254,730,2,0},
+    {1255,732,2,0},
+    {1258,734,2,0},
+    {1259,736,2,0},
+    {1260,738,2,0},
+    {1261,740,2,0},
+    {1262,742,2,0},
+    {1263,744,2,0},
+    {1264,746,2,0},
+    {1265,748,2,0},
+    {1266,750,2,0},
+    {1267,752,2,0},
+    {1268,754,2,0},
+    {1269,756,2,0},
+    {1272,758,2,0},
+    {1273,760,2,0},
+    {1415,762,2,1},
+    {1570,764,2,0},
+    {1571,766,2,0},
+    {1572,768,2,0},
+    {1573,770,2,0},
+    {1574,772,2,0},
+    {1653,774,2,1},
+    {1654,776,2,1},
+    {1655,778,2,1},
+    {1656,780,2,1},
+    {1728,782,2,0},
+    {1730,784,2,0},
+    {1747,786,2,0},
+    {2345,788,2,0},
+    {2353,790,2,0},
+    {2356,792,2,0},
+    {2392,794,2,0},
+    {2393,796,2,0},
+    {2394,798,2,0},
+    {2395,800,2,0},
+    {2396,802,2,0},
+    {2397,804,2,0},
+    {2398,806,2,0},
+    {2399,808,2,0},
+    {2507,810,2,0},
+    {2508,812,2,0},
+    {2524,814,2,0},
+    {2525,816,2,0},
+    {2527,818,2,0},
+    {2611,820,2,0},
+    {2614,822,2,0},
+    {2649,824,2,0},
+    {2650,826,2,0},
+    {2651,828,2,0},
+    {2654,830,2,0},
+    {2888,832,2,0},
+    {2891,834,2,0},
+    {2892,836,2,0},
+    {2908,838,2,0},
+    {2909,840,2,0},
+    {2964,842,2,0},
+    {3018,844,2,0},
+    {3019,846,2,0},
+    {3020,848,2,0},
+    {3144,850,2,0},
+    {3264,852,2,0},
+    {3271,854,2,0},
+    {3272,856,2,0},
+    {3274,858,2,0},
+    {3275,860,2,0},
+    {3402,862,2,0},
+    {3403,864,2,0},
+    {3404,866,2,0},
+    {3546,868,2,0},
+    {3548,870,2,0},
+    {3549,872,2,0},
+    {3550,874,2,0},
+    {3635,876,2,1},
+    {3763,878,2,1},
+    {3804,880,2,1},
+    {3805,882,2,1},
+    {3852,884,1,1},
+    {3907,885,2,0},
+    {3917,887,2,0},
+    {3922,889,2,0},
+    {3927,891,2,0},
+    {3932,893,2,0},
+    {3945,895,2,0},
+    {3955,897,2,0},
+    {3957,899,2,0},
+    {3958,901,2,0},
+    {3959,903,2,1},
+    {3960,905,2,0},
+    {3961,907,2,1},
+    {3969,909,2,0},
+    {3987,911,2,0},
+    {3997,913,2,0},
+    {4002,915,2,0},
+    {4007,917,2,0},
+    {4012,919,2,0},
+    {4025,921,2,0},
+    {4134,923,2,0},
+    {4348,925,1,1},
+    {6918,926,2,0},
+    {6920,928,2,0},
+    {6922,930,2,0},
+    {6924,932,2,0},
+    {6926,934,2,0},
+    {6930,936,2,0},
+    {6971,938,2,0},
+    {6973,940,2,0},
+    {6976,942,2,0},
+    {6977,944,2,0},
+    {6979,946,2,0},
+    {7468,948,1,1},
+    {7469,949,1,1},
+    {7470,950,1,1},
+    {7472,951,1,1},
+    {7473,952,1,1},
+    {7474,953,1,1},
+    {7475,954,1,1},
+    {7476,955,1,1},
+    {7477,956,1,1},
+    {7478,957,1,1},
+    {7479,958,1,1},
+    {7480,959,1,1},
+    {7481,960,1,1},
+    {7482,961,1,1},
+    {7484,962,1,1},
+    {7485,963,1,1},
+    {7486,964,1,1},
+    {7487,965,1,1},
+    {7488,966,1,1},
+    {7489,967,1,1},
+    {7490,968,1,1},
+    {7491,969,1,1},
+    {7492,970,1,1},
+    {7493,971,1,1},
+    {7494,972,1,1},
+    {7495,973,1,1},
+    {7496,974,1,1},
+    {7497,975,1,1},
+    {7498,976,1,1},
+    {7499,977,1,1},
+    {7500,978,1,1},
+    {7501,979,1,1},
+    {7503,980,1,1},
+    {7504,981,1,1},
+    {7505,982,1,1},
+    {7506,983,1,1},
+    {7507,984,1,1},
+    {7508,985,1,1},
+    {7509,986,1,1},
+    {7510,987,1,1},
+    {7511,988,1,1},
+    {7512,989,1,1},
+    {7513,990,1,1},
+    {7514,991,1,1},
+    {7515,992,1,1},
+    {7516,993,1,1},
+    {7517,994,1,1},
+    {7518,995,1,1},
+    {7519,996,1,1},
+    {7520,997,1,1},
+    {7521,998,1,1},
+    {7522,999,1,1},
+    {7523,1000,1,1},
+    {7524,1001,1,1},
+    {7525,1002,1,1},
+    {7526,1003,1,1},
+    {7527,1004,1,1},
+    {7528,1005,1,1},
+    {7529,1006,1,1},
+    {7530,1007,1,1},
+    {7544,1008,1,1},
+    {7579,1009,1,1},
+    {7580,1010,1,1},
+    {7581,1011,1,1},
+    {7582,1012,1,1},
+    {7583,1013,1,1},
+    {7584,1014,1,1},
+    {7585,1015,1,1},
+    {7586,1016,1,1},
+    {7587,1017,1,1},
+    {7588,1018,1,1},
+    {7589,1019,1,1},
+    {7590,1020,1,1},
+    {7591,1021,1,1},
+    {7592,1022,1,1},
+    {7593,1023,1,1},
+    {7594,1024,1,1},
+    {7595,1025,1,1},
+    {7596,1026,1,1},
+    {7597,1027,1,1},
+    {7598,1028,1,1},
+    {7599,1029,1,1},
+    {7600,1030,1,1},
+    {7601,1031,1,1},
+    {7602,1032,1,1},
+    {7603,1033,1,1},
+    {7604,1034,1,1},
+    {7605,1035,1,1},
+    {7606,1036,1,1},
+    {7607,1037,1,1},
+    {7608,1038,1,1},
+    {7609,1039,1,1},
+    {7610,1040,1,1},
+    {7611,1041,1,1},
+    {7612,1042,1,1},
+    {7613,1043,1,1},
+    {7614,1044,1,1},
+    {7615,1045,1,1},
+    {7680,1046,2,0},
+    {7681,1048,2,0},
+    {7682,1050,2,0},
+    {7683,1052,2,0},
+    {7684,1054,2,0},
+    {7685,1056,2,0},
+    {7686,1058,2,0},
+    {7687,1060,2,0},
+    {7688,1062,2,0},
+    {7689,1064,2,0},
+    {7690,1066,2,0},
+    {7691,1068,2,0},
+    {7692,1070,2,0},
+    {7693,1072,2,0},
+    {7694,1074,2,0},
+    {7695,1076,2,0},
+    {7696,1078,2,0},
+    {7697,1080,2,0},
+    {7698,1082,2,0},
+    {7699,1084,2,0},
+    {7700,1086,2,0},
+    {7701,1088,2,0},
+    {7702,1090,2,0},
+    {7703,1092,2,0},
+    {7704,1094,2,0},
+    {7705,1096,2,0},
+    {7706,1098,2,0},
+    {7707,1100,2,0},
+    {7708,1102,2,0},
+    {7709,1104,2,0},
+    {7710,1106,2,0},
+    {7711,1108,2,0},
+    {7712,1110,2,0},
+    {7713,1112,2,0},
+    {7714,1114,2,0},
+    {7715,1116,2,0},
+    {7716,1118,2,0},
+    {7717,1120,2,0},
+    {7718,1122,2,0},
+    {7719,1124,2,0},
+    {7720,1126,2,0},
+    {7721,1128,2,0},
+    {7722,1130,2,0},
+    {7723,1132,2,0},
+    {7724,1134,2,0},
+    {7725,1136,2,0},
+    {7726,1138,2,0},
+    {7727,1140,2,0},
+    {7728,1142,2,0},
+    {7729,1144,2,0},
+    {7730,1146,2,0},
+    {7731,1148,2,0},
+    {7732,1150,2,0},
+    {7733,1152,2,0},
+    {7734,1154,2,0},
+    {7735,1156,2,0},
+    {7736,1158,2,0},
+    {7737,1160,2,0},
+    {7738,1162,2,0},
+    {7739,1164,2,0},
+    {7740,1166,2,0},
+    {7741,1168,2,0},
+    {7742,1170,2,0},
+    {7743,1172,2,0},
+    {7744,1174,2,0},
+    {7745,1176,2,0},
+    {7746,1178,2,0},
+    {7747,1180,2,0},
+    {7748,1182,2,0},
+    {7749,1184,2,0},
+    {7750,1186,2,0},
+    {7751,1188,2,0},
+    {7752,1190,2,0},
+    {7753,1192,2,0},
+    {7754,1194,2,0},
+    {7755,1196,2,0},
+    {7756,1198,2,0},
+    {7757,1200,2,0},
+    {7758,1202,2,0},
+    {7759,1204,2,0},
+    {7760,1206,2,0},
+    {7761,1208,2,0},
+    {7762,1210,2,0},
+    {7763,1212,2,0},
+    {7764,1214,2,0},
+    {7765,1216,2,0},
+    {7766,1218,2,0},
+    {7767,1220,2,0},
+    {7768,1222,2,0},
+    {7769,1224,2,0},
+    {7770,1226,2,0},
+    {7771,1228,2,0},
+    {7772,1230,2,0},
+    {7773,1232,2,0},
+    {7774,1234,2,0},
+    {7775,1236,2,0},
+    {7776,1238,2,0},
+    {7777,1240,2,0},
+    {7778,1242,2,0},
+    {7779,1244,2,0},
+    {7780,1246,2,0},
+    {7781,1248,2,0},
+    {7782,1250,2,0},
+    {7783,1252,2,0},
+    {7784,1254,2,0},
+    {7785,1256,2,0},
+    {7786,1258,2,0},
+    {7787,1260,2,0},
+    {7788,1262,2,0},
+    {7789,1264,2,0},
+    {7790,1266,2,0},
+    {7791,1268,2,0},
+    {7792,1270,2,0},
+    {7793,1272,2,0},
+    {7794,1274,2,0},
+    {7795,1276,2,0},
+    {7796,1278,2,0},
+    {7797,1280,2,0},
+    {7798,1282,2,0},
+    {7799,1284,2,0},
+    {7800,1286,2,0},
+    {7801,1288,2,0},
+    {7802,1290,2,0},
+    {7803,1292,2,0},
+    {7804,1294,2,0},
+    {7805,1296,2,0},
+    {7806,1298,2,0},
+    {7807,1300,2,0},
+    {7808,1302,2,0},
+    {7809,1304,2,0},
+    {7810,1306,2,0},
+    {7811,1308,2,0},
+    {7812,1310,2,0},
+    {7813,1312,2,0},
+    {7814,1314,2,0},
+    {7815,1316,2,0},
+    {7816,1318,2,0},
+    {7817,1320,2,0},
+    {7818,1322,2,0},
+    {7819,1324,2,0},
+    {7820,1326,2,0},
+    {7821,1328,2,0},
+    {7822,1330,2,0},
+    {7823,1332,2,0},
+    {7824,1334,2,0},
+    {7825,1336,2,0},
+    {7826,1338,2,0},
+    {7827,1340,2,0},
+    {7828,1342,2,0},
+    {7829,1344,2,0},
+    {7830,1346,2,0},
+    {7831,1348,2,0},
+    {7832,1350,2,0},
+    {7833,1352,2,0},
+    {7834,1354,2,1},
+    {7835,1356,2,0},
+    {7840,1358,2,0},
+    {7841,1360,2,0},
+    {7842,1362,2,0},
+    {7843,1364,2,0},
+    {7844,1366,2,0},
+    {7845,1368,2,0},
+    {7846,1370,2,0},
+    {7847,1372,2,0},
+    {7848,1374,2,0},
+    {7849,1376,2,0},
+    {7850,1378,2,0},
+    {7851,1380,2,0},
+    {7852,1382,2,0},
+    {7853,1384,2,0},
+    {7854,1386,2,0},
+    {7855,1388,2,0},
+    {7856,1390,2,0},
+    {7857,1392,2,0},
+    {7858,1394,2,0},
+    {7859,1396,2,0},
+    {7860,1398,2,0},
+    {7861,1400,2,0},
+    {7862,1402,2,0},
+    {7863,1404,2,0},
+    {7864,1406,2,0},
+    {7865,1408,2,0},
+    {7866,1410,2,0},
+    {7867,1412,2,0},
+    {7868,1414,2,0},
+    {7869,1416,2,0},
+    {7870,1418,2,0},
+    {7871,1420,2,0},
+    {7872,1422,2,0},
+    {7873,1424,2,0},
+    {7874,1426,2,0},
+    {7875,1428,2,0},
+    {7876,1430,2,0},
+    {7877,1432,2,0},
+    {7878,1434,2,0},
+    {7879,1436,2,0},
+    {7880,1438,2,0},
+    {7881,1440,2,0},
+    {7882,1442,2,0},
+    {7883,1444,2,0},
+    {7884,1446,2,0},
+    {7885,1448,2,0},
+    {7886,1450,2,0},
+    {7887,1452,2,0},
+    {7888,1454,2,0},
+    {7889,1456,2,0},
+    {7890,1458,2,0},
+    {7891,1460,2,0},
+    {7892,1462,2,0},
+    {7893,1464,2,0},
+    {7894,1466,2,0},
+    {7895,1468,2,0},
+    {7896,1470,2,0},
+    {7897,1472,2,0},
+    {7898,1474,2,0},
+    {7899,1476,2,0},
+    {7900,1478,2,0},
+    {7901,1480,2,0},
+    {7902,1482,2,0},
+    {7903,1484,2,0},
+    {7904,1486,2,0},
+    {7905,1488,2,0},
+    {7906,1490,2,0},
+    {7907,1492,2,0},
+    {7908,1494,2,0},
+    {7909,1496,2,0},
+    {7910,1498,2,0},
+    {7911,1500,2,0},
+    {7912,1502,2,0},
+    {7913,1504,2,0},
+    {7914,1506,2,0},
+    {7915,1508,2,0},
+    {7916,1510,2,0},
+    {7917,1512,2,0},
+    {7918,1514,2,0},
+    {7919,1516,2,0},
+    {7920,1518,2,0},
+    {7921,1520,2,0},
+    {7922,1522,2,0},
+    {7923,1524,2,0},
+    {7924,1526,2,0},
+    {7925,1528,2,0},
+    {7926,1530,2,0},
+    {7927,1532,2,0},
+    {7928,1534,2,0},
+    {7929,1536,2,0},
+    {7936,1538,2,0},
+    {7937,1540,2,0},
+    {7938,1542,2,0},
+    {7939,1544,2,0},
+    {7940,1546,2,0},
+    {7941,1548,2,0},
+    {7942,1550,2,0},
+    {7943,1552,2,0},
+    {7944,1554,2,0},
+    {7945,1556,2,0},
+    {7946,1558,2,0},
+    {7947,1560,2,0},
+    {7948,1562,2,0},
+    {7949,1564,2,0},
+    {7950,1566,2,0},
+    {7951,1568,2,0},
+    {7952,1570,2,0},
+    {7953,1572,2,0},
+    {7954,1574,2,0},
+    {7955,1576,2,0},
+    {7956,1578,2,0},
+    {7957,1580,2,0},
+    {7960,1582,2,0},
+    {7961,1584,2,0},
+    {7962,1586,2,0},
+    {7963,1588,2,0},
+    {7964,1590,2,0},
+    {7965,1592,2,0},
+    {7968,1594,2,0},
+    {7969,1596,2,0},
+    {7970,1598,2,0},
+    {7971,1600,2,0},
+    {7972,1602,2,0},
+    {7973,1604,2,0},
+    {7974,1606,2,0},
+    {7975,1608,2,0},
+    {7976,1610,2,0},
+    {7977,1612,2,0},
+    {7978,1614,2,0},
+    {7979,1616,2,0},
+    {7980,1618,2,0},
+    {7981,1620,2,0},
+    {7982,1622,2,0},
+    {7983,1624,2,0},
+    {7984,1626,2,0},
+    {7985,1628,2,0},
+    {7986,1630,2,0},
+    {7987,1632,2,0},
+    {7988,1634,2,0},
+    {7989,1636,2,0},
+    {7990,1638,2,0},
+    {7991,1640,2,0},
+    {7992,1642,2,0},
+    {7993,1644,2,0},
+    {7994,1646,2,0},
+    {7995,1648,2,0},
+    {7996,1650,2,0},
+    {7997,1652,2,0},
+    {7998,1654,2,0},
+    {7999,1656,2,0},
+    {8000,1658,2,0},
+    {8001,1660,2,0},
+    {8002,1662,2,0},
+    {8003,1664,2,0},
+    {8004,1666,2,0},
+    {8005,1668,2,0},
+    {8008,1670,2,0},
+    {8009,1672,2,0},
+    {8010,1674,2,0},
+    {8011,1676,2,0},
+    {8012,1678,2,0},
+    {8013,1680,2,0},
+    {8016,1682,2,0},
+    {8017,1684,2,0},
+    {8018,1686,2,0},
+    {8019,1688,2,0},
+    {8020,1690,2,0},
+    {8021,1692,2,0},
+    {8022,1694,2,0},
+    {8023,1696,2,0},
+    {8025,1698,2,0},
+    {8027,1700,2,0},
+    {8029,1702,2,0},
+    {8031,1704,2,0},
+    {8032,1706,2,0},
+    {8033,1708,2,0},
+    {8034,1710,2,0},
+    {8035,1712,2,0},
+    {8036,1714,2,0},
+    {8037,1716,2,0},
+    {8038,1718,2,0},
+    {8039,1720,2,0},
+    {8040,1722,2,0},
+    {8041,1724,2,0},
+    {8042,1726,2,0},
+    {8043,1728,2,0},
+    {8044,1730,2,0},
+    {8045,1732,2,0},
+    {8046,1734,2,0},
+    {8047,1736,2,0},
+    {8048,1738,2,0},
+    {8049,1740,1,0},
+    {8050,1741,2,0},
+    {8051,1743,1,0},
+    {8052,1744,2,0},
+    {8053,1746,1,0},
+    {8054,1747,2,0},
+    {8055,1749,1,0},
+    {8056,1750,2,0},
+    {8057,1752,1,0},
+    {8058,1753,2,0},
+    {8059,1755,1,0},
+    {8060,1756,2,0},
+    {8061,1758,1,0},
+    {8064,1759,2,0},
+    {8065,1761,2,0},
+    {8066,1763,2,0},
+    {8067,1765,2,0},
+    {8068,1767,2,0},
+    {8069,1769,2,0},
+    {8070,1771,2,0},
+    {8071,1773,2,0},
+    {8072,1775,2,0},
+    {8073,1777,2,0},
+    {8074,1779,2,0},
+    {8075,1781,2,0},
+    {8076,1783,2,0},
+    {8077,1785,2,0},
+    {8078,1787,2,0},
+    {8079,1789,2,0},
+    {8080,1791,2,0},
+    {8081,1793,2,0},
+    {8082,1795,2,0},
+    {8083,1797,2,0},
+    {8084,1799,2,0},
+    {8085,1801,2,0},
+    {8086,1803,2,0},
+    {8087,1805,2,0},
+    {8088,1807,2,0},
+    {8089,1809,2,0},
+    {8090,1811,2,0},
+    {8091,1813,2,0},
+    {8092,1815,2,0},
+    {8093,1817,2,0},
+    {8094,1819,2,0},
+    {8095,1821,2,0},
+    {8096,1823,2,0},
+    {8097,1825,2,0},
+    {8098,1827,2,0},
+    {8099,1829,2,0},
+    {8100,1831,2,0},
+    {8101,1833,2,0},
+    {8102,1835,2,0},
+    {8103,1837,2,0},
+    {8104,1839,2,0},
+    {8105,1841,2,0},
+    {8106,1843,2,0},
+    {8107,1845,2,0},
+    {8108,1847,2,0},
+    {8109,1849,2,0},
+    {8110,1851,2,0},
+    {8111,1853,2,0},
+    {8112,1855,2,0},
+    {8113,1857,2,0},
+    {8114,1859,2,0},
+    {8115,1861,2,0},
+    {8116,1863,2,0},
+    {8118,1865,2,0},
+    {8119,1867,2,0},
+    {8120,1869,2,0},
+    {8121,1871,2,0},
+    {8122,1873,2,0},
+    {8123,1875,1,0},
+    {8124,1876,2,0},
+    {8125,1878,2,1},
+    {8126,1880,1,0},
+    {8127,1881,2,1},
+    {8128,1883,2,1},
+    {8129,1885,2,0},
+    {8130,1887,2,0},
+    {8131,1889,2,0},
+    {8132,1891,2,0},
+    {8134,1893,2,0},
+    {8135,1895,2,0},
+    {8136,1897,2,0},
+    {8137,1899,1,0},
+    {8138,1900,2,0},
+    {8139,1902,1,0},
+    {8140,1903,2,0},
+    {8141,1905,2,0},
+    {8142,1907,2,0},
+    {8143,1909,2,0},
+    {8144,1911,2,0},
+    {8145,1913,2,0},
+    {8146,1915,2,0},
+    {8147,1917,1,0},
+    {8150,1918,2,0},
+    {8151,1920,2,0},
+    {8152,1922,2,0},
+    {8153,1924,2,0},
+    {8154,1926,2,0},
+    {8155,1928,1,0},
+    {8157,1929,2,0},
+    {8158,1931,2,0},
+    {8159,1933,2,0},
+    {8160,1935,2,0},
+    {8161,1937,2,0},
+    {8162,1939,2,0},
+    {8163,1941,1,0},
+    {8164,1942,2,0},
+    {8165,1944,2,0},
+    {8166,1946,2,0},
+    {8167,1948,2,0},
+    {8168,1950,2,0},
+    {8169,1952,2,0},
+    {8170,1954,2,0},
+    {8171,1956,1,0},
+    {8172,1957,2,0},
+    {8173,1959,2,0},
+    {8174,1961,1,0},
+    {8175,1962,1,0},
+    {8178,1963,2,0},
+    {8179,1965,2,0},
+    {8180,1967,2,0},
+    {8182,1969,2,0},
+    {8183,1971,2,0},
+    {8184,1973,2,0},
+    {8185,1975,1,0},
+    {8186,1976,2,0},
+    {8187,1978,1,0},
+    {8188,1979,2,0},
+    {8189,1981,1,0},
+    {8190,1982,2,1},
+    {8192,1984,1,0},
+    {8193,1985,1,0},
+    {8194,1986,1,1},
+    {8195,1987,1,1},
+    {8196,1988,1,1},
+    {8197,1989,1,1},
+    {8198,1990,1,1},
+    {8199,1991,1,1},
+    {8200,1992,1,1},
+    {8201,1993,1,1},
+    {8202,1994,1,1},
+    {8209,1995,1,1},
+    {8215,1996,2,1},
+    {8228,1998,1,1},
+    {8229,1999,2,1},
+    {8230,2001,3,1},
+    {8239,2004,1,1},
+    {8243,2005,2,1},
+    {8244,2007,3,1},
+    {8246,2010,2,1},
+    {8247,2012,3,1},
+    {8252,2015,2,1},
+    {8254,2017,2,1},
+    {8263,2019,2,1},
+    {8264,2021,2,1},
+    {8265,2023,2,1},
+    {8279,2025,4,1},
+    {8287,2029,1,1},
+    {8304,2030,1,1},
+    {8305,2031,1,1},
+    {8308,2032,1,1},
+    {8309,2033,1,1},
+    {8310,2034,1,1},
+    {8311,2035,1,1},
+    {8312,2036,1,1},
+    {8313,2037,1,1},
+    {8314,2038,1,1},
+    {8315,2039,1,1},
+    {8316,2040,1,1},
+    {8317,2041,1,1},
+    {8318,2042,1,1},
+    {8319,2043,1,1},
+    {8320,2044,1,1},
+    {8321,2045,1,1},
+    {8322,2046,1,1},
+    {8323,2047,1,1},
+    {8324,2048,1,1},
+    {8325,2049,1,1},
+    {8326,2050,1,1},
+    {8327,2051,1,1},
+    {8328,2052,1,1},
+    {8329,2053,1,1},
+    {8330,2054,1,1},
+    {8331,2055,1,1},
+    {8332,2056,1,1},
+    {8333,2057,1,1},
+    {8334,2058,1,1},
+    {8336,2059,1,1},
+    {8337,2060,1,1},
+    {8338,2061,1,1},
+    {8339,2062,1,1},
+    {8340,2063,1,1},
+    {8341,2064,1,1},
+    {8342,2065,1,1},
+    {8343,2066,1,1},
+    {8344,2067,1,1},
+    {8345,2068,1,1},
+    {8346,2069,1,1},
+    {8347,2070,1,1},
+    {8348,2071,1,1},
+    {8360,2072,2,1},
+    {8448,2074,3,1},
+    {8449,2077,3,1},
+    {8450,2080,1,1},
+    {8451,2081,2,1},
+    {8453,2083,3,1},
+    {8454,2086,3,1},
+    {8455,2089,1,1},
+    {8457,2090,2,1},
+    {8458,2092,1,1},
+    {8459,2093,1,1},
+    {8460,2094,1,1},
+    {8461,2095,1,1},
+    {8462,2096,1,1},
+    {8463,2097,1,1},
+    {8464,2098,1,1},
+    {8465,2099,1,1},
+    {8466,2100,1,1},
+    {8467,2101,1,1},
+    {8469,2102,1,1},
+    {8470,2103,2,1},
+    {8473,2105,1,1},
+    {8474,2106,1,1},
+    {8475,2107,1,1},
+    {8476,2108,1,1},
+    {8477,2109,1,1},
+    {8480,2110,2,1},
+    {8481,2112,3,1},
+    {8482,2115,2,1},
+    {8484,2117,1,1},
+    {8486,2118,1,0},
+    {8488,2119,1,1},
+    {8490,2120,1,0},
+    {8491,2121,1,0},
+    {8492,2122,1,1},
+    {8493,2123,1,1},
+    {8495,2124,1,1},
+    {8496,2125,1,1},
+    {8497,2126,1,1},
+    {8499,2127,1,1},
+    {8500,2128,1,1},
+    {8501,2129,1,1},
+    {8502,2130,1,1},
+    {8503,2131,1,1},
+    {8504,2132,1,1},
+    {8505,2133,1,1},
+    {8507,2134,3,1},
+    {8508,2137,1,1},
+    {8509,2138,1,1},
+    {8510,2139,1,1},
+    {8511,2140,1,1},
+    {8512,2141,1,1},
+    {8517,2142,1,1},
+    {8518,2143,1,1},
+    {8519,2144,1,1},
+    {8520,2145,1,1},
+    {8521,2146,1,1},
+    {8528,2147,3,1},
+    {8529,2150,3,1},
+    {8530,2153,4,1},
+    {8531,2157,3,1},
+    {8532,2160,3,1},
+    {8533,2163,3,1},
+    {8534,2166,3,1},
+    {8535,2169,3,1},
+    {8536,2172,3,1},
+    {8537,2175,3,1},
+    {8538,2178,3,1},
+    {8539,2181,3,1},
+    {8540,2184,3,1},
+    {8541,2187,3,1},
+    {8542,2190,3,1},
+    {8543,2193,2,1},
+    {8544,2195,1,1},
+    {8545,2196,2,1},
+    {8546,2198,3,1},
+    {8547,2201,2,1},
+    {8548,2203,1,1},
+    {8549,2204,2,1},
+    {8550,2206,3,1},
+    {8551,2209,4,1},
+    {8552,2213,2,1},
+    {8553,2215,1,1},
+    {8554,2216,2,1},
+    {8555,2218,3,1},
+    {8556,2221,1,1},
+    {8557,2222,1,1},
+    {8558,2223,1,1},
+    {8559,2224,1,1},
+    {8560,2225,1,1},
+    {8561,2226,2,1},
+    {8562,2228,3,1},
+    {8563,2231,2,1},
+    {8564,2233,1,1},
+    {8565,2234,2,1},
+    {8566,2236,3,1},
+    {8567,2239,4,1},
+    {8568,2243,2,1},
+    {8569,2245,1,1},
+    {8570,2246,2,1},
+    {8571,2248,3,1},
+    {8572,2251,1,1},
+    {8573,2252,1,1},
+    {8574,2253,1,1},
+    {8575,2254,1,1},
+    {8585,2255,3,1},
+    {8602,2258,2,0},
+    {8603,2260,2,0},
+    {8622,2262,2,0},
+    {8653,2264,2,0},
+    {8654,2266,2,0},
+    {8655,2268,2,0},
+    {8708,2270,2,0},
+    {8713,2272,2,0},
+    {8716,2274,2,0},
+    {8740,2276,2,0},
+    {8742,2278,2,0},
+    {8748,2280,2,1},
+    {8749,2282,3,1},
+    {8751,2285,2,1},
+    {8752,2287,3,1},
+    {8769,2290,2,0},
+    {8772,2292,2,0},
+    {8775,2294,2,0},
+    {8777,2296,2,0},
+    {8800,2298,2,0},
+    {8802,2300,2,0},
+    {8813,2302,2,0},
+    {8814,2304,2,0},
+    {8815,2306,2,0},
+    {8816,2308,2,0},
+    {8817,2310,2,0},
+    {8820,2312,2,0},
+    {8821,2314,2,0},
+    {8824,2316,2,0},
+    {8825,2318,2,0},
+    {8832,2320,2,0},
+    {8833,2322,2,0},
+    {8836,2324,2,0},
+    {8837,2326,2,0},
+    {8840,2328,2,0},
+    {8841,2330,2,0},
+    {8876,2332,2,0},
+    {8877,2334,2,0},
+    {8878,2336,2,0},
+    {8879,2338,2,0},
+    {8928,2340,2,0},
+    {8929,2342,2,0},
+    {8930,2344,2,0},
+    {8931,2346,2,0},
+    {8938,2348,2,0},
+    {8939,2350,2,0},
+    {8940,2352,2,0},
+    {8941,2354,2,0},
+    {9001,2356,1,0},
+    {9002,2357,1,0},
+    {9312,2358,1,1},
+    {9313,2359,1,1},
+    {9314,2360,1,1},
+    {9315,2361,1,1},
+    {9316,2362,1,1},
+    {9317,2363,1,1},
+    {9318,2364,1,1},
+    {9319,2365,1,1},
+    {9320,2366,1,1},
+    {9321,2367,2,1},
+    {9322,2369,2,1},
+    {9323,2371,2,1},
+    {9324,2373,2,1},
+    {9325,2375,2,1},
+    {9326,2377,2,1},
+    {9327,2379,2,1},
+    {9328,2381,2,1},
+    {9329,2383,2,1},
+    {9330,2385,2,1},
+    {9331,2387,2,1},
+    {9332,2389,3,1},
+    {9333,2392,3,1},
+    {9334,2395,3,1},
+    {9335,2398,3,1},
+    {9336,2401,3,1},
+    {9337,2404,3,1},
+    {9338,2407,3,1},
+    {9339,2410,3,1},
+    {9340,2413,3,1},
+    {9341,2416,4,1},
+    {9342,2420,4,1},
+    {9343,2424,4,1},
+    {9344,2428,4,1},
+    {9345,2432,4,1},
+    {9346,2436,4,1},
+    {9347,2440,4,1},
+    {9348,2444,4,1},
+    {9349,2448,4,1},
+    {9350,2452,4,1},
+    {9351,2456,4,1},
+    {9352,2460,2,1},
+    {9353,2462,2,1},
+    {9354,2464,2,1},
+    {9355,2466,2,1},
+    {9356,2468,2,1},
+    {9357,2470,2,1},
+    {9358,2472,2,1},
+    {9359,2474,2,1},
+    {9360,2476,2,1},
+    {9361,2478,3,1},
+    {9362,2481,3,1},
+    {9363,2484,3,1},
+    {9364,2487,3,1},
+    {9365,2490,3,1},
+    {9366,2493,3,1},
+    {9367,2496,3,1},
+    {9368,2499,3,1},
+    {9369,2502,3,1},
+    {9370,2505,3,1},
+    {9371,2508,3,1},
+    {9372,2511,3,1},
+    {9373,2514,3,1},
+    {9374,2517,3,1},
+    {9375,2520,3,1},
+    {9376,2523,3,1},
+    {9377,2526,3,1},
+    {9378,2529,3,1},
+    {9379,2532,3,1},
+    {9380,2535,3,1},
+    {9381,2538,3,1},
+    {9382,2541,3,1},
+    {9383,2544,3,1},
+    {9384,2547,3,1},
+    {9385,2550,3,1},
+    {9386,2553,3,1},
+    {9387,2556,3,1},
+    {9388,2559,3,1},
+    {9389,2562,3,1},
+    {9390,2565,3,1},
+    {9391,2568,3,1},
+    {9392,2571,3,1},
+    {9393,2574,3,1},
+    {9394,2577,3,1},
+    {9395,2580,3,1},
+    {9396,2583,3,1},
+    {9397,2586,3,1},
+    {9398,2589,1,1},
+    {9399,2590,1,1},
+    {9400,2591,1,1},
+    {9401,2592,1,1},
+    {9402,2593,1,1},
+    {9403,2594,1,1},
+    {9404,2595,1,1},
+    {9405,2596,1,1},
+    {9406,2597,1,1},
+    {9407,2598,1,1},
+    {9408,2599,1,1},
+    {9409,2600,1,1},
+    {9410,2601,1,1},
+    {9411,2602,1,1},
+    {9412,2603,1,1},
+    {9413,2604,1,1},
+    {9414,2605,1,1},
+    {9415,2606,1,1},
+    {9416,2607,1,1},
+    {9417,2608,1,1},
+    {9418,2609,1,1},
+    {9419,2610,1,1},
+    {9420,2611,1,1},
+    {9421,2612,1,1},
+    {9422,2613,1,1},
+    {9423,2614,1,1},
+    {9424,2615,1,1},
+    {9425,2616,1,1},
+    {9426,2617,1,1},
+    {9427,2618,1,1},
+    {9428,2619,1,1},
+    {9429,2620,1,1},
+    {9430,2621,1,1},
+    {9431,2622,1,1},
+    {9432,2623,1,1},
+    {9433,2624,1,1},
+    {9434,2625,1,1},
+    {9435,2626,1,1},
+    {9436,2627,1,1},
+    {9437,2628,1,1},
+    {9438,2629,1,1},
+    {9439,2630,1,1},
+    {9440,2631,1,1},
+    {9441,2632,1,1},
+    {9442,2633,1,1},
+    {9443,2634,1,1},
+    {9444,2635,1,1},
+    {9445,2636,1,1},
+    {9446,2637,1,1},
+    {9447,2638,1,1},
+    {9448,2639,1,1},
+    {9449,2640,1,1},
+    {9450,2641,1,1},
+    {10764,2642,4,1},
+    {10868,2646,3,1},
+    {10869,2649,2,1},
+    {10870,2651,3,1},
+    {10972,2654,2,0},
+    {11388,2656,1,1},
+    {11389,2657,1,1},
+    {11631,2658,1,1},
+    {11935,2659,1,1},
+    {12019,2660,1,1},
+    {12032,2661,1,1},
+    {12033,2662,1,1},
+    {12034,2663,1,1},
+    {12035,2664,1,1},
+    {12036,2665,1,1},
+    {12037,2666,1,1},
+    {12038,2667,1,1},
+    {12039,2668,1,1},
+    {12040,2669,1,1},
+    {12041,2670,1,1},
+    {12042,2671,1,1},
+    {12043,2672,1,1},
+    {12044,2673,1,1},
+    {12045,2674,1,1},
+    {12046,2675,1,1},
+    {12047,2676,1,1},
+    {12048,2677,1,1},
+    {12049,2678,1,1},
+    {12050,2679,1,1},
+    {12051,2680,1,1},
+    {12052,2681,1,1},
+    {12053,2682,1,1},
+    {12054,2683,1,1},
+    {12055,2684,1,1},
+    {12056,2685,1,1},
+    {12057,2686,1,1},
+    {12058,2687,1,1},
+    {12059,2688,1,1},
+    {12060,2689,1,1},
+    {12061,2690,1,1},
+    {12062,2691,1,1},
+    {12063,2692,1,1},
+    {12064,2693,1,1},
+    {12065,2694,1,1},
+    {12066,2695,1,1},
+    {12067,2696,1,1},
+    {12068,2697,1,1},
+    {12069,2698,1,1},
+    {12070,2699,1,1},
+    {12071,2700,1,1},
+    {12072,2701,1,1},
+    {12073,2702,1,1},
+    {12074,2703,1,1},
+    {12075,2704,1,1},
+    {12076,2705,1,1},
+    {12077,2706,1,1},
+    {12078,2707,1,1},
+    {12079,2708,1,1},
+    {12080,2709,1,1},
+    {12081,2710,1,1},
+    {12082,2711,1,1},
+    {12083,2712,1,1},
+    {12084,2713,1,1},
+    {12085,2714,1,1},
+    {12086,2715,1,1},
+    {12087,2716,1,1},
+    {12088,2717,1,1},
+    {12089,2718,1,1},
+    {12090,2719,1,1},
+    {12091,2720,1,1},
+    {12092,2721,1,1},
+    {12093,2722,1,1},
+    {12094,2723,1,1},
+    {12095,2724,1,1},
+    {12096,2725,1,1},
+    {12097,2726,1,1},
+    {12098,2727,1,1},
+    {12099,2728,1,1},
+    {12100,2729,1,1},
+    {12101,2730,1,1},
+    {12102,2731,1,1},
+    {12103,2732,1,1},
+    {12104,2733,1,1},
+    {12105,2734,1,1},
+    {12106,2735,1,1},
+    {12107,2736,1,1},
+    {12108,2737,1,1},
+    {12109,2738,1,1},
+    {12110,2739,1,1},
+    {12111,2740,1,1},
+    {12112,2741,1,1},
+    {12113,2742,1,1},
+    {12114,2743,1,1},
+    {12115,2744,1,1},
+    {12116,2745,1,1},
+    {12117,2746,1,1},
+    {12118,2747,1,1},
+    {12119,2748,1,1},
+    {12120,2749,1,1},
+    {12121,2750,1,1},
+    {12122,2751,1,1},
+    {12123,2752,1,1},
+    {12124,2753,1,1},
+    {12125,2754,1,1},
+    {12126,2755,1,1},
+    {12127,2756,1,1},
+    {12128,2757,1,1},
+    {12129,2758,1,1},
+    {12130,2759,1,1},
+    {12131,2760,1,1},
+    {12132,2761,1,1},
+    {12133,2762,1,1},
+    {12134,2763,1,1},
+    {12135,2764,1,1},
+    {12136,2765,1,1},
+    {12137,2766,1,1},
+    {12138,2767,1,1},
+    {12139,2768,1,1},
+    {12140,2769,1,1},
+    {12141,2770,1,1},
+    {12142,2771,1,1},
+    {12143,2772,1,1},
+    {12144,2773,1,1},
+    {12145,2774,1,1},
+    {12146,2775,1,1},
+    {12147,2776,1,1},
+    {12148,2777,1,1},
+    {12149,2778,1,1},
+    {12150,2779,1,1},
+    {12151,2780,1,1},
+    {12152,2781,1,1},
+    {12153,2782,1,1},
+    {12154,2783,1,1},
+    {12155,2784,1,1},
+    {12156,2785,1,1},
+    {12157,2786,1,1},
+    {12158,2787,1,1},
+    {12159,2788,1,1},
+    {12160,2789,1,1},
+    {12161,2790,1,1},
+    {12162,2791,1,1},
+    {12163,2792,1,1},
+    {12164,2793,1,1},
+    {12165,2794,1,1},
+    {12166,2795,1,1},
+    {12167,2796,1,1},
+    {12168,2797,1,1},
+    {12169,2798,1,1},
+    {12170,2799,1,1},
+    {12171,2800,1,1},
+    {12172,2801,1,1},
+    {12173,2802,1,1},
+    {12174,2803,1,1},
+    {12175,2804,1,1},
+    {12176,2805,1,1},
+    {12177,2806,1,1},
+    {12178,2807,1,1},
+    {12179,2808,1,1},
+    {12180,2809,1,1},
+    {12181,2810,1,1},
+    {12182,2811,1,1},
+    {12183,2812,1,1},
+    {12184,2813,1,1},
+    {12185,2814,1,1},
+    {12186,2815,1,1},
+    {12187,2816,1,1},
+    {12188,2817,1,1},
+    {12189,2818,1,1},
+    {12190,2819,1,1},
+    {12191,2820,1,1},
+    {12192,2821,1,1},
+    {12193,2822,1,1},
+    {12194,2823,1,1},
+    {12195,2824,1,1},
+    {12196,2825,1,1},
+    {12197,2826,1,1},
+    {12198,2827,1,1},
+    {12199,2828,1,1},
+    {12200,2829,1,1},
+    {12201,2830,1,1},
+    {12202,2831,1,1},
+    {12203,2832,1,1},
+    {12204,2833,1,1},
+    {12205,2834,1,1},
+    {12206,2835,1,1},
+    {12207,2836,1,1},
+    {12208,2837,1,1},
+    {12209,2838,1,1},
+    {12210,2839,1,1},
+    {12211,2840,1,1},
+    {12212,2841,1,1},
+    {12213,2842,1,1},
+    {12214,2843,1,1},
+    {12215,2844,1,1},
+    {12216,2845,1,1},
+    {12217,2846,1,1},
+    {12218,2847,1,1},
+    {12219,2848,1,1},
+    {12220,2849,1,1},
+    {12221,2850,1,1},
+    {12222,2851,1,1},
+    {12223,2852,1,1},
+    {12224,2853,1,1},
+    {12225,2854,1,1},
+    {12226,2855,1,1},
+    {12227,2856,1,1},
+    {12228,2857,1,1},
+    {12229,2858,1,1},
+    {12230,2859,1,1},
+    {12231,2860,1,1},
+    {12232,2861,1,1},
+    {12233,2862,1,1},
+    {12234,2863,1,1},
+    {12235,2864,1,1},
+    {12236,2865,1,1},
+    {12237,2866,1,1},
+    {12238,2867,1,1},
+    {12239,2868,1,1},
+    {12240,2869,1,1},
+    {12241,2870,1,1},
+    {12242,2871,1,1},
+    {12243,2872,1,1},
+    {12244,2873,1,1},
+    {12245,2874,1,1},
+    {12288,2875,1,1},
+    {12342,2876,1,1},
+    {12344,2877,1,1},
+    {12345,2878,1,1},
+    {12346,2879,1,1},
+    {12364,2880,2,0},
+    {12366,2882,2,0},
+    {12368,2884,2,0},
+    {12370,2886,2,0},
+    {12372,2888,2,0},
+    {12374,2890,2,0},
+    {12376,2892,2,0},
+    {12378,2894,2,0},
+    {12380,2896,2,0},
+    {12382,2898,2,0},
+    {12384,2900,2,0},
+    {12386,2902,2,0},
+    {12389,2904,2,0},
+    {12391,2906,2,0},
+    {12393,2908,2,0},
+    {12400,2910,2,0},
+    {12401,2912,2,0},
+    {12403,2914,2,0},
+    {12404,2916,2,0},
+    {12406,2918,2,0},
+    {12407,2920,2,0},
+    {12409,2922,2,0},
+    {12410,2924,2,0},
+    {12412,2926,2,0},
+    {12413,2928,2,0},
+    {12436,2930,2,0},
+    {12443,2932,2,1},
+    {12444,2934,2,1},
+    {12446,2936,2,0},
+    {12447,2938,2,1},
+    {12460,2940,2,0},
+    {12462,2942,2,0},
+    {12464,2944,2,0},
+    {12466,2946,2,0},
+    {12468,2948,2,0},
+    {12470,2950,2,0},
+    {12472,2952,2,0},
+    {12474,2954,2,0},
+    {12476,2956,2,0},
+    {12478,2958,2,0},
+    {12480,2960,2,0},
+    {12482,2962,2,0},
+    {12485,2964,2,0},
+    {12487,2966,2,0},
+    {12489,2968,2,0},
+    {12496,2970,2,0},
+    {12497,2972,2,0},
+    {12499,2974,2,0},
+    {12500,2976,2,0},
+    {12502,2978,2,0},
+    {12503,2980,2,0},
+    {12505,2982,2,0},
+    {12506,2984,2,0},
+    {12508,2986,2,0},
+    {12509,2988,2,0},
+    {12532,2990,2,0},
+    {12535,2992,2,0},
+    {12536,2994,2,0},
+    {12537,2996,2,0},
+    {12538,2998,2,0},
+    {12542,3000,2,0},
+    {12543,3002,2,1},
+    {12593,3004,1,1},
+    {12594,3005,1,1},
+    {12595,3006,1,1},
+    {12596,3007,1,1},
+    {12597,3008,1,1},
+    {12598,3009,1,1},
+    {12599,3010,1,1},
+    {12600,3011,1,1},
+    {12601,3012,1,1},
+    {12602,3013,1,1},
+    {12603,3014,1,1},
+    {12604,3015,1,1},
+    {12605,3016,1,1},
+    {12606,3017,1,1},
+    {12607,3018,1,1},
+    {12608,3019,1,1},
+    {12609,3020,1,1},
+    {12610,3021,1,1},
+    {12611,3022,1,1},
+    {12612,3023,1,1},
+    {12613,3024,1,1},
+    {12614,3025,1,1},
+    {12615,3026,1,1},
+    {12616,3027,1,1},
+    {12617,3028,1,1},
+    {12618,3029,1,1},
+    {12619,3030,1,1},
+    {12620,3031,1,1},
+    {12621,3032,1,1},
+    {12622,3033,1,1},
+    {12623,3034,1,1},
+    {12624,3035,1,1},
+    {12625,3036,1,1},
+    {12626,3037,1,1},
+    {12627,3038,1,1},
+    {12628,3039,1,1},
+    {12629,3040,1,1},
+    {12630,3041,1,1},
+    {12631,3042,1,1},
+    {12632,3043,1,1},
+    {12633,3044,1,1},
+    {12634,3045,1,1},
+    {12635,3046,1,1},
+    {12636,3047,1,1},
+    {12637,3048,1,1},
+    {12638,3049,1,1},
+    {12639,3050,1,1},
+    {12640,3051,1,1},
+    {12641,3052,1,1},
+    {12642,3053,1,1},
+    {12643,3054,1,1},
+    {12644,3055,1,1},
+    {12645,3056,1,1},
+    {12646,3057,1,1},
+    {12647,3058,1,1},
+    {12648,3059,1,1},
+    {12649,3060,1,1},
+    {12650,3061,1,1},
+    {12651,3062,1,1},
+    {12652,3063,1,1},
+    {12653,3064,1,1},
+    {12654,3065,1,1},
+    {12655,3066,1,1},
+    {12656,3067,1,1},
+    {12657,3068,1,1},
+    {12658,3069,1,1},
+    {12659,3070,1,1},
+    {12660,3071,1,1},
+    {12661,3072,1,1},
+    {12662,3073,1,1},
+    {12663,3074,1,1},
+    {12664,3075,1,1},
+    {12665,3076,1,1},
+    {12666,3077,1,1},
+    {12667,3078,1,1},
+    {12668,3079,1,1},
+    {12669,3080,1,1},
+    {12670,3081,1,1},
+    {12671,3082,1,1},
+    {12672,3083,1,1},
+    {12673,3084,1,1},
+    {12674,3085,1,1},
+    {12675,3086,1,1},
+    {12676,3087,1,1},
+    {12677,3088,1,1},
+    {12678,3089,1,1},
+    {12679,3090,1,1},
+    {12680,3091,1,1},
+    {12681,3092,1,1},
+    {12682,3093,1,1},
+    {12683,3094,1,1},
+    {12684,3095,1,1},
+    {12685,3096,1,1},
+    {12686,3097,1,1},
+    {12690,3098,1,1},
+    {12691,3099,1,1},
+    {12692,3100,1,1},
+    {12693,3101,1,1},
+    {12694,3102,1,1},
+    {12695,3103,1,1},
+    {12696,3104,1,1},
+    {12697,3105,1,1},
+    {12698,3106,1,1},
+    {12699,3107,1,1},
+    {12700,3108,1,1},
+    {12701,3109,1,1},
+    {12702,3110,1,1},
+    {12703,3111,1,1},
+    {12800,3112,3,1},
+    {12801,3115,3,1},
+    {12802,3118,3,1},
+    {12803,3121,3,1},
+    {12804,3124,3,1},
+    {12805,3127,3,1},
+    {12806,3130,3,1},
+    {12807,3133,3,1},
+    {12808,3136,3,1},
+    {12809,3139,3,1},
+    {12810,3142,3,1},
+    {12811,3145,3,1},
+    {12812,3148,3,1},
+    {12813,3151,3,1},
+    {12814,3154,4,1},
+    {12815,3158,4,1},
+    {12816,3162,4,1},
+    {12817,3166,4,1},
+    {12818,3170,4,1},
+    {12819,3174,4,1},
+    {12820,3178,4,1},
+    {12821,3182,4,1},
+    {12822,3186,4,1},
+    {12823,3190,4,1},
+    {12824,3194,4,1},
+    {12825,3198,4,1},
+    {12826,3202,4,1},
+    {12827,3206,4,1},
+    {12828,3210,4,1},
+    {12829,3214,7,1},
+    {12830,3221,6,1},
+    {12832,3227,3,1},
+    {12833,3230,3,1},
+    {12834,3233,3,1},
+    {12835,3236,3,1},
+    {12836,3239,3,1},
+    {12837,3242,3,1},
+    {12838,3245,3,1},
+    {12839,3248,3,1},
+    {12840,3251,3,1},
+    {12841,3254,3,1},
+    {12842,3257,3,1},
+    {12843,3260,3,1},
+    {12844,3263,3,1},
+    {12845,3266,3,1},
+    {12846,3269,3,1},
+    {12847,3272,3,1},
+    {12848,3275,3,1},
+    {12849,3278,3,1},
+    {12850,3281,3,1},
+    {12851,3284,3,1},
+    {12852,3287,3,1},
+    {12853,3290,3,1},
+    {12854,3293,3,1},
+    {12855,3296,3,1},
+    {12856,3299,3,1},
+    {12857,3302,3,1},
+    {12858,3305,3,1},
+    {12859,3308,3,1},
+    {12860,3311,3,1},
+    {12861,3314,3,1},
+    {12862,3317,3,1},
+    {12863,3320,3,1},
+    {12864,3323,3,1},
+    {12865,3326,3,1},
+    {12866,3329,3,1},
+    {12867,3332,3,1},
+    {12868,3335,1,1},
+    {12869,3336,1,1},
+    {12870,3337,1,1},
+    {12871,3338,1,1},
+    {12880,3339,3,1},
+    {12881,3342,2,1},
+    {12882,3344,2,1},
+    {12883,3346,2,1},
+    {12884,3348,2,1},
+    {12885,3350,2,1},
+    {12886,3352,2,1},
+    {12887,3354,2,1},
+    {12888,3356,2,1},
+    {12889,3358,2,1},
+    {12890,3360,2,1},
+    {12891,3362,2,1},
+    {12892,3364,2,1},
+    {12893,3366,2,1},
+    {12894,3368,2,1},
+    {12895,3370,2,1},
+    {12896,3372,1,1},
+    {12897,3373,1,1},
+    {12898,3374,1,1},
+    {12899,3375,1,1},
+    {12900,3376,1,1},
+    {12901,3377,1,1},
+    {12902,3378,1,1},
+    {12903,3379,1,1},
+    {12904,3380,1,1},
+    {12905,3381,1,1},
+    {12906,3382,1,1},
+    {12907,3383,1,1},
+    {12908,3384,1,1},
+    {12909,3385,1,1},
+    {12910,3386,2,1},
+    {12911,3388,2,1},
+    {12912,3390,2,1},
+    {12913,3392,2,1},
+    {12914,3394,2,1},
+    {12915,3396,2,1},
+    {12916,3398,2,1},
+    {12917,3400,2,1},
+    {12918,3402,2,1},
+    {12919,3404,2,1},
+    {12920,3406,2,1},
+    {12921,3408,2,1},
+    {12922,3410,2,1},
+    {12923,3412,2,1},
+    {12924,3414,5,1},
+    {12925,3419,4,1},
+    {12926,3423,2,1},
+    {12928,3425,1,1},
+    {12929,3426,1,1},
+    {12930,3427,1,1},
+    {12931,3428,1,1},
+    {12932,3429,1,1},
+    {12933,3430,1,1},
+    {12934,3431,1,1},
+    {12935,3432,1,1},
+    {12936,3433,1,1},
+    {12937,3434,1,1},
+    {12938,3435,1,1},
+    {12939,3436,1,1},
+    {12940,3437,1,1},
+    {12941,3438,1,1},
+    {12942,3439,1,1},
+    {12943,3440,1,1},
+    {12944,3441,1,1},
+    {12945,3442,1,1},
+    {12946,3443,1,1},
+    {12947,3444,1,1},
+    {12948,3445,1,1},
+    {12949,3446,1,1},
+    {12950,3447,1,1},
+    {12951,3448,1,1},
+    {12952,3449,1,1},
+    {12953,3450,1,1},
+    {12954,3451,1,1},
+    {12955,3452,1,1},
+    {12956,3453,1,1},
+    {12957,3454,1,1},
+    {12958,3455,1,1},
+    {12959,3456,1,1},
+    {12960,3457,1,1},
+    {12961,3458,1,1},
+    {12962,3459,1,1},
+    {12963,3460,1,1},
+    {12964,3461,1,1},
+    {12965,3462,1,1},
+    {12966,3463,1,1},
+    {12967,3464,1,1},
+    {12968,3465,1,1},
+    {12969,3466,1,1},
+    {12970,3467,1,1},
+    {12971,3468,1,1},
+    {12972,3469,1,1},
+    {12973,3470,1,1},
+    {12974,3471,1,1},
+    {12975,3472,1,1},
+    {12976,3473,1,1},
+    {12977,3474,2,1},
+    {12978,3476,2,1},
+    {12979,3478,2,1},
+    {12980,3480,2,1},
+    {12981,3482,2,1},
+    {12982,3484,2,1},
+    {12983,3486,2,1},
+    {12984,3488,2,1},
+    {12985,3490,2,1},
+    {12986,3492,2,1},
+    {12987,3494,2,1},
+    {12988,3496,2,1},
+    {12989,3498,2,1},
+    {12990,3500,2,1},
+    {12991,3502,2,1},
+    {12992,3504,2,1},
+    {12993,3506,2,1},
+    {12994,3508,2,1},
+    {12995,3510,2,1},
+    {12996,3512,2,1},
+    {12997,3514,2,1},
+    {12998,3516,2,1},
+    {12999,3518,2,1},
+    {13000,3520,2,1},
+    {13001,3522,3,1},
+    {13002,3525,3,1},
+    {13003,3528,3,1},
+    {13004,3531,2,1},
+    {13005,3533,3,1},
+    {13006,3536,2,1},
+    {13007,3538,3,1},
+    {13008,3541,1,1},
+    {13009,3542,1,1},
+    {13010,3543,1,1},
+    {13011,3544,1,1},
+    {13012,3545,1,1},
+    {13013,3546,1,1},
+    {13014,3547,1,1},
+    {13015,3548,1,1},
+    {13016,3549,1,1},
+    {13017,3550,1,1},
+    {13018,3551,1,1},
+    {13019,3552,1,1},
+    {13020,3553,1,1},
+    {13021,3554,1,1},
+    {13022,3555,1,1},
+    {13023,3556,1,1},
+    {13024,3557,1,1},
+    {13025,3558,1,1},
+    {13026,3559,1,1},
+    {13027,3560,1,1},
+    {13028,3561,1,1},
+    {13029,3562,1,1},
+    {13030,3563,1,1},
+    {13031,3564,1,1},
+    {13032,3565,1,1},
+    {13033,3566,1,1},
+    {13034,3567,1,1},
+    {13035,3568,1,1},
+    {13036,3569,1,1},
+    {13037,3570,1,1},
+    {13038,3571,1,1},
+    {13039,3572,1,1},
+    {13040,3573,1,1},
+    {13041,3574,1,1},
+    {13042,3575,1,1},
+    {13043,3576,1,1},
+    {13044,3577,1,1},
+    {13045,3578,1,1},
+    {13046,3579,1,1},
+    {13047,3580,1,1},
+    {13048,3581,1,1},
+    {13049,3582,1,1},
+    {13050,3583,1,1},
+    {13051,3584,1,1},
+    {13052,3585,1,1},
+    {13053,3586,1,1},
+    {13054,3587,1,1},
+    {13055,3588,2,1},
+    {13056,3590,4,1},
+    {13057,3594,4,1},
+    {13058,3598,4,1},
+    {13059,3602,3,1},
+    {13060,3605,4,1},
+    {13061,3609,3,1},
+    {13062,3612,3,1},
+    {13063,3615,5,1},
+    {13064,3620,4,1},
+    {13065,3624,3,1},
+    {13066,3627,3,1},
+    {13067,3630,3,1},
+    {13068,3633,4,1},
+    {13069,3637,4,1},
+    {13070,3641,3,1},
+    {13071,3644,3,1},
+    {13072,3647,2,1},
+    {13073,3649,3,1},
+    {13074,3652,4,1},
+    {13075,3656,4,1},
+    {13076,3660,2,1},
+    {13077,3662,5,1},
+    {13078,3667,6,1},
+    {13079,3673,5,1},
+    {13080,3678,3,1},
+    {13081,3681,5,1},
+    {13082,3686,5,1},
+    {13083,3691,4,1},
+    {13084,3695,3,1},
+    {13085,3698,3,1},
+    {13086,3701,3,1},
+    {13087,3704,4,1},
+    {13088,3708,5,1},
+    {13089,3713,4,1},
+    {13090,3717,3,1},
+    {13091,3720,3,1},
+    {13092,3723,3,1},
+    {13093,3726,2,1},
+    {13094,3728,2,1},
+    {13095,3730,2,1},
+    {13096,3732,2,1},
+    {13097,3734,3,1},
+    {13098,3737,3,1},
+    {13099,3740,5,1},
+    {13100,3745,3,1},
+    {13101,3748,4,1},
+    {13102,3752,5,1},
+    {13103,3757,3,1},
+    {13104,3760,2,1},
+    {13105,3762,2,1},
+    {13106,3764,5,1},
+    {13107,3769,4,1},
+    {13108,3773,5,1},
+    {13109,3778,3,1},
+    {13110,3781,5,1},
+    {13111,3786,2,1},
+    {13112,3788,3,1},
+    {13113,3791,3,1},
+    {13114,3794,3,1},
+    {13115,3797,3,1},
+    {13116,3800,3,1},
+    {13117,3803,4,1},
+    {13118,3807,3,1},
+    {13119,3810,2,1},
+    {13120,3812,3,1},
+    {13121,3815,3,1},
+    {13122,3818,3,1},
+    {13123,3821,4,1},
+    {13124,3825,3,1},
+    {13125,3828,3,1},
+    {13126,3831,3,1},
+    {13127,3834,5,1},
+    {13128,3839,4,1},
+    {13129,3843,2,1},
+    {13130,3845,5,1},
+    {13131,3850,2,1},
+    {13132,3852,4,1},
+    {13133,3856,4,1},
+    {13134,3860,3,1},
+    {13135,3863,3,1},
+    {13136,3866,3,1},
+    {13137,3869,4,1},
+    {13138,3873,2,1},
+    {13139,3875,3,1},
+    {13140,3878,4,1},
+    {13141,3882,2,1},
+    {13142,3884,5,1},
+    {13143,3889,3,1},
+    {13144,3892,2,1},
+    {13145,3894,2,1},
+    {13146,3896,2,1},
+    {13147,3898,2,1},
+    {13148,3900,2,1},
+    {13149,3902,2,1},
+    {13150,3904,2,1},
+    {13151,3906,2,1},
+    {13152,3908,2,1},
+    {13153,3910,2,1},
+    {13154,3912,3,1},
+    {13155,3915,3,1},
+    {13156,3918,3,1},
+    {13157,3921,3,1},
+    {13158,3924,3,1},
+    {13159,3927,3,1},
+    {13160,3930,3,1},
+    {13161,3933,3,1},
+    {13162,3936,3,1},
+    {13163,3939,3,1},
+    {13164,3942,3,1},
+    {13165,3945,3,1},
+    {13166,3948,3,1},
+    {13167,3951,3,1},
+    {13168,3954,3,1},
+    {13169,3957,3,1},
+    {13170,3960,2,1},
+    {13171,3962,2,1},
+    {13172,3964,3,1},
+    {13173,3967,2,1},
+    {13174,3969,2,1},
+    {13175,3971,2,1},
+    {13176,3973,3,1},
+    {13177,3976,3,1},
+    {13178,3979,2,1},
+    {13179,3981,2,1},
+    {13180,3983,2,1},
+    {13181,3985,2,1},
+    {13182,3987,2,1},
+    {13183,3989,4,1},
+    {13184,3993,2,1},
+    {13185,3995,2,1},
+    {13186,3997,2,1},
+    {13187,3999,2,1},
+    {13188,4001,2,1},
+    {13189,4003,2,1},
+    {13190,4005,2,1},
+    {13191,4007,2,1},
+    {13192,4009,3,1},
+    {13193,4012,4,1},
+    {13194,4016,2,1},
+    {13195,4018,2,1},
+    {13196,4020,2,1},
+    {13197,4022,2,1},
+    {13198,4024,2,1},
+    {13199,4026,2,1},
+    {13200,4028,2,1},
+    {13201,4030,3,1},
+    {13202,4033,3,1},
+    {13203,4036,3,1},
+    {13204,4039,3,1},
+    {13205,4042,2,1},
+    {13206,4044,2,1},
+    {13207,4046,2,1},
+    {13208,4048,2,1},
+    {13209,4050,2,1},
+    {13210,4052,2,1},
+    {13211,4054,2,1},
+    {13212,4056,2,1},
+    {13213,4058,2,1},
+    {13214,4060,2,1},
+    {13215,4062,3,1},
+    {13216,4065,3,1},
+    {13217,4068,2,1},
+    {13218,4070,3,1},
+    {13219,4073,3,1},
+    {13220,4076,3,1},
+    {13221,4079,2,1},
+    {13222,4081,3,1},
+    {13223,4084,3,1},
+    {13224,4087,4,1},
+    {13225,4091,2,1},
+    {13226,4093,3,1},
+    {13227,4096,3,1},
+    {13228,4099,3,1},
+    {13229,4102,3,1},
+    {13230,4105,5,1},
+    {13231,4110,6,1},
+    {13232,4116,2,1},
+    {13233,4118,2,1},
+    {13234,4120,2,1},
+    {13235,4122,2,1},
+    {13236,4124,2,1},
+    {13237,4126,2,1},
+    {13238,4128,2,1},
+    {13239,4130,2,1},
+    {13240,4132,2,1},
+    {13241,4134,2,1},
+    {13242,4136,2,1},
+    {13243,4138,2,1},
+    {13244,4140,2,1},
+    {13245,4142,2,1},
+    {13246,4144,2,1},
+    {13247,4146,2,1},
+    {13248,4148,2,1},
+    {13249,4150,2,1},
+    {13250,4152,4,1},
+    {13251,4156,2,1},
+    {13252,4158,2,1},
+    {13253,4160,2,1},
+    {13254,4162,4,1},
+    {13255,4166,3,1},
+    {13256,4169,2,1},
+    {13257,4171,2,1},
+    {13258,4173,2,1},
+    {13259,4175,2,1},
+    {13260,4177,2,1},
+    {13261,4179,2,1},
+    {13262,4181,2,1},
+    {13263,4183,2,1},
+    {13264,4185,2,1},
+    {13265,4187,2,1},
+    {13266,4189,3,1},
+    {13267,4192,2,1},
+    {13268,4194,2,1},
+    {13269,4196,3,1},
+    {13270,4199,3,1},
+    {13271,4202,2,1},
+    {13272,4204,4,1},
+    {13273,4208,3,1},
+    {13274,4211,2,1},
+    {13275,4213,2,1},
+    {13276,4215,2,1},
+    {13277,4217,2,1},
+    {13278,4219,3,1},
+    {13279,4222,3,1},
+    {13280,4225,2,1},
+    {13281,4227,2,1},
+    {13282,4229,2,1},
+    {13283,4231,2,1},
+    {13284,4233,2,1},
+    {13285,4235,2,1},
+    {13286,4237,2,1},
+    {13287,4239,2,1},
+    {13288,4241,2,1},
+    {13289,4243,3,1},
+    {13290,4246,3,1},
+    {13291,4249,3,1},
+    {13292,4252,3,1},
+    {13293,4255,3,1},
+    {13294,4258,3,1},
+    {13295,4261,3,1},
+    {13296,4264,3,1},
+    {13297,4267,3,1},
+    {13298,4270,3,1},
+    {13299,4273,3,1},
+    {13300,4276,3,1},
+    {13301,4279,3,1},
+    {13302,4282,3,1},
+    {13303,4285,3,1},
+    {13304,4288,3,1},
+    {13305,4291,3,1},
+    {13306,4294,3,1},
+    {13307,4297,3,1},
+    {13308,4300,3,1},
+    {13309,4303,3,1},
+    {13310,4306,3,1},
+    {13311,4309,3,1},
+    {42652,4312,1,1},
+    {42653,4313,1,1},
+    {42864,4314,1,1},
+    {42994,4315,1,1},
+    {42995,4316,1,1},
+    {42996,4317,1,1},
+    {43000,4318,1,1},
+    {43001,4319,1,1},
+    {43868,4320,1,1},
+    {43869,4321,1,1},
+    {43870,4322,1,1},
+    {43871,4323,1,1},
+    {43881,4324,1,1},
+    {63744,4325,1,0},
+    {63745,4326,1,0},
+    {63746,4327,1,0},
+    {63747,4328,1,0},
+    {63748,4329,1,0},
+    {63749,4330,1,0},
+    {63750,4331,1,0},
+    {63751,4332,1,0},
+    {63752,4333,1,0},
+    {63753,4334,1,0},
+    {63754,4335,1,0},
+    {63755,4336,1,0},
+    {63756,4337,1,0},
+    {63757,4338,1,0},
+    {63758,4339,1,0},
+    {63759,4340,1,0},
+    {63760,4341,1,0},
+    {63761,4342,1,0},
+    {63762,4343,1,0},
+    {63763,4344,1,0},
+    {63764,4345,1,0},
+    {63765,4346,1,0},
+    {63766,4347,1,0},
+    {63767,4348,1,0},
+    {63768,4349,1,0},
+    {63769,4350,1,0},
+    {63770,4351,1,0},
+    {63771,4352,1,0},
+    {63772,4353,1,0},
+    {63773,4354,1,0},
+    {63774,4355,1,0},
+    {63775,4356,1,0},
+    {63776,4357,1,0},
+    {63777,4358,1,0},
+    {63778,4359,1,0},
+    {63779,4360,1,0},
+    {63780,4361,1,0},
+    {63781,4362,1,0},
+    {63782,4363,1,0},
+    {63783,4364,1,0},
+    {63784,4365,1,0},
+    {63785,4366,1,0},
+    {63786,4367,1,0},
+    {63787,4368,1,0},
+    {63788,4369,1,0},
+    {63789,4370,1,0},
+    {63790,4371,1,0},
+    {63791,4372,1,0},
+    {63792,4373,1,0},
+    {63793,4374,1,0},
+    {63794,4375,1,0},
+    {63795,4376,1,0},
+    {63796,4377,1,0},
+    {63797,4378,1,0},
+    {63798,4379,1,0},
+    {63799,4380,1,0},
+    {63800,4381,1,0},
+    {63801,4382,1,0},
+    {63802,4383,1,0},
+    {63803,4384,1,0},
+    {63804,4385,1,0},
+    {63805,4386,1,0},
+    {63806,4387,1,0},
+    {63807,4388,1,0},
+    {63808,4389,1,0},
+    {63809,4390,1,0},
+    {63810,4391,1,0},
+    {63811,4392,1,0},
+    {63812,4393,1,0},
+    {63813,4394,1,0},
+    {63814,4395,1,0},
+    {63815,4396,1,0},
+    {63816,4397,1,0},
+    {63817,4398,1,0},
+    {63818,4399,1,0},
+    {63819,4400,1,0},
+    {63820,4401,1,0},
+    {63821,4402,1,0},
+    {63822,4403,1,0},
+    {63823,4404,1,0},
+    {63824,4405,1,0},
+    {63825,4406,1,0},
+    {63826,4407,1,0},
+    {63827,4408,1,0},
+    {63828,4409,1,0},
+    {63829,4410,1,0},
+    {63830,4411,1,0},
+    {63831,4412,1,0},
+    {63832,4413,1,0},
+    {63833,4414,1,0},
+    {63834,4415,1,0},
+    {63835,4416,1,0},
+    {63836,4417,1,0},
+    {63837,4418,1,0},
+    {63838,4419,1,0},
+    {63839,4420,1,0},
+    {63840,4421,1,0},
+    {63841,4422,1,0},
+    {63842,4423,1,0},
+    {63843,4424,1,0},
+    {63844,4425,1,0},
+    {63845,4426,1,0},
+    {63846,4427,1,0},
+    {63847,4428,1,0},
+    {63848,4429,1,0},
+    {63849,4430,1,0},
+    {63850,4431,1,0},
+    {63851,4432,1,0},
+    {63852,4433,1,0},
+    {63853,4434,1,0},
+    {63854,4435,1,0},
+    {63855,4436,1,0},
+    {63856,4437,1,0},
+    {63857,4438,1,0},
+    {63858,4439,1,0},
+    {63859,4440,1,0},
+    {63860,4441,1,0},
+    {63861,4442,1,0},
+    {63862,4443,1,0},
+    {63863,4444,1,0},
+    {63864,4445,1,0},
+    {63865,4446,1,0},
+    {63866,4447,1,0},
+    {63867,4448,1,0},
+    {63868,4449,1,0},
+    {63869,4450,1,0},
+    {63870,4451,1,0},
+    {63871,4452,1,0},
+    {63872,4453,1,0},
+    {63873,4454,1,0},
+    {63874,4455,1,0},
+    {63875,4456,1,0},
+    {63876,4457,1,0},
+    {63877,4458,1,0},
+    {63878,4459,1,0},
+    {63879,4460,1,0},
+    {63880,4461,1,0},
+    {63881,4462,1,0},
+    {63882,4463,1,0},
+    {63883,4464,1,0},
+    {63884,4465,1,0},
+    {63885,4466,1,0},
+    {63886,4467,1,0},
+    {63887,4468,1,0},
+    {63888,4469,1,0},
+    {63889,4470,1,0},
+    {63890,4471,1,0},
+    {63891,4472,1,0},
+    {63892,4473,1,0},
+    {63893,4474,1,0},
+    {63894,4475,1,0},
+    {63895,4476,1,0},
+    {63896,4477,1,0},
+    {63897,4478,1,0},
+    {63898,4479,1,0},
+    {63899,4480,1,0},
+    {63900,4481,1,0},
+    {63901,4482,1,0},
+    {63902,4483,1,0},
+    {63903,4484,1,0},
+    {63904,4485,1,0},
+    {63905,4486,1,0},
+    {63906,4487,1,0},
+    {63907,4488,1,0},
+    {63908,4489,1,0},
+    {63909,4490,1,0},
+    {63910,4491,1,0},
+    {63911,4492,1,0},
+    {63912,4493,1,0},
+    {63913,4494,1,0},
+    {63914,4495,1,0},
+    {63915,4496,1,0},
+    {63916,4497,1,0},
+    {63917,4498,1,0},
+    {63918,4499,1,0},
+    {63919,4500,1,0},
+    {63920,4501,1,0},
+    {63921,4502,1,0},
+    {63922,4503,1,0},
+    {63923,4504,1,0},
+    {63924,4505,1,0},
+    {63925,4506,1,0},
+    {63926,4507,1,0},
+    {63927,4508,1,0},
+    {63928,4509,1,0},
+    {63929,4510,1,0},
+    {63930,4511,1,0},
+    {63931,4512,1,0},
+    {63932,4513,1,0},
+    {63933,4514,1,0},
+    {63934,4515,1,0},
+    {63935,4516,1,0},
+    {63936,4517,1,0},
+    {63937,4518,1,0},
+    {63938,4519,1,0},
+    {63939,4520,1,0},
+    {63940,4521,1,0},
+    {63941,4522,1,0},
+    {63942,4523,1,0},
+    {63943,4524,1,0},
+    {63944,4525,1,0},
+    {63945,4526,1,0},
+    {63946,4527,1,0},
+    {63947,4528,1,0},
+    {63948,4529,1,0},
+    {63949,4530,1,0},
+    {63950,4531,1,0},
+    {63951,4532,1,0},
+    {63952,4533,1,0},
+    {63953,4534,1,0},
+    {63954,4535,1,0},
+    {63955,4536,1,0},
+    {63956,4537,1,0},
+    {63957,4538,1,0},
+    {63958,4539,1,0},
+    {63959,4540,1,0},
+    {63960,4541,1,0},
+    {63961,4542,1,0},
+    {63962,4543,1,0},
+    {63963,4544,1,0},
+    {63964,4545,1,0},
+    {63965,4546,1,0},
+    {63966,4547,1,0},
+    {63967,4548,1,0},
+    {63968,4549,1,0},
+    {63969,4550,1,0},
+    {63970,4551,1,0},
+    {63971,4552,1,0},
+    {63972,4553,1,0},
+    {63973,4554,1,0},
+    {63974,4555,1,0},
+    {63975,4556,1,0},
+    {63976,4557,1,0},
+    {63977,4558,1,0},
+    {63978,4559,1,0},
+    {63979,4560,1,0},
+    {63980,4561,1,0},
+    {63981,4562,1,0},
+    {63982,4563,1,0},
+    {63983,4564,1,0},
+    {63984,4565,1,0},
+    {63985,4566,1,0},
+    {63986,4567,1,0},
+    {63987,4568,1,0},
+    {63988,4569,1,0},
+    {63989,4570,1,0},
+    {63990,4571,1,0},
+    {63991,4572,1,0},
+    {63992,4573,1,0},
+    {63993,4574,1,0},
+    {63994,4575,1,0},
+    {63995,4576,1,0},
+    {63996,4577,1,0},
+    {63997,4578,1,0},
+    {63998,4579,1,0},
+    {63999,4580,1,0},
+    {64000,4581,1,0},
+    {64001,4582,1,0},
+    {64002,4583,1,0},
+    {64003,4584,1,0},
+    {64004,4585,1,0},
+    {64005,4586,1,0},
+    {64006,4587,1,0},
+    {64007,4588,1,0},
+    {64008,4589,1,0},
+    {64009,4590,1,0},
+    {64010,4591,1,0},
+    {64011,4592,1,0},
+    {64012,4593,1,0},
+    {64013,4594,1,0},
+    {64016,4595,1,0},
+    {64018,4596,1,0},
+    {64021,4597,1,0},
+    {64022,4598,1,0},
+    {64023,4599,1,0},
+    {64024,4600,1,0},
+    {64025,4601,1,0},
+    {64026,4602,1,0},
+    {64027,4603,1,0},
+    {64028,4604,1,0},
+    {64029,4605,1,0},
+    {64030,4606,1,0},
+    {64032,4607,1,0},
+    {64034,4608,1,0},
+    {64037,4609,1,0},
+    {64038,4610,1,0},
+    {64042,4611,1,0},
+    {64043,4612,1,0},
+    {64044,4613,1,0},
+    {64045,4614,1,0},
+    {64046,4615,1,0},
+    {64047,4616,1,0},
+    {64048,4617,1,0},
+    {64049,4618,1,0},
+    {64050,4619,1,0},
+    {64051,4620,1,0},
+    {64052,4621,1,0},
+    {64053,4622,1,0},
+    {64054,4623,1,0},
+    {64055,4624,1,0},
+    {64056,4625,1,0},
+    {64057,4626,1,0},
+    {64058,4627,1,0},
+    {64059,4628,1,0},
+    {64060,4629,1,0},
+    {64061,4630,1,0},
+    {64062,4631,1,0},
+    {64063,4632,1,0},
+    {64064,4633,1,0},
+    {64065,4634,1,0},
+    {64066,4635,1,0},
+    {64067,4636,1,0},
+    {64068,4637,1,0},
+    {64069,4638,1,0},
+    {64070,4639,1,0},
+    {64071,4640,1,0},
+    {64072,4641,1,0},
+    {64073,4642,1,0},
+    {64074,4643,1,0},
+    {64075,4644,1,0},
+    {64076,4645,1,0},
+    {64077,4646,1,0},
+    {64078,4647,1,0},
+    {64079,4648,1,0},
+    {64080,4649,1,0},
+    {64081,4650,1,0},
+    {64082,4651,1,0},
+    {64083,4652,1,0},
+    {64084,4653,1,0},
+    {64085,4654,1,0},
+    {64086,4655,1,0},
+    {64087,4656,1,0},
+    {64088,4657,1,0},
+    {64089,4658,1,0},
+    {64090,4659,1,0},
+    {64091,4660,1,0},
+    {64092,4661,1,0},
+    {64093,4662,1,0},
+    {64094,4663,1,0},
+    {64095,4664,1,0},
+    {64096,4665,1,0},
+    {64097,4666,1,0},
+    {64098,4667,1,0},
+    {64099,4668,1,0},
+    {64100,4669,1,0},
+    {64101,4670,1,0},
+    {64102,4671,1,0},
+    {64103,4672,1,0},
+    {64104,4673,1,0},
+    {64105,4674,1,0},
+    {64106,4675,1,0},
+    {64107,4676,1,0},
+    {64108,4677,1,0},
+    {64109,4678,1,0},
+    {64112,4679,1,0},
+    {64113,4680,1,0},
+    {64114,4681,1,0},
+    {64115,4682,1,0},
+    {64116,4683,1,0},
+    {64117,4684,1,0},
+    {64118,4685,1,0},
+    {64119,4686,1,0},
+    {64120,4687,1,0},
+    {64121,4688,1,0},
+    {64122,4689,1,0},
+    {64123,4690,1,0},
+    {64124,4691,1,0},
+    {64125,4692,1,0},
+    {64126,4693,1,0},
+    {64127,4694,1,0},
+    {64128,4695,1,0},
+    {64129,4696,1,0},
+    {64130,4697,1,0},
+    {64131,4698,1,0},
+    {64132,4699,1,0},
+    {64133,4700,1,0},
+    {64134,4701,1,0},
+    {64135,4702,1,0},
+    {64136,4703,1,0},
+    {64137,4704,1,0},
+    {64138,4705,1,0},
+    {64139,4706,1,0},
+    {64140,4707,1,0},
+    {64141,4708,1,0},
+    {64142,4709,1,0},
+    {64143,4710,1,0},
+    {64144,4711,1,0},
+    {64145,4712,1,0},
+    {64146,4713,1,0},
+    {64147,4714,1,0},
+    {64148,4715,1,0},
+    {64149,4716,1,0},
+    {64150,4717,1,0},
+    {64151,4718,1,0},
+    {64152,4719,1,0},
+    {64153,4720,1,0},
+    {64154,4721,1,0},
+    {64155,4722,1,0},
+    {64156,4723,1,0},
+    {64157,4724,1,0},
+    {64158,4725,1,0},
+    {64159,4726,1,0},
+    {64160,4727,1,0},
+    {64161,4728,1,0},
+    {64162,4729,1,0},
+    {64163,4730,1,0},
+    {64164,4731,1,0},
+    {64165,4732,1,0},
+    {64166,4733,1,0},
+    {64167,4734,1,0},
+    {64168,4735,1,0},
+    {64169,4736,1,0},
+    {64170,4737,1,0},
+    {64171,4738,1,0},
+    {64172,4739,1,0},
+    {64173,4740,1,0},
+    {64174,4741,1,0},
+    {64175,4742,1,0},
+    {64176,4743,1,0},
+    {64177,4744,1,0},
+    {64178,4745,1,0},
+    {64179,4746,1,0},
+    {64180,4747,1,0},
+    {64181,4748,1,0},
+    {64182,4749,1,0},
+    {64183,4750,1,0},
+    {64184,4751,1,0},
+    {64185,4752,1,0},
+    {64186,4753,1,0},
+    {64187,4754,1,0},
+    {64188,4755,1,0},
+    {64189,4756,1,0},
+    {64190,4757,1,0},
+    {64191,4758,1,0},
+    {64192,4759,1,0},
+    {64193,4760,1,0},
+    {64194,4761,1,0},
+    {64195,4762,1,0},
+    {64196,4763,1,0},
+    {64197,4764,1,0},
+    {64198,4765,1,0},
+    {64199,4766,1,0},
+    {64200,4767,1,0},
+    {64201,4768,1,0},
+    {64202,4769,1,0},
+    {64203,4770,1,0},
+    {64204,4771,1,0},
+    {64205,4772,1,0},
+    {64206,4773,1,0},
+    {64207,4774,1,0},
+    {64208,4775,1,0},
+    {64209,4776,1,0},
+    {64210,4777,1,0},
+    {64211,4778,1,0},
+    {64212,4779,1,0},
+    {64213,4780,1,0},
+    {64214,4781,1,0},
+    {64215,4782,1,0},
+    {64216,4783,1,0},
+    {64217,4784,1,0},
+    {64256,4785,2,1},
+    {64257,4787,2,1},
+    {64258,4789,2,1},
+    {64259,4791,3,1},
+    {64260,4794,3,1},
+    {64261,4797,2,1},
+    {64262,4799,2,1},
+    {64275,4801,2,1},
+    {64276,4803,2,1},
+    {64277,4805,2,1},
+    {64278,4807,2,1},
+    {64279,4809,2,1},
+    {64285,4811,2,0},
+    {64287,4813,2,0},
+    {64288,4815,1,1},
+    {64289,4816,1,1},
+    {64290,4817,1,1},
+    {64291,4818,1,1},
+    {64292,4819,1,1},
+    {64293,4820,1,1},
+    {64294,4821,1,1},
+    {64295,4822,1,1},
+    {64296,4823,1,1},
+    {64297,4824,1,1},
+    {64298,4825,2,0},
+    {64299,4827,2,0},
+    {64300,4829,2,0},
+    {64301,4831,2,0},
+    {64302,4833,2,0},
+    {64303,4835,2,0},
+    {64304,4837,2,0},
+    {64305,4839,2,0},
+    {64306,4841,2,0},
+    {64307,4843,2,0},
+    {64308,4845,2,0},
+    {64309,4847,2,0},
+    {64310,4849,2,0},
+    {64312,4851,2,0},
+    {64313,4853,2,0},
+    {64314,4855,2,0},
+    {64315,4857,2,0},
+    {64316,4859,2,0},
+    {64318,4861,2,0},
+    {64320,4863,2,0},
+    {64321,4865,2,0},
+    {64323,4867,2,0},
+    {64324,4869,2,0},
+    {64326,4871,2,0},
+    {64327,4873,2,0},
+    {64328,4875,2,0},
+    {64329,4877,2,0},
+    {64330,4879,2,0},
+    {64331,4881,2,0},
+    {64332,4883,2,0},
+    {64333,4885,2,0},
+    {64334,4887,2,0},
+    {64335,4889,2,1},
+    {64336,4891,1,1},
+    {64337,4892,1,1},
+    {64338,4893,1,1},
+    {64339,4894,1,1},
+    {64340,4895,1,1},
+    {64341,4896,1,1},
+    {64342,4897,1,1},
+    {64343,4898,1,1},
+    {64344,4899,1,1},
+    {64345,4900,1,1},
+    {64346,4901,1,1},
+    {64347,4902,1,1},
+    {64348,4903,1,1},
+    {64349,4904,1,1},
+    {64350,4905,1,1},
+    {64351,4906,1,1},
+    {64352,4907,1,1},
+    {64353,4908,1,1},
+    {64354,4909,1,1},
+    {64355,4910,1,1},
+    {64356,4911,1,1},
+    {64357,4912,1,1},
+    {64358,4913,1,1},
+    {64359,4914,1,1},
+    {64360,4915,1,1},
+    {64361,4916,1,1},
+    {64362,4917,1,1},
+    {64363,4918,1,1},
+    {64364,4919,1,1},
+    {64365,4920,1,1},
+    {64366,4921,1,1},
+    {64367,4922,1,1},
+    {64368,4923,1,1},
+    {64369,4924,1,1},
+    {64370,4925,1,1},
+    {64371,4926,1,1},
+    {64372,4927,1,1},
+    {64373,4928,1,1},
+    {64374,4929,1,1},
+    {64375,4930,1,1},
+    {64376,4931,1,1},
+    {64377,4932,1,1},
+    {64378,4933,1,1},
+    {64379,4934,1,1},
+    {64380,4935,1,1},
+    {64381,4936,1,1},
+    {64382,4937,1,1},
+    {64383,4938,1,1},
+    {64384,4939,1,1},
+    {64385,4940,1,1},
+    {64386,4941,1,1},
+    {64387,4942,1,1},
+    {64388,4943,1,1},
+    {64389,4944,1,1},
+    {64390,4945,1,1},
+    {64391,4946,1,1},
+    {64392,4947,1,1},
+    {64393,4948,1,1},
+    {64394,4949,1,1},
+    {64395,4950,1,1},
+    {64396,4951,1,1},
+    {64397,4952,1,1},
+    {64398,4953,1,1},
+    {64399,4954,1,1},
+    {64400,4955,1,1},
+    {64401,4956,1,1},
+    {64402,4957,1,1},
+    {64403,4958,1,1},
+    {64404,4959,1,1},
+    {64405,4960,1,1},
+    {64406,4961,1,1},
+    {64407,4962,1,1},
+    {64408,4963,1,1},
+    {64409,4964,1,1},
+    {64410,4965,1,1},
+    {64411,4966,1,1},
+    {64412,4967,1,1},
+    {64413,4968,1,1},
+    {64414,4969,1,1},
+    {64415,4970,1,1},
+    {64416,4971,1,1},
+    {64417,4972,1,1},
+    {64418,4973,1,1},
+    {64419,4974,1,1},
+    {64420,4975,1,1},
+    {64421,4976,1,1},
+    {64422,4977,1,1},
+    {64423,4978,1,1},
+    {64424,4979,1,1},
+    {64425,4980,1,1},
+    {64426,4981,1,1},
+    {64427,4982,1,1},
+    {64428,4983,1,1},
+    {64429,4984,1,1},
+    {64430,4985,1,1},
+    {64431,4986,1,1},
+    {64432,4987,1,1},
+    {64433,4988,1,1},
+    {64467,4989,1,1},
+    {64468,4990,1,1},
+    {64469,4991,1,1},
+    {64470,4992,1,1},
+    {64471,4993,1,1},
+    {64472,4994,1,1},
+    {64473,4995,1,1},
+    {64474,4996,1,1},
+    {64475,4997,1,1},
+    {64476,4998,1,1},
+    {64477,4999,1,1},
+    {64478,5000,1,1},
+    {64479,5001,1,1},
+    {64480,5002,1,1},
+    {64481,5003,1,1},
+    {64482,5004,1,1},
+    {64483,5005,1,1},
+    {64484,5006,1,1},
+    {64485,5007,1,1},
+    {64486,5008,1,1},
+    {64487,5009,1,1},
+    {64488,5010,1,1},
+    {64489,5011,1,1},
+    {64490,5012,2,1},
+    {64491,5014,2,1},
+    {64492,5016,2,1},
+    {64493,5018,2,1},
+    {64494,5020,2,1},
+    {64495,5022,2,1},
+    {64496,5024,2,1},
+    {64497,5026,2,1},
+    {64498,5028,2,1},
+    {64499,5030,2,1},
+    {64500,5032,2,1},
+    {64501,5034,2,1},
+    {64502,5036,2,1},
+    {64503,5038,2,1},
+    {64504,5040,2,1},
+    {64505,5042,2,1},
+    {64506,5044,2,1},
+    {64507,5046,2,1},
+    {64508,5048,1,1},
+    {64509,5049,1,1},
+    {64510,5050,1,1},
+    {64511,5051,1,1},
+    {64512,5052,2,1},
+    {64513,5054,2,1},
+    {64514,5056,2,1},
+    {64515,5058,2,1},
+    {64516,5060,2,1},
+    {64517,5062,2,1},
+    {64518,5064,2,1},
+    {64519,5066,2,1},
+    {64520,5068,2,1},
+    {64521,5070,2,1},
+    {64522,5072,2,1},
+    {64523,5074,2,1},
+    {64524,5076,2,1},
+    {64525,5078,2,1},
+    {64526,5080,2,1},
+    {64527,5082,2,1},
+    {64528,5084,2,1},
+    {64529,5086,2,1},
+    {64530,5088,2,1},
+    {64531,5090,2,1},
+    {64532,5092,2,1},
+    {64533,5094,2,1},
+    {64534,5096,2,1},
+    {64535,5098,2,1},
+    {64536,5100,2,1},
+    {64537,5102,2,1},
+    {64538,5104,2,1},
+    {64539,5106,2,1},
+    {64540,5108,2,1},
+    {64541,5110,2,1},
+    {64542,5112,2,1},
+    {64543,5114,2,1},
+    {64544,5116,2,1},
+    {64545,5118,2,1},
+    {64546,5120,2,1},
+    {64547,5122,2,1},
+    {64548,5124,2,1},
+    {64549,5126,2,1},
+    {64550,5128,2,1},
+    {64551,5130,2,1},
+    {64552,5132,2,1},
+    {64553,5134,2,1},
+    {64554,5136,2,1},
+    {64555,5138,2,1},
+    {64556,5140,2,1},
+    {64557,5142,2,1},
+    {64558,5144,2,1},
+    {64559,5146,2,1},
+    {64560,5148,2,1},
+    {64561,5150,2,1},
+    {64562,5152,2,1},
+    {64563,5154,2,1},
+    {64564,5156,2,1},
+    {64565,5158,2,1},
+    {64566,5160,2,1},
+    {64567,5162,2,1},
+    {64568,5164,2,1},
+    {64569,5166,2,1},
+    {64570,5168,2,1},
+    {64571,5170,2,1},
+    {64572,5172,2,1},
+    {64573,5174,2,1},
+    {64574,5176,2,1},
+    {64575,5178,2,1},
+    {64576,5180,2,1},
+    {64577,5182,2,1},
+    {64578,5184,2,1},
+    {64579,5186,2,1},
+    {64580,5188,2,1},
+    {64581,5190,2,1},
+    {64582,5192,2,1},
+    {64583,5194,2,1},
+    {64584,5196,2,1},
+    {64585,5198,2,1},
+    {64586,5200,2,1},
+    {64587,5202,2,1},
+    {64588,5204,2,1},
+    {64589,5206,2,1},
+    {64590,5208,2,1},
+    {64591,5210,2,1},
+    {64592,5212,2,1},
+    {64593,5214,2,1},
+    {64594,5216,2,1},
+    {64595,5218,2,1},
+    {64596,5220,2,1},
+    {64597,5222,2,1},
+    {64598,5224,2,1},
+    {64599,5226,2,1},
+    {64600,5228,2,1},
+    {64601,5230,2,1},
+    {64602,5232,2,1},
+    {64603,5234,2,1},
+    {64604,5236,2,1},
+    {64605,5238,2,1},
+    {64606,5240,3,1},
+    {64607,5243,3,1},
+    {64608,5246,3,1},
+    {64609,5249,3,1},
+    {64610,5252,3,1},
+    {64611,5255,3,1},
+    {64612,5258,2,1},
+    {64613,5260,2,1},
+    {64614,5262,2,1},
+    {64615,5264,2,1},
+    {64616,5266,2,1},
+    {64617,5268,2,1},
+    {64618,5270,2,1},
+    {64619,5272,2,1},
+    {64620,5274,2,1},
+    {64621,5276,2,1},
+    {64622,5278,2,1},
+    {64623,5280,2,1},
+    {64624,5282,2,1},
+    {64625,5284,2,1},
+    {64626,5286,2,1},
+    {64627,5288,2,1},
+    {64628,5290,2,1},
+    {64629,5292,2,1},
+    {64630,5294,2,1},
+    {64631,5296,2,1},
+    {64632,5298,2,1},
+    {64633,5300,2,1},
+    {64634,5302,2,1},
+    {64635,5304,2,1},
+    {64636,5306,2,1},
+    {64637,5308,2,1},
+    {64638,5310,2,1},
+    {64639,5312,2,1},
+    {64640,5314,2,1},
+    {64641,5316,2,1},
+    {64642,5318,2,1},
+    {64643,5320,2,1},
+    {64644,5322,2,1},
+    {64645,5324,2,1},
+    {64646,5326,2,1},
+    {64647,5328,2,1},
+    {64648,5330,2,1},
+    {64649,5332,2,1},
+    {64650,5334,2,1},
+    {64651,5336,2,1},
+    {64652,5338,2,1},
+    {64653,5340,2,1},
+    {64654,5342,2,1},
+    {64655,5344,2,1},
+    {64656,5346,2,1},
+    {64657,5348,2,1},
+    {64658,5350,2,1},
+    {64659,5352,2,1},
+    {64660,5354,2,1},
+    {64661,5356,2,1},
+    {64662,5358,2,1},
+    {64663,5360,2,1},
+    {64664,5362,2,1},
+    {64665,5364,2,1},
+    {64666,5366,2,1},
+    {64667,5368,2,1},
+    {64668,5370,2,1},
+    {64669,5372,2,1},
+    {64670,5374,2,1},
+    {64671,5376,2,1},
+    {64672,5378,2,1},
+    {64673,5380,2,1},
+    {64674,5382,2,1},
+    {64675,5384,2,1},
+    {64676,5386,2,1},
+    {64677,5388,2,1},
+    {64678,5390,2,1},
+    {64679,5392,2,1},
+    {64680,5394,2,1},
+    {64681,5396,2,1},
+    {64682,5398,2,1},
+    {64683,5400,2,1},
+    {64684,5402,2,1},
+    {64685,5404,2,1},
+    {64686,5406,2,1},
+    {64687,5408,2,1},
+    {64688,5410,2,1},
+    {64689,5412,2,1},
+    {64690,5414,2,1},
+    {64691,5416,2,1},
+    {64692,5418,2,1},
+    {64693,5420,2,1},
+    {64694,5422,2,1},
+    {64695,5424,2,1},
+    {64696,5426,2,1},
+    {64697,5428,2,1},
+    {64698,5430,2,1},
+    {64699,5432,2,1},
+    {64700,5434,2,1},
+    {64701,5436,2,1},
+    {64702,5438,2,1},
+    {64703,5440,2,1},
+    {64704,5442,2,1},
+    {64705,5444,2,1},
+    {64706,5446,2,1},
+    {64707,5448,2,1},
+    {64708,5450,2,1},
+    {64709,5452,2,1},
+    {64710,5454,2,1},
+    {64711,5456,2,1},
+    {64712,5458,2,1},
+    {64713,5460,2,1},
+    {64714,5462,2,1},
+    {64715,5464,2,1},
+    {64716,5466,2,1},
+    {64717,5468,2,1},
+    {64718,5470,2,1},
+    {64719,5472,2,1},
+    {64720,5474,2,1},
+    {64721,5476,2,1},
+    {64722,5478,2,1},
+    {64723,5480,2,1},
+    {64724,5482,2,1},
+    {64725,5484,2,1},
+    {64726,5486,2,1},
+    {64727,5488,2,1},
+    {64728,5490,2,1},
+    {64729,5492,2,1},
+    {64730,5494,2,1},
+    {64731,5496,2,1},
+    {64732,5498,2,1},
+    {64733,5500,2,1},
+    {64734,5502,2,1},
+    {64735,5504,2,1},
+    {64736,5506,2,1},
+    {64737,5508,2,1},
+    {64738,5510,2,1},
+    {64739,5512,2,1},
+    {64740,5514,2,1},
+    {64741,5516,2,1},
+    {64742,5518,2,1},
+    {64743,5520,2,1},
+    {64744,5522,2,1},
+    {64745,5524,2,1},
+    {64746,5526,2,1},
+    {64747,5528,2,1},
+    {64748,5530,2,1},
+    {64749,5532,2,1},
+    {64750,5534,2,1},
+    {64751,5536,2,1},
+    {64752,5538,2,1},
+    {64753,5540,2,1},
+    {64754,5542,3,1},
+    {64755,5545,3,1},
+    {64756,5548,3,1},
+    {64757,5551,2,1},
+    {64758,5553,2,1},
+    {64759,5555,2,1},
+    {64760,5557,2,1},
+    {64761,5559,2,1},
+    {64762,5561,2,1},
+    {64763,5563,2,1},
+    {64764,5565,2,1},
+    {64765,5567,2,1},
+    {64766,5569,2,1},
+    {64767,5571,2,1},
+    {64768,5573,2,1},
+    {64769,5575,2,1},
+    {64770,5577,2,1},
+    {64771,5579,2,1},
+    {64772,5581,2,1},
+    {64773,5583,2,1},
+    {64774,5585,2,1},
+    {64775,5587,2,1},
+    {64776,5589,2,1},
+    {64777,5591,2,1},
+    {64778,5593,2,1},
+    {64779,5595,2,1},
+    {64780,5597,2,1},
+    {64781,5599,2,1},
+    {64782,5601,2,1},
+    {64783,5603,2,1},
+    {64784,5605,2,1},
+    {64785,5607,2,1},
+    {64786,5609,2,1},
+    {64787,5611,2,1},
+    {64788,5613,2,1},
+    {64789,5615,2,1},
+    {64790,5617,2,1},
+    {64791,5619,2,1},
+    {64792,5621,2,1},
+    {64793,5623,2,1},
+    {64794,5625,2,1},
+    {64795,5627,2,1},
+    {64796,5629,2,1},
+    {64797,5631,2,1},
+    {64798,5633,2,1},
+    {64799,5635,2,1},
+    {64800,5637,2,1},
+    {64801,5639,2,1},
+    {64802,5641,2,1},
+    {64803,5643,2,1},
+    {64804,5645,2,1},
+    {64805,5647,2,1},
+    {64806,5649,2,1},
+    {64807,5651,2,1},
+    {64808,5653,2,1},
+    {64809,5655,2,1},
+    {64810,5657,2,1},
+    {64811,5659,2,1},
+    {64812,5661,2,1},
+    {64813,5663,2,1},
+    {64814,5665,2,1},
+    {64815,5667,2,1},
+    {64816,5669,2,1},
+    {64817,5671,2,1},
+    {64818,5673,2,1},
+    {64819,5675,2,1},
+    {64820,5677,2,1},
+    {64821,5679,2,1},
+    {64822,5681,2,1},
+    {64823,5683,2,1},
+    {64824,5685,2,1},
+    {64825,5687,2,1},
+    {64826,5689,2,1},
+    {64827,5691,2,1},
+    {64828,5693,2,1},
+    {64829,5695,2,1},
+    {64848,5697,3,1},
+    {64849,5700,3,1},
+    {64850,5703,3,1},
+    {64851,5706,3,1},
+    {64852,5709,3,1},
+    {64853,5712,3,1},
+    {64854,5715,3,1},
+    {64855,5718,3,1},
+    {64856,5721,3,1},
+    {64857,5724,3,1},
+    {64858,5727,3,1},
+    {64859,5730,3,1},
+    {64860,5733,3,1},
+    {64861,5736,3,1},
+    {64862,5739,3,1},
+    {64863,5742,3,1},
+    {64864,5745,3,1},
+    {64865,5748,3,1},
+    {64866,5751,3,1},
+    {64867,5754,3,1},
+    {64868,5757,3,1},
+    {64869,5760,3,1},
+    {64870,5763,3,1},
+    {64871,5766,3,1},
+    {64872,5769,3,1},
+    {64873,5772,3,1},
+    {64874,5775,3,1},
+    {64875,5778,3,1},
+    {64876,5781,3,1},
+    {64877,5784,3,1},
+    {64878,5787,3,1},
+    {64879,5790,3,1},
+    {64880,5793,3,1},
+    {64881,5796,3,1},
+    {64882,5799,3,1},
+    {64883,5802,3,1},
+    {64884,5805,3,1},
+    {64885,5808,3,1},
+    {64886,5811,3,1},
+    {64887,5814,3,1},
+    {64888,5817,3,1},
+    {64889,5820,3,1},
+    {64890,5823,3,1},
+    {64891,5826,3,1},
+    {64892,5829,3,1},
+    {64893,5832,3,1},
+    {64894,5835,3,1},
+    {64895,5838,3,1},
+    {64896,5841,3,1},
+    {64897,5844,3,1},
+    {64898,5847,3,1},
+    {64899,5850,3,1},
+    {64900,5853,3,1},
+    {64901,5856,3,1},
+    {64902,5859,3,1},
+    {64903,5862,3,1},
+    {64904,5865,3,1},
+    {64905,5868,3,1},
+    {64906,5871,3,1},
+    {64907,5874,3,1},
+    {64908,5877,3,1},
+    {64909,5880,3,1},
+    {64910,5883,3,1},
+    {64911,5886,3,1},
+    {64914,5889,3,1},
+    {64915,5892,3,1},
+    {64916,5895,3,1},
+    {64917,5898,3,1},
+    {64918,5901,3,1},
+    {64919,5904,3,1},
+    {64920,5907,3,1},
+    {64921,5910,3,1},
+    {64922,5913,3,1},
+    {64923,5916,3,1},
+    {64924,5919,3,1},
+    {64925,5922,3,1},
+    {64926,5925,3,1},
+    {64927,5928,3,1},
+    {64928,5931,3,1},
+    {64929,5934,3,1},
+    {64930,5937,3,1},
+    {64931,5940,3,1},
+    {64932,5943,3,1},
+    {64933,5946,3,1},
+    {64934,5949,3,1},
+    {64935,5952,3,1},
+    {64936,5955,3,1},
+    {64937,5958,3,1},
+    {64938,5961,3,1},
+    {64939,5964,3,1},
+    {64940,5967,3,1},
+    {64941,5970,3,1},
+    {64942,5973,3,1},
+    {64943,5976,3,1},
+    {64944,5979,3,1},
+    {64945,5982,3,1},
+    {64946,5985,3,1},
+    {64947,5988,3,1},
+    {64948,5991,3,1},
+    {64949,5994,3,1},
+    {64950,5997,3,1},
+    {64951,6000,3,1},
+    {64952,6003,3,1},
+    {64953,6006,3,1},
+    {64954,6009,3,1},
+    {64955,6012,3,1},
+    {64956,6015,3,1},
+    {64957,6018,3,1},
+    {64958,6021,3,1},
+    {64959,6024,3,1},
+    {64960,6027,3,1},
+    {64961,6030,3,1},
+    {64962,6033,3,1},
+    {64963,6036,3,1},
+    {64964,6039,3,1},
+    {64965,6042,3,1},
+    {64966,6045,3,1},
+    {64967,6048,3,1},
+    {65008,6051,3,1},
+    {65009,6054,3,1},
+    {65010,6057,4,1},
+    {65011,6061,4,1},
+    {65012,6065,4,1},
+    {65013,6069,4,1},
+    {65014,6073,4,1},
+    {65015,6077,4,1},
+    {65016,6081,4,1},
+    {65017,6085,3,1},
+    {65018,6088,18,1},
+    {65019,6106,8,1},
+    {65020,6114,4,1},
+    {65040,6118,1,1},
+    {65041,6119,1,1},
+    {65042,6120,1,1},
+    {65043,6121,1,1},
+    {65044,6122,1,1},
+    {65045,6123,1,1},
+    {65046,6124,1,1},
+    {65047,6125,1,1},
+    {65048,6126,1,1},
+    {65049,6127,1,1},
+    {65072,6128,1,1},
+    {65073,6129,1,1},
+    {65074,6130,1,1},
+    {65075,6131,1,1},
+    {65076,6132,1,1},
+    {65077,6133,1,1},
+    {65078,6134,1,1},
+    {65079,6135,1,1},
+    {65080,6136,1,1},
+    {65081,6137,1,1},
+    {65082,6138,1,1},
+    {65083,6139,1,1},
+    {65084,6140,1,1},
+    {65085,6141,1,1},
+    {65086,6142,1,1},
+    {65087,6143,1,1},
+    {65088,6144,1,1},
+    {65089,6145,1,1},
+    {65090,6146,1,1},
+    {65091,6147,1,1},
+    {65092,6148,1,1},
+    {65095,6149,1,1},
+    {65096,6150,1,1},
+    {65097,6151,1,1},
+    {65098,6152,1,1},
+    {65099,6153,1,1},
+    {65100,6154,1,1},
+    {65101,6155,1,1},
+    {65102,6156,1,1},
+    {65103,6157,1,1},
+    {65104,6158,1,1},
+    {65105,6159,1,1},
+    {65106,6160,1,1},
+    {65108,6161,1,1},
+    {65109,6162,1,1},
+    {65110,6163,1,1},
+    {65111,6164,1,1},
+    {65112,6165,1,1},
+    {65113,6166,1,1},
+    {65114,6167,1,1},
+    {65115,6168,1,1},
+    {65116,6169,1,1},
+    {65117,6170,1,1},
+    {65118,6171,1,1},
+    {65119,6172,1,1},
+    {65120,6173,1,1},
+    {65121,6174,1,1},
+    {65122,6175,1,1},
+    {65123,6176,1,1},
+    {65124,6177,1,1},
+    {65125,6178,1,1},
+    {65126,6179,1,1},
+    {65128,6180,1,1},
+    {65129,6181,1,1},
+    {65130,6182,1,1},
+    {65131,6183,1,1},
+    {65136,6184,2,1},
+    {65137,6186,2,1},
+    {65138,6188,2,1},
+    {65140,6190,2,1},
+    {65142,6192,2,1},
+    {65143,6194,2,1},
+    {65144,6196,2,1},
+    {65145,6198,2,1},
+    {65146,6200,2,1},
+    {65147,6202,2,1},
+    {65148,6204,2,1},
+    {65149,6206,2,1},
+    {65150,6208,2,1},
+    {65151,6210,2,1},
+    {65152,6212,1,1},
+    {65153,6213,1,1},
+    {65154,6214,1,1},
+    {65155,6215,1,1},
+    {65156,6216,1,1},
+    {65157,6217,1,1},
+    {65158,6218,1,1},
+    {65159,6219,1,1},
+    {65160,6220,1,1},
+    {65161,6221,1,1},
+    {65162,6222,1,1},
+    {65163,6223,1,1},
+    {65164,6224,1,1},
+    {65165,6225,1,1},
+    {65166,6226,1,1},
+    {65167,6227,1,1},
+    {65168,6228,1,1},
+    {65169,6229,1,1},
+    {65170,6230,1,1},
+    {65171,6231,1,1},
+    {65172,6232,1,1},
+    {65173,6233,1,1},
+    {65174,6234,1,1},
+    {65175,6235,1,1},
+    {65176,6236,1,1},
+    {65177,6237,1,1},
+    {65178,6238,1,1},
+    {65179,6239,1,1},
+    {65180,6240,1,1},
+    {65181,6241,1,1},
+    {65182,6242,1,1},
+    {65183,6243,1,1},
+    {65184,6244,1,1},
+    {65185,6245,1,1},
+    {65186,6246,1,1},
+    {65187,6247,1,1},
+    {65188,6248,1,1},
+    {65189,6249,1,1},
+    {65190,6250,1,1},
+    {65191,6251,1,1},
+    {65192,6252,1,1},
+    {65193,6253,1,1},
+    {65194,6254,1,1},
+    {65195,6255,1,1},
+    {65196,6256,1,1},
+    {65197,6257,1,1},
+    {65198,6258,1,1},
+    {65199,6259,1,1},
+    {65200,6260,1,1},
+    {65201,6261,1,1},
+    {65202,6262,1,1},
+    {65203,6263,1,1},
+    {65204,6264,1,1},
+    {65205,6265,1,1},
+    {65206,6266,1,1},
+    {65207,6267,1,1},
+    {65208,6268,1,1},
+    {65209,6269,1,1},
+    {65210,6270,1,1},
+    {65211,6271,1,1},
+    {65212,6272,1,1},
+    {65213,6273,1,1},
+    {65214,6274,1,1},
+    {65215,6275,1,1},
+    {65216,6276,1,1},
+    {65217,6277,1,1},
+    {65218,6278,1,1},
+    {65219,6279,1,1},
+    {65220,6280,1,1},
+    {65221,6281,1,1},
+    {65222,6282,1,1},
+    {65223,6283,1,1},
+    {65224,6284,1,1},
+    {65225,6285,1,1},
+    {65226,6286,1,1},
+    {65227,6287,1,1},
+    {65228,6288,1,1},
+    {65229,6289,1,1},
+    {65230,6290,1,1},
+    {65231,6291,1,1},
+    {65232,6292,1,1},
+    {65233,6293,1,1},
+    {65234,6294,1,1},
+    {65235,6295,1,1},
+    {65236,6296,1,1},
+    {65237,6297,1,1},
+    {65238,6298,1,1},
+    {65239,6299,1,1},
+    {65240,6300,1,1},
+    {65241,6301,1,1},
+    {65242,6302,1,1},
+    {65243,6303,1,1},
+    {65244,6304,1,1},
+    {65245,6305,1,1},
+    {65246,6306,1,1},
+    {65247,6307,1,1},
+    {65248,6308,1,1},
+    {65249,6309,1,1},
+    {65250,6310,1,1},
+    {65251,6311,1,1},
+    {65252,6312,1,1},
+    {65253,6313,1,1},
+    {65254,6314,1,1},
+    {65255,6315,1,1},
+    {65256,6316,1,1},
+    {65257,6317,1,1},
+    {65258,6318,1,1},
+    {65259,6319,1,1},
+    {65260,6320,1,1},
+    {65261,6321,1,1},
+    {65262,6322,1,1},
+    {65263,6323,1,1},
+    {65264,6324,1,1},
+    {65265,6325,1,1},
+    {65266,6326,1,1},
+    {65267,6327,1,1},
+    {65268,6328,1,1},
+    {65269,6329,2,1},
+    {65270,6331,2,1},
+    {65271,6333,2,1},
+    {65272,6335,2,1},
+    {65273,6337,2,1},
+    {65274,6339,2,1},
+    {65275,6341,2,1},
+    {65276,6343,2,1},
+    {65281,6345,1,1},
+    {65282,6346,1,1},
+    {65283,6347,1,1},
+    {65284,6348,1,1},
+    {65285,6349,1,1},
+    {65286,6350,1,1},
+    {65287,6351,1,1},
+    {65288,6352,1,1},
+    {65289,6353,1,1},
+    {65290,6354,1,1},
+    {65291,6355,1,1},
+    {65292,6356,1,1},
+    {65293,6357,1,1},
+    {65294,6358,1,1},
+    {65295,6359,1,1},
+    {65296,6360,1,1},
+    {65297,6361,1,1},
+    {65298,6362,1,1},
+    {65299,6363,1,1},
+    {65300,6364,1,1},
+    {65301,6365,1,1},
+    {65302,6366,1,1},
+    {65303,6367,1,1},
+    {65304,6368,1,1},
+    {65305,6369,1,1},
+    {65306,6370,1,1},
+    {65307,6371,1,1},
+    {65308,6372,1,1},
+    {65309,6373,1,1},
+    {65310,6374,1,1},
+    {65311,6375,1,1},
+    {65312,6376,1,1},
+    {65313,6377,1,1},
+    {65314,6378,1,1},
+    {65315,6379,1,1},
+    {65316,6380,1,1},
+    {65317,6381,1,1},
+    {65318,6382,1,1},
+    {65319,6383,1,1},
+    {65320,6384,1,1},
+    {65321,6385,1,1},
+    {65322,6386,1,1},
+    {65323,6387,1,1},
+    {65324,6388,1,1},
+    {65325,6389,1,1},
+    {65326,6390,1,1},
+    {65327,6391,1,1},
+    {65328,6392,1,1},
+    {65329,6393,1,1},
+    {65330,6394,1,1},
+    {65331,6395,1,1},
+    {65332,6396,1,1},
+    {65333,6397,1,1},
+    {65334,6398,1,1},
+    {65335,6399,1,1},
+    {65336,6400,1,1},
+    {65337,6401,1,1},
+    {65338,6402,1,1},
+    {65339,6403,1,1},
+    {65340,6404,1,1},
+    {65341,6405,1,1},
+    {65342,6406,1,1},
+    {65343,6407,1,1},
+    {65344,6408,1,1},
+    {65345,6409,1,1},
+    {65346,6410,1,1},
+    {65347,6411,1,1},
+    {65348,6412,1,1},
+    {65349,6413,1,1},
+    {65350,6414,1,1},
+    {65351,6415,1,1},
+    {65352,6416,1,1},
+    {65353,6417,1,1},
+    {65354,6418,1,1},
+    {65355,6419,1,1},
+    {65356,6420,1,1},
+    {65357,6421,1,1},
+    {65358,6422,1,1},
+    {65359,6423,1,1},
+    {65360,6424,1,1},
+    {65361,6425,1,1},
+    {65362,6426,1,1},
+    {65363,6427,1,1},
+    {65364,6428,1,1},
+    {65365,6429,1,1},
+    {65366,6430,1,1},
+    {65367,6431,1,1},
+    {65368,6432,1,1},
+    {65369,6433,1,1},
+    {65370,6434,1,1},
+    {65371,6435,1,1},
+    {65372,6436,1,1},
+    {65373,6437,1,1},
+    {65374,6438,1,1},
+    {65375,6439,1,1},
+    {65376,6440,1,1},
+    {65377,6441,1,1},
+    {65378,6442,1,1},
+    {65379,6443,1,1},
+    {65380,6444,1,1},
+    {65381,6445,1,1},
+    {65382,6446,1,1},
+    {65383,6447,1,1},
+    {65384,6448,1,1},
+    {65385,6449,1,1},
+    {65386,6450,1,1},
+    {65387,6451,1,1},
+    {65388,6452,1,1},
+    {65389,6453,1,1},
+    {65390,6454,1,1},
+    {65391,6455,1,1},
+    {65392,6456,1,1},
+    {65393,6457,1,1},
+    {65394,6458,1,1},
+    {65395,6459,1,1},
+    {65396,6460,1,1},
+    {65397,6461,1,1},
+    {65398,6462,1,1},
+    {65399,6463,1,1},
+    {65400,6464,1,1},
+    {65401,6465,1,1},
+    {65402,6466,1,1},
+    {65403,6467,1,1},
+    {65404,6468,1,1},
+    {65405,6469,1,1},
+    {65406,6470,1,1},
+    {65407,6471,1,1},
+    {65408,6472,1,1},
+    {65409,6473,1,1},
+    {65410,6474,1,1},
+    {65411,6475,1,1},
+    {65412,6476,1,1},
+    {65413,6477,1,1},
+    {65414,6478,1,1},
+    {65415,6479,1,1},
+    {65416,6480,1,1},
+    {65417,6481,1,1},
+    {65418,6482,1,1},
+    {65419,6483,1,1},
+    {65420,6484,1,1},
+    {65421,6485,1,1},
+    {65422,6486,1,1},
+    {65423,6487,1,1},
+    {65424,6488,1,1},
+    {65425,6489,1,1},
+    {65426,6490,1,1},
+    {65427,6491,1,1},
+    {65428,6492,1,1},
+    {65429,6493,1,1},
+    {65430,6494,1,1},
+    {65431,6495,1,1},
+    {65432,6496,1,1},
+    {65433,6497,1,1},
+    {65434,6498,1,1},
+    {65435,6499,1,1},
+    {65436,6500,1,1},
+    {65437,6501,1,1},
+    {65438,6502,1,1},
+    {65439,6503,1,1},
+    {65440,6504,1,1},
+    {65441,6505,1,1},
+    {65442,6506,1,1},
+    {65443,6507,1,1},
+    {65444,6508,1,1},
+    {65445,6509,1,1},
+    {65446,6510,1,1},
+    {65447,6511,1,1},
+    {65448,6512,1,1},
+    {65449,6513,1,1},
+    {65450,6514,1,1},
+    {65451,6515,1,1},
+    {65452,6516,1,1},
+    {65453,6517,1,1},
+    {65454,6518,1,1},
+    {65455,6519,1,1},
+    {65456,6520,1,1},
+    {65457,6521,1,1},
+    {65458,6522,1,1},
+    {65459,6523,1,1},
+    {65460,6524,1,1},
+    {65461,6525,1,1},
+    {65462,6526,1,1},
+    {65463,6527,1,1},
+    {65464,6528,1,1},
+    {65465,6529,1,1},
+    {65466,6530,1,1},
+    {65467,6531,1,1},
+    {65468,6532,1,1},
+    {65469,6533,1,1},
+    {65470,6534,1,1},
+    {65474,6535,1,1},
+    {65475,6536,1,1},
+    {65476,6537,1,1},
+    {65477,6538,1,1},
+    {65478,6539,1,1},
+    {65479,6540,1,1},
+    {65482,6541,1,1},
+    {65483,6542,1,1},
+    {65484,6543,1,1},
+    {65485,6544,1,1},
+    {65486,6545,1,1},
+    {65487,6546,1,1},
+    {65490,6547,1,1},
+    {65491,6548,1,1},
+    {65492,6549,1,1},
+    {65493,6550,1,1},
+    {65494,6551,1,1},
+    {65495,6552,1,1},
+    {65498,6553,1,1},
+    {65499,6554,1,1},
+    {65500,6555,1,1},
+    {65504,6556,1,1},
+    {65505,6557,1,1},
+    {65506,6558,1,1},
+    {65507,6559,1,1},
+    {65508,6560,1,1},
+    {65509,6561,1,1},
+    {65510,6562,1,1},
+    {65512,6563,1,1},
+    {65513,6564,1,1},
+    {65514,6565,1,1},
+    {65515,6566,1,1},
+    {65516,6567,1,1},
+    {65517,6568,1,1},
+    {65518,6569,1,1},
+    {67457,6570,1,1},
+    {67458,6571,1,1},
+    {67459,6572,1,1},
+    {67460,6573,1,1},
+    {67461,6574,1,1},
+    {67463,6575,1,1},
+    {67464,6576,1,1},
+    {67465,6577,1,1},
+    {67466,6578,1,1},
+    {67467,6579,1,1},
+    {67468,6580,1,1},
+    {67469,6581,1,1},
+    {67470,6582,1,1},
+    {67471,6583,1,1},
+    {67472,6584,1,1},
+    {67473,6585,1,1},
+    {67474,6586,1,1},
+    {67475,6587,1,1},
+    {67476,6588,1,1},
+    {67477,6589,1,1},
+    {67478,6590,1,1},
+    {67479,6591,1,1},
+    {67480,6592,1,1},
+    {67481,6593,1,1},
+    {67482,6594,1,1},
+    {67483,6595,1,1},
+    {67484,6596,1,1},
+    {67485,6597,1,1},
+    {67486,6598,1,1},
+    {67487,6599,1,1},
+    {67488,6600,1,1},
+    {67489,6601,1,1},
+    {67490,6602,1,1},
+    {67491,6603,1,1},
+    {67492,6604,1,1},
+    {67493,6605,1,1},
+    {67494,6606,1,1},
+    {67495,6607,1,1},
+    {67496,6608,1,1},
+    {67497,6609,1,1},
+    {67498,6610,1,1},
+    {67499,6611,1,1},
+    {67500,6612,1,1},
+    {67501,6613,1,1},
+    {67502,6614,1,1},
+    {67503,6615,1,1},
+    {67504,6616,1,1},
+    {67506,6617,1,1},
+    {67507,6618,1,1},
+    {67508,6619,1,1},
+    {67509,6620,1,1},
+    {67510,6621,1,1},
+    {67511,6622,1,1},
+    {67512,6623,1,1},
+    {67513,6624,1,1},
+    {67514,6625,1,1},
+    {69786,6626,2,0},
+    {69788,6628,2,0},
+    {69803,6630,2,0},
+    {69934,6632,2,0},
+    {69935,6634,2,0},
+    {70475,6636,2,0},
+    {70476,6638,2,0},
+    {70843,6640,2,0},
+    {70844,6642,2,0},
+    {70846,6644,2,0},
+    {71098,6646,2,0},
+    {71099,6648,2,0},
+    {71992,6650,2,0},
+    {119134,6652,2,0},
+    {119135,6654,2,0},
+    {119136,6656,2,0},
+    {119137,6658,2,0},
+    {119138,6660,2,0},
+    {119139,6662,2,0},
+    {119140,6664,2,0},
+    {119227,6666,2,0},
+    {119228,6668,2,0},
+    {119229,6670,2,0},
+    {119230,6672,2,0},
+    {119231,6674,2,0},
+    {119232,6676,2,0},
+    {119808,6678,1,1},
+    {119809,6679,1,1},
+    {119810,6680,1,1},
+    {119811,6681,1,1},
+    {119812,6682,1,1},
+    {119813,6683,1,1},
+    {119814,6684,1,1},
+    {119815,6685,1,1},
+    {119816,6686,1,1},
+    {119817,6687,1,1},
+    {119818,6688,1,1},
+    {119819,6689,1,1},
+    {119820,6690,1,1},
+    {119821,6691,1,1},
+    {119822,6692,1,1},
+    {119823,6693,1,1},
+    {119824,6694,1,1},
+    {119825,6695,1,1},
+    {119826,6696,1,1},
+    {119827,6697,1,1},
+    {119828,6698,1,1},
+    {119829,6699,1,1},
+    {119830,6700,1,1},
+    {119831,6701,1,1},
+    {119832,6702,1,1},
+    {119833,6703,1,1},
+    {119834,6704,1,1},
+    {119835,6705,1,1},
+    {119836,6706,1,1},
+    {119837,6707,1,1},
+    {119838,6708,1,1},
+    {119839,6709,1,1},
+    {119840,6710,1,1},
+    {119841,6711,1,1},
+    {119842,6712,1,1},
+    {119843,6713,1,1},
+    {119844,6714,1,1},
+    {119845,6715,1,1},
+    {119846,6716,1,1},
+    {119847,6717,1,1},
+    {119848,6718,1,1},
+    {119849,6719,1,1},
+    {119850,6720,1,1},
+    {119851,6721,1,1},
+    {119852,6722,1,1},
+    {119853,6723,1,1},
+    {119854,6724,1,1},
+    {119855,6725,1,1},
+    {119856,6726,1,1},
+    {119857,6727,1,1},
+    {119858,6728,1,1},
+    {119859,6729,1,1},
+    {119860,6730,1,1},
+    {119861,6731,1,1},
+    {119862,6732,1,1},
+    {119863,6733,1,1},
+    {119864,6734,1,1},
+    {119865,6735,1,1},
+    {119866,6736,1,1},
+    {119867,6737,1,1},
+    {119868,6738,1,1},
+    {119869,6739,1,1},
+    {119870,6740,1,1},
+    {119871,6741,1,1},
+    {119872,6742,1,1},
+    {119873,6743,1,1},
+    {119874,6744,1,1},
+    {119875,6745,1,1},
+    {119876,6746,1,1},
+    {119877,6747,1,1},
+    {119878,6748,1,1},
+    {119879,6749,1,1},
+    {119880,6750,1,1},
+    {119881,6751,1,1},
+    {119882,6752,1,1},
+    {119883,6753,1,1},
+    {119884,6754,1,1},
+    {119885,6755,1,1},
+    {119886,6756,1,1},
+    {119887,6757,1,1},
+    {119888,6758,1,1},
+    {119889,6759,1,1},
+    {119890,6760,1,1},
+    {119891,6761,1,1},
+    {119892,6762,1,1},
+    {119894,6763,1,1},
+    {119895,6764,1,1},
+    {119896,6765,1,1},
+    {119897,6766,1,1},
+    {119898,6767,1,1},
+    {119899,6768,1,1},
+    {119900,6769,1,1},
+    {119901,6770,1,1},
+    {119902,6771,1,1},
+    {119903,6772,1,1},
+    {119904,6773,1,1},
+    {119905,6774,1,1},
+    {119906,6775,1,1},
+    {119907,6776,1,1},
+    {119908,6777,1,1},
+    {119909,6778,1,1},
+    {119910,6779,1,1},
+    {119911,6780,1,1},
+    {119912,6781,1,1},
+    {119913,6782,1,1},
+    {119914,6783,1,1},
+    {119915,6784,1,1},
+    {119916,6785,1,1},
+    {119917,6786,1,1},
+    {119918,6787,1,1},
+    {119919,6788,1,1},
+    {119920,6789,1,1},
+    {119921,6790,1,1},
+    {119922,6791,1,1},
+    {119923,6792,1,1},
+    {119924,6793,1,1},
+    {119925,6794,1,1},
+    {119926,6795,1,1},
+    {119927,6796,1,1},
+    {119928,6797,1,1},
+    {119929,6798,1,1},
+    {119930,6799,1,1},
+    {119931,6800,1,1},
+    {119932,6801,1,1},
+    {119933,6802,1,1},
+    {119934,6803,1,1},
+    {119935,6804,1,1},
+    {119936,6805,1,1},
+    {119937,6806,1,1},
+    {119938,6807,1,1},
+    {119939,6808,1,1},
+    {119940,6809,1,1},
+    {119941,6810,1,1},
+    {119942,6811,1,1},
+    {119943,6812,1,1},
+    {119944,6813,1,1},
+    {119945,6814,1,1},
+    {119946,6815,1,1},
+    {119947,6816,1,1},
+    {119948,6817,1,1},
+    {119949,6818,1,1},
+    {119950,6819,1,1},
+    {119951,6820,1,1},
+    {119952,6821,1,1},
+    {119953,6822,1,1},
+    {119954,6823,1,1},
+    {119955,6824,1,1},
+    {119956,6825,1,1},
+    {119957,6826,1,1},
+    {119958,6827,1,1},
+    {119959,6828,1,1},
+    {119960,6829,1,1},
+    {119961,6830,1,1},
+    {119962,6831,1,1},
+    {119963,6832,1,1},
+    {119964,6833,1,1},
+    {119966,6834,1,1},
+    {119967,6835,1,1},
+    {119970,6836,1,1},
+    {119973,6837,1,1},
+    {119974,6838,1,1},
+    {119977,6839,1,1},
+    {119978,6840,1,1},
+    {119979,6841,1,1},
+    {119980,6842,1,1},
+    {119982,6843,1,1},
+    {119983,6844,1,1},
+    {119984,6845,1,1},
+    {119985,6846,1,1},
+    {119986,6847,1,1},
+    {119987,6848,1,1},
+    {119988,6849,1,1},
+    {119989,6850,1,1},
+    {119990,6851,1,1},
+    {119991,6852,1,1},
+    {119992,6853,1,1},
+    {119993,6854,1,1},
+    {119995,6855,1,1},
+    {119997,6856,1,1},
+    {119998,6857,1,1},
+    {119999,6858,1,1},
+    {120000,6859,1,1},
+    {120001,6860,1,1},
+    {120002,6861,1,1},
+    {120003,6862,1,1},
+    {120005,6863,1,1},
+    {120006,6864,1,1},
+    {120007,6865,1,1},
+    {120008,6866,1,1},
+    {120009,6867,1,1},
+    {120010,6868,1,1},
+    {120011,6869,1,1},
+    {120012,6870,1,1},
+    {120013,6871,1,1},
+    {120014,6872,1,1},
+    {120015,6873,1,1},
+    {120016,6874,1,1},
+    {120017,6875,1,1},
+    {120018,6876,1,1},
+    {120019,6877,1,1},
+    {120020,6878,1,1},
+    {120021,6879,1,1},
+    {120022,6880,1,1},
+    {120023,6881,1,1},
+    {120024,6882,1,1},
+    {120025,6883,1,1},
+    {120026,6884,1,1},
+    {120027,6885,1,1},
+    {120028,6886,1,1},
+    {120029,6887,1,1},
+    {120030,6888,1,1},
+    {120031,6889,1,1},
+    {120032,6890,1,1},
+    {120033,6891,1,1},
+    {120034,6892,1,1},
+    {120035,6893,1,1},
+    {120036,6894,1,1},
+    {120037,6895,1,1},
+    {120038,6896,1,1},
+    {120039,6897,1,1},
+    {120040,6898,1,1},
+    {120041,6899,1,1},
+    {120042,6900,1,1},
+    {120043,6901,1,1},
+    {120044,6902,1,1},
+    {120045,6903,1,1},
+    {120046,6904,1,1},
+    {120047,6905,1,1},
+    {120048,6906,1,1},
+    {120049,6907,1,1},
+    {120050,6908,1,1},
+    {120051,6909,1,1},
+    {120052,6910,1,1},
+    {120053,6911,1,1},
+    {120054,6912,1,1},
+    {120055,6913,1,1},
+    {120056,6914,1,1},
+    {120057,6915,1,1},
+    {120058,6916,1,1},
+    {120059,6917,1,1},
+    {120060,6918,1,1},
+    {120061,6919,1,1},
+    {120062,6920,1,1},
+    {120063,6921,1,1},
+    {120064,6922,1,1},
+    {120065,6923,1,1},
+    {120066,6924,1,1},
+    {120067,6925,1,1},
+    {120068,6926,1,1},
+    {120069,6927,1,1},
+    {120071,6928,1,1},
+    {120072,6929,1,1},
+    {120073,6930,1,1},
+    {120074,6931,1,1},
+    {120077,6932,1,1},
+    {120078,6933,1,1},
+    {120079,6934,1,1},
+    {120080,6935,1,1},
+    {120081,6936,1,1},
+    {120082,6937,1,1},
+    {120083,6938,1,1},
+    {120084,6939,1,1},
+    {120086,6940,1,1},
+    {120087,6941,1,1},
+    {120088,6942,1,1},
+    {120089,6943,1,1},
+    {120090,6944,1,1},
+    {120091,6945,1,1},
+    {120092,6946,1,1},
+    {120094,6947,1,1},
+    {120095,6948,1,1},
+    {120096,6949,1,1},
+    {120097,6950,1,1},
+    {120098,6951,1,1},
+    {120099,6952,1,1},
+    {120100,6953,1,1},
+    {120101,6954,1,1},
+    {120102,6955,1,1},
+    {120103,6956,1,1},
+    {120104,6957,1,1},
+    {120105,6958,1,1},
+    {120106,6959,1,1},
+    {120107,6960,1,1},
+    {120108,6961,1,1},
+    {120109,6962,1,1},
+    {120110,6963,1,1},
+    {120111,6964,1,1},
+    {120112,6965,1,1},
+    {120113,6966,1,1},
+    {120114,6967,1,1},
+    {120115,6968,1,1},
+    {120116,6969,1,1},
+    {120117,6970,1,1},
+    {120118,6971,1,1},
+    {120119,6972,1,1},
+    {120120,6973,1,1},
+    {120121,6974,1,1},
+    {120123,6975,1,1},
+    {120124,6976,1,1},
+    {120125,6977,1,1},
+    {120126,6978,1,1},
+    {120128,6979,1,1},
+    {120129,6980,1,1},
+    {120130,6981,1,1},
+    {120131,6982,1,1},
+    {120132,6983,1,1},
+    {120134,6984,1,1},
+    {120138,6985,1,1},
+    {120139,6986,1,1},
+    {120140,6987,1,1},
+    {120141,6988,1,1},
+    {120142,6989,1,1},
+    {120143,6990,1,1},
+    {120144,6991,1,1},
+    {120146,6992,1,1},
+    {120147,6993,1,1},
+    {120148,6994,1,1},
+    {120149,6995,1,1},
+    {120150,6996,1,1},
+    {120151,6997,1,1},
+    {120152,6998,1,1},
+    {120153,6999,1,1},
+    {120154,7000,1,1},
+    {120155,7001,1,1},
+    {120156,7002,1,1},
+    {120157,7003,1,1},
+    {120158,7004,1,1},
+    {120159,7005,1,1},
+    {120160,7006,1,1},
+    {120161,7007,1,1},
+    {120162,7008,1,1},
+    {120163,7009,1,1},
+    {120164,7010,1,1},
+    {120165,7011,1,1},
+    {120166,7012,1,1},
+    {120167,7013,1,1},
+    {120168,7014,1,1},
+    {120169,7015,1,1},
+    {120170,7016,1,1},
+    {120171,7017,1,1},
+    {120172,7018,1,1},
+    {120173,7019,1,1},
+    {120174,7020,1,1},
+    {120175,7021,1,1},
+    {120176,7022,1,1},
+    {120177,7023,1,1},
+    {120178,7024,1,1},
+    {120179,7025,1,1},
+    {120180,7026,1,1},
+    {120181,7027,1,1},
+    {120182,7028,1,1},
+    {120183,7029,1,1},
+    {120184,7030,1,1},
+    {120185,7031,1,1},
+    {120186,7032,1,1},
+    {120187,7033,1,1},
+    {120188,7034,1,1},
+    {120189,7035,1,1},
+    {120190,7036,1,1},
+    {120191,7037,1,1},
+    {120192,7038,1,1},
+    {120193,7039,1,1},
+    {120194,7040,1,1},
+    {120195,7041,1,1},
+    {120196,7042,1,1},
+    {120197,7043,1,1},
+    {120198,7044,1,1},
+    {120199,7045,1,1},
+    {120200,7046,1,1},
+    {120201,7047,1,1},
+    {120202,7048,1,1},
+    {120203,7049,1,1},
+    {120204,7050,1,1},
+    {120205,7051,1,1},
+    {120206,7052,1,1},
+    {120207,7053,1,1},
+    {120208,7054,1,1},
+    {120209,7055,1,1},
+    {120210,7056,1,1},
+    {120211,7057,1,1},
+    {120212,7058,1,1},
+    {120213,7059,1,1},
+    {120214,7060,1,1},
+    {120215,7061,1,1},
+    {120216,7062,1,1},
+    {120217,7063,1,1},
+    {120218,7064,1,1},
+    {120219,7065,1,1},
+    {120220,7066,1,1},
+    {120221,7067,1,1},
+    {120222,7068,1,1},
+    {120223,7069,1,1},
+    {120224,7070,1,1},
+    {120225,7071,1,1},
+    {120226,7072,1,1},
+    {120227,7073,1,1},
+    {120228,7074,1,1},
+    {120229,7075,1,1},
+    {120230,7076,1,1},
+    {120231,7077,1,1},
+    {120232,7078,1,1},
+    {120233,7079,1,1},
+    {120234,7080,1,1},
+    {120235,7081,1,1},
+    {120236,7082,1,1},
+    {120237,7083,1,1},
+    {120238,7084,1,1},
+    {120239,7085,1,1},
+    {120240,7086,1,1},
+    {120241,7087,1,1},
+    {120242,7088,1,1},
+    {120243,7089,1,1},
+    {120244,7090,1,1},
+    {120245,7091,1,1},
+    {120246,7092,1,1},
+    {120247,7093,1,1},
+    {120248,7094,1,1},
+    {120249,7095,1,1},
+    {120250,7096,1,1},
+    {120251,7097,1,1},
+    {120252,7098,1,1},
+    {120253,7099,1,1},
+    {120254,7100,1,1},
+    {120255,7101,1,1},
+    {120256,7102,1,1},
+    {120257,7103,1,1},
+    {120258,7104,1,1},
+    {120259,7105,1,1},
+    {120260,7106,1,1},
+    {120261,7107,1,1},
+    {120262,7108,1,1},
+    {120263,7109,1,1},
+    {120264,7110,1,1},
+    {120265,7111,1,1},
+    {120266,7112,1,1},
+    {120267,7113,1,1},
+    {120268,7114,1,1},
+    {120269,7115,1,1},
+    {120270,7116,1,1},
+    {120271,7117,1,1},
+    {120272,7118,1,1},
+    {120273,7119,1,1},
+    {120274,7120,1,1},
+    {120275,7121,1,1},
+    {120276,7122,1,1},
+    {120277,7123,1,1},
+    {120278,7124,1,1},
+    {120279,7125,1,1},
+    {120280,7126,1,1},
+    {120281,7127,1,1},
+    {120282,7128,1,1},
+    {120283,7129,1,1},
+    {120284,7130,1,1},
+    {120285,7131,1,1},
+    {120286,7132,1,1},
+    {120287,7133,1,1},
+    {120288,7134,1,1},
+    {120289,7135,1,1},
+    {120290,7136,1,1},
+    {120291,7137,1,1},
+    {120292,7138,1,1},
+    {120293,7139,1,1},
+    {120294,7140,1,1},
+    {120295,7141,1,1},
+    {120296,7142,1,1},
+    {120297,7143,1,1},
+    {120298,7144,1,1},
+    {120299,7145,1,1},
+    {120300,7146,1,1},
+    {120301,7147,1,1},
+    {120302,7148,1,1},
+    {120303,7149,1,1},
+    {120304,7150,1,1},
+    {120305,7151,1,1},
+    {120306,7152,1,1},
+    {120307,7153,1,1},
+    {120308,7154,1,1},
+    {120309,7155,1,1},
+    {120310,7156,1,1},
+    {120311,7157,1,1},
+    {120312,7158,1,1},
+    {120313,7159,1,1},
+    {120314,7160,1,1},
+    {120315,7161,1,1},
+    {120316,7162,1,1},
+    {120317,7163,1,1},
+    {120318,7164,1,1},
+    {120319,7165,1,1},
+    {120320,7166,1,1},
+    {120321,7167,1,1},
+    {120322,7168,1,1},
+    {120323,7169,1,1},
+    {120324,7170,1,1},
+    {120325,7171,1,1},
+    {120326,7172,1,1},
+    {120327,7173,1,1},
+    {120328,7174,1,1},
+    {120329,7175,1,1},
+    {120330,7176,1,1},
+    {120331,7177,1,1},
+    {120332,7178,1,1},
+    {120333,7179,1,1},
+    {120334,7180,1,1},
+    {120335,7181,1,1},
+    {120336,7182,1,1},
+    {120337,7183,1,1},
+    {120338,7184,1,1},
+    {120339,7185,1,1},
+    {120340,7186,1,1},
+    {120341,7187,1,1},
+    {120342,7188,1,1},
+    {120343,7189,1,1},
+    {120344,7190,1,1},
+    {120345,7191,1,1},
+    {120346,7192,1,1},
+    {120347,7193,1,1},
+    {120348,7194,1,1},
+    {120349,7195,1,1},
+    {120350,7196,1,1},
+    {120351,7197,1,1},
+    {120352,7198,1,1},
+    {120353,7199,1,1},
+    {120354,7200,1,1},
+    {120355,7201,1,1},
+    {120356,7202,1,1},
+    {120357,7203,1,1},
+    {120358,7204,1,1},
+    {120359,7205,1,1},
+    {120360,7206,1,1},
+    {120361,7207,1,1},
+    {120362,7208,1,1},
+    {120363,7209,1,1},
+    {120364,7210,1,1},
+    {120365,7211,1,1},
+    {120366,7212,1,1},
+    {120367,7213,1,1},
+    {120368,7214,1,1},
+    {120369,7215,1,1},
+    {120370,7216,1,1},
+    {120371,7217,1,1},
+    {120372,7218,1,1},
+    {120373,7219,1,1},
+    {120374,7220,1,1},
+    {120375,7221,1,1},
+    {120376,7222,1,1},
+    {120377,7223,1,1},
+    {120378,7224,1,1},
+    {120379,7225,1,1},
+    {120380,7226,1,1},
+    {120381,7227,1,1},
+    {120382,7228,1,1},
+    {120383,7229,1,1},
+    {120384,7230,1,1},
+    {120385,7231,1,1},
+    {120386,7232,1,1},
+    {120387,7233,1,1},
+    {120388,7234,1,1},
+    {120389,7235,1,1},
+    {120390,7236,1,1},
+    {120391,7237,1,1},
+    {120392,7238,1,1},
+    {120393,7239,1,1},
+    {120394,7240,1,1},
+    {120395,7241,1,1},
+    {120396,7242,1,1},
+    {120397,7243,1,1},
+    {120398,7244,1,1},
+    {120399,7245,1,1},
+    {120400,7246,1,1},
+    {120401,7247,1,1},
+    {120402,7248,1,1},
+    {120403,7249,1,1},
+    {120404,7250,1,1},
+    {120405,7251,1,1},
+    {120406,7252,1,1},
+    {120407,7253,1,1},
+    {120408,7254,1,1},
+    {120409,7255,1,1},
+    {120410,7256,1,1},
+    {120411,7257,1,1},
+    {120412,7258,1,1},
+    {120413,7259,1,1},
+    {120414,7260,1,1},
+    {120415,7261,1,1},
+    {120416,7262,1,1},
+    {120417,7263,1,1},
+    {120418,7264,1,1},
+    {120419,7265,1,1},
+    {120420,7266,1,1},
+    {120421,7267,1,1},
+    {120422,7268,1,1},
+    {120423,7269,1,1},
+    {120424,7270,1,1},
+    {120425,7271,1,1},
+    {120426,7272,1,1},
+    {120427,7273,1,1},
+    {120428,7274,1,1},
+    {120429,7275,1,1},
+    {120430,7276,1,1},
+    {120431,7277,1,1},
+    {120432,7278,1,1},
+    {120433,7279,1,1},
+    {120434,7280,1,1},
+    {120435,7281,1,1},
+    {120436,7282,1,1},
+    {120437,7283,1,1},
+    {120438,7284,1,1},
+    {120439,7285,1,1},
+    {120440,7286,1,1},
+    {120441,7287,1,1},
+    {120442,7288,1,1},
+    {120443,7289,1,1},
+    {120444,7290,1,1},
+    {120445,7291,1,1},
+    {120446,7292,1,1},
+    {120447,7293,1,1},
+    {120448,7294,1,1},
+    {120449,7295,1,1},
+    {120450,7296,1,1},
+    {120451,7297,1,1},
+    {120452,7298,1,1},
+    {120453,7299,1,1},
+    {120454,7300,1,1},
+    {120455,7301,1,1},
+    {120456,7302,1,1},
+    {120457,7303,1,1},
+    {120458,7304,1,1},
+    {120459,7305,1,1},
+    {120460,7306,1,1},
+    {120461,7307,1,1},
+    {120462,7308,1,1},
+    {120463,7309,1,1},
+    {120464,7310,1,1},
+    {120465,7311,1,1},
+    {120466,7312,1,1},
+    {120467,7313,1,1},
+    {120468,7314,1,1},
+    {120469,7315,1,1},
+    {120470,7316,1,1},
+    {120471,7317,1,1},
+    {120472,7318,1,1},
+    {120473,7319,1,1},
+    {120474,7320,1,1},
+    {120475,7321,1,1},
+    {120476,7322,1,1},
+    {120477,7323,1,1},
+    {120478,7324,1,1},
+    {120479,7325,1,1},
+    {120480,7326,1,1},
+    {120481,7327,1,1},
+    {120482,7328,1,1},
+    {120483,7329,1,1},
+    {120484,7330,1,1},
+    {120485,7331,1,1},
+    {120488,7332,1,1},
+    {120489,7333,1,1},
+    {120490,7334,1,1},
+    {120491,7335,1,1},
+    {120492,7336,1,1},
+    {120493,7337,1,1},
+    {120494,7338,1,1},
+    {120495,7339,1,1},
+    {120496,7340,1,1},
+    {120497,7341,1,1},
+    {120498,7342,1,1},
+    {120499,7343,1,1},
+    {120500,7344,1,1},
+    {120501,7345,1,1},
+    {120502,7346,1,1},
+    {120503,7347,1,1},
+    {120504,7348,1,1},
+    {120505,7349,1,1},
+    {120506,7350,1,1},
+    {120507,7351,1,1},
+    {120508,7352,1,1},
+    {120509,7353,1,1},
+    {120510,7354,1,1},
+    {120511,7355,1,1},
+    {120512,7356,1,1},
+    {120513,7357,1,1},
+    {120514,7358,1,1},
+    {120515,7359,1,1},
+    {120516,7360,1,1},
+    {120517,7361,1,1},
+    {120518,7362,1,1},
+    {120519,7363,1,1},
+    {120520,7364,1,1},
+    {120521,7365,1,1},
+    {120522,7366,1,1},
+    {120523,7367,1,1},
+    {120524,7368,1,1},
+    {120525,7369,1,1},
+    {120526,7370,1,1},
+    {120527,7371,1,1},
+    {120528,7372,1,1},
+    {120529,7373,1,1},
+    {120530,7374,1,1},
+    {120531,7375,1,1},
+    {120532,7376,1,1},
+    {120533,7377,1,1},
+    {120534,7378,1,1},
+    {120535,7379,1,1},
+    {120536,7380,1,1},
+    {120537,7381,1,1},
+    {120538,7382,1,1},
+    {120539,7383,1,1},
+    {120540,7384,1,1},
+    {120541,7385,1,1},
+    {120542,7386,1,1},
+    {120543,7387,1,1},
+    {120544,7388,1,1},
+    {120545,7389,1,1},
+    {120546,7390,1,1},
+    {120547,7391,1,1},
+    {120548,7392,1,1},
+    {120549,7393,1,1},
+    {120550,7394,1,1},
+    {120551,7395,1,1},
+    {120552,7396,1,1},
+    {120553,7397,1,1},
+    {120554,7398,1,1},
+    {120555,7399,1,1},
+    {120556,7400,1,1},
+    {120557,7401,1,1},
+    {120558,7402,1,1},
+    {120559,7403,1,1},
+    {120560,7404,1,1},
+    {120561,7405,1,1},
+    {120562,7406,1,1},
+    {120563,7407,1,1},
+    {120564,7408,1,1},
+    {120565,7409,1,1},
+    {120566,7410,1,1},
+    {120567,7411,1,1},
+    {120568,7412,1,1},
+    {120569,7413,1,1},
+    {120570,7414,1,1},
+    {120571,7415,1,1},
+    {120572,7416,1,1},
+    {120573,7417,1,1},
+    {120574,7418,1,1},
+    {120575,7419,1,1},
+    {120576,7420,1,1},
+    {120577,7421,1,1},
+    {120578,7422,1,1},
+    {120579,7423,1,1},
+    {120580,7424,1,1},
+    {120581,7425,1,1},
+    {120582,7426,1,1},
+    {120583,7427,1,1},
+    {120584,7428,1,1},
+    {120585,7429,1,1},
+    {120586,7430,1,1},
+    {120587,7431,1,1},
+    {120588,7432,1,1},
+    {120589,7433,1,1},
+    {120590,7434,1,1},
+    {120591,7435,1,1},
+    {120592,7436,1,1},
+    {120593,7437,1,1},
+    {120594,7438,1,1},
+    {120595,7439,1,1},
+    {120596,7440,1,1},
+    {120597,7441,1,1},
+    {120598,7442,1,1},
+    {120599,7443,1,1},
+    {120600,7444,1,1},
+    {120601,7445,1,1},
+    {120602,7446,1,1},
+    {120603,7447,1,1},
+    {120604,7448,1,1},
+    {120605,7449,1,1},
+    {120606,7450,1,1},
+    {120607,7451,1,1},
+    {120608,7452,1,1},
+    {120609,7453,1,1},
+    {120610,7454,1,1},
+    {120611,7455,1,1},
+    {120612,7456,1,1},
+    {120613,7457,1,1},
+    {120614,7458,1,1},
+    {120615,7459,1,1},
+    {120616,7460,1,1},
+    {120617,7461,1,1},
+    {120618,7462,1,1},
+    {120619,7463,1,1},
+    {120620,7464,1,1},
+    {120621,7465,1,1},
+    {120622,7466,1,1},
+    {120623,7467,1,1},
+    {120624,7468,1,1},
+    {120625,7469,1,1},
+    {120626,7470,1,1},
+    {120627,7471,1,1},
+    {120628,7472,1,1},
+    {120629,7473,1,1},
+    {120630,7474,1,1},
+    {120631,7475,1,1},
+    {120632,7476,1,1},
+    {120633,7477,1,1},
+    {120634,7478,1,1},
+    {120635,7479,1,1},
+    {120636,7480,1,1},
+    {120637,7481,1,1},
+    {120638,7482,1,1},
+    {120639,7483,1,1},
+    {120640,7484,1,1},
+    {120641,7485,1,1},
+    {120642,7486,1,1},
+    {120643,7487,1,1},
+    {120644,7488,1,1},
+    {120645,7489,1,1},
+    {120646,7490,1,1},
+    {120647,7491,1,1},
+    {120648,7492,1,1},
+    {120649,7493,1,1},
+    {120650,7494,1,1},
+    {120651,7495,1,1},
+    {120652,7496,1,1},
+    {120653,7497,1,1},
+    {120654,7498,1,1},
+    {120655,7499,1,1},
+    {120656,7500,1,1},
+    {120657,7501,1,1},
+    {120658,7502,1,1},
+    {120659,7503,1,1},
+    {120660,7504,1,1},
+    {120661,7505,1,1},
+    {120662,7506,1,1},
+    {120663,7507,1,1},
+    {120664,7508,1,1},
+    {120665,7509,1,1},
+    {120666,7510,1,1},
+    {120667,7511,1,1},
+    {120668,7512,1,1},
+    {120669,7513,1,1},
+    {120670,7514,1,1},
+    {120671,7515,1,1},
+    {120672,7516,1,1},
+    {120673,7517,1,1},
+    {120674,7518,1,1},
+    {120675,7519,1,1},
+    {120676,7520,1,1},
+    {120677,7521,1,1},
+    {120678,7522,1,1},
+    {120679,7523,1,1},
+    {120680,7524,1,1},
+    {120681,7525,1,1},
+    {120682,7526,1,1},
+    {120683,7527,1,1},
+    {120684,7528,1,1},
+    {120685,7529,1,1},
+    {120686,7530,1,1},
+    {120687,7531,1,1},
+    {120688,7532,1,1},
+    {120689,7533,1,1},
+    {120690,7534,1,1},
+    {120691,7535,1,1},
+    {120692,7536,1,1},
+    {120693,7537,1,1},
+    {120694,7538,1,1},
+    {120695,7539,1,1},
+    {120696,7540,1,1},
+    {120697,7541,1,1},
+    {120698,7542,1,1},
+    {120699,7543,1,1},
+    {120700,7544,1,1},
+    {120701,7545,1,1},
+    {120702,7546,1,1},
+    {120703,7547,1,1},
+    {120704,7548,1,1},
+    {120705,7549,1,1},
+    {120706,7550,1,1},
+    {120707,7551,1,1},
+    {120708,7552,1,1},
+    {120709,7553,1,1},
+    {120710,7554,1,1},
+    {120711,7555,1,1},
+    {120712,7556,1,1},
+    {120713,7557,1,1},
+    {120714,7558,1,1},
+    {120715,7559,1,1},
+    {120716,7560,1,1},
+    {120717,7561,1,1},
+    {120718,7562,1,1},
+    {120719,7563,1,1},
+    {120720,7564,1,1},
+    {120721,7565,1,1},
+    {120722,7566,1,1},
+    {120723,7567,1,1},
+    {120724,7568,1,1},
+    {120725,7569,1,1},
+    {120726,7570,1,1},
+    {120727,7571,1,1},
+    {120728,7572,1,1},
+    {120729,7573,1,1},
+    {120730,7574,1,1},
+    {120731,7575,1,1},
+    {120732,7576,1,1},
+    {120733,7577,1,1},
+    {120734,7578,1,1},
+    {120735,7579,1,1},
+    {120736,7580,1,1},
+    {120737,7581,1,1},
+    {120738,7582,1,1},
+    {120739,7583,1,1},
+    {120740,7584,1,1},
+    {120741,7585,1,1},
+    {120742,7586,1,1},
+    {120743,7587,1,1},
+    {120744,7588,1,1},
+    {120745,7589,1,1},
+    {120746,7590,1,1},
+    {120747,7591,1,1},
+    {120748,7592,1,1},
+    {120749,7593,1,1},
+    {120750,7594,1,1},
+    {120751,7595,1,1},
+    {120752,7596,1,1},
+    {120753,7597,1,1},
+    {120754,7598,1,1},
+    {120755,7599,1,1},
+    {120756,7600,1,1},
+    {120757,7601,1,1},
+    {120758,7602,1,1},
+    {120759,7603,1,1},
+    {120760,7604,1,1},
+    {120761,7605,1,1},
+    {120762,7606,1,1},
+    {120763,7607,1,1},
+    {120764,7608,1,1},
+    {120765,7609,1,1},
+    {120766,7610,1,1},
+    {120767,7611,1,1},
+    {120768,7612,1,1},
+    {120769,7613,1,1},
+    {120770,7614,1,1},
+    {120771,7615,1,1},
+    {120772,7616,1,1},
+    {120773,7617,1,1},
+    {120774,7618,1,1},
+    {120775,7619,1,1},
+    {120776,7620,1,1},
+    {120777,7621,1,1},
+    {120778,7622,1,1},
+    {120779,7623,1,1},
+    {120782,7624,1,1},
+    {120783,7625,1,1},
+    {120784,7626,1,1},
+    {120785,7627,1,1},
+    {120786,7628,1,1},
+    {120787,7629,1,1},
+    {120788,7630,1,1},
+    {120789,7631,1,1},
+    {120790,7632,1,1},
+    {120791,7633,1,1},
+    {120792,7634,1,1},
+    {120793,7635,1,1},
+    {120794,7636,1,1},
+    {120795,7637,1,1},
+    {120796,7638,1,1},
+    {120797,7639,1,1},
+    {120798,7640,1,1},
+    {120799,7641,1,1},
+    {120800,7642,1,1},
+    {120801,7643,1,1},
+    {120802,7644,1,1},
+    {120803,7645,1,1},
+    {120804,7646,1,1},
+    {120805,7647,1,1},
+    {120806,7648,1,1},
+    {120807,7649,1,1},
+    {120808,7650,1,1},
+    {120809,7651,1,1},
+    {120810,7652,1,1},
+    {120811,7653,1,1},
+    {120812,7654,1,1},
+    {120813,7655,1,1},
+    {120814,7656,1,1},
+    {120815,7657,1,1},
+    {120816,7658,1,1},
+    {120817,7659,1,1},
+    {120818,7660,1,1},
+    {120819,7661,1,1},
+    {120820,7662,1,1},
+    {120821,7663,1,1},
+    {120822,7664,1,1},
+    {120823,7665,1,1},
+    {120824,7666,1,1},
+    {120825,7667,1,1},
+    {120826,7668,1,1},
+    {120827,7669,1,1},
+    {120828,7670,1,1},
+    {120829,7671,1,1},
+    {120830,7672,1,1},
+    {120831,7673,1,1},
+    {126464,7674,1,1},
+    {126465,7675,1,1},
+    {126466,7676,1,1},
+    {126467,7677,1,1},
+    {126469,7678,1,1},
+    {126470,7679,1,1},
+    {126471,7680,1,1},
+    {126472,7681,1,1},
+    {126473,7682,1,1},
+    {126474,7683,1,1},
+    {126475,7684,1,1},
+    {126476,7685,1,1},
+    {126477,7686,1,1},
+    {126478,7687,1,1},
+    {126479,7688,1,1},
+    {126480,7689,1,1},
+    {126481,7690,1,1},
+    {126482,7691,1,1},
+    {126483,7692,1,1},
+    {126484,7693,1,1},
+    {126485,7694,1,1},
+    {126486,7695,1,1},
+    {126487,7696,1,1},
+    {126488,7697,1,1},
+    {126489,7698,1,1},
+    {126490,7699,1,1},
+    {126491,7700,1,1},
+    {126492,7701,1,1},
+    {126493,7702,1,1},
+    {126494,7703,1,1},
+    {126495,7704,1,1},
+    {126497,7705,1,1},
+    {126498,7706,1,1},
+    {126500,7707,1,1},
+    {126503,7708,1,1},
+    {126505,7709,1,1},
+    {126506,7710,1,1},
+    {126507,7711,1,1},
+    {126508,7712,1,1},
+    {126509,7713,1,1},
+    {126510,7714,1,1},
+    {126511,7715,1,1},
+    {126512,7716,1,1},
+    {126513,7717,1,1},
+    {126514,7718,1,1},
+    {126516,7719,1,1},
+    {126517,7720,1,1},
+    {126518,7721,1,1},
+    {126519,7722,1,1},
+    {126521,7723,1,1},
+    {126523,7724,1,1},
+    {126530,7725,1,1},
+    {126535,7726,1,1},
+    {126537,7727,1,1},
+    {126539,7728,1,1},
+    {126541,7729,1,1},
+    {126542,7730,1,1},
+    {126543,7731,1,1},
+    {126545,7732,1,1},
+    {126546,7733,1,1},
+    {126548,7734,1,1},
+    {126551,7735,1,1},
+    {126553,7736,1,1},
+    {126555,7737,1,1},
+    {126557,7738,1,1},
+    {126559,7739,1,1},
+    {126561,7740,1,1},
+    {126562,7741,1,1},
+    {126564,7742,1,1},
+    {126567,7743,1,1},
+    {126568,7744,1,1},
+    {126569,7745,1,1},
+    {126570,7746,1,1},
+    {126572,7747,1,1},
+    {126573,7748,1,1},
+    {126574,7749,1,1},
+    {126575,7750,1,1},
+    {126576,7751,1,1},
+    {126577,7752,1,1},
+    {126578,7753,1,1},
+    {126580,7754,1,1},
+    {126581,7755,1,1},
+    {126582,7756,1,1},
+    {126583,7757,1,1},
+    {126585,7758,1,1},
+    {126586,7759,1,1},
+    {126587,7760,1,1},
+    {126588,7761,1,1},
+    {126590,7762,1,1},
+    {126592,7763,1,1},
+    {126593,7764,1,1},
+    {126594,7765,1,1},
+    {126595,7766,1,1},
+    {126596,7767,1,1},
+    {126597,7768,1,1},
+    {126598,7769,1,1},
+    {126599,7770,1,1},
+    {126600,7771,1,1},
+    {126601,7772,1,1},
+    {126603,7773,1,1},
+    {126604,7774,1,1},
+    {126605,7775,1,1},
+    {126606,7776,1,1},
+    {126607,7777,1,1},
+    {126608,7778,1,1},
+    {126609,7779,1,1},
+    {126610,7780,1,1},
+    {126611,7781,1,1},
+    {126612,7782,1,1},
+    {126613,7783,1,1},
+    {126614,7784,1,1},
+    {126615,7785,1,1},
+    {126616,7786,1,1},
+    {126617,7787,1,1},
+    {126618,7788,1,1},
+    {126619,7789,1,1},
+    {126625,7790,1,1},
+    {126626,7791,1,1},
+    {126627,7792,1,1},
+    {126629,7793,1,1},
+    {126630,7794,1,1},
+    {126631,7795,1,1},
+    {126632,7796,1,1},
+    {126633,7797,1,1},
+    {126635,7798,1,1},
+    {126636,7799,1,1},
+    {126637,7800,1,1},
+    {126638,7801,1,1},
+    {126639,7802,1,1},
+    {126640,7803,1,1},
+    {126641,7804,1,1},
+    {126642,7805,1,1},
+    {126643,7806,1,1},
+    {126644,7807,1,1},
+    {126645,7808,1,1},
+    {126646,7809,1,1},
+    {126647,7810,1,1},
+    {126648,7811,1,1},
+    {126649,7812,1,1},
+    {126650,7813,1,1},
+    {126651,7814,1,1},
+    {127232,7815,2,1},
+    {127233,7817,2,1},
+    {127234,7819,2,1},
+    {127235,7821,2,1},
+    {127236,7823,2,1},
+    {127237,7825,2,1},
+    {127238,7827,2,1},
+    {127239,7829,2,1},
+    {127240,7831,2,1},
+    {127241,7833,2,1},
+    {127242,7835,2,1},
+    {127248,7837,3,1},
+    {127249,7840,3,1},
+    {127250,7843,3,1},
+    {127251,7846,3,1},
+    {127252,7849,3,1},
+    {127253,7852,3,1},
+    {127254,7855,3,1},
+    {127255,7858,3,1},
+    {127256,7861,3,1},
+    {127257,7864,3,1},
+    {127258,7867,3,1},
+    {127259,7870,3,1},
+    {127260,7873,3,1},
+    {127261,7876,3,1},
+    {127262,7879,3,1},
+    {127263,7882,3,1},
+    {127264,7885,3,1},
+    {127265,7888,3,1},
+    {127266,7891,3,1},
+    {127267,7894,3,1},
+    {127268,7897,3,1},
+    {127269,7900,3,1},
+    {127270,7903,3,1},
+    {127271,7906,3,1},
+    {127272,7909,3,1},
+    {127273,7912,3,1},
+    {127274,7915,3,1},
+    {127275,7918,1,1},
+    {127276,7919,1,1},
+    {127277,7920,2,1},
+    {127278,7922,2,1},
+    {127280,7924,1,1},
+    {127281,7925,1,1},
+    {127282,7926,1,1},
+    {127283,7927,1,1},
+    {127284,7928,1,1},
+    {127285,7929,1,1},
+    {127286,7930,1,1},
+    {127287,7931,1,1},
+    {127288,7932,1,1},
+    {127289,7933,1,1},
+    {127290,7934,1,1},
+    {127291,7935,1,1},
+    {127292,7936,1,1},
+    {127293,7937,1,1},
+    {127294,7938,1,1},
+    {127295,7939,1,1},
+    {127296,7940,1,1},
+    {127297,7941,1,1},
+    {127298,7942,1,1},
+    {127299,7943,1,1},
+    {127300,7944,1,1},
+    {127301,7945,1,1},
+    {127302,7946,1,1},
+    {127303,7947,1,1},
+    {127304,7948,1,1},
+    {127305,7949,1,1},
+    {127306,7950,2,1},
+    {127307,7952,2,1},
+    {127308,7954,2,1},
+    {127309,7956,2,1},
+    {127310,7958,3,1},
+    {127311,7961,2,1},
+    {127338,7963,2,1},
+    {127339,7965,2,1},
+    {127340,7967,2,1},
+    {127376,7969,2,1},
+    {127488,7971,2,1},
+    {127489,7973,2,1},
+    {127490,7975,1,1},
+    {127504,7976,1,1},
+    {127505,7977,1,1},
+    {127506,7978,1,1},
+    {127507,7979,1,1},
+    {127508,7980,1,1},
+    {127509,7981,1,1},
+    {127510,7982,1,1},
+    {127511,7983,1,1},
+    {127512,7984,1,1},
+    {127513,7985,1,1},
+    {127514,7986,1,1},
+    {127515,7987,1,1},
+    {127516,7988,1,1},
+    {127517,7989,1,1},
+    {127518,7990,1,1},
+    {127519,7991,1,1},
+    {127520,7992,1,1},
+    {127521,7993,1,1},
+    {127522,7994,1,1},
+    {127523,7995,1,1},
+    {127524,7996,1,1},
+    {127525,7997,1,1},
+    {127526,7998,1,1},
+    {127527,7999,1,1},
+    {127528,8000,1,1},
+    {127529,8001,1,1},
+    {127530,8002,1,1},
+    {127531,8003,1,1},
+    {127532,8004,1,1},
+    {127533,8005,1,1},
+    {127534,8006,1,1},
+    {127535,8007,1,1},
+    {127536,8008,1,1},
+    {127537,8009,1,1},
+    {127538,8010,1,1},
+    {127539,8011,1,1},
+    {127540,8012,1,1},
+    {127541,8013,1,1},
+    {127542,8014,1,1},
+    {127543,8015,1,1},
+    {127544,8016,1,1},
+    {127545,8017,1,1},
+    {127546,8018,1,1},
+    {127547,8019,1,1},
+    {127552,8020,3,1},
+    {127553,8023,3,1},
+    {127554,8026,3,1},
+    {127555,8029,3,1},
+    {127556,8032,3,1},
+    {127557,8035,3,1},
+    {127558,8038,3,1},
+    {127559,8041,3,1},
+    {127560,8044,3,1},
+    {127568,8047,1,1},
+    {127569,8048,1,1},
+    {130032,8049,1,1},
+    {130033,8050,1,1},
+    {130034,8051,1,1},
+    {130035,8052,1,1},
+    {130036,8053,1,1},
+    {130037,8054,1,1},
+    {130038,8055,1,1},
+    {130039,8056,1,1},
+    {130040,8057,1,1},
+    {130041,8058,1,1},
+    {194560,8059,1,0},
+    {194561,8060,1,0},
+    {194562,8061,1,0},
+    {194563,8062,1,0},
+    {194564,8063,1,0},
+    {194565,8064,1,0},
+    {194566,8065,1,0},
+    {194567,8066,1,0},
+    {194568,8067,1,0},
+    {194569,8068,1,0},
+    {194570,8069,1,0},
+    {194571,8070,1,0},
+    {194572,8071,1,0},
+    {194573,8072,1,0},
+    {194574,8073,1,0},
+    {194575,8074,1,0},
+    {194576,8075,1,0},
+    {194577,8076,1,0},
+    {194578,8077,1,0},
+    {194579,8078,1,0},
+    {194580,8079,1,0},
+    {194581,8080,1,0},
+    {194582,8081,1,0},
+    {194583,8082,1,0},
+    {194584,8083,1,0},
+    {194585,8084,1,0},
+    {194586,8085,1,0},
+    {194587,8086,1,0},
+    {194588,8087,1,0},
+    {194589,8088,1,0},
+    {194590,8089,1,0},
+    {194591,8090,1,0},
+    {194592,8091,1,0},
+    {194593,8092,1,0},
+    {194594,8093,1,0},
+    {194595,8094,1,0},
+    {194596,8095,1,0},
+    {194597,8096,1,0},
+    {194598,8097,1,0},
+    {194599,8098,1,0},
+    {194600,8099,1,0},
+    {194601,8100,1,0},
+    {194602,8101,1,0},
+    {194603,8102,1,0},
+    {194604,8103,1,0},
+    {194605,8104,1,0},
+    {194606,8105,1,0},
+    {194607,8106,1,0},
+    {194608,8107,1,0},
+    {194609,8108,1,0},
+    {194610,8109,1,0},
+    {194611,8110,1,0},
+    {194612,8111,1,0},
+    {194613,8112,1,0},
+    {194614,8113,1,0},
+    {194615,8114,1,0},
+    {194616,8115,1,0},
+    {194617,8116,1,0},
+    {194618,8117,1,0},
+    {194619,8118,1,0},
+    {194620,8119,1,0},
+    {194621,8120,1,0},
+    {194622,8121,1,0},
+    {194623,8122,1,0},
+    {194624,8123,1,0},
+    {194625,8124,1,0},
+    {194626,8125,1,0},
+    {194627,8126,1,0},
+    {194628,8127,1,0},
+    {194629,8128,1,0},
+    {194630,8129,1,0},
+    {194631,8130,1,0},
+    {194632,8131,1,0},
+    {194633,8132,1,0},
+    {194634,8133,1,0},
+    {194635,8134,1,0},
+    {194636,8135,1,0},
+    {194637,8136,1,0},
+    {194638,8137,1,0},
+    {194639,8138,1,0},
+    {194640,8139,1,0},
+    {194641,8140,1,0},
+    {194642,8141,1,0},
+    {194643,8142,1,0},
+    {194644,8143,1,0},
+    {194645,8144,1,0},
+    {194646,8145,1,0},
+    {194647,8146,1,0},
+    {194648,8147,1,0},
+    {194649,8148,1,0},
+    {194650,8149,1,0},
+    {194651,8150,1,0},
+    {194652,8151,1,0},
+    {194653,8152,1,0},
+    {194654,8153,1,0},
+    {194655,8154,1,0},
+    {194656,8155,1,0},
+    {194657,8156,1,0},
+    {194658,8157,1,0},
+    {194659,8158,1,0},
+    {194660,8159,1,0},
+    {194661,8160,1,0},
+    {194662,8161,1,0},
+    {194663,8162,1,0},
+    {194664,8163,1,0},
+    {194665,8164,1,0},
+    {194666,8165,1,0},
+    {194667,8166,1,0},
+    {194668,8167,1,0},
+    {194669,8168,1,0},
+    {194670,8169,1,0},
+    {194671,8170,1,0},
+    {194672,8171,1,0},
+    {194673,8172,1,0},
+    {194674,8173,1,0},
+    {194675,8174,1,0},
+    {194676,8175,1,0},
+    {194677,8176,1,0},
+    {194678,8177,1,0},
+    {194679,8178,1,0},
+    {194680,8179,1,0},
+    {194681,8180,1,0},
+    {194682,8181,1,0},
+    {194683,8182,1,0},
+    {194684,8183,1,0},
+    {194685,8184,1,0},
+    {194686,8185,1,0},
+    {194687,8186,1,0},
+    {194688,8187,1,0},
+    {194689,8188,1,0},
+    {194690,8189,1,0},
+    {194691,8190,1,0},
+    {194692,8191,1,0},
+    {194693,8192,1,0},
+    {194694,8193,1,0},
+    {194695,8194,1,0},
+    {194696,8195,1,0},
+    {194697,8196,1,0},
+    {194698,8197,1,0},
+    {194699,8198,1,0},
+    {194700,8199,1,0},
+    {194701,8200,1,0},
+    {194702,8201,1,0},
+    {194703,8202,1,0},
+    {194704,8203,1,0},
+    {194705,8204,1,0},
+    {194706,8205,1,0},
+    {194707,8206,1,0},
+    {194708,8207,1,0},
+    {194709,8208,1,0},
+    {194710,8209,1,0},
+    {194711,8210,1,0},
+    {194712,8211,1,0},
+    {194713,8212,1,0},
+    {194714,8213,1,0},
+    {194715,8214,1,0},
+    {194716,8215,1,0},
+    {194717,8216,1,0},
+    {194718,8217,1,0},
+    {194719,8218,1,0},
+    {194720,8219,1,0},
+    {194721,8220,1,0},
+    {194722,8221,1,0},
+    {194723,8222,1,0},
+    {194724,8223,1,0},
+    {194725,8224,1,0},
+    {194726,8225,1,0},
+    {194727,8226,1,0},
+    {194728,8227,1,0},
+    {194729,8228,1,0},
+    {194730,8229,1,0},
+    {194731,8230,1,0},
+    {194732,8231,1,0},
+    {194733,8232,1,0},
+    {194734,8233,1,0},
+    {194735,8234,1,0},
+    {194736,8235,1,0},
+    {194737,8236,1,0},
+    {194738,8237,1,0},
+    {194739,8238,1,0},
+    {194740,8239,1,0},
+    {194741,8240,1,0},
+    {194742,8241,1,0},
+    {194743,8242,1,0},
+    {194744,8243,1,0},
+    {194745,8244,1,0},
+    {194746,8245,1,0},
+    {194747,8246,1,0},
+    {194748,8247,1,0},
+    {194749,8248,1,0},
+    {194750,8249,1,0},
+    {194751,8250,1,0},
+    {194752,8251,1,0},
+    {194753,8252,1,0},
+    {194754,8253,1,0},
+    {194755,8254,1,0},
+    {194756,8255,1,0},
+    {194757,8256,1,0},
+    {194758,8257,1,0},
+    {194759,8258,1,0},
+    {194760,8259,1,0},
+    {194761,8260,1,0},
+    {194762,8261,1,0},
+    {194763,8262,1,0},
+    {194764,8263,1,0},
+    {194765,8264,1,0},
+    {194766,8265,1,0},
+    {194767,8266,1,0},
+    {194768,8267,1,0},
+    {194769,8268,1,0},
+    {194770,8269,1,0},
+    {194771,8270,1,0},
+    {194772,8271,1,0},
+    {194773,8272,1,0},
+    {194774,8273,1,0},
+    {194775,8274,1,0},
+    {194776,8275,1,0},
+    {194777,8276,1,0},
+    {194778,8277,1,0},
+    {194779,8278,1,0},
+    {194780,8279,1,0},
+    {194781,8280,1,0},
+    {194782,8281,1,0},
+    {194783,8282,1,0},
+    {194784,8283,1,0},
+    {194785,8284,1,0},
+    {194786,8285,1,0},
+    {194787,8286,1,0},
+    {194788,8287,1,0},
+    {194789,8288,1,0},
+    {194790,8289,1,0},
+    {194791,8290,1,0},
+    {194792,8291,1,0},
+    {194793,8292,1,0},
+    {194794,8293,1,0},
+    {194795,8294,1,0},
+    {194796,8295,1,0},
+    {194797,8296,1,0},
+    {194798,8297,1,0},
+    {194799,8298,1,0},
+    {194800,8299,1,0},
+    {194801,8300,1,0},
+    {194802,8301,1,0},
+    {194803,8302,1,0},
+    {194804,8303,1,0},
+    {194805,8304,1,0},
+    {194806,8305,1,0},
+    {194807,8306,1,0},
+    {194808,8307,1,0},
+    {194809,8308,1,0},
+    {194810,8309,1,0},
+    {194811,8310,1,0},
+    {194812,8311,1,0},
+    {194813,8312,1,0},
+    {194814,8313,1,0},
+    {194815,8314,1,0},
+    {194816,8315,1,0},
+    {194817,8316,1,0},
+    {194818,8317,1,0},
+    {194819,8318,1,0},
+    {194820,8319,1,0},
+    {194821,8320,1,0},
+    {194822,8321,1,0},
+    {194823,8322,1,0},
+    {194824,8323,1,0},
+    {194825,8324,1,0},
+    {194826,8325,1,0},
+    {194827,8326,1,0},
+    {194828,8327,1,0},
+    {194829,8328,1,0},
+    {194830,8329,1,0},
+    {194831,8330,1,0},
+    {194832,8331,1,0},
+    {194833,8332,1,0},
+    {194834,8333,1,0},
+    {194835,8334,1,0},
+    {194836,8335,1,0},
+    {194837,8336,1,0},
+    {194838,8337,1,0},
+    {194839,8338,1,0},
+    {194840,8339,1,0},
+    {194841,8340,1,0},
+    {194842,8341,1,0},
+    {194843,8342,1,0},
+    {194844,8343,1,0},
+    {194845,8344,1,0},
+    {194846,8345,1,0},
+    {194847,8346,1,0},
+    {194848,8347,1,0},
+    {194849,8348,1,0},
+    {194850,8349,1,0},
+    {194851,8350,1,0},
+    {194852,8351,1,0},
+    {194853,8352,1,0},
+    {194854,8353,1,0},
+    {194855,8354,1,0},
+    {194856,8355,1,0},
+    {194857,8356,1,0},
+    {194858,8357,1,0},
+    {194859,8358,1,0},
+    {194860,8359,1,0},
+    {194861,8360,1,0},
+    {194862,8361,1,0},
+    {194863,8362,1,0},
+    {194864,8363,1,0},
+    {194865,8364,1,0},
+    {194866,8365,1,0},
+    {194867,8366,1,0},
+    {194868,8367,1,0},
+    {194869,8368,1,0},
+    {194870,8369,1,0},
+    {194871,8370,1,0},
+    {194872,8371,1,0},
+    {194873,8372,1,0},
+    {194874,8373,1,0},
+    {194875,8374,1,0},
+    {194876,8375,1,0},
+    {194877,8376,1,0},
+    {194878,8377,1,0},
+    {194879,8378,1,0},
+    {194880,8379,1,0},
+    {194881,8380,1,0},
+    {194882,8381,1,0},
+    {194883,8382,1,0},
+    {194884,8383,1,0},
+    {194885,8384,1,0},
+    {194886,8385,1,0},
+    {194887,8386,1,0},
+    {194888,8387,1,0},
+    {194889,8388,1,0},
+    {194890,8389,1,0},
+    {194891,8390,1,0},
+    {194892,8391,1,0},
+    {194893,8392,1,0},
+    {194894,8393,1,0},
+    {194895,8394,1,0},
+    {194896,8395,1,0},
+    {194897,8396,1,0},
+    {194898,8397,1,0},
+    {194899,8398,1,0},
+    {194900,8399,1,0},
+    {194901,8400,1,0},
+    {194902,8401,1,0},
+    {194903,8402,1,0},
+    {194904,8403,1,0},
+    {194905,8404,1,0},
+    {194906,8405,1,0},
+    {194907,8406,1,0},
+    {194908,8407,1,0},
+    {194909,8408,1,0},
+    {194910,8409,1,0},
+    {194911,8410,1,0},
+    {194912,8411,1,0},
+    {194913,8412,1,0},
+    {194914,8413,1,0},
+    {194915,8414,1,0},
+    {194916,8415,1,0},
+    {194917,8416,1,0},
+    {194918,8417,1,0},
+    {194919,8418,1,0},
+    {194920,8419,1,0},
+    {194921,8420,1,0},
+    {194922,8421,1,0},
+    {194923,8422,1,0},
+    {194924,8423,1,0},
+    {194925,8424,1,0},
+    {194926,8425,1,0},
+    {194927,8426,1,0},
+    {194928,8427,1,0},
+    {194929,8428,1,0},
+    {194930,8429,1,0},
+    {194931,8430,1,0},
+    {194932,8431,1,0},
+    {194933,8432,1,0},
+    {194934,8433,1,0},
+    {194935,8434,1,0},
+    {194936,8435,1,0},
+    {194937,8436,1,0},
+    {194938,8437,1,0},
+    {194939,8438,1,0},
+    {194940,8439,1,0},
+    {194941,8440,1,0},
+    {194942,8441,1,0},
+    {194943,8442,1,0},
+    {194944,8443,1,0},
+    {194945,8444,1,0},
+    {194946,8445,1,0},
+    {194947,8446,1,0},
+    {194948,8447,1,0},
+    {194949,8448,1,0},
+    {194950,8449,1,0},
+    {194951,8450,1,0},
+    {194952,8451,1,0},
+    {194953,8452,1,0},
+    {194954,8453,1,0},
+    {194955,8454,1,0},
+    {194956,8455,1,0},
+    {194957,8456,1,0},
+    {194958,8457,1,0},
+    {194959,8458,1,0},
+    {194960,8459,1,0},
+    {194961,8460,1,0},
+    {194962,8461,1,0},
+    {194963,8462,1,0},
+    {194964,8463,1,0},
+    {194965,8464,1,0},
+    {194966,8465,1,0},
+    {194967,8466,1,0},
+    {194968,8467,1,0},
+    {194969,8468,1,0},
+    {194970,8469,1,0},
+    {194971,8470,1,0},
+    {194972,8471,1,0},
+    {194973,8472,1,0},
+    {194974,8473,1,0},
+    {194975,8474,1,0},
+    {194976,8475,1,0},
+    {194977,8476,1,0},
+    {194978,8477,1,0},
+    {194979,8478,1,0},
+    {194980,8479,1,0},
+    {194981,8480,1,0},
+    {194982,8481,1,0},
+    {194983,8482,1,0},
+    {194984,8483,1,0},
+    {194985,8484,1,0},
+    {194986,8485,1,0},
+    {194987,8486,1,0},
+    {194988,8487,1,0},
+    {194989,8488,1,0},
+    {194990,8489,1,0},
+    {194991,8490,1,0},
+    {194992,8491,1,0},
+    {194993,8492,1,0},
+    {194994,8493,1,0},
+    {194995,8494,1,0},
+    {194996,8495,1,0},
+    {194997,8496,1,0},
+    {194998,8497,1,0},
+    {194999,8498,1,0},
+    {195000,8499,1,0},
+    {195001,8500,1,0},
+    {195002,8501,1,0},
+    {195003,8502,1,0},
+    {195004,8503,1,0},
+    {195005,8504,1,0},
+    {195006,8505,1,0},
+    {195007,8506,1,0},
+    {195008,8507,1,0},
+    {195009,8508,1,0},
+    {195010,8509,1,0},
+    {195011,8510,1,0},
+    {195012,8511,1,0},
+    {195013,8512,1,0},
+    {195014,8513,1,0},
+    {195015,8514,1,0},
+    {195016,8515,1,0},
+    {195017,8516,1,0},
+    {195018,8517,1,0},
+    {195019,8518,1,0},
+    {195020,8519,1,0},
+    {195021,8520,1,0},
+    {195022,8521,1,0},
+    {195023,8522,1,0},
+    {195024,8523,1,0},
+    {195025,8524,1,0},
+    {195026,8525,1,0},
+    {195027,8526,1,0},
+    {195028,8527,1,0},
+    {195029,8528,1,0},
+    {195030,8529,1,0},
+    {195031,8530,1,0},
+    {195032,8531,1,0},
+    {195033,8532,1,0},
+    {195034,8533,1,0},
+    {195035,8534,1,0},
+    {195036,8535,1,0},
+    {195037,8536,1,0},
+    {195038,8537,1,0},
+    {195039,8538,1,0},
+    {195040,8539,1,0},
+    {195041,8540,1,0},
+    {195042,8541,1,0},
+    {195043,8542,1,0},
+    {195044,8543,1,0},
+    {195045,8544,1,0},
+    {195046,8545,1,0},
+    {195047,8546,1,0},
+    {195048,8547,1,0},
+    {195049,8548,1,0},
+    {195050,8549,1,0},
+    {195051,8550,1,0},
+    {195052,8551,1,0},
+    {195053,8552,1,0},
+    {195054,8553,1,0},
+    {195055,8554,1,0},
+    {195056,8555,1,0},
+    {195057,8556,1,0},
+    {195058,8557,1,0},
+    {195059,8558,1,0},
+    {195060,8559,1,0},
+    {195061,8560,1,0},
+    {195062,8561,1,0},
+    {195063,8562,1,0},
+    {195064,8563,1,0},
+    {195065,8564,1,0},
+    {195066,8565,1,0},
+    {195067,8566,1,0},
+    {195068,8567,1,0},
+    {195069,8568,1,0},
+    {195070,8569,1,0},
+    {195071,8570,1,0},
+    {195072,8571,1,0},
+    {195073,8572,1,0},
+    {195074,8573,1,0},
+    {195075,8574,1,0},
+    {195076,8575,1,0},
+    {195077,8576,1,0},
+    {195078,8577,1,0},
+    {195079,8578,1,0},
+    {195080,8579,1,0},
+    {195081,8580,1,0},
+    {195082,8581,1,0},
+    {195083,8582,1,0},
+    {195084,8583,1,0},
+    {195085,8584,1,0},
+    {195086,8585,1,0},
+    {195087,8586,1,0},
+    {195088,8587,1,0},
+    {195089,8588,1,0},
+    {195090,8589,1,0},
+    {195091,8590,1,0},
+    {195092,8591,1,0},
+    {195093,8592,1,0},
+    {195094,8593,1,0},
+    {195095,8594,1,0},
+    {195096,8595,1,0},
+    {195097,8596,1,0},
+    {195098,8597,1,0},
+    {195099,8598,1,0},
+    {195100,8599,1,0},
+    {195101,8600,1,0},
+};
+const size_t tsearch_normalize_decomposition_count = 5795;
+
+
+const uint32_t tsearch_normalize_decomposition_mappings[8601] =
+{
+    32,32,776,97,32,772,50,51,32,769,956,32,807,49,111,49,
+    8260,52,49,8260,50,51,8260,52,65,768,65,769,65,770,65,771,
+    65,776,65,778,67,807,69,768,69,769,69,770,69,776,73,768,
+    73,769,73,770,73,776,78,771,79,768,79,769,79,770,79,771,
+    79,776,85,768,85,769,85,770,85,776,89,769,97,768,97,769,
+    97,770,97,771,97,776,97,778,99,807,101,768,101,769,101,770,
+    101,776,105,768,105,769,105,770,105,776,110,771,111,768,111,769,
+    111,770,111,771,111,776,117,768,117,769,117,770,117,776,121,769,
+    121,776,65,772,97,772,65,774,97,774,65,808,97,808,67,769,
+    99,769,67,770,99,770,67,775,99,775,67,780,99,780,68,780,
+    100,780,69,772,101,772,69,774,101,774,69,775,101,775,69,808,
+    101,808,69,780,101,780,71,770,103,770,71,774,103,774,71,775,
+    103,775,71,807,103,807,72,770,104,770,73,771,105,771,73,772,
+    105,772,73,774,105,774,73,808,105,808,73,775,73,74,105,106,
+    74,770,106,770,75,807,107,807,76,769,108,769,76,807,108,807,
+    76,780,108,780,76,183,108,183,78,769,110,769,78,807,110,807,
+    78,780,110,780,700,110,79,772,111,772,79,774,111,774,79,779,
+    111,779,82,769,114,769,82,807,114,807,82,780,114,780,83,769,
+    115,769,83,770,115,770,83,807,115,807,83,780,115,780,84,807,
+    116,807,84,780,116,780,85,771,117,771,85,772,117,772,85,774,
+    117,774,85,778,117,778,85,779,117,779,85,808,117,808,87,770,
+    119,770,89,770,121,770,89,776,90,769,122,769,90,775,122,775,
+    90,780,122,780,115,79,795,111,795,85,795,117,795,68,381,68,
+    382,100,382,76,74,76,106,108,106,78,74,78,106,110,106,65,
+    780,97,780,73,780,105,780,79,780,111,780,85,780,117,780,220,
+    772,252,772,220,769,252,769,220,780,252,780,220,768,252,768,196,
+    772,228,772,550,772,551,772,198,772,230,772,71,780,103,780,75,
+    780,107,780,79,808,111,808,490,772,491,772,439,780,658,780,106,
+    780,68,90,68,122,100,122,71,769,103,769,78,768,110,768,197,
+    769,229,769,198,769,230,769,216,769,248,769,65,783,97,783,65,
+    785,97,785,69,783,101,783,69,785,101,785,73,783,105,783,73,
+    785,105,785,79,783,111,783,79,785,111,785,82,783,114,783,82,
+    785,114,785,85,783,117,783,85,785,117,785,83,806,115,806,84,
+    806,116,806,72,780,104,780,65,775,97,775,69,807,101,807,214,
+    772,246,772,213,772,245,772,79,775,111,775,558,772,559,772,89,
+    772,121,772,104,614,106,114,633,635,641,119,121,32,774,32,775,
+    32,778,32,808,32,771,32,779,611,108,115,120,661,768,769,787,
+    776,769,697,32,837,59,32,769,168,769,913,769,183,917,769,919,
+    769,921,769,927,769,933,769,937,769,970,769,921,776,933,776,945,
+    769,949,769,951,769,953,769,971,769,953,776,965,776,959,769,965,
+    769,969,769,946,952,933,978,769,978,776,966,960,954,961,962,920,
+    949,931,1045,768,1045,776,1043,769,1030,776,1050,769,1048,768,1059,774,
+    1048,774,1080,774,1077,768,1077,776,1075,769,1110,776,1082,769,1080,768,
+    1091,774,1140,783,1141,783,1046,774,1078,774,1040,774,1072,774,1040,776,
+    1072,776,1045,774,1077,774,1240,776,1241,776,1046,776,1078,776,1047,776,
+    1079,776,1048,772,1080,772,1048,776,1080,776,1054,776,1086,776,1256,776,
+    1257,776,1069,776,1101,776,1059,772,1091,772,1059,776,1091,776,1059,779,
+    1091,779,1063,776,1095,776,1067,776,1099,776,1381,1410,1575,1619,1575,1620,
+    1608,1620,1575,1621,1610,1620,1575,1652,1608,1652,1735,1652,1610,1652,1749,1620,
+    1729,1620,1746,1620,2344,2364,2352,2364,2355,2364,2325,2364,2326,2364,2327,2364,
+    2332,2364,2337,2364,2338,2364,2347,2364,2351,2364,2503,2494,2503,2519,2465,2492,
+    2466,2492,2479,2492,2610,2620,2616,2620,2582,2620,2583,2620,2588,2620,2603,2620,
+    2887,2902,2887,2878,2887,2903,2849,2876,2850,2876,2962,3031,3014,3006,3015,3006,
+    3014,3031,3142,3158,3263,3285,3270,3285,3270,3286,3270,3266,3274,3285,3398,3390,
+    3399,3390,3398,3415,3545,3530,3545,3535,3548,3530,3545,3551,3661,3634,3789,3762,
+    3755,3737,3755,3745,3851,3906,4023,3916,4023,3921,4023,3926,4023,3931,4023,3904,
+    4021,3953,3954,3953,3956,4018,3968,4018,3969,4019,3968,4019,3969,3953,3968,3986,
+    4023,3996,4023,4001,4023,4006,4023,4011,4023,3984,4021,4133,4142,4316,6917,6965,
+    6919,6965,6921,6965,6923,6965,6925,6965,6929,6965,6970,6965,6972,6965,6974,6965,
+    6975,6965,6978,6965,65,198,66,68,69,398,71,72,73,74,75,76,
+    77,78,79,546,80,82,84,85,87,97,592,593,7426,98,100,101,
+    601,603,604,103,107,109,331,111,596,7446,7447,112,116,117,7453,623,
+    118,7461,946,947,948,966,967,105,114,117,118,946,947,961,966,967,
+    1085,594,99,597,240,604,102,607,609,613,616,617,618,7547,669,621,
+    7557,671,625,624,626,627,628,629,632,642,643,427,649,650,7452,651,
+    652,122,656,657,658,952,65,805,97,805,66,775,98,775,66,803,
+    98,803,66,817,98,817,199,769,231,769,68,775,100,775,68,803,
+    100,803,68,817,100,817,68,807,100,807,68,813,100,813,274,768,
+    275,768,274,769,275,769,69,813,101,813,69,816,101,816,552,774,
+    553,774,70,775,102,775,71,772,103,772,72,775,104,775,72,803,
+    104,803,72,776,104,776,72,807,104,807,72,814,104,814,73,816,
+    105,816,207,769,239,769,75,769,107,769,75,803,107,803,75,817,
+    107,817,76,803,108,803,7734,772,7735,772,76,817,108,817,76,813,
+    108,813,77,769,109,769,77,775,109,775,77,803,109,803,78,775,
+    110,775,78,803,110,803,78,817,110,817,78,813,110,813,213,769,
+    245,769,213,776,245,776,332,768,333,768,332,769,333,769,80,769,
+    112,769,80,775,112,775,82,775,114,775,82,803,114,803,7770,772,
+    7771,772,82,817,114,817,83,775,115,775,83,803,115,803,346,775,
+    347,775,352,775,353,775,7778,775,7779,775,84,775,116,775,84,803,
+    116,803,84,817,116,817,84,813,116,813,85,804,117,804,85,816,
+    117,816,85,813,117,813,360,769,361,769,362,776,363,776,86,771,
+    118,771,86,803,118,803,87,768,119,768,87,769,119,769,87,776,
+    119,776,87,775,119,775,87,803,119,803,88,775,120,775,88,776,
+    120,776,89,775,121,775,90,770,122,770,90,803,122,803,90,817,
+    122,817,104,817,116,776,119,778,121,778,97,702,383,775,65,803,
+    97,803,65,777,97,777,194,769,226,769,194,768,226,768,194,777,
+    226,777,194,771,226,771,7840,770,7841,770,258,769,259,769,258,768,
+    259,768,258,777,259,777,258,771,259,771,7840,774,7841,774,69,803,
+    101,803,69,777,101,777,69,771,101,771,202,769,234,769,202,768,
+    234,768,202,777,234,777,202,771,234,771,7864,770,7865,770,73,777,
+    105,777,73,803,105,803,79,803,111,803,79,777,111,777,212,769,
+    244,769,212,768,244,768,212,777,244,777,212,771,244,771,7884,770,
+    7885,770,416,769,417,769,416,768,417,768,416,777,417,777,416,771,
+    417,771,416,803,417,803,85,803,117,803,85,777,117,777,431,769,
+    432,769,431,768,432,768,431,777,432,777,431,771,432,771,431,803,
+    432,803,89,768,121,768,89,803,121,803,89,777,121,777,89,771,
+    121,771,945,787,945,788,7936,768,7937,768,7936,769,7937,769,7936,834,
+    7937,834,913,787,913,788,7944,768,7945,768,7944,769,7945,769,7944,834,
+    7945,834,949,787,949,788,7952,768,7953,768,7952,769,7953,769,917,787,
+    917,788,7960,768,7961,768,7960,769,7961,769,951,787,951,788,7968,768,
+    7969,768,7968,769,7969,769,7968,834,7969,834,919,787,919,788,7976,768,
+    7977,768,7976,769,7977,769,7976,834,7977,834,953,787,953,788,7984,768,
+    7985,768,7984,769,7985,769,7984,834,7985,834,921,787,921,788,7992,768,
+    7993,768,7992,769,7993,769,7992,834,7993,834,959,787,959,788,8000,768,
+    8001,768,8000,769,8001,769,927,787,927,788,8008,768,8009,768,8008,769,
+    8009,769,965,787,965,788,8016,768,8017,768,8016,769,8017,769,8016,834,
+    8017,834,933,788,8025,768,8025,769,8025,834,969,787,969,788,8032,768,
+    8033,768,8032,769,8033,769,8032,834,8033,834,937,787,937,788,8040,768,
+    8041,768,8040,769,8041,769,8040,834,8041,834,945,768,940,949,768,941,
+    951,768,942,953,768,943,959,768,972,965,768,973,969,768,974,7936,
+    837,7937,837,7938,837,7939,837,7940,837,7941,837,7942,837,7943,837,7944,
+    837,7945,837,7946,837,7947,837,7948,837,7949,837,7950,837,7951,837,7968,
+    837,7969,837,7970,837,7971,837,7972,837,7973,837,7974,837,7975,837,7976,
+    837,7977,837,7978,837,7979,837,7980,837,7981,837,7982,837,7983,837,8032,
+    837,8033,837,8034,837,8035,837,8036,837,8037,837,8038,837,8039,837,8040,
+    837,8041,837,8042,837,8043,837,8044,837,8045,837,8046,837,8047,837,945,
+    774,945,772,8048,837,945,837,940,837,945,834,8118,837,913,774,913,
+    772,913,768,902,913,837,32,787,953,32,787,32,834,168,834,8052,
+    837,951,837,942,837,951,834,8134,837,917,768,904,919,768,905,919,
+    837,8127,768,8127,769,8127,834,953,774,953,772,970,768,912,953,834,
+    970,834,921,774,921,772,921,768,906,8190,768,8190,769,8190,834,965,
+    774,965,772,971,768,944,961,787,961,788,965,834,971,834,933,774,
+    933,772,933,768,910,929,788,168,768,901,96,8060,837,969,837,974,
+    837,969,834,8182,837,927,768,908,937,768,911,937,837,180,32,788,
+    8194,8195,32,32,32,32,32,32,32,32,32,8208,32,819,46,46,
+    46,46,46,46,32,8242,8242,8242,8242,8242,8245,8245,8245,8245,8245,33,
+    33,32,773,63,63,63,33,33,63,8242,8242,8242,8242,32,48,105,
+    52,53,54,55,56,57,43,8722,61,40,41,110,48,49,50,51,
+    52,53,54,55,56,57,43,8722,61,40,41,97,101,111,120,601,
+    104,107,108,109,110,112,115,116,82,115,97,47,99,97,47,115,
+    67,176,67,99,47,111,99,47,117,400,176,70,103,72,72,72,
+    104,295,73,73,76,108,78,78,111,80,81,82,82,82,83,77,
+    84,69,76,84,77,90,937,90,75,197,66,67,101,69,70,77,
+    111,1488,1489,1490,1491,105,70,65,88,960,947,915,928,8721,68,100,
+    101,105,106,49,8260,55,49,8260,57,49,8260,49,48,49,8260,51,
+    50,8260,51,49,8260,53,50,8260,53,51,8260,53,52,8260,53,49,
+    8260,54,53,8260,54,49,8260,56,51,8260,56,53,8260,56,55,8260,
+    56,49,8260,73,73,73,73,73,73,73,86,86,86,73,86,73,
+    73,86,73,73,73,73,88,88,88,73,88,73,73,76,67,68,
+    77,105,105,105,105,105,105,105,118,118,118,105,118,105,105,118,
+    105,105,105,105,120,120,120,105,120,105,105,108,99,100,109,48,
+    8260,51,8592,824,8594,824,8596,824,8656,824,8660,824,8658,824,8707,824,
+    8712,824,8715,824,8739,824,8741,824,8747,8747,8747,8747,8747,8750,8750,8750,
+    8750,8750,8764,824,8771,824,8773,824,8776,824,61,824,8801,824,8781,824,
+    60,824,62,824,8804,824,8805,824,8818,824,8819,824,8822,824,8823,824,
+    8826,824,8827,824,8834,824,8835,824,8838,824,8839,824,8866,824,8872,824,
+    8873,824,8875,824,8828,824,8829,824,8849,824,8850,824,8882,824,8883,824,
+    8884,824,8885,824,12296,12297,49,50,51,52,53,54,55,56,57,49,
+    48,49,49,49,50,49,51,49,52,49,53,49,54,49,55,49,
+    56,49,57,50,48,40,49,41,40,50,41,40,51,41,40,52,
+    41,40,53,41,40,54,41,40,55,41,40,56,41,40,57,41,
+    40,49,48,41,40,49,49,41,40,49,50,41,40,49,51,41,
+    40,49,52,41,40,49,53,41,40,49,54,41,40,49,55,41,
+    40,49,56,41,40,49,57,41,40,50,48,41,49,46,50,46,
+    51,46,52,46,53,46,54,46,55,46,56,46,57,46,49,48,
+    46,49,49,46,49,50,46,49,51,46,49,52,46,49,53,46,
+    49,54,46,49,55,46,49,56,46,49,57,46,50,48,46,40,
+    97,41,40,98,41,40,99,41,40,100,41,40,101,41,40,102,
+    41,40,103,41,40,104,41,40,105,41,40,106,41,40,107,41,
+    40,108,41,40,109,41,40,110,41,40,111,41,40,112,41,40,
+    113,41,40,114,41,40,115,41,40,116,41,40,117,41,40,118,
+    41,40,119,41,40,120,41,40,121,41,40,122,41,65,66,67,
+    68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,
+    84,85,86,87,88,89,90,97,98,99,100,101,102,103,104,105,
+    106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,
+    122,48,8747,8747,8747,8747,58,58,61,61,61,61,61,61,10973,824,
+    106,86,11617,27597,40863,19968,20008,20022,20031,20057,20101,20108,20128,20154,20799,20837,
+    20843,20866,20886,20907,20960,20981,20992,21147,21241,21269,21274,21304,21313,21340,21353,21378,
+    21430,21448,21475,22231,22303,22763,22786,22794,22805,22823,22899,23376,23424,23544,23567,23586,
+    23608,23662,23665,24027,24037,24049,24062,24178,24186,24191,24308,24318,24331,24339,24400,24417,
+    24435,24515,25096,25142,25163,25903,25908,25991,26007,26020,26041,26080,26085,26352,26376,26408,
+    27424,27490,27513,27571,27595,27604,27611,27663,27668,27700,28779,29226,29238,29243,29247,29255,
+    29273,29275,29356,29572,29577,29916,29926,29976,29983,29992,30000,30091,30098,30326,30333,30382,
+    30399,30446,30683,30690,30707,31034,31160,31166,31348,31435,31481,31859,31992,32566,32593,32650,
+    32701,32769,32780,32786,32819,32895,32905,33251,33258,33267,33276,33292,33307,33311,33390,33394,
+    33400,34381,34411,34880,34892,34915,35198,35211,35282,35328,35895,35910,35925,35960,35997,36196,
+    36208,36275,36523,36554,36763,36784,36789,37009,37193,37318,37324,37329,38263,38272,38428,38582,
+    38585,38632,38737,38750,38754,38761,38859,38893,38899,38913,39080,39131,39135,39318,39321,39340,
+    39592,39640,39647,39717,39727,39730,39740,39770,40165,40565,40575,40613,40635,40643,40653,40657,
+    40697,40701,40718,40723,40736,40763,40778,40786,40845,40860,40864,32,12306,21313,21316,21317,
+    12363,12441,12365,12441,12367,12441,12369,12441,12371,12441,12373,12441,12375,12441,12377,12441,
+    12379,12441,12381,12441,12383,12441,12385,12441,12388,12441,12390,12441,12392,12441,12399,12441,
+    12399,12442,12402,12441,12402,12442,12405,12441,12405,12442,12408,12441,12408,12442,12411,12441,
+    12411,12442,12358,12441,32,12441,32,12442,12445,12441,12424,12426,12459,12441,12461,12441,
+    12463,12441,12465,12441,12467,12441,12469,12441,12471,12441,12473,12441,12475,12441,12477,12441,
+    12479,12441,12481,12441,12484,12441,12486,12441,12488,12441,12495,12441,12495,12442,12498,12441,
+    12498,12442,12501,12441,12501,12442,12504,12441,12504,12442,12507,12441,12507,12442,12454,12441,
+    12527,12441,12528,12441,12529,12441,12530,12441,12541,12441,12467,12488,4352,4353,4522,4354,
+    4524,4525,4355,4356,4357,4528,4529,4530,4531,4532,4533,4378,4358,4359,4360,4385,
+    4361,4362,4363,4364,4365,4366,4367,4368,4369,4370,4449,4450,4451,4452,4453,4454,
+    4455,4456,4457,4458,4459,4460,4461,4462,4463,4464,4465,4466,4467,4468,4469,4448,
+    4372,4373,4551,4552,4556,4558,4563,4567,4569,4380,4573,4575,4381,4382,4384,4386,
+    4387,4391,4393,4395,4396,4397,4398,4399,4402,4406,4416,4423,4428,4593,4594,4439,
+    4440,4441,4484,4485,4488,4497,4498,4500,4510,4513,19968,20108,19977,22235,19978,20013,
+    19979,30002,20057,19993,19969,22825,22320,20154,40,4352,41,40,4354,41,40,4355,
+    41,40,4357,41,40,4358,41,40,4359,41,40,4361,41,40,4363,41,
+    40,4364,41,40,4366,41,40,4367,41,40,4368,41,40,4369,41,40,
+    4370,41,40,4352,4449,41,40,4354,4449,41,40,4355,4449,41,40,4357,
+    4449,41,40,4358,4449,41,40,4359,4449,41,40,4361,4449,41,40,4363,
+    4449,41,40,4364,4449,41,40,4366,4449,41,40,4367,4449,41,40,4368,
+    4449,41,40,4369,4449,41,40,4370,4449,41,40,4364,4462,41,40,4363,
+    4457,4364,4453,4523,41,40,4363,4457,4370,4462,41,40,19968,41,40,20108,
+    41,40,19977,41,40,22235,41,40,20116,41,40,20845,41,40,19971,41,
+    40,20843,41,40,20061,41,40,21313,41,40,26376,41,40,28779,41,40,
+    27700,41,40,26408,41,40,37329,41,40,22303,41,40,26085,41,40,26666,
+    41,40,26377,41,40,31038,41,40,21517,41,40,29305,41,40,36001,41,
+    40,31069,41,40,21172,41,40,20195,41,40,21628,41,40,23398,41,40,
+    30435,41,40,20225,41,40,36039,41,40,21332,41,40,31085,41,40,20241,
+    41,40,33258,41,40,33267,41,21839,24188,25991,31631,80,84,69,50,49,
+    50,50,50,51,50,52,50,53,50,54,50,55,50,56,50,57,
+    51,48,51,49,51,50,51,51,51,52,51,53,4352,4354,4355,4357,
+    4358,4359,4361,4363,4364,4366,4367,4368,4369,4370,4352,4449,4354,4449,4355,4449,
+    4357,4449,4358,4449,4359,4449,4361,4449,4363,4449,4364,4449,4366,4449,4367,4449,
+    4368,4449,4369,4449,4370,4449,4366,4449,4535,4352,4457,4364,4462,4363,4468,4363,
+    4462,19968,20108,19977,22235,20116,20845,19971,20843,20061,21313,26376,28779,27700,26408,37329,
+    22303,26085,26666,26377,31038,21517,29305,36001,31069,21172,31192,30007,22899,36969,20778,21360,
+    27880,38917,20241,20889,27491,19978,20013,19979,24038,21491,21307,23447,23398,30435,20225,36039,
+    21332,22812,51,54,51,55,51,56,51,57,52,48,52,49,52,50,
+    52,51,52,52,52,53,52,54,52,55,52,56,52,57,53,48,
+    49,26376,50,26376,51,26376,52,26376,53,26376,54,26376,55,26376,56,26376,
+    57,26376,49,48,26376,49,49,26376,49,50,26376,72,103,101,114,103,
+    101,86,76,84,68,12450,12452,12454,12456,12458,12459,12461,12463,12465,12467,12469,
+    12471,12473,12475,12477,12479,12481,12484,12486,12488,12490,12491,12492,12493,12494,12495,12498,
+    12501,12504,12507,12510,12511,12512,12513,12514,12516,12518,12520,12521,12522,12523,12524,12525,
+    12527,12528,12529,12530,20196,21644,12450,12497,12540,12488,12450,12523,12501,12449,12450,12531,
+    12506,12450,12450,12540,12523,12452,12491,12531,12464,12452,12531,12481,12454,12457,12531,12456,
+    12473,12463,12540,12489,12456,12540,12459,12540,12458,12531,12473,12458,12540,12512,12459,12452,
+    12522,12459,12521,12483,12488,12459,12525,12522,12540,12460,12525,12531,12460,12531,12510,12462,
+    12460,12462,12491,12540,12461,12517,12522,12540,12462,12523,12480,12540,12461,12525,12461,12525,
+    12464,12521,12512,12461,12525,12513,12540,12488,12523,12461,12525,12527,12483,12488,12464,12521,
+    12512,12464,12521,12512,12488,12531,12463,12523,12476,12452,12525,12463,12525,12540,12493,12465,
+    12540,12473,12467,12523,12490,12467,12540,12509,12469,12452,12463,12523,12469,12531,12481,12540,
+    12512,12471,12522,12531,12464,12475,12531,12481,12475,12531,12488,12480,12540,12473,12487,12471,
+    12489,12523,12488,12531,12490,12494,12494,12483,12488,12495,12452,12484,12497,12540,12475,12531,
+    12488,12497,12540,12484,12496,12540,12524,12523,12500,12450,12473,12488,12523,12500,12463,12523,
+    12500,12467,12499,12523,12501,12449,12521,12483,12489,12501,12451,12540,12488,12502,12483,12471,
+    12455,12523,12501,12521,12531,12504,12463,12479,12540,12523,12506,12477,12506,12491,12498,12504,
+    12523,12484,12506,12531,12473,12506,12540,12472,12505,12540,12479,12509,12452,12531,12488,12508,
+    12523,12488,12507,12531,12509,12531,12489,12507,12540,12523,12507,12540,12531,12510,12452,12463,
+    12525,12510,12452,12523,12510,12483,12495,12510,12523,12463,12510,12531,12471,12519,12531,12511,
+    12463,12525,12531,12511,12522,12511,12522,12496,12540,12523,12513,12460,12513,12460,12488,12531,
+    12513,12540,12488,12523,12516,12540,12489,12516,12540,12523,12518,12450,12531,12522,12483,12488,
+    12523,12522,12521,12523,12500,12540,12523,12540,12502,12523,12524,12512,12524,12531,12488,12466,
+    12531,12527,12483,12488,48,28857,49,28857,50,28857,51,28857,52,28857,53,28857,
+    54,28857,55,28857,56,28857,57,28857,49,48,28857,49,49,28857,49,50,
+    28857,49,51,28857,49,52,28857,49,53,28857,49,54,28857,49,55,28857,
+    49,56,28857,49,57,28857,50,48,28857,50,49,28857,50,50,28857,50,
+    51,28857,50,52,28857,104,80,97,100,97,65,85,98,97,114,111,
+    86,112,99,100,109,100,109,178,100,109,179,73,85,24179,25104,26157,
+    21644,22823,27491,26126,27835,26666,24335,20250,31038,112,65,110,65,956,65,109,
+    65,107,65,75,66,77,66,71,66,99,97,108,107,99,97,108,
+    112,70,110,70,956,70,956,103,109,103,107,103,72,122,107,72,
+    122,77,72,122,71,72,122,84,72,122,956,8467,109,8467,100,8467,
+    107,8467,102,109,110,109,956,109,109,109,99,109,107,109,109,109,
+    178,99,109,178,109,178,107,109,178,109,109,179,99,109,179,109,
+    179,107,109,179,109,8725,115,109,8725,115,178,80,97,107,80,97,
+    77,80,97,71,80,97,114,97,100,114,97,100,8725,115,114,97,
+    100,8725,115,178,112,115,110,115,956,115,109,115,112,86,110,86,
+    956,86,109,86,107,86,77,86,112,87,110,87,956,87,109,87,
+    107,87,77,87,107,937,77,937,97,46,109,46,66,113,99,99,
+    99,100,67,8725,107,103,67,111,46,100,66,71,121,104,97,72,
+    80,105,110,75,75,75,77,107,116,108,109,108,110,108,111,103,
+    108,120,109,98,109,105,108,109,111,108,80,72,112,46,109,46,
+    80,80,77,80,82,115,114,83,118,87,98,86,8725,109,65,8725,
+    109,49,26085,50,26085,51,26085,52,26085,53,26085,54,26085,55,26085,56,
+    26085,57,26085,49,48,26085,49,49,26085,49,50,26085,49,51,26085,49,
+    52,26085,49,53,26085,49,54,26085,49,55,26085,49,56,26085,49,57,
+    26085,50,48,26085,50,49,26085,50,50,26085,50,51,26085,50,52,26085,
+    50,53,26085,50,54,26085,50,55,26085,50,56,26085,50,57,26085,51,
+    48,26085,51,49,26085,103,97,108,1098,1100,42863,67,70,81,294,339,
+    42791,43831,619,43858,653,35912,26356,36554,36040,28369,20018,21477,40860,40860,22865,37329,
+    21895,22856,25078,30313,32645,34367,34746,35064,37007,27138,27931,28889,29662,33853,37226,39409,
+    20098,21365,27396,29211,34349,40478,23888,28651,34253,35172,25289,33240,34847,24266,26391,28010,
+    29436,37070,20358,20919,21214,25796,27347,29200,30439,32769,34310,34396,36335,38706,39791,40442,
+    30860,31103,32160,33737,37636,40575,35542,22751,24324,31840,32894,29282,30922,36034,38647,22744,
+    23650,27155,28122,28431,32047,32311,38475,21202,32907,20956,20940,31260,32190,33777,38517,35712,
+    25295,27138,35582,20025,23527,24594,29575,30064,21271,30971,20415,24489,19981,27852,25976,32034,
+    21443,22622,30465,33865,35498,27578,36784,27784,25342,33509,25504,30053,20142,20841,20937,26753,
+    31975,33391,35538,37327,21237,21570,22899,24300,26053,28670,31018,38317,39530,40599,40654,21147,
+    26310,27511,36706,24180,24976,25088,25754,28451,29001,29833,31178,32244,32879,36646,34030,36899,
+    37706,21015,21155,21693,28872,35010,35498,24265,24565,25467,27566,31806,29557,20196,22265,23527,
+    23994,24604,29618,29801,32666,32838,37428,38646,38728,38936,20363,31150,37300,38584,24801,20102,
+    20698,23534,23615,26009,27138,29134,30274,34044,36988,40845,26248,38446,21129,26491,26611,27969,
+    28316,29705,30041,30827,32016,39006,20845,25134,38520,20523,23833,28138,36650,24459,24900,26647,
+    29575,38534,21033,21519,23653,26131,26446,26792,27877,29702,30178,32633,35023,35041,37324,38626,
+    21311,28346,21533,29136,29848,34298,38563,40023,40607,26519,28107,33256,31435,31520,31890,29376,
+    28825,35672,20160,33590,21050,20999,24230,25299,31958,23429,27934,26292,36667,34892,38477,35211,
+    24275,20800,21952,22618,26228,20958,29482,30410,31036,31070,31077,31119,38742,31934,32701,34322,
+    35576,36920,37117,39151,39164,39208,40372,37086,38583,20398,20711,20813,21193,21220,21329,21917,
+    22022,22120,22592,22696,23652,23662,24724,24936,24974,25074,25935,26082,26257,26757,28023,28186,
+    28450,29038,29227,29730,30865,31038,31049,31048,31056,31062,31069,31117,31118,31296,31361,31680,
+    32244,32265,32321,32626,32773,33261,33401,33401,33879,35088,35222,35585,35641,36051,36104,36790,
+    36920,38627,38911,38971,24693,148206,33304,20006,20917,20840,20352,20805,20864,21191,21242,21917,
+    21845,21913,21986,22618,22707,22852,22868,23138,23336,24274,24281,24425,24493,24792,24910,24840,
+    24974,24928,25074,25140,25540,25628,25682,25942,26228,26391,26395,26454,27513,27578,27969,28379,
+    28363,28450,28702,29038,30631,29237,29359,29482,29809,29958,30011,30237,30239,30410,30427,30452,
+    30538,30528,30924,31409,31680,31867,32091,32244,32574,32773,33618,33775,34681,35137,35206,35222,
+    35519,35576,35531,35585,35582,35565,35641,35722,36104,36664,36978,37273,37494,38524,38627,38742,
+    38875,38911,38923,38971,39698,40860,141386,141380,144341,15261,16408,16441,152137,154832,163539,40771,
+    40846,102,102,102,105,102,108,102,102,105,102,102,108,383,116,115,
+    116,1396,1398,1396,1381,1396,1387,1406,1398,1396,1389,1497,1460,1522,1463,1506,
+    1488,1491,1492,1499,1500,1501,1512,1514,43,1513,1473,1513,1474,64329,1473,64329,
+    1474,1488,1463,1488,1464,1488,1468,1489,1468,1490,1468,1491,1468,1492,1468,1493,
+    1468,1494,1468,1496,1468,1497,1468,1498,1468,1499,1468,1500,1468,1502,1468,1504,
+    1468,1505,1468,1507,1468,1508,1468,1510,1468,1511,1468,1512,1468,1513,1468,1514,
+    1468,1493,1465,1489,1471,1499,1471,1508,1471,1488,1500,1649,1649,1659,1659,1659,
+    1659,1662,1662,1662,1662,1664,1664,1664,1664,1658,1658,1658,1658,1663,1663,1663,
+    1663,1657,1657,1657,1657,1700,1700,1700,1700,1702,1702,1702,1702,1668,1668,1668,
+    1668,1667,1667,1667,1667,1670,1670,1670,1670,1671,1671,1671,1671,1677,1677,1676,
+    1676,1678,1678,1672,1672,1688,1688,1681,1681,1705,1705,1705,1705,1711,1711,1711,
+    1711,1715,1715,1715,1715,1713,1713,1713,1713,1722,1722,1723,1723,1723,1723,1728,
+    1728,1729,1729,1729,1729,1726,1726,1726,1726,1746,1746,1747,1747,1709,1709,1709,
+    1709,1735,1735,1734,1734,1736,1736,1655,1739,1739,1733,1733,1737,1737,1744,1744,
+    1744,1744,1609,1609,1574,1575,1574,1575,1574,1749,1574,1749,1574,1608,1574,1608,
+    1574,1735,1574,1735,1574,1734,1574,1734,1574,1736,1574,1736,1574,1744,1574,1744,
+    1574,1744,1574,1609,1574,1609,1574,1609,1740,1740,1740,1740,1574,1580,1574,1581,
+    1574,1605,1574,1609,1574,1610,1576,1580,1576,1581,1576,1582,1576,1605,1576,1609,
+    1576,1610,1578,1580,1578,1581,1578,1582,1578,1605,1578,1609,1578,1610,1579,1580,
+    1579,1605,1579,1609,1579,1610,1580,1581,1580,1605,1581,1580,1581,1605,1582,1580,
+    1582,1581,1582,1605,1587,1580,1587,1581,1587,1582,1587,1605,1589,1581,1589,1605,
+    1590,1580,1590,1581,1590,1582,1590,1605,1591,1581,1591,1605,1592,1605,1593,1580,
+    1593,1605,1594,1580,1594,1605,1601,1580,1601,1581,1601,1582,1601,1605,1601,1609,
+    1601,1610,1602,1581,1602,1605,1602,1609,1602,1610,1603,1575,1603,1580,1603,1581,
+    1603,1582,1603,1604,1603,1605,1603,1609,1603,1610,1604,1580,1604,1581,1604,1582,
+    1604,1605,1604,1609,1604,1610,1605,1580,1605,1581,1605,1582,1605,1605,1605,1609,
+    1605,1610,1606,1580,1606,1581,1606,1582,1606,1605,1606,1609,1606,1610,1607,1580,
+    1607,1605,1607,1609,1607,1610,1610,1580,1610,1581,1610,1582,1610,1605,1610,1609,
+    1610,1610,1584,1648,1585,1648,1609,1648,32,1612,1617,32,1613,1617,32,1614,
+    1617,32,1615,1617,32,1616,1617,32,1617,1648,1574,1585,1574,1586,1574,1605,
+    1574,1606,1574,1609,1574,1610,1576,1585,1576,1586,1576,1605,1576,1606,1576,1609,
+    1576,1610,1578,1585,1578,1586,1578,1605,1578,1606,1578,1609,1578,1610,1579,1585,
+    1579,1586,1579,1605,1579,1606,1579,1609,1579,1610,1601,1609,1601,1610,1602,1609,
+    1602,1610,1603,1575,1603,1604,1603,1605,1603,1609,1603,1610,1604,1605,1604,1609,
+    1604,1610,1605,1575,1605,1605,1606,1585,1606,1586,1606,1605,1606,1606,1606,1609,
+    1606,1610,1609,1648,1610,1585,1610,1586,1610,1605,1610,1606,1610,1609,1610,1610,
+    1574,1580,1574,1581,1574,1582,1574,1605,1574,1607,1576,1580,1576,1581,1576,1582,
+    1576,1605,1576,1607,1578,1580,1578,1581,1578,1582,1578,1605,1578,1607,1579,1605,
+    1580,1581,1580,1605,1581,1580,1581,1605,1582,1580,1582,1605,1587,1580,1587,1581,
+    1587,1582,1587,1605,1589,1581,1589,1582,1589,1605,1590,1580,1590,1581,1590,1582,
+    1590,1605,1591,1581,1592,1605,1593,1580,1593,1605,1594,1580,1594,1605,1601,1580,
+    1601,1581,1601,1582,1601,1605,1602,1581,1602,1605,1603,1580,1603,1581,1603,1582,
+    1603,1604,1603,1605,1604,1580,1604,1581,1604,1582,1604,1605,1604,1607,1605,1580,
+    1605,1581,1605,1582,1605,1605,1606,1580,1606,1581,1606,1582,1606,1605,1606,1607,
+    1607,1580,1607,1605,1607,1648,1610,1580,1610,1581,1610,1582,1610,1605,1610,1607,
+    1574,1605,1574,1607,1576,1605,1576,1607,1578,1605,1578,1607,1579,1605,1579,1607,
+    1587,1605,1587,1607,1588,1605,1588,1607,1603,1604,1603,1605,1604,1605,1606,1605,
+    1606,1607,1610,1605,1610,1607,1600,1614,1617,1600,1615,1617,1600,1616,1617,1591,
+    1609,1591,1610,1593,1609,1593,1610,1594,1609,1594,1610,1587,1609,1587,1610,1588,
+    1609,1588,1610,1581,1609,1581,1610,1580,1609,1580,1610,1582,1609,1582,1610,1589,
+    1609,1589,1610,1590,1609,1590,1610,1588,1580,1588,1581,1588,1582,1588,1605,1588,
+    1585,1587,1585,1589,1585,1590,1585,1591,1609,1591,1610,1593,1609,1593,1610,1594,
+    1609,1594,1610,1587,1609,1587,1610,1588,1609,1588,1610,1581,1609,1581,1610,1580,
+    1609,1580,1610,1582,1609,1582,1610,1589,1609,1589,1610,1590,1609,1590,1610,1588,
+    1580,1588,1581,1588,1582,1588,1605,1588,1585,1587,1585,1589,1585,1590,1585,1588,
+    1580,1588,1581,1588,1582,1588,1605,1587,1607,1588,1607,1591,1605,1587,1580,1587,
+    1581,1587,1582,1588,1580,1588,1581,1588,1582,1591,1605,1592,1605,1575,1611,1575,
+    1611,1578,1580,1605,1578,1581,1580,1578,1581,1580,1578,1581,1605,1578,1582,1605,
+    1578,1605,1580,1578,1605,1581,1578,1605,1582,1580,1605,1581,1580,1605,1581,1581,
+    1605,1610,1581,1605,1609,1587,1581,1580,1587,1580,1581,1587,1580,1609,1587,1605,
+    1581,1587,1605,1581,1587,1605,1580,1587,1605,1605,1587,1605,1605,1589,1581,1581,
+    1589,1581,1581,1589,1605,1605,1588,1581,1605,1588,1581,1605,1588,1580,1610,1588,
+    1605,1582,1588,1605,1582,1588,1605,1605,1588,1605,1605,1590,1581,1609,1590,1582,
+    1605,1590,1582,1605,1591,1605,1581,1591,1605,1581,1591,1605,1605,1591,1605,1610,
+    1593,1580,1605,1593,1605,1605,1593,1605,1605,1593,1605,1609,1594,1605,1605,1594,
+    1605,1610,1594,1605,1609,1601,1582,1605,1601,1582,1605,1602,1605,1581,1602,1605,
+    1605,1604,1581,1605,1604,1581,1610,1604,1581,1609,1604,1580,1580,1604,1580,1580,
+    1604,1582,1605,1604,1582,1605,1604,1605,1581,1604,1605,1581,1605,1581,1580,1605,
+    1581,1605,1605,1581,1610,1605,1580,1581,1605,1580,1605,1605,1582,1580,1605,1582,
+    1605,1605,1580,1582,1607,1605,1580,1607,1605,1605,1606,1581,1605,1606,1581,1609,
+    1606,1580,1605,1606,1580,1605,1606,1580,1609,1606,1605,1610,1606,1605,1609,1610,
+    1605,1605,1610,1605,1605,1576,1582,1610,1578,1580,1610,1578,1580,1609,1578,1582,
+    1610,1578,1582,1609,1578,1605,1610,1578,1605,1609,1580,1605,1610,1580,1581,1609,
+    1580,1605,1609,1587,1582,1609,1589,1581,1610,1588,1581,1610,1590,1581,1610,1604,
+    1580,1610,1604,1605,1610,1610,1581,1610,1610,1580,1610,1610,1605,1610,1605,1605,
+    1610,1602,1605,1610,1606,1581,1610,1602,1605,1581,1604,1581,1605,1593,1605,1610,
+    1603,1605,1610,1606,1580,1581,1605,1582,1610,1604,1580,1605,1603,1605,1605,1604,
+    1580,1605,1606,1580,1581,1580,1581,1610,1581,1580,1610,1605,1580,1610,1601,1605,
+    1610,1576,1581,1610,1603,1605,1605,1593,1580,1605,1589,1605,1605,1587,1582,1610,
+    1606,1580,1610,1589,1604,1746,1602,1604,1746,1575,1604,1604,1607,1575,1603,1576,
+    1585,1605,1581,1605,1583,1589,1604,1593,1605,1585,1587,1608,1604,1593,1604,1610,
+    1607,1608,1587,1604,1605,1589,1604,1609,1589,1604,1609,32,1575,1604,1604,1607,
+    32,1593,1604,1610,1607,32,1608,1587,1604,1605,1580,1604,32,1580,1604,1575,
+    1604,1607,1585,1740,1575,1604,44,12289,12290,58,59,33,63,12310,12311,8230,
+    8229,8212,8211,95,95,40,41,123,125,12308,12309,12304,12305,12298,12299,12296,
+    12297,12300,12301,12302,12303,91,93,8254,8254,8254,8254,95,95,95,44,12289,
+    46,59,58,63,33,8212,40,41,123,125,12308,12309,35,38,42,43,
+    45,60,62,61,92,36,37,64,32,1611,1600,1611,32,1612,32,1613,
+    32,1614,1600,1614,32,1615,1600,1615,32,1616,1600,1616,32,1617,1600,1617,
+    32,1618,1600,1618,1569,1570,1570,1571,1571,1572,1572,1573,1573,1574,1574,1574,
+    1574,1575,1575,1576,1576,1576,1576,1577,1577,1578,1578,1578,1578,1579,1579,1579,
+    1579,1580,1580,1580,1580,1581,1581,1581,1581,1582,1582,1582,1582,1583,1583,1584,
+    1584,1585,1585,1586,1586,1587,1587,1587,1587,1588,1588,1588,1588,1589,1589,1589,
+    1589,1590,1590,1590,1590,1591,1591,1591,1591,1592,1592,1592,1592,1593,1593,1593,
+    1593,1594,1594,1594,1594,1601,1601,1601,1601,1602,1602,1602,1602,1603,1603,1603,
+    1603,1604,1604,1604,1604,1605,1605,1605,1605,1606,1606,1606,1606,1607,1607,1607,
+    1607,1608,1608,1609,1609,1610,1610,1610,1610,1604,1570,1604,1570,1604,1571,1604,
+    1571,1604,1573,1604,1573,1604,1575,1604,1575,33,34,35,36,37,38,39,
+    40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,
+    56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,
+    72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,
+    88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,
+    104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,
+    120,121,122,123,124,125,126,10629,10630,12290,12300,12301,12289,12539,12530,12449,
+    12451,12453,12455,12457,12515,12517,12519,12483,12540,12450,12452,12454,12456,12458,12459,12461,
+    12463,12465,12467,12469,12471,12473,12475,12477,12479,12481,12484,12486,12488,12490,12491,12492,
+    12493,12494,12495,12498,12501,12504,12507,12510,12511,12512,12513,12514,12516,12518,12520,12521,
+    12522,12523,12524,12525,12527,12531,12441,12442,12644,12593,12594,12595,12596,12597,12598,12599,
+    12600,12601,12602,12603,12604,12605,12606,12607,12608,12609,12610,12611,12612,12613,12614,12615,
+    12616,12617,12618,12619,12620,12621,12622,12623,12624,12625,12626,12627,12628,12629,12630,12631,
+    12632,12633,12634,12635,12636,12637,12638,12639,12640,12641,12642,12643,162,163,172,175,
+    166,165,8361,9474,8592,8593,8594,8595,9632,9675,720,721,230,665,595,675,
+    43878,677,676,598,599,7569,600,606,681,612,610,608,667,295,668,615,
+    644,682,683,620,122628,42894,622,122629,654,122630,248,630,631,113,634,122632,
+    637,638,640,680,678,43879,679,648,11377,655,673,674,664,448,449,450,
+    122634,122654,69785,69818,69787,69818,69797,69818,69937,69927,69938,69927,70471,70462,70471,70487,
+    70841,70842,70841,70832,70841,70845,71096,71087,71097,71087,71989,71984,119127,119141,119128,119141,
+    119135,119150,119135,119151,119135,119152,119135,119153,119135,119154,119225,119141,119226,119141,119227,119150,
+    119228,119150,119227,119151,119228,119151,65,66,67,68,69,70,71,72,73,74,
+    75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,
+    97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,
+    113,114,115,116,117,118,119,120,121,122,65,66,67,68,69,70,
+    71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,
+    87,88,89,90,97,98,99,100,101,102,103,105,106,107,108,109,
+    110,111,112,113,114,115,116,117,118,119,120,121,122,65,66,67,
+    68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,
+    84,85,86,87,88,89,90,97,98,99,100,101,102,103,104,105,
+    106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,
+    122,65,67,68,71,74,75,78,79,80,81,83,84,85,86,87,
+    88,89,90,97,98,99,100,102,104,105,106,107,108,109,110,112,
+    113,114,115,116,117,118,119,120,121,122,65,66,67,68,69,70,
+    71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,
+    87,88,89,90,97,98,99,100,101,102,103,104,105,106,107,108,
+    109,110,111,112,113,114,115,116,117,118,119,120,121,122,65,66,
+    68,69,70,71,74,75,76,77,78,79,80,81,83,84,85,86,
+    87,88,89,97,98,99,100,101,102,103,104,105,106,107,108,109,
+    110,111,112,113,114,115,116,117,118,119,120,121,122,65,66,68,
+    69,70,71,73,74,75,76,77,79,83,84,85,86,87,88,89,
+    97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,
+    113,114,115,116,117,118,119,120,121,122,65,66,67,68,69,70,
+    71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,
+    87,88,89,90,97,98,99,100,101,102,103,104,105,106,107,108,
+    109,110,111,112,113,114,115,116,117,118,119,120,121,122,65,66,
+    67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,
+    83,84,85,86,87,88,89,90,97,98,99,100,101,102,103,104,
+    105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,
+    121,122,65,66,67,68,69,70,71,72,73,74,75,76,77,78,
+    79,80,81,82,83,84,85,86,87,88,89,90,97,98,99,100,
+    101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,
+    117,118,119,120,121,122,65,66,67,68,69,70,71,72,73,74,
+    75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,
+    97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,
+    113,114,115,116,117,118,119,120,121,122,65,66,67,68,69,70,
+    71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,
+    87,88,89,90,97,98,99,100,101,102,103,104,105,106,107,108,
+    109,110,111,112,113,114,115,116,117,118,119,120,121,122,65,66,
+    67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,
+    83,84,85,86,87,88,89,90,97,98,99,100,101,102,103,104,
+    105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,
+    121,122,305,567,913,914,915,916,917,918,919,920,921,922,923,924,
+    925,926,927,928,929,1012,931,932,933,934,935,936,937,8711,945,946,
+    947,948,949,950,951,952,953,954,955,956,957,958,959,960,961,962,
+    963,964,965,966,967,968,969,8706,1013,977,1008,981,1009,982,913,914,
+    915,916,917,918,919,920,921,922,923,924,925,926,927,928,929,1012,
+    931,932,933,934,935,936,937,8711,945,946,947,948,949,950,951,952,
+    953,954,955,956,957,958,959,960,961,962,963,964,965,966,967,968,
+    969,8706,1013,977,1008,981,1009,982,913,914,915,916,917,918,919,920,
+    921,922,923,924,925,926,927,928,929,1012,931,932,933,934,935,936,
+    937,8711,945,946,947,948,949,950,951,952,953,954,955,956,957,958,
+    959,960,961,962,963,964,965,966,967,968,969,8706,1013,977,1008,981,
+    1009,982,913,914,915,916,917,918,919,920,921,922,923,924,925,926,
+    927,928,929,1012,931,932,933,934,935,936,937,8711,945,946,947,948,
+    949,950,951,952,953,954,955,956,957,958,959,960,961,962,963,964,
+    965,966,967,968,969,8706,1013,977,1008,981,1009,982,913,914,915,916,
+    917,918,919,920,921,922,923,924,925,926,927,928,929,1012,931,932,
+    933,934,935,936,937,8711,945,946,947,948,949,950,951,952,953,954,
+    955,956,957,958,959,960,961,962,963,964,965,966,967,968,969,8706,
+    1013,977,1008,981,1009,982,988,989,48,49,50,51,52,53,54,55,
+    56,57,48,49,50,51,52,53,54,55,56,57,48,49,50,51,
+    52,53,54,55,56,57,48,49,50,51,52,53,54,55,56,57,
+    48,49,50,51,52,53,54,55,56,57,1575,1576,1580,1583,1608,1586,
+    1581,1591,1610,1603,1604,1605,1606,1587,1593,1601,1589,1602,1585,1588,1578,1579,
+    1582,1584,1590,1592,1594,1646,1722,1697,1647,1576,1580,1607,1581,1610,1603,1604,
+    1605,1606,1587,1593,1601,1589,1602,1588,1578,1579,1582,1590,1594,1580,1581,1610,
+    1604,1606,1587,1593,1589,1602,1588,1582,1590,1594,1722,1647,1576,1580,1607,1581,
+    1591,1610,1603,1605,1606,1587,1593,1601,1589,1602,1588,1578,1579,1582,1590,1592,
+    1594,1646,1697,1575,1576,1580,1583,1607,1608,1586,1581,1591,1610,1604,1605,1606,
+    1587,1593,1601,1589,1602,1585,1588,1578,1579,1582,1584,1590,1592,1594,1576,1580,
+    1583,1608,1586,1581,1591,1610,1604,1605,1606,1587,1593,1601,1589,1602,1585,1588,
+    1578,1579,1582,1584,1590,1592,1594,48,46,48,44,49,44,50,44,51,
+    44,52,44,53,44,54,44,55,44,56,44,57,44,40,65,41,
+    40,66,41,40,67,41,40,68,41,40,69,41,40,70,41,40,
+    71,41,40,72,41,40,73,41,40,74,41,40,75,41,40,76,
+    41,40,77,41,40,78,41,40,79,41,40,80,41,40,81,41,
+    40,82,41,40,83,41,40,84,41,40,85,41,40,86,41,40,
+    87,41,40,88,41,40,89,41,40,90,41,12308,83,12309,67,82,
+    67,68,87,90,65,66,67,68,69,70,71,72,73,74,75,76,
+    77,78,79,80,81,82,83,84,85,86,87,88,89,90,72,86,
+    77,86,83,68,83,83,80,80,86,87,67,77,67,77,68,77,
+    82,68,74,12411,12363,12467,12467,12469,25163,23383,21452,12487,20108,22810,35299,22825,
+    20132,26144,28961,26009,21069,24460,20877,26032,21021,32066,29983,36009,22768,21561,28436,25237,
+    25429,19968,19977,36938,24038,20013,21491,25351,36208,25171,31105,31354,21512,28288,26377,26376,
+    30003,21106,21942,37197,12308,26412,12309,12308,19977,12309,12308,20108,12309,12308,23433,12309,
+    12308,28857,12309,12308,25171,12309,12308,30423,12309,12308,21213,12309,12308,25943,12309,24471,
+    21487,48,49,50,51,52,53,54,55,56,57,20029,20024,20033,131362,20320,
+    20398,20411,20482,20602,20633,20711,20687,13470,132666,20813,20820,20836,20855,132380,13497,20839,
+    20877,132427,20887,20900,20172,20908,20917,168415,20981,20995,13535,21051,21062,21106,21111,13589,
+    21191,21193,21220,21242,21253,21254,21271,21321,21329,21338,21363,21373,21375,21375,21375,133676,
+    28784,21450,21471,133987,21483,21489,21510,21662,21560,21576,21608,21666,21750,21776,21843,21859,
+    21892,21892,21913,21931,21939,21954,22294,22022,22295,22097,22132,20999,22766,22478,22516,22541,
+    22411,22578,22577,22700,136420,22770,22775,22790,22810,22818,22882,136872,136938,23020,23067,23079,
+    23000,23142,14062,14076,23304,23358,23358,137672,23491,23512,23527,23539,138008,23551,23558,24403,
+    23586,14209,23648,23662,23744,23693,138724,23875,138726,23918,23915,23932,24033,24034,14383,24061,
+    24104,24125,24169,14434,139651,14460,24240,24243,24246,24266,172946,24318,140081,140081,33281,24354,
+    24354,14535,144056,156122,24418,24427,14563,24474,24525,24535,24569,24705,14650,14620,24724,141012,
+    24775,24904,24908,24910,24908,24954,24974,25010,24996,25007,25054,25074,25078,25104,25115,25181,
+    25265,25300,25424,142092,25405,25340,25448,25475,25572,142321,25634,25541,25513,14894,25705,25726,
+    25757,25719,14956,25935,25964,143370,26083,26360,26185,15129,26257,15112,15076,20882,20885,26368,
+    26268,32941,17369,26391,26395,26401,26462,26451,144323,15177,26618,26501,26706,26757,144493,26766,
+    26655,26900,15261,26946,27043,27114,27304,145059,27355,15384,27425,145575,27476,15438,27506,27551,
+    27578,27579,146061,138507,146170,27726,146620,27839,27853,27751,27926,27966,28023,27969,28009,28024,
+    28037,146718,27956,28207,28270,15667,28363,28359,147153,28153,28526,147294,147342,28614,28729,28702,
+    28699,15766,28746,28797,28791,28845,132389,28997,148067,29084,148395,29224,29237,29264,149000,29312,
+    29333,149301,149524,29562,29579,16044,29605,16056,16056,29767,29788,29809,29829,29898,16155,29988,
+    150582,30014,150674,30064,139679,30224,151457,151480,151620,16380,16392,30452,151795,151794,151833,151859,
+    30494,30495,30495,30538,16441,30603,16454,16534,152605,30798,30860,30924,16611,153126,31062,153242,
+    153285,31119,31211,16687,31296,31306,31311,153980,154279,154279,31470,16898,154539,31686,31689,16935,
+    154752,31954,17056,31976,31971,32000,155526,32099,17153,32199,32258,32325,17204,156200,156231,17241,
+    156377,32634,156478,32661,32762,32773,156890,156963,32864,157096,32880,144223,17365,32946,33027,17419,
+    33086,23221,157607,157621,144275,144284,33281,33284,36766,17515,33425,33419,33437,21171,33457,33459,
+    33469,33510,158524,33509,33565,33635,33709,33571,33725,33767,33879,33619,33738,33740,33756,158774,
+    159083,158933,17707,34033,34035,34070,160714,34148,159532,17757,17761,159665,159954,17771,34384,34396,
+    34407,34409,34473,34440,34574,34530,34681,34600,34667,34694,17879,34785,34817,17913,34912,34915,
+    161383,35031,35038,17973,35066,13499,161966,162150,18110,18119,35488,35565,35722,35925,162984,36011,
+    36033,36123,36215,163631,133124,36299,36284,36336,133342,36564,36664,165330,165357,37012,37105,37137,
+    165678,37147,37432,37591,37592,37500,37881,37909,166906,38283,18837,38327,167287,18918,38595,23986,
+    38691,168261,168474,19054,19062,38880,168970,19122,169110,38923,38923,38953,169398,39138,19251,39209,
+    39335,39362,39422,19406,170800,39698,40000,40189,19662,19693,40295,172238,19704,172293,172558,172689,
+    40635,19798,40697,40702,40709,40719,40726,40763,173568,
+};
+
+
+const tsearch_normalize_composition tsearch_normalize_compositions[941] =
+{
+    {60,824,8814},
+    {61,824,8800},
+    {62,824,8815},
+    {65,768,192},
+    {65,769,193},
+    {65,770,194},
+    {65,771,195},
+    {65,772,256},
+    {65,774,258},
+    {65,775,550},
+    {65,776,196},
+    {65,777,7842},
+    {65,778,197},
+    {65,780,461},
+    {65,783,512},
+    {65,785,514},
+    {65,803,7840},
+    {65,805,7680},
+    {65,808,260},
+    {66,775,7682},
+    {66,803,7684},
+    {66,817,7686},
+    {67,769,262},
+    {67,770,264},
+    {67,775,266},
+    {67,780,268},
+    {67,807,199},
+    {68,775,7690},
+    {68,780,270},
+    {68,803,7692},
+    {68,807,7696},
+    {68,813,7698},
+    {68,817,7694},
+    {69,768,200},
+    {69,769,201},
+    {69,770,202},
+    {69,771,7868},
+    {69,772,274},
+    {69,774,276},
+    {69,775,278},
+    {69,776,203},
+    {69,777,7866},
+    {69,780,282},
+    {69,783,516},
+    {69,785,518},
+    {69,803,7864},
+    {69,807,552},
+    {69,808,280},
+    {69,813,7704},
+    {69,816,7706},
+    {70,775,7710},
+    {71,769,500},
+    {71,770,284},
+    {71,772,7712},
+    {71,774,286},
+    {71,775,288},
+    {71,780,486},
+    {71,807,290},
+    {72,770,292},
+    {72,775,7714},
+    {72,776,7718},
+    {72,780,542},
+    {72,803,7716},
+    {72,807,7720},
+    {72,814,7722},
+    {73,768,204},
+    {73,769,205},
+    {73,770,206},
+    {73,771,296},
+    {73,772,298},
+    {73,774,300},
+    {73,775,304},
+    {73,776,207},
+    {73,777,7880},
+    {73,780,463},
+    {73,783,520},
+    {73,785,522},
+    {73,803,7882},
+    {73,808,302},
+    {73,816,7724},
+    {74,770,308},
+    {75,769,7728},
+    {75,780,488},
+    {75,803,7730},
+    {75,807,310},
+    {75,817,7732},
+    {76,769,313},
+    {76,780,317},
+    {76,803,7734},
+    {76,807,315},
+    {76,813,7740},
+    {76,817,7738},
+    {77,769,7742},
+    {77,775,7744},
+    {77,803,7746},
+    {78,768,504},
+    {78,769,323},
+    {78,771,209},
+    {78,775,7748},
+    {78,780,327},
+    {78,803,7750},
+    {78,807,325},
+    {78,813,7754},
+    {78,817,7752},
+    {79,768,210},
+    {79,769,211},
+    {79,770,212},
+    {79,771,213},
+    {79,772,332},
+    {79,774,334},
+    {79,775,558},
+    {79,776,214},
+    {79,777,7886},
+    {79,779,336},
+    {79,780,465},
+    {79,783,524},
+    {79,785,526},
+    {79,795,416},
+    {79,803,7884},
+    {79,808,490},
+    {80,769,7764},
+    {80,775,7766},
+    {82,769,340},
+    {82,775,7768},
+    {82,780,344},
+    {82,783,528},
+    {82,785,530},
+    {82,803,7770},
+    {82,807,342},
+    {82,817,7774},
+    {83,769,346},
+    {83,770,348},
+    {83,775,7776},
+    {83,780,352},
+    {83,803,7778},
+    {83,806,536},
+    {83,807,350},
+    {84,775,7786},
+    {84,780,356},
+    {84,803,7788},
+    {84,806,538},
+    {84,807,354},
+    {84,813,7792},
+    {84,817,7790},
+    {85,768,217},
+    {85,769,218},
+    {85,770,219},
+    {85,771,360},
+    {85,772,362},
+    {85,774,364},
+    {85,776,220},
+    {85,777,7910},
+    {85,778,366},
+    {85,779,368},
+    {85,780,467},
+    {85,783,532},
+    {85,785,534},
+    {85,795,431},
+    {85,803,7908},
+    {85,804,7794},
+    {85,808,370},
+    {85,813,7798},
+    {85,816,7796},
+    {86,771,7804},
+    {86,803,7806},
+    {87,768,7808},
+    {87,769,7810},
+    {87,770,372},
+    {87,775,7814},
+    {87,776,7812},
+    {87,803,7816},
+    {88,775,7818},
+    {88,776,7820},
+    {89,768,7922},
+    {89,769,221},
+    {89,770,374},
+    {89,771,7928},
+    {89,772,562},
+    {89,775,7822},
+    {89,776,376},
+    {89,777,7926},
+    {89,803,7924},
+    {90,769,377},
+    {90,770,7824},
+    {90,775,379},
+    {90,780,381},
+    {90,803,7826},
+    {90,817,7828},
+    {97,768,224},
+    {97,769,225},
+    {97,770,226},
+    {97,771,227},
+    {97,772,257},
+    {97,774,259},
+    {97,775,551},
+    {97,776,228},
+    {97,777,7843},
+    {97,778,229},
+    {97,780,462},
+    {97,783,513},
+    {97,785,515},
+    {97,803,7841},
+    {97,805,7681},
+    {97,808,261},
+    {98,775,7683},
+    {98,803,7685},
+    {98,817,7687},
+    {99,769,263},
+    {99,770,265},
+    {99,775,267},
+    {99,780,269},
+    {99,807,231},
+    {100,775,7691},
+    {100,780,271},
+    {100,803,7693},
+    {100,807,7697},
+    {100,813,7699},
+    {100,817,7695},
+    {101,768,232},
+    {101,769,233},
+    {101,770,234},
+    {101,771,7869},
+    {101,772,275},
+    {101,774,277},
+    {101,775,279},
+    {101,776,235},
+    {101,777,7867},
+    {101,780,283},
+    {101,783,517},
+    {101,785,519},
+    {101,803,7865},
+    {101,807,553},
+    {101,808,281},
+    {101,813,7705},
+    {101,816,7707},
+    {102,775,7711},
+    {103,769,501},
+    {103,770,285},
+    {103,772,7713},
+    {103,774,287},
+    {103,775,289},
+    {103,780,487},
+    {103,807,291},
+    {104,770,293},
+    {104,775,7715},
+    {104,776,7719},
+    {104,780,543},
+    {104,803,7717},
+    {104,807,7721},
+    {104,814,7723},
+    {104,817,7830},
+    {105,768,236},
+    {105,769,237},
+    {105,770,238},
+    {105,771,297},
+    {105,772,299},
+    {105,774,301},
+    {105,776,239},
+    {105,777,7881},
+    {105,780,464},
+    {105,783,521},
+    {105,785,523},
+    {105,803,7883},
+    {105,808,303},
+    {105,816,7725},
+    {106,770,309},
+    {106,780,496},
+    {107,769,7729},
+    {107,780,489},
+    {107,803,7731},
+    {107,807,311},
+    {107,817,7733},
+    {108,769,314},
+    {108,780,318},
+    {108,803,7735},
+    {108,807,316},
+    {108,813,7741},
+    {108,817,7739},
+    {109,769,7743},
+    {109,775,7745},
+    {109,803,7747},
+    {110,768,505},
+    {110,769,324},
+    {110,771,241},
+    {110,775,7749},
+    {110,780,328},
+    {110,803,7751},
+    {110,807,326},
+    {110,813,7755},
+    {110,817,7753},
+    {111,768,242},
+    {111,769,243},
+    {111,770,244},
+    {111,771,245},
+    {111,772,333},
+    {111,774,335},
+    {111,775,559},
+    {111,776,246},
+    {111,777,7887},
+    {111,779,337},
+    {111,780,466},
+    {111,783,525},
+    {111,785,527},
+    {111,795,417},
+    {111,803,7885},
+    {111,808,491},
+    {112,769,7765},
+    {112,775,7767},
+    {114,769,341},
+    {114,775,7769},
+    {114,780,345},
+    {114,783,529},
+    {114,785,531},
+    {114,803,7771},
+    {114,807,343},
+    {114,817,7775},
+    {115,769,347},
+    {115,770,349},
+    {115,775,7777},
+    {115,780,353},
+    {115,803,7779},
+    {115,806,537},
+    {115,807,351},
+    {116,775,7787},
+    {116,776,7831},
+    {116,780,357},
+    {116,803,7789},
+    {116,806,539},
+    {116,807,355},
+    {116,813,7793},
+    {116,817,7791},
+    {117,768,249},
+    {117,769,250},
+    {117,770,251},
+    {117,771,361},
+    {117,772,363},
+    {117,774,365},
+    {117,776,252},
+    {117,777,7911},
+    {117,778,367},
+    {117,779,369},
+    {117,780,468},
+    {117,783,533},
+    {117,785,535},
+    {117,795,432},
+    {117,803,7909},
+    {117,804,7795},
+    {117,808,371},
+    {117,813,7799},
+    {117,816,7797},
+    {118,771,7805},
+    {118,803,7807},
+    {119,768,7809},
+    {119,769,7811},
+    {119,770,373},
+    {119,775,7815},
+    {119,776,7813},
+    {119,778,7832},
+    {119,803,7817},
+    {120,775,7819},
+    {120,776,7821},
+    {121,768,7923},
+    {121,769,253},
+    {121,770,375},
+    {121,771,7929},
+    {121,772,563},
+    {121,775,7823},
+    {121,776,255},
+    {121,777,7927},
+    {121,778,7833},
+    {121,803,7925},
+    {122,769,378},
+    {122,770,7825},
+    {122,775,380},
+    {122,780,382},
+    {122,803,7827},
+    {122,817,7829},
+    {168,768,8173},
+    {168,769,901},
+    {168,834,8129},
+    {194,768,7846},
+    {194,769,7844},
+    {194,771,7850},
+    {194,777,7848},
+    {196,772,478},
+    {197,769,506},
+    {198,769,508},
+    {198,772,482},
+    {199,769,7688},
+    {202,768,7872},
+    {202,769,7870},
+    {202,771,7876},
+    {202,777,7874},
+    {207,769,7726},
+    {212,768,7890},
+    {212,769,7888},
+    {212,771,7894},
+    {212,777,7892},
+    {213,769,7756},
+    {213,772,556},
+    {213,776,7758},
+    {214,772,554},
+    {216,769,510},
+    {220,768,475},
+    {220,769,471},
+    {220,772,469},
+    {220,780,473},
+    {226,768,7847},
+    {226,769,7845},
+    {226,771,7851},
+    {226,777,7849},
+    {228,772,479},
+    {229,769,507},
+    {230,769,509},
+    {230,772,483},
+    {231,769,7689},
+    {234,768,7873},
+    {234,769,7871},
+    {234,771,7877},
+    {234,777,7875},
+    {239,769,7727},
+    {244,768,7891},
+    {244,769,7889},
+    {244,771,7895},
+    {244,777,7893},
+    {245,769,7757},
+    {245,772,557},
+    {245,776,7759},
+    {246,772,555},
+    {248,769,511},
+    {252,768,476},
+    {252,769,472},
+    {252,772,470},
+    {252,780,474},
+    {258,768,7856},
+    {258,769,7854},
+    {258,771,7860},
+    {258,777,7858},
+    {259,768,7857},
+    {259,769,7855},
+    {259,771,7861},
+    {259,777,7859},
+    {274,768,7700},
+    {274,769,7702},
+    {275,768,7701},
+    {275,769,7703},
+    {332,768,7760},
+    {332,769,7762},
+    {333,768,7761},
+    {333,769,7763},
+    {346,775,7780},
+    {347,775,7781},
+    {352,775,7782},
+    {353,775,7783},
+    {360,769,7800},
+    {361,769,7801},
+    {362,776,7802},
+    {363,776,7803},
+    {383,775,7835},
+    {416,768,7900},
+    {416,769,7898},
+    {416,771,7904},
+    {416,777,7902},
+    {416,803,7906},
+    {417,768,7901},
+    {417,769,7899},
+    {417,771,7905},
+    {417,777,7903},
+    {417,803,7907},
+    {431,768,7914},
+    {431,769,7912},
+    {431,771,7918},
+    {431,777,7916},
+    {431,803,7920},
+    {432,768,7915},
+    {432,769,7913},
+    {432,771,7919},
+    {432,777,7917},
+    {432,803,7921},
+    {439,780,494},
+    {490,772,492},
+    {491,772,493},
+    {550,772,480},
+    {551,772,481},
+    {552,774,7708},
+    {553,774,7709},
+    {558,772,560},
+    {559,772,561},
+    {658,780,495},
+    {913,768,8122},
+    {913,769,902},
+    {913,772,8121},
+    {913,774,8120},
+    {913,787,7944},
+    {913,788,7945},
+    {913,837,8124},
+    {917,768,8136},
+    {917,769,904},
+    {917,787,7960},
+    {917,788,7961},
+    {919,768,8138},
+    {919,769,905},
+    {919,787,7976},
+    {919,788,7977},
+    {919,837,8140},
+    {921,768,8154},
+    {921,769,906},
+    {921,772,8153},
+    {921,774,8152},
+    {921,776,938},
+    {921,787,7992},
+    {921,788,7993},
+    {927,768,8184},
+    {927,769,908},
+    {927,787,8008},
+    {927,788,8009},
+    {929,788,8172},
+    {933,768,8170},
+    {933,769,910},
+    {933,772,8169},
+    {933,774,8168},
+    {933,776,939},
+    {933,788,8025},
+    {937,768,8186},
+    {937,769,911},
+    {937,787,8040},
+    {937,788,8041},
+    {937,837,8188},
+    {940,837,8116},
+    {942,837,8132},
+    {945,768,8048},
+    {945,769,940},
+    {945,772,8113},
+    {945,774,8112},
+    {945,787,7936},
+    {945,788,7937},
+    {945,834,8118},
+    {945,837,8115},
+    {949,768,8050},
+    {949,769,941},
+    {949,787,7952},
+    {949,788,7953},
+    {951,768,8052},
+    {951,769,942},
+    {951,787,7968},
+    {951,788,7969},
+    {951,834,8134},
+    {951,837,8131},
+    {953,768,8054},
+    {953,769,943},
+    {953,772,8145},
+    {953,774,8144},
+    {953,776,970},
+    {953,787,7984},
+    {953,788,7985},
+    {953,834,8150},
+    {959,768,8056},
+    {959,769,972},
+    {959,787,8000},
+    {959,788,8001},
+    {961,787,8164},
+    {961,788,8165},
+    {965,768,8058},
+    {965,769,973},
+    {965,772,8161},
+    {965,774,8160},
+    {965,776,971},
+    {965,787,8016},
+    {965,788,8017},
+    {965,834,8166},
+    {969,768,8060},
+    {969,769,974},
+    {969,787,8032},
+    {969,788,8033},
+    {969,834,8182},
+    {969,837,8179},
+    {970,768,8146},
+    {970,769,912},
+    {970,834,8151},
+    {971,768,8162},
+    {971,769,944},
+    {971,834,8167},
+    {974,837,8180},
+    {978,769,979},
+    {978,776,980},
+    {1030,776,1031},
+    {1040,774,1232},
+    {1040,776,1234},
+    {1043,769,1027},
+    {1045,768,1024},
+    {1045,774,1238},
+    {1045,776,1025},
+    {1046,774,1217},
+    {1046,776,1244},
+    {1047,776,1246},
+    {1048,768,1037},
+    {1048,772,1250},
+    {1048,774,1049},
+    {1048,776,1252},
+    {1050,769,1036},
+    {1054,776,1254},
+    {1059,772,1262},
+    {1059,774,1038},
+    {1059,776,1264},
+    {1059,779,1266},
+    {1063,776,1268},
+    {1067,776,1272},
+    {1069,776,1260},
+    {1072,774,1233},
+    {1072,776,1235},
+    {1075,769,1107},
+    {1077,768,1104},
+    {1077,774,1239},
+    {1077,776,1105},
+    {1078,774,1218},
+    {1078,776,1245},
+    {1079,776,1247},
+    {1080,768,1117},
+    {1080,772,1251},
+    {1080,774,1081},
+    {1080,776,1253},
+    {1082,769,1116},
+    {1086,776,1255},
+    {1091,772,1263},
+    {1091,774,1118},
+    {1091,776,1265},
+    {1091,779,1267},
+    {1095,776,1269},
+    {1099,776,1273},
+    {1101,776,1261},
+    {1110,776,1111},
+    {1140,783,1142},
+    {1141,783,1143},
+    {1240,776,1242},
+    {1241,776,1243},
+    {1256,776,1258},
+    {1257,776,1259},
+    {1575,1619,1570},
+    {1575,1620,1571},
+    {1575,1621,1573},
+    {1608,1620,1572},
+    {1610,1620,1574},
+    {1729,1620,1730},
+    {1746,1620,1747},
+    {1749,1620,1728},
+    {2344,2364,2345},
+    {2352,2364,2353},
+    {2355,2364,2356},
+    {2503,2494,2507},
+    {2503,2519,2508},
+    {2887,2878,2891},
+    {2887,2902,2888},
+    {2887,2903,2892},
+    {2962,3031,2964},
+    {3014,3006,3018},
+    {3014,3031,3020},
+    {3015,3006,3019},
+    {3142,3158,3144},
+    {3263,3285,3264},
+    {3270,3266,3274},
+    {3270,3285,3271},
+    {3270,3286,3272},
+    {3274,3285,3275},
+    {3398,3390,3402},
+    {3398,3415,3404},
+    {3399,3390,3403},
+    {3545,3530,3546},
+    {3545,3535,3548},
+    {3545,3551,3550},
+    {3548,3530,3549},
+    {4133,4142,4134},
+    {6917,6965,6918},
+    {6919,6965,6920},
+    {6921,6965,6922},
+    {6923,6965,6924},
+    {6925,6965,6926},
+    {6929,6965,6930},
+    {6970,6965,6971},
+    {6972,6965,6973},
+    {6974,6965,6976},
+    {6975,6965,6977},
+    {6978,6965,6979},
+    {7734,772,7736},
+    {7735,772,7737},
+    {7770,772,7772},
+    {7771,772,7773},
+    {7778,775,7784},
+    {7779,775,7785},
+    {7840,770,7852},
+    {7840,774,7862},
+    {7841,770,7853},
+    {7841,774,7863},
+    {7864,770,7878},
+    {7865,770,7879},
+    {7884,770,7896},
+    {7885,770,7897},
+    {7936,768,7938},
+    {7936,769,7940},
+    {7936,834,7942},
+    {7936,837,8064},
+    {7937,768,7939},
+    {7937,769,7941},
+    {7937,834,7943},
+    {7937,837,8065},
+    {7938,837,8066},
+    {7939,837,8067},
+    {7940,837,8068},
+    {7941,837,8069},
+    {7942,837,8070},
+    {7943,837,8071},
+    {7944,768,7946},
+    {7944,769,7948},
+    {7944,834,7950},
+    {7944,837,8072},
+    {7945,768,7947},
+    {7945,769,7949},
+    {7945,834,7951},
+    {7945,837,8073},
+    {7946,837,8074},
+    {7947,837,8075},
+    {7948,837,8076},
+    {7949,837,8077},
+    {7950,837,8078},
+    {7951,837,8079},
+    {7952,768,7954},
+    {7952,769,7956},
+    {7953,768,7955},
+    {7953,769,7957},
+    {7960,768,7962},
+    {7960,769,7964},
+    {7961,768,7963},
+    {7961,769,7965},
+    {7968,768,7970},
+    {7968,769,7972},
+    {7968,834,7974},
+    {7968,837,8080},
+    {7969,768,7971},
+    {7969,769,7973},
+    {7969,834,7975},
+    {7969,837,8081},
+    {7970,837,8082},
+    {7971,837,8083},
+    {7972,837,8084},
+    {7973,837,8085},
+    {7974,837,8086},
+    {7975,837,8087},
+    {7976,768,7978},
+    {7976,769,7980},
+    {7976,834,7982},
+    {7976,837,8088},
+    {7977,768,7979},
+    {7977,769,7981},
+    {7977,834,7983},
+    {7977,837,8089},
+    {7978,837,8090},
+    {7979,837,8091},
+    {7980,837,8092},
+    {7981,837,8093},
+    {7982,837,8094},
+    {7983,837,8095},
+    {7984,768,7986},
+    {7984,769,7988},
+    {7984,834,7990},
+    {7985,768,7987},
+    {7985,769,7989},
+    {7985,834,7991},
+    {7992,768,7994},
+    {7992,769,7996},
+    {7992,834,7998},
+    {7993,768,7995},
+    {7993,769,7997},
+    {7993,834,7999},
+    {8000,768,8002},
+    {8000,769,8004},
+    {8001,768,8003},
+    {8001,769,8005},
+    {8008,768,8010},
+    {8008,769,8012},
+    {8009,768,8011},
+    {8009,769,8013},
+    {8016,768,8018},
+    {8016,769,8020},
+    {8016,834,8022},
+    {8017,768,8019},
+    {8017,769,8021},
+    {8017,834,8023},
+    {8025,768,8027},
+    {8025,769,8029},
+    {8025,834,8031},
+    {8032,768,8034},
+    {8032,769,8036},
+    {8032,834,8038},
+    {8032,837,8096},
+    {8033,768,8035},
+    {8033,769,8037},
+    {8033,834,8039},
+    {8033,837,8097},
+    {8034,837,8098},
+    {8035,837,8099},
+    {8036,837,8100},
+    {8037,837,8101},
+    {8038,837,8102},
+    {8039,837,8103},
+    {8040,768,8042},
+    {8040,769,8044},
+    {8040,834,8046},
+    {8040,837,8104},
+    {8041,768,8043},
+    {8041,769,8045},
+    {8041,834,8047},
+    {8041,837,8105},
+    {8042,837,8106},
+    {8043,837,8107},
+    {8044,837,8108},
+    {8045,837,8109},
+    {8046,837,8110},
+    {8047,837,8111},
+    {8048,837,8114},
+    {8052,837,8130},
+    {8060,837,8178},
+    {8118,837,8119},
+    {8127,768,8141},
+    {8127,769,8142},
+    {8127,834,8143},
+    {8134,837,8135},
+    {8182,837,8183},
+    {8190,768,8157},
+    {8190,769,8158},
+    {8190,834,8159},
+    {8592,824,8602},
+    {8594,824,8603},
+    {8596,824,8622},
+    {8656,824,8653},
+    {8658,824,8655},
+    {8660,824,8654},
+    {8707,824,8708},
+    {8712,824,8713},
+    {8715,824,8716},
+    {8739,824,8740},
+    {8741,824,8742},
+    {8764,824,8769},
+    {8771,824,8772},
+    {8773,824,8775},
+    {8776,824,8777},
+    {8781,824,8813},
+    {8801,824,8802},
+    {8804,824,8816},
+    {8805,824,8817},
+    {8818,824,8820},
+    {8819,824,8821},
+    {8822,824,8824},
+    {8823,824,8825},
+    {8826,824,8832},
+    {8827,824,8833},
+    {8828,824,8928},
+    {8829,824,8929},
+    {8834,824,8836},
+    {8835,824,8837},
+    {8838,824,8840},
+    {8839,824,8841},
+    {8849,824,8930},
+    {8850,824,8931},
+    {8866,824,8876},
+    {8872,824,8877},
+    {8873,824,8878},
+    {8875,824,8879},
+    {8882,824,8938},
+    {8883,824,8939},
+    {8884,824,8940},
+    {8885,824,8941},
+    {12358,12441,12436},
+    {12363,12441,12364},
+    {12365,12441,12366},
+    {12367,12441,12368},
+    {12369,12441,12370},
+    {12371,12441,12372},
+    {12373,12441,12374},
+    {12375,12441,12376},
+    {12377,12441,12378},
+    {12379,12441,12380},
+    {12381,12441,12382},
+    {12383,12441,12384},
+    {12385,12441,12386},
+    {12388,12441,12389},
+    {12390,12441,12391},
+    {12392,12441,12393},
+    {12399,12441,12400},
+    {12399,12442,12401},
+    {12402,12441,12403},
+    {12402,12442,12404},
+    {12405,12441,12406},
+    {12405,12442,12407},
+    {12408,12441,12409},
+    {12408,12442,12410},
+    {12411,12441,12412},
+    {12411,12442,12413},
+    {12445,12441,12446},
+    {12454,12441,12532},
+    {12459,12441,12460},
+    {12461,12441,12462},
+    {12463,12441,12464},
+    {12465,12441,12466},
+    {12467,12441,12468},
+    {12469,12441,12470},
+    {12471,12441,12472},
+    {12473,12441,12474},
+    {12475,12441,12476},
+    {12477,12441,12478},
+    {12479,12441,12480},
+    {12481,12441,12482},
+    {12484,12441,12485},
+    {12486,12441,12487},
+    {12488,12441,12489},
+    {12495,12441,12496},
+    {12495,12442,12497},
+    {12498,12441,12499},
+    {12498,12442,12500},
+    {12501,12441,12502},
+    {12501,12442,12503},
+    {12504,12441,12505},
+    {12504,12442,12506},
+    {12507,12441,12508},
+    {12507,12442,12509},
+    {12527,12441,12535},
+    {12528,12441,12536},
+    {12529,12441,12537},
+    {12530,12441,12538},
+    {12541,12441,12542},
+    {69785,69818,69786},
+    {69787,69818,69788},
+    {69797,69818,69803},
+    {69937,69927,69934},
+    {69938,69927,69935},
+    {70471,70462,70475},
+    {70471,70487,70476},
+    {70841,70832,70844},
+    {70841,70842,70843},
+    {70841,70845,70846},
+    {71096,71087,71098},
+    {71097,71087,71099},
+    {71989,71984,71992},
+};
+const size_t tsearch_normalize_composition_count = 941;
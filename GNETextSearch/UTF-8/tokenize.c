@@ -26,15 +26,113 @@
 //
 
 #include "tokenize.h"
-#include "utf8_utils.h"
+#include "wordbreak.h"
 #include "GNETextSearchPrivate.h"
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
 
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define TSEARCH_TOKENIZE_X86 1
+    #define TSEARCH_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+    #include <immintrin.h>
+#else
+    #define TSEARCH_TOKENIZE_X86 0
+#endif
+
 
 #define UTF8_ACCEPT 0
 #define UTF8_REJECT 1
+#define REPLACEMENT_CHARACTER 0xFFFD
+#define TOKEN_BUFFER_LENGTH 64
+#define MAX_UTF8_LENGTH 4
+#define SCAN_BLOCK_LENGTH 32
+
+#define SIMD_NONE 0
+#define SIMD_SSE2 1
+#define SIMD_AVX2 2
+
+#define WB_BIT(property) ((uint32_t)1 << (property))
+#define WB_AHLETTER (WB_BIT(tsearch_wordbreak_aletter) | WB_BIT(tsearch_wordbreak_hebrew_letter))
+#define WB_MIDNUMLETQ (WB_BIT(tsearch_wordbreak_midnumlet) | WB_BIT(tsearch_wordbreak_single_quote))
+#define WB_NEWLINES (WB_BIT(tsearch_wordbreak_cr) | WB_BIT(tsearch_wordbreak_lf) | WB_BIT(tsearch_wordbreak_newline))
+#define WB_IGNORED (WB_BIT(tsearch_wordbreak_extend) | WB_BIT(tsearch_wordbreak_format) | WB_BIT(tsearch_wordbreak_zwj))
+#define WB_WORD_LIKE (WB_AHLETTER | WB_BIT(tsearch_wordbreak_numeric) | WB_BIT(tsearch_wordbreak_katakana) | \
+                      WB_BIT(tsearch_wordbreak_spaceless))
+#define WB_SEPARATORS (WB_BIT(tsearch_wordbreak_other) | WB_BIT(tsearch_wordbreak_wsegspace) | \
+                       WB_BIT(tsearch_wordbreak_lf) | WB_BIT(tsearch_wordbreak_newline))
+
+// ------------------------------------------------------------------------------------------
+
+typedef struct _tsearch_tokenize_scanner
+{
+    const unsigned char *string;
+    const unsigned char *block;
+    uint32_t mask;
+    int simdLevel;
+} _tsearch_tokenize_scanner;
+
+typedef struct _tsearch_tokenize_segmenter
+{
+    const char *string;
+    process_token_func processCodePoints;
+    process_token_bytes_func processBytes;
+    process_normalized_token_func processNormalized;
+    tsearch_normalize_options options;
+    void *context;
+
+    // The properties of the code point before the next one, and the Word_Break properties of the
+    // last two code points that weren't ignored by rule WB4.
+    uint8_t lastProperties;
+    uint8_t previous;
+    uint8_t beforePrevious;
+    size_t regionalIndicatorCount;
+
+    size_t segmentLocation;
+    bool isWordLike;
+
+    // Whether a MidLetter, MidNum, MidNumLet, Single_Quote, or Double_Quote is part of a word
+    // depends on the code point after it, so the break before it is pending until then.
+    bool hasPendingBreak;
+    uint32_t pendingContinuations;
+    size_t pendingLocation;
+    size_t pendingTokenLength;
+
+    uint32_t *token;
+    size_t tokenLength;
+    size_t tokenCapacity;
+    uint32_t tokenBuffer[TOKEN_BUFFER_LENGTH];
+
+    // In the normalized mode, the token holds case folded code points, and the quick checks record
+    // whether they need to be normalized before they're encoded into the reused UTF-8 buffer.
+    bool needsNormalizing;
+    uint8_t lastCombiningClass;
+    uint16_t quickCheckFlag;
+    uint32_t *normalized;
+    size_t normalizedCapacity;
+    char *utf8;
+    size_t utf8Capacity;
+    char utf8Buffer[TOKEN_BUFFER_LENGTH * MAX_UTF8_LENGTH + 1];
+    bool hasFailed;
+} _tsearch_tokenize_segmenter;
+
+result _tsearch_tokenize(_tsearch_tokenize_segmenter *segmenter);
+void _tsearch_tokenize_segmenter_init(_tsearch_tokenize_segmenter *segmenter, const char *cString, void *context);
+void _tsearch_tokenize_segmenter_process_normalized(_tsearch_tokenize_segmenter *segmenter, const tsearch_range range,
+                                                    const size_t tokenLength);
+void _tsearch_tokenize_segmenter_free(_tsearch_tokenize_segmenter *segmenter);
+size_t _tsearch_tokenize_encode(const uint32_t codePoint, char *outBytes);
+result _tsearch_tokenize_reserve(uint32_t **tokenPtr, uint32_t *tokenBuffer, size_t *capacity, const size_t length);
+void _tsearch_tokenize_scanner_init(_tsearch_tokenize_scanner *scanner, const unsigned char *s);
+int _tsearch_tokenize_get_simd_level(void);
+uint32_t _tsearch_tokenize_special_mask(const _tsearch_tokenize_scanner *scanner);
+uint32_t _tsearch_tokenize_special_mask_scalar(const unsigned char *block, const unsigned char *string);
+#if TSEARCH_TOKENIZE_X86
+uint32_t _tsearch_tokenize_special_mask_sse2(const unsigned char *block);
+uint32_t _tsearch_tokenize_special_mask_avx2(const unsigned char *block);
+#endif
+
+// ------------------------------------------------------------------------------------------
 
 
 // ------------------------------------------------------------------------------------------
@@ -127,72 +225,397 @@ void utf8_printUTF16CodePoints(const char *s)
 
 
 // ------------------------------------------------------------------------------------------
-#pragma mark - Range
+#pragma mark - Scanning
 // ------------------------------------------------------------------------------------------
-TSEARCH_INLINE size_t _range_sum(tsearch_range range)
+/// Classifies the bytes the scanners stop at, which are every byte except the ASCII letters,
+/// digits, and underscore. Word boundaries never fall between two of those, so the tokenizer
+/// only has to look at the first of them in a run.
+static const uint8_t specialBytes[] =
 {
-    return range.location + range.length;
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // 00..0f
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // 10..1f
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // 20..2f
+    0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1, // 30..3f
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, // 40..4f
+    0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0, // 50..5f
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, // 60..6f
+    0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1, // 70..7f
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // 80..8f
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // 90..9f
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // a0..af
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // b0..bf
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // c0..cf
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // d0..df
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // e0..ef
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, // f0..ff
+};
+
+
+/// Returns the index of the scanner's next special byte. Because the terminating NUL is special,
+/// the scanner must not be advanced past it.
+TSEARCH_INLINE size_t _tsearch_tokenize_scanner_next(_tsearch_tokenize_scanner *scanner)
+{
+    while (scanner->mask == 0) {
+        scanner->block += SCAN_BLOCK_LENGTH;
+        scanner->mask = _tsearch_tokenize_special_mask(scanner);
+    }
+    size_t index = (size_t)(scanner->block - scanner->string) + (size_t)__builtin_ctz(scanner->mask);
+    scanner->mask &= scanner->mask - 1;
+    return index;
+}
+
+
+/// Moves the scanner forward, so that its next special byte is the first one at or after the index.
+TSEARCH_INLINE void _tsearch_tokenize_scanner_seek(_tsearch_tokenize_scanner *scanner, const size_t index)
+{
+    const unsigned char *target = scanner->string + index;
+    size_t offset = (size_t)(target - scanner->block);
+    if (offset >= SCAN_BLOCK_LENGTH) {
+        offset = (uintptr_t)target & (SCAN_BLOCK_LENGTH - 1);
+        scanner->block = target - offset;
+        scanner->mask = _tsearch_tokenize_special_mask(scanner);
+    }
+    scanner->mask &= (UINT32_MAX << offset);
+}
+
+
+/// Decodes the code point at the start of the string and returns the number of its bytes. An
+/// invalid sequence is decoded as U+FFFD and its bytes up to the first one that doesn't fit it.
+TSEARCH_INLINE size_t _tsearch_tokenize_decode(const unsigned char *s, uint32_t *outCodePoint)
+{
+    // Valid two- and three-byte sequences, which most non-ASCII text is made of, are decoded directly.
+    if (s[0] >= 0xC2 && s[0] < 0xE0 && (s[1] & 0xC0) == 0x80) {
+        *outCodePoint = ((uint32_t)(s[0] & 0x1F) << 6) | (uint32_t)(s[1] & 0x3F);
+        return 2;
+    }
+    if ((s[0] & 0xF0) == 0xE0 && (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+        uint32_t codePoint = ((uint32_t)(s[0] & 0x0F) << 12) | ((uint32_t)(s[1] & 0x3F) << 6) | (uint32_t)(s[2] & 0x3F);
+        if (codePoint >= 0x800 && (codePoint < 0xD800 || codePoint > 0xDFFF)) {
+            *outCodePoint = codePoint;
+            return 3;
+        }
+    }
+
+    uint32_t state = UTF8_ACCEPT;
+    uint32_t codePoint = 0;
+    for (size_t i = 0; true; i++) {
+        if (utf8_decode(&state, &codePoint, s[i]) == UTF8_ACCEPT) {
+            *outCodePoint = codePoint;
+            return i + 1;
+        }
+        if (state == UTF8_REJECT) {
+            *outCodePoint = REPLACEMENT_CHARACTER;
+            return (i > 0) ? i : 1;
+        }
+    }
 }
 
 
 // ------------------------------------------------------------------------------------------
-#pragma mark - Public
+#pragma mark - Segment
 // ------------------------------------------------------------------------------------------
-int tsearch_cstring_tokenize(const char *cstr, process_token_func process, void *context)
+/// Ends the current segment at the location, reporting it as a token if it contains any letters,
+/// numbers, or ideographs. The first tokenLength code points of the token belong to the segment.
+TSEARCH_INLINE void _tsearch_tokenize_segmenter_break(_tsearch_tokenize_segmenter *segmenter, const size_t location,
+                                                      const size_t tokenLength)
+{
+    if (segmenter->isWordLike == true && location > segmenter->segmentLocation) {
+        tsearch_range range = {segmenter->segmentLocation, location - segmenter->segmentLocation};
+        if (segmenter->processCodePoints != NULL) {
+            segmenter->processCodePoints(segmenter->string, range, segmenter->token, tokenLength,
+                                         segmenter->context);
+        } else if (segmenter->processNormalized != NULL) {
+            _tsearch_tokenize_segmenter_process_normalized(segmenter, range, tokenLength);
+        } else if (segmenter->processBytes != NULL) {
+            segmenter->processBytes(segmenter->string, range, segmenter->context);
+        }
+    }
+
+    // The code points after a pending break belong to the next segment.
+    size_t remainingLength = segmenter->tokenLength - tokenLength;
+    if (remainingLength > 0) {
+        memmove(segmenter->token, segmenter->token + tokenLength, remainingLength * sizeof(uint32_t));
+    }
+    segmenter->tokenLength = remainingLength;
+    segmenter->segmentLocation = location;
+    segmenter->isWordLike = false;
+    if (remainingLength == 0) {
+        segmenter->needsNormalizing = false;
+        segmenter->lastCombiningClass = 0;
+    }
+}
+
+
+/// Returns the code point's simple case folding if the options call for it, and records whether
+/// the token needs to be normalized, because the folded code point fails the quick check or is a
+/// non-starter that is out of canonical order.
+TSEARCH_INLINE uint32_t _tsearch_tokenize_segmenter_fold(_tsearch_tokenize_segmenter *segmenter,
+                                                         const uint32_t codePoint)
 {
-    if (process == NULL) { return failure; }
+    uint32_t folded = codePoint;
+    if ((segmenter->options & tsearch_normalize_fold_case) != 0) {
+        folded = tsearch_normalize_get_case_folding(codePoint);
+    }
+    const uint16_t properties = tsearch_normalize_get_properties(folded);
+    const uint8_t combiningClass = (uint8_t)(properties & TSEARCH_NORMALIZE_COMBINING_CLASS_MASK);
+    if ((properties & segmenter->quickCheckFlag) != 0 ||
+        (combiningClass != 0 && combiningClass < segmenter->lastCombiningClass))
+    {
+        segmenter->needsNormalizing = true;
+    }
+    segmenter->lastCombiningClass = combiningClass;
+    return folded;
+}
 
-    tsearch_range range = {0, 0};
 
-    uint32_t codePoint = 0;
-    uint32_t state = UTF8_ACCEPT;
+/// Returns true if there's a word boundary before the code point with the properties, following
+/// the rules of UAX #29, tailored to keep runs of tsearch_wordbreak_spaceless together. A break
+/// that depends on the next code point is left pending instead.
+TSEARCH_INLINE bool _tsearch_tokenize_segmenter_is_boundary(_tsearch_tokenize_segmenter *segmenter,
+                                                            const uint8_t properties, const size_t location)
+{
+    const uint8_t property = properties & TSEARCH_WORDBREAK_PROPERTY_MASK;
+    const uint32_t propertyBit = WB_BIT(property);
+    const uint8_t last = segmenter->lastProperties & TSEARCH_WORDBREAK_PROPERTY_MASK;
+    const bool isIgnored = ((WB_IGNORED & propertyBit) != 0 && (WB_NEWLINES & WB_BIT(last)) == 0);
+
+    if (segmenter->hasPendingBreak == true && isIgnored == false) {
+        segmenter->hasPendingBreak = false;
+        if ((segmenter->pendingContinuations & propertyBit) != 0) { return false; } // WB7, WB7c, WB11
+        _tsearch_tokenize_segmenter_break(segmenter, segmenter->pendingLocation, segmenter->pendingTokenLength);
+    }
+
+    if (last == tsearch_wordbreak_cr && property == tsearch_wordbreak_lf) { return false; } // WB3
+    if ((WB_NEWLINES & (WB_BIT(last) | propertyBit)) != 0) { return true; } // WB3a, WB3b
+    if (last == tsearch_wordbreak_zwj && (properties & TSEARCH_WORDBREAK_EXTENDED_PICTOGRAPHIC) != 0) {
+        return false; // WB3c
+    }
+    if (last == tsearch_wordbreak_wsegspace && property == tsearch_wordbreak_wsegspace) { return false; } // WB3d
+    if (isIgnored == true) { return false; } // WB4
+    if (property == segmenter->previous && (WB_WORD_LIKE & propertyBit) != 0) {
+        return false; // WB5, WB8, WB13, and runs of tsearch_wordbreak_spaceless
+    }
 
-    size_t tokenCapacity = 10;
-    size_t tokenLength = 0;
-    uint32_t *token = calloc(tokenCapacity, sizeof(uint32_t));
-    if (token == NULL) { return failure; }
-
-    while (cstr[_range_sum(range)] != '\0') {
-        if (utf8_decode(&state, &codePoint, cstr[_range_sum(range)]) == UTF8_ACCEPT) {
-            // TODO: Handle invalid control characters.
-
-            if (utf8_isBreak(codePoint) == true) {
-                if (tokenLength > 0) {
-                    tsearch_range tokenRange = {0, 0};
-                    process(cstr, tokenRange, token, tokenLength, context);
-                }
-
-                range.location = _range_sum(range) + 1;
-                range.length = 0;
-                tokenLength = 0;
-            } else {
-                token[tokenLength] = codePoint;
-                tokenLength += 1;
-                range.length += 1;
-
-                if (tokenLength + 1 >= tokenCapacity) {
-                    size_t bufferLength = _tsearch_next_buf_len(&tokenCapacity, sizeof(uint32_t));
-                    uint32_t *newToken = realloc(token, bufferLength);
-                    if (newToken == NULL) { free(token); return failure; }
-                    token = newToken;
-                }
+    const uint32_t previousBit = WB_BIT(segmenter->previous);
+    uint32_t continuations = 0;
+    if ((previousBit & WB_AHLETTER) != 0) {
+        if ((propertyBit & (WB_AHLETTER | WB_BIT(tsearch_wordbreak_numeric))) != 0) { return false; } // WB5, WB9
+        if (segmenter->previous == tsearch_wordbreak_hebrew_letter) {
+            if (property == tsearch_wordbreak_single_quote) { return false; } // WB7a
+            if (property == tsearch_wordbreak_double_quote) {
+                continuations = WB_BIT(tsearch_wordbreak_hebrew_letter); // WB7b
             }
+        }
+        if ((propertyBit & (WB_BIT(tsearch_wordbreak_midletter) | WB_MIDNUMLETQ)) != 0) {
+            continuations = WB_AHLETTER; // WB6
+        }
+    } else if (segmenter->previous == tsearch_wordbreak_numeric) {
+        if ((propertyBit & (WB_AHLETTER | WB_BIT(tsearch_wordbreak_numeric))) != 0) { return false; } // WB8, WB10
+        if ((propertyBit & (WB_BIT(tsearch_wordbreak_midnum) | WB_MIDNUMLETQ)) != 0) {
+            continuations = WB_BIT(tsearch_wordbreak_numeric); // WB12
+        }
+    } else if ((previousBit & (WB_BIT(tsearch_wordbreak_midletter) | WB_MIDNUMLETQ)) != 0 &&
+               (WB_BIT(segmenter->beforePrevious) & WB_AHLETTER) != 0 && (propertyBit & WB_AHLETTER) != 0)
+    {
+        return false; // WB7, after WB7a
+    }
 
+    if (continuations != 0) {
+        segmenter->hasPendingBreak = true;
+        segmenter->pendingContinuations = continuations;
+        segmenter->pendingLocation = location;
+        segmenter->pendingTokenLength = segmenter->tokenLength;
+        return false;
+    }
 
-        } else { range.length += 1; }
+    const uint32_t extendNumLetBit = WB_BIT(tsearch_wordbreak_extendnumlet);
+    const uint32_t katakanaBit = WB_BIT(tsearch_wordbreak_katakana);
+    if ((previousBit & (WB_AHLETTER | WB_BIT(tsearch_wordbreak_numeric) | katakanaBit | extendNumLetBit)) != 0 &&
+        property == tsearch_wordbreak_extendnumlet)
+    {
+        return false; // WB13a
     }
+    if (segmenter->previous == tsearch_wordbreak_extendnumlet &&
+        (propertyBit & (WB_AHLETTER | WB_BIT(tsearch_wordbreak_numeric) | katakanaBit)) != 0)
+    {
+        return false; // WB13b
+    }
+    if (segmenter->previous == tsearch_wordbreak_regional_indicator &&
+        property == tsearch_wordbreak_regional_indicator && (segmenter->regionalIndicatorCount % 2) == 1)
+    {
+        return false; // WB15, WB16
+    }
+
+    return true; // WB999
+}
+
 
-    if (tokenLength > 0) {
-        tsearch_range tokenRange = {0, 0};
-        process(cstr, tokenRange, token, tokenLength, context);
+/// Adds the code point that starts at the location, breaking the current segment before it if
+/// the rules of UAX #29 call for a word boundary there.
+TSEARCH_INLINE result _tsearch_tokenize_segmenter_add(_tsearch_tokenize_segmenter *segmenter,
+                                                      const uint32_t codePoint, const size_t location)
+{
+    const uint8_t properties = tsearch_wordbreak_get_properties(codePoint);
+    const uint8_t property = properties & TSEARCH_WORDBREAK_PROPERTY_MASK;
+    const uint8_t last = segmenter->lastProperties & TSEARCH_WORDBREAK_PROPERTY_MASK;
+    const bool isIgnored = ((WB_IGNORED & WB_BIT(property)) != 0 && (WB_NEWLINES & WB_BIT(last)) == 0);
+
+    if (_tsearch_tokenize_segmenter_is_boundary(segmenter, properties, location) == true) {
+        _tsearch_tokenize_segmenter_break(segmenter, location, segmenter->tokenLength);
     }
 
-    free(token);
+    if (segmenter->processBytes == NULL) {
+        size_t length = segmenter->tokenLength + 1;
+        if (length > segmenter->tokenCapacity &&
+            _tsearch_tokenize_reserve(&(segmenter->token), segmenter->tokenBuffer,
+                                      &(segmenter->tokenCapacity), length) == failure)
+        {
+            return failure;
+        }
+        bool isNormalized = (segmenter->processNormalized != NULL);
+        segmenter->token[segmenter->tokenLength] = (isNormalized == true) ?
+            _tsearch_tokenize_segmenter_fold(segmenter, codePoint) : codePoint;
+        segmenter->tokenLength = length;
+    }
+    if ((WB_WORD_LIKE & WB_BIT(property)) != 0) { segmenter->isWordLike = true; }
+
+    segmenter->lastProperties = properties;
+    if (isIgnored == false) {
+        segmenter->beforePrevious = segmenter->previous;
+        segmenter->previous = property;
+        bool isRegionalIndicator = (property == tsearch_wordbreak_regional_indicator) ? true : false;
+        segmenter->regionalIndicatorCount = (isRegionalIndicator == true) ? segmenter->regionalIndicatorCount + 1 : 0;
+    }
 
     return success;
 }
 
 
+/// Adds the ASCII code point and returns true if it's a space, control character, or punctuation
+/// mark that the rules always separate from the code points before it, which most of the bytes
+/// between words are. Otherwise, returns false without adding it.
+TSEARCH_INLINE bool _tsearch_tokenize_segmenter_add_separator(_tsearch_tokenize_segmenter *segmenter,
+                                                              const unsigned char c, const size_t location)
+{
+    // Other, WSegSpace, LF, and Newline can't continue a word (WB5–WB13b) or a pending break, and
+    // only CR (WB3) and WSegSpace (WB3d) keep them in the same segment as the code point before.
+    const uint8_t property = tsearch_wordbreak_get_properties(c);
+    if ((WB_SEPARATORS & WB_BIT(property)) == 0 || property == segmenter->lastProperties ||
+        segmenter->lastProperties == tsearch_wordbreak_cr || segmenter->tokenCapacity == 0)
+    {
+        return false;
+    }
+
+    if (segmenter->hasPendingBreak == true) {
+        segmenter->hasPendingBreak = false;
+        _tsearch_tokenize_segmenter_break(segmenter, segmenter->pendingLocation, segmenter->pendingTokenLength);
+    }
+    _tsearch_tokenize_segmenter_break(segmenter, location, segmenter->tokenLength);
+
+    segmenter->token[0] = c;
+    segmenter->tokenLength = 1;
+    segmenter->lastProperties = property;
+    segmenter->beforePrevious = segmenter->previous;
+    segmenter->previous = property;
+    segmenter->regionalIndicatorCount = 0;
+
+    return true;
+}
+
+
+/// Adds the ASCII letters, digits, and underscores from the location to the end. Rules WB5 and
+/// WB8–WB13b keep all of them in the same segment, so only the first one can start a new segment.
+TSEARCH_INLINE result _tsearch_tokenize_segmenter_add_word_characters(_tsearch_tokenize_segmenter *segmenter,
+                                                                      const unsigned char *s, const size_t location,
+                                                                      const size_t end)
+{
+    // None of them continue a segment after a separator, which can't leave a break pending.
+    size_t start = location;
+    if (segmenter->hasPendingBreak == false && (WB_SEPARATORS & WB_BIT(segmenter->previous)) != 0) {
+        _tsearch_tokenize_segmenter_break(segmenter, location, segmenter->tokenLength);
+    } else {
+        if (_tsearch_tokenize_segmenter_add(segmenter, s[location], location) == failure) { return failure; }
+        if (location + 1 == end) { return success; }
+        start = location + 1;
+    }
+
+    if (segmenter->processBytes == NULL) {
+        size_t length = segmenter->tokenLength + (end - start);
+        if (length > segmenter->tokenCapacity &&
+            _tsearch_tokenize_reserve(&(segmenter->token), segmenter->tokenBuffer,
+                                      &(segmenter->tokenCapacity), length) == failure)
+        {
+            return failure;
+        }
+        // The simple case foldings of the ASCII letters are their lowercase letters.
+        if (segmenter->processNormalized != NULL && (segmenter->options & tsearch_normalize_fold_case) != 0) {
+            for (size_t i = start; i < end; i++) {
+                uint32_t c = s[i];
+                segmenter->token[segmenter->tokenLength++] = (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+            }
+        } else {
+            for (size_t i = start; i < end; i++) { segmenter->token[segmenter->tokenLength++] = s[i]; }
+        }
+        // They're all starters.
+        segmenter->lastCombiningClass = 0;
+    }
+    if (segmenter->isWordLike == false) {
+        for (size_t i = start; i < end && segmenter->isWordLike == false; i++) {
+            if (s[i] != '_') { segmenter->isWordLike = true; }
+        }
+    }
+
+    // None of the ASCII letters, digits, or underscore are Extended_Pictographic.
+    segmenter->lastProperties = tsearch_wordbreak_get_properties(s[end - 1]);
+    segmenter->beforePrevious = (end - location > 1) ? tsearch_wordbreak_get_properties(s[end - 2])
+                                                     : segmenter->previous;
+    segmenter->previous = segmenter->lastProperties;
+    segmenter->regionalIndicatorCount = 0;
+
+    return success;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Public
+// ------------------------------------------------------------------------------------------
+int tsearch_cstring_tokenize(const char *cstr, process_token_func process, void *context)
+{
+    if (cstr == NULL || process == NULL) { return failure; }
+    _tsearch_tokenize_segmenter segmenter;
+    _tsearch_tokenize_segmenter_init(&segmenter, cstr, context);
+    segmenter.processCodePoints = process;
+    return _tsearch_tokenize(&segmenter);
+}
+
+
+result tsearch_cstring_tokenize_bytes(const char *cString, process_token_bytes_func process, void *context)
+{
+    if (cString == NULL || process == NULL) { return failure; }
+    _tsearch_tokenize_segmenter segmenter;
+    _tsearch_tokenize_segmenter_init(&segmenter, cString, context);
+    segmenter.processBytes = process;
+    return _tsearch_tokenize(&segmenter);
+}
+
+
+result tsearch_cstring_tokenize_normalized(const char *cString, const tsearch_normalize_options options,
+                                           process_normalized_token_func process, void *context)
+{
+    if (cString == NULL || process == NULL) { return failure; }
+    _tsearch_tokenize_segmenter segmenter;
+    _tsearch_tokenize_segmenter_init(&segmenter, cString, context);
+    segmenter.processNormalized = process;
+    segmenter.options = options;
+    if ((options & tsearch_normalize_nfkc) != 0) {
+        segmenter.quickCheckFlag = TSEARCH_NORMALIZE_NFKC_QUICK_CHECK_NO;
+    } else if ((options & tsearch_normalize_nfc) != 0) {
+        segmenter.quickCheckFlag = TSEARCH_NORMALIZE_NFC_QUICK_CHECK_NO;
+    }
+    return _tsearch_tokenize(&segmenter);
+}
+
+
 int  tsearch_cstring_copy_code_points(const char *cString, uint32_t **outCodePoints, size_t *outLength)
 {
 	if (outCodePoints == NULL || outLength == NULL) { return failure; }
@@ -295,3 +718,301 @@ size_t tsearch_code_point_character_count(uint32_t codePoint)
     assert(0); // This should never be reached.
     return 0;
 }
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Private
+// ------------------------------------------------------------------------------------------
+result _tsearch_tokenize(_tsearch_tokenize_segmenter *segmenter)
+{
+    const unsigned char *s = (const unsigned char *)segmenter->string;
+    _tsearch_tokenize_scanner scanner;
+    _tsearch_tokenize_scanner_init(&scanner, s);
+
+    result ret = success;
+    size_t i = 0;
+    // Normalizing a token is the only way a break can fail, which it records in hasFailed.
+    while (ret == success && segmenter->hasFailed == false) {
+        size_t specialIndex = _tsearch_tokenize_scanner_next(&scanner);
+        if (specialIndex > i) {
+            ret = _tsearch_tokenize_segmenter_add_word_characters(segmenter, s, i, specialIndex);
+            i = specialIndex;
+        }
+        if (ret == failure || s[i] == '\0') { break; }
+
+        if (s[i] < 0x80) {
+            if (_tsearch_tokenize_segmenter_add_separator(segmenter, s[i], i) == false) {
+                ret = _tsearch_tokenize_segmenter_add(segmenter, s[i], i);
+            }
+            i++;
+            continue;
+        }
+
+        // Every byte of a run of non-ASCII code points is special, so the scanner skips the whole run at once.
+        do {
+            uint32_t codePoint = 0;
+            size_t length = _tsearch_tokenize_decode(s + i, &codePoint);
+            ret = _tsearch_tokenize_segmenter_add(segmenter, codePoint, i);
+            i += length;
+        } while (ret == success && s[i] >= 0x80);
+        _tsearch_tokenize_scanner_seek(&scanner, i);
+    }
+
+    if (ret == success && segmenter->hasFailed == false) {
+        if (segmenter->hasPendingBreak == true) {
+            _tsearch_tokenize_segmenter_break(segmenter, segmenter->pendingLocation, segmenter->pendingTokenLength);
+        }
+        _tsearch_tokenize_segmenter_break(segmenter, i, segmenter->tokenLength);
+    }
+    if (segmenter->hasFailed == true) { ret = failure; }
+    _tsearch_tokenize_segmenter_free(segmenter);
+
+    return ret;
+}
+
+
+void _tsearch_tokenize_segmenter_init(_tsearch_tokenize_segmenter *segmenter, const char *cString, void *context)
+{
+    segmenter->string = cString;
+    segmenter->processCodePoints = NULL;
+    segmenter->processBytes = NULL;
+    segmenter->processNormalized = NULL;
+    segmenter->options = 0;
+    segmenter->context = context;
+    // The start of the text is treated like the end of a line, after which there's always a break.
+    segmenter->lastProperties = tsearch_wordbreak_lf;
+    segmenter->previous = tsearch_wordbreak_lf;
+    segmenter->beforePrevious = tsearch_wordbreak_other;
+    segmenter->regionalIndicatorCount = 0;
+    segmenter->segmentLocation = 0;
+    segmenter->isWordLike = false;
+    segmenter->hasPendingBreak = false;
+    segmenter->pendingContinuations = 0;
+    segmenter->pendingLocation = 0;
+    segmenter->pendingTokenLength = 0;
+    segmenter->token = segmenter->tokenBuffer;
+    segmenter->tokenLength = 0;
+    segmenter->tokenCapacity = TOKEN_BUFFER_LENGTH;
+    segmenter->needsNormalizing = false;
+    segmenter->lastCombiningClass = 0;
+    segmenter->quickCheckFlag = 0;
+    segmenter->normalized = NULL;
+    segmenter->normalizedCapacity = 0;
+    segmenter->utf8 = segmenter->utf8Buffer;
+    segmenter->utf8Capacity = sizeof(segmenter->utf8Buffer);
+    segmenter->hasFailed = false;
+}
+
+
+/// Normalizes the first tokenLength code points of the token if the quick checks found that they
+/// need it, encodes them as UTF-8, and calls processNormalized with them. The UTF-8 buffer starts
+/// on the stack and moves to the heap the first time a token doesn't fit in it.
+void _tsearch_tokenize_segmenter_process_normalized(_tsearch_tokenize_segmenter *segmenter, const tsearch_range range,
+                                                    const size_t tokenLength)
+{
+    const uint32_t *codePoints = segmenter->token;
+    size_t length = tokenLength;
+    const tsearch_normalize_options forms = tsearch_normalize_nfc | tsearch_normalize_nfkc;
+    if (segmenter->needsNormalizing == true && (segmenter->options & forms) != 0) {
+        if (tsearch_normalize_code_points(segmenter->token, tokenLength, segmenter->options,
+                                          &(segmenter->normalized), &(segmenter->normalizedCapacity),
+                                          &length) == failure)
+        {
+            segmenter->hasFailed = true;
+            return;
+        }
+        codePoints = segmenter->normalized;
+    }
+
+    if (length > (SIZE_MAX - 1) / MAX_UTF8_LENGTH) { segmenter->hasFailed = true; return; }
+    size_t capacity = length * MAX_UTF8_LENGTH + 1;
+    if (capacity > segmenter->utf8Capacity) {
+        char *utf8 = (segmenter->utf8 == segmenter->utf8Buffer) ? malloc(capacity) : realloc(segmenter->utf8, capacity);
+        if (utf8 == NULL) { segmenter->hasFailed = true; return; }
+        segmenter->utf8 = utf8;
+        segmenter->utf8Capacity = capacity;
+    }
+
+    size_t byteLength = 0;
+    for (size_t i = 0; i < length; i++) {
+        byteLength += _tsearch_tokenize_encode(codePoints[i], segmenter->utf8 + byteLength);
+    }
+    segmenter->utf8[byteLength] = '\0';
+    segmenter->processNormalized(segmenter->string, range, segmenter->utf8, byteLength, segmenter->context);
+}
+
+
+void _tsearch_tokenize_segmenter_free(_tsearch_tokenize_segmenter *segmenter)
+{
+    if (segmenter->token != segmenter->tokenBuffer) { free(segmenter->token); }
+    if (segmenter->utf8 != segmenter->utf8Buffer) { free(segmenter->utf8); }
+    free(segmenter->normalized);
+}
+
+
+/// Writes the code point's UTF-8 bytes and returns their number. The tokenizer never produces
+/// surrogates or code points above U+10FFFF, because it decodes them as U+FFFD.
+size_t _tsearch_tokenize_encode(const uint32_t codePoint, char *outBytes)
+{
+    unsigned char *bytes = (unsigned char *)outBytes;
+    if (codePoint <= 0x7F) {
+        bytes[0] = (unsigned char)codePoint;
+        return 1;
+    }
+    if (codePoint <= 0x7FF) {
+        bytes[0] = (unsigned char)(0xC0 | (codePoint >> 6));
+        bytes[1] = (unsigned char)(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint <= 0xFFFF) {
+        bytes[0] = (unsigned char)(0xE0 | (codePoint >> 12));
+        bytes[1] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+        bytes[2] = (unsigned char)(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    bytes[0] = (unsigned char)(0xF0 | (codePoint >> 18));
+    bytes[1] = (unsigned char)(0x80 | ((codePoint >> 12) & 0x3F));
+    bytes[2] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+    bytes[3] = (unsigned char)(0x80 | (codePoint & 0x3F));
+    return 4;
+}
+
+
+/// Makes room for length code points in the token, moving it from the stack buffer to the heap
+/// the first time it outgrows the buffer. The token is freed if it can't be grown.
+result _tsearch_tokenize_reserve(uint32_t **tokenPtr, uint32_t *tokenBuffer, size_t *capacity, const size_t length)
+{
+    if (length <= *capacity) { return success; }
+
+    uint32_t *token = *tokenPtr;
+    size_t newCapacity = *capacity;
+    size_t bufferLength = 0;
+    while (newCapacity < length) {
+        size_t oldCapacity = newCapacity;
+        bufferLength = _tsearch_next_buf_len(&newCapacity, sizeof(uint32_t));
+        if (newCapacity == oldCapacity) { bufferLength = 0; break; }
+    }
+
+    uint32_t *newToken = NULL;
+    if (bufferLength > 0) {
+        newToken = (token == tokenBuffer) ? malloc(bufferLength) : realloc(token, bufferLength);
+    }
+    if (newToken == NULL) {
+        if (token != tokenBuffer) { free(token); }
+        *tokenPtr = tokenBuffer;
+        *capacity = 0;
+        return failure;
+    }
+
+    if (token == tokenBuffer) { memcpy(newToken, tokenBuffer, *capacity * sizeof(uint32_t)); }
+    *tokenPtr = newToken;
+    *capacity = newCapacity;
+    return success;
+}
+
+
+/// Positions the scanner at the start of the string. The scanner's blocks are aligned, so the first
+/// block may start before the string, and the bytes before the start are removed from its mask.
+void _tsearch_tokenize_scanner_init(_tsearch_tokenize_scanner *scanner, const unsigned char *s)
+{
+    const size_t offset = (uintptr_t)s & (SCAN_BLOCK_LENGTH - 1);
+    scanner->string = s;
+    scanner->block = s - offset;
+    scanner->simdLevel = _tsearch_tokenize_get_simd_level();
+    scanner->mask = _tsearch_tokenize_special_mask(scanner);
+    scanner->mask &= (UINT32_MAX << offset);
+}
+
+
+/// Returns the widest instruction set the scanners can use on the current CPU.
+int _tsearch_tokenize_get_simd_level(void)
+{
+#if TSEARCH_TOKENIZE_X86
+    // Checking the CPU is cheap, but the answer never changes, so it's only done once.
+    // A race here is harmless because every thread computes the same value.
+    static volatile int simdLevel = -1;
+    if (simdLevel < 0) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) { simdLevel = SIMD_AVX2; }
+        else if (__builtin_cpu_supports("sse2")) { simdLevel = SIMD_SSE2; }
+        else { simdLevel = SIMD_NONE; }
+    }
+    return simdLevel;
+#else
+    return SIMD_NONE;
+#endif
+}
+
+
+/// Returns a mask with a bit set for each special byte (see specialBytes) in the scanner's block.
+/// The bits of bytes before the start of the string or after its terminating NUL aren't meaningful,
+/// and the terminating NUL ends the scan before they're used.
+uint32_t _tsearch_tokenize_special_mask(const _tsearch_tokenize_scanner *scanner)
+{
+#if TSEARCH_TOKENIZE_X86
+    if (scanner->simdLevel >= SIMD_AVX2) { return _tsearch_tokenize_special_mask_avx2(scanner->block); }
+    if (scanner->simdLevel >= SIMD_SSE2) { return _tsearch_tokenize_special_mask_sse2(scanner->block); }
+#endif
+    return _tsearch_tokenize_special_mask_scalar(scanner->block, scanner->string);
+}
+
+
+/// Only reads the bytes of the block from the start of the string up to its terminating NUL.
+uint32_t _tsearch_tokenize_special_mask_scalar(const unsigned char *block, const unsigned char *string)
+{
+    uint32_t mask = 0;
+    for (uint32_t i = (block < string) ? (uint32_t)(string - block) : 0; i < SCAN_BLOCK_LENGTH; i++) {
+        mask |= (uint32_t)specialBytes[block[i]] << i;
+        if (block[i] == '\0') { break; }
+    }
+    return mask;
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - SIMD
+// ------------------------------------------------------------------------------------------
+#if TSEARCH_TOKENIZE_X86
+
+// Because the length of the string isn't known, these read whole aligned blocks, which can't cross
+// into the next page, even though they may include bytes before the start or after the end of
+// the string. That's why they aren't checked by AddressSanitizer.
+
+// The ASCII letters are the bytes for which (byte | 0x20) - 'a' is less than 26 and the digits
+// are the bytes for which byte - '0' is less than 10. SSE2 and AVX2 only compare signed bytes,
+// so the unsigned comparisons check whether the byte is its own minimum with the limit.
+
+__attribute__((target("sse2"))) TSEARCH_NO_SANITIZE_ADDRESS
+TSEARCH_INLINE uint32_t _tsearch_tokenize_word_mask_sse2(const __m128i bytes)
+{
+    const __m128i letters = _mm_sub_epi8(_mm_or_si128(bytes, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i digits = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+    __m128i word = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(25)), letters);
+    word = _mm_or_si128(word, _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits));
+    word = _mm_or_si128(word, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_')));
+    return (uint32_t)_mm_movemask_epi8(word);
+}
+
+
+__attribute__((target("sse2"))) TSEARCH_NO_SANITIZE_ADDRESS
+uint32_t _tsearch_tokenize_special_mask_sse2(const unsigned char *block)
+{
+    const __m128i low = _mm_load_si128((const __m128i *)(const void *)block);
+    const __m128i high = _mm_load_si128((const __m128i *)(const void *)(block + 16));
+    return ~(_tsearch_tokenize_word_mask_sse2(low) | (_tsearch_tokenize_word_mask_sse2(high) << 16));
+}
+
+
+__attribute__((target("avx2"))) TSEARCH_NO_SANITIZE_ADDRESS
+uint32_t _tsearch_tokenize_special_mask_avx2(const unsigned char *block)
+{
+    const __m256i bytes = _mm256_load_si256((const __m256i *)(const void *)block);
+    const __m256i letters = _mm256_sub_epi8(_mm256_or_si256(bytes, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i digits = _mm256_sub_epi8(bytes, _mm256_set1_epi8('0'));
+    __m256i word = _mm256_cmpeq_epi8(_mm256_min_epu8(letters, _mm256_set1_epi8(25)), letters);
+    word = _mm256_or_si256(word, _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits));
+    word = _mm256_or_si256(word, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('_')));
+    return ~(uint32_t)_mm256_movemask_epi8(word);
+}
+
+#endif
@@ -10,6 +10,7 @@
 #define GNEUnicodeUtilities_h
 
 #include "GNETextSearchPublic.h"
+#include "normalize.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,9 +19,32 @@ extern "C" {
 typedef struct {size_t location; size_t length;} tsearch_range;
 typedef void(*process_token_func)(const char *string, const tsearch_range range, uint32_t *token,
                                   const size_t length, const void *context);
-
+typedef void(*process_token_bytes_func)(const char *string, const tsearch_range range, const void *context);
+typedef void(*process_normalized_token_func)(const char *string, const tsearch_range range, const char *token,
+                                             const size_t length, const void *context);
+
+/// Calls process with the code points of each token in cString and the range of the token's bytes
+/// in cString. The code points are only valid until process returns. The tokens are the words
+/// found by the word boundaries of Unicode Standard Annex #29 that contain letters, numbers, or
+/// ideographs, so whitespace, punctuation, and symbols aren't included. Runs of ideographs and of
+/// the letters of other scripts written without spaces are kept together. Invalid UTF-8 sequences
+/// are treated as U+FFFD.
 result tsearch_cstring_tokenize(const char *cString, process_token_func process, void *context);
 
+/// Calls process with the range of each token's bytes in cString, for callers that only need slices
+/// of cString. It finds the same tokens as tsearch_cstring_tokenize(), but only decodes non-ASCII
+/// code points, to look up their word break properties, and doesn't allocate any memory.
+result tsearch_cstring_tokenize_bytes(const char *cString, process_token_bytes_func process, void *context);
+
+/// Calls process with each token in cString as NUL-terminated UTF-8, after applying the stages in
+/// options to it, and the range of the token's original bytes in cString. It finds the same tokens
+/// as tsearch_cstring_tokenize(). The code points are case folded as they're decoded, and a token is
+/// only normalized if the quick checks of UAX #15 find that it may not already be in the normal
+/// form, so most tokens are encoded straight into the UTF-8 buffer that is reused for every token.
+/// The token is only valid until process returns.
+result tsearch_cstring_tokenize_normalized(const char *cString, const tsearch_normalize_options options,
+                                           process_normalized_token_func process, void *context);
+
 result tsearch_cstring_copy_code_points(const char *cString, uint32_t **outCodePoints, size_t *outLength);
 result tsearch_cstring_copy_utf16_code_points(const char *cString, uint32_t **outCodePoints, size_t *outLength);
 size_t tsearch_code_point_character_count(uint32_t codePoint);
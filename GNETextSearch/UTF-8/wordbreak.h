@@ -0,0 +1,84 @@
+//
+//  wordbreak.h
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#ifndef tsearch_wordbreak_h
+#define tsearch_wordbreak_h
+
+#include "GNETextSearchPublic.h"
+
+#ifndef TSEARCH_INLINE
+    #if defined(_MSC_VER) && !defined(__cplusplus)
+        #define TSEARCH_INLINE __inline
+    #else
+        #define TSEARCH_INLINE static inline
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The Word_Break property values of Unicode Standard Annex #29 (http://www.unicode.org/reports/tr29/),
+// which the tokenizer uses to find the boundaries of words. The tables are generated by
+// generate_wordbreak.py, which must be run again to update them for a new version of Unicode.
+
+/// The Word_Break property values, in the order used by generate_wordbreak.py.
+typedef enum
+{
+    tsearch_wordbreak_other = 0,
+    tsearch_wordbreak_cr,
+    tsearch_wordbreak_lf,
+    tsearch_wordbreak_newline,
+    tsearch_wordbreak_extend,
+    tsearch_wordbreak_zwj,
+    tsearch_wordbreak_regional_indicator,
+    tsearch_wordbreak_format,
+    tsearch_wordbreak_katakana,
+    tsearch_wordbreak_hebrew_letter,
+    tsearch_wordbreak_aletter,
+    tsearch_wordbreak_single_quote,
+    tsearch_wordbreak_double_quote,
+    tsearch_wordbreak_midnumlet,
+    tsearch_wordbreak_midletter,
+    tsearch_wordbreak_midnum,
+    tsearch_wordbreak_numeric,
+    tsearch_wordbreak_extendnumlet,
+    tsearch_wordbreak_wsegspace,
+    /// A tailoring for the ideographs, Hiragana, and the letters of the scripts written without
+    /// spaces between words, which are otherwise Other. Runs of them are kept together, because
+    /// finding the words in them takes dictionaries.
+    tsearch_wordbreak_spaceless,
+} tsearch_wordbreak_property;
+
+/// Set in a code point's properties if it is Extended_Pictographic.
+#define TSEARCH_WORDBREAK_EXTENDED_PICTOGRAPHIC 0x20
+#define TSEARCH_WORDBREAK_PROPERTY_MASK 0x1F
+
+/// Code points are looked up in blocks of 1 << TSEARCH_WORDBREAK_BLOCK_SHIFT, which must match
+/// BLOCK_SHIFT in generate_wordbreak.py.
+#define TSEARCH_WORDBREAK_BLOCK_SHIFT 7
+#define TSEARCH_WORDBREAK_MAX_CODE_POINT 0x10FFFF
+
+extern const uint8_t tsearch_wordbreak_block_indexes[];
+extern const uint8_t tsearch_wordbreak_blocks[];
+
+/// Returns the code point's tsearch_wordbreak_property, combined with
+/// TSEARCH_WORDBREAK_EXTENDED_PICTOGRAPHIC if it is Extended_Pictographic.
+TSEARCH_INLINE uint8_t tsearch_wordbreak_get_properties(const uint32_t codePoint)
+{
+    if (codePoint > TSEARCH_WORDBREAK_MAX_CODE_POINT) { return tsearch_wordbreak_other; }
+    const uint32_t blockIndex = tsearch_wordbreak_block_indexes[codePoint >> TSEARCH_WORDBREAK_BLOCK_SHIFT];
+    const uint32_t mask = (1 << TSEARCH_WORDBREAK_BLOCK_SHIFT) - 1;
+    return tsearch_wordbreak_blocks[(blockIndex << TSEARCH_WORDBREAK_BLOCK_SHIFT) | (codePoint & mask)];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* tsearch_wordbreak_h */
@@ -0,0 +1,218 @@
+//
+//  bitmap_tests.m
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "bitmap.h"
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@interface GNEBitmapTests : XCTestCase
+{
+    tsearch_bitmap_ptr _bitmap;
+}
+
+@end
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@implementation GNEBitmapTests
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Set Up / Tear Down
+// ------------------------------------------------------------------------------------------
+- (void)setUp
+{
+    [super setUp];
+    _bitmap = tsearch_bitmap_init(true);
+}
+
+
+- (void)tearDown
+{
+    tsearch_bitmap_free(_bitmap);
+    _bitmap = NULL;
+    [super tearDown];
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Add / Subtract
+// ------------------------------------------------------------------------------------------
+- (void)testAddIntegers_ExtremeIntegers_ContainsAllWithCounts
+{
+    GNEInteger integers[] = {INT64_MIN, -65537, -1, 0, 65535, 65536, INT64_MAX, 0};
+    for (size_t i = 0; i < 8; i++)
+    {
+        XCTAssertEqual(success, tsearch_bitmap_add_int(_bitmap, integers[i], 1));
+    }
+
+    XCTAssertEqual(7, tsearch_bitmap_get_count(_bitmap));
+    XCTAssertEqual(2, tsearch_bitmap_get_count_for_int(_bitmap, 0));
+    XCTAssertEqual(1, tsearch_bitmap_get_count_for_int(_bitmap, INT64_MIN));
+    XCTAssertEqual(1, tsearch_bitmap_get_count_for_int(_bitmap, INT64_MAX));
+    XCTAssertEqual(false, tsearch_bitmap_contains_int(_bitmap, 1));
+
+    GNEInteger sortedIntegers[7];
+    size_t counts[7];
+    XCTAssertEqual(success, tsearch_bitmap_copy_sorted_ints(_bitmap, sortedIntegers, counts));
+    XCTAssertEqual(INT64_MIN, sortedIntegers[0]);
+    XCTAssertEqual(0, sortedIntegers[3]);
+    XCTAssertEqual(2, counts[3]);
+    XCTAssertEqual(INT64_MAX, sortedIntegers[6]);
+}
+
+
+- (void)testAddIntegers_TenThousandIntegersInOneChunk_ConvertsToBitmapAndBack
+{
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual(success, tsearch_bitmap_add_int(_bitmap, i * 6, (size_t)(i % 3) + 1));
+    }
+    XCTAssertEqual(10000, tsearch_bitmap_get_count(_bitmap));
+    size_t bitmapSize = tsearch_bitmap_get_size(_bitmap);
+
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual((size_t)(i % 3) + 1, tsearch_bitmap_get_count_for_int(_bitmap, i * 6));
+        XCTAssertEqual(false, tsearch_bitmap_contains_int(_bitmap, (i * 6) + 1));
+    }
+
+    for (GNEInteger i = 0; i < 9000; i++)
+    {
+        XCTAssertEqual(success, tsearch_bitmap_subtract_int(_bitmap, i * 6, 1));
+    }
+    XCTAssertEqual(7000, tsearch_bitmap_get_count(_bitmap));
+    XCTAssertEqual(0, tsearch_bitmap_get_count_for_int(_bitmap, 0));
+    XCTAssertEqual(1, tsearch_bitmap_get_count_for_int(_bitmap, 6));
+    XCTAssertEqual(2, tsearch_bitmap_get_count_for_int(_bitmap, 12));
+
+    for (GNEInteger i = 0; i < 9000; i++)
+    {
+        XCTAssertEqual(success, tsearch_bitmap_subtract_int(_bitmap, i * 6, SIZE_MAX));
+    }
+    XCTAssertEqual(1000, tsearch_bitmap_get_count(_bitmap));
+    XCTAssertTrue(tsearch_bitmap_get_size(_bitmap) < bitmapSize);
+    XCTAssertEqual(1, tsearch_bitmap_get_count_for_int(_bitmap, 9000 * 6));
+}
+
+
+- (void)testAddIntegers_WithoutCounts_CountsAreOne
+{
+    tsearch_bitmap_ptr bitmap = tsearch_bitmap_init(false);
+    XCTAssertEqual(success, tsearch_bitmap_add_int(bitmap, 5, 3));
+    XCTAssertEqual(success, tsearch_bitmap_add_int(bitmap, 5, 1));
+    XCTAssertEqual(1, tsearch_bitmap_get_count_for_int(bitmap, 5));
+    XCTAssertEqual(success, tsearch_bitmap_subtract_int(bitmap, 5, 1));
+    XCTAssertEqual(false, tsearch_bitmap_contains_int(bitmap, 5));
+    tsearch_bitmap_free(bitmap);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Set Operations
+// ------------------------------------------------------------------------------------------
+- (void)testSetOperations_ArrayAndBitmapContainers_SameResultsAsSortedIntegers
+{
+    tsearch_bitmap_ptr other = tsearch_bitmap_init(true);
+    for (GNEInteger i = 0; i < 200000; i++)
+    {
+        if (i % 2 == 0) { XCTAssertEqual(success, tsearch_bitmap_add_int(_bitmap, i, 1)); }
+        if (i % 50 == 0) { XCTAssertEqual(success, tsearch_bitmap_add_int(other, i, 2)); }
+    }
+
+    tsearch_bitmap_ptr unionBitmap = tsearch_bitmap_copy(_bitmap);
+    XCTAssertEqual(success, tsearch_bitmap_union(unionBitmap, other));
+    XCTAssertEqual(100000, tsearch_bitmap_get_count(unionBitmap));
+    XCTAssertEqual(3, tsearch_bitmap_get_count_for_int(unionBitmap, 100));
+    XCTAssertEqual(1, tsearch_bitmap_get_count_for_int(unionBitmap, 102));
+
+    tsearch_bitmap_ptr minusBitmap = tsearch_bitmap_copy(_bitmap);
+    XCTAssertEqual(success, tsearch_bitmap_minus(minusBitmap, other));
+    XCTAssertEqual(96000, tsearch_bitmap_get_count(minusBitmap));
+    XCTAssertEqual(false, tsearch_bitmap_contains_int(minusBitmap, 100));
+
+    XCTAssertEqual(success, tsearch_bitmap_intersect(_bitmap, other));
+    XCTAssertEqual(4000, tsearch_bitmap_get_count(_bitmap));
+    XCTAssertEqual(3, tsearch_bitmap_get_count_for_int(_bitmap, 199950));
+    XCTAssertEqual(false, tsearch_bitmap_contains_int(_bitmap, 2));
+
+    tsearch_bitmap_free(unionBitmap);
+    tsearch_bitmap_free(minusBitmap);
+    tsearch_bitmap_free(other);
+}
+
+
+- (void)testSetOperations_TwoBitmapsWithoutCounts_WordWideResults
+{
+    tsearch_bitmap_ptr bitmap = tsearch_bitmap_init(false);
+    tsearch_bitmap_ptr other = tsearch_bitmap_init(false);
+    for (GNEInteger i = 0; i < 65536; i++)
+    {
+        if (i % 3 == 0) { XCTAssertEqual(success, tsearch_bitmap_add_int(bitmap, i, 1)); }
+        if (i % 5 == 0) { XCTAssertEqual(success, tsearch_bitmap_add_int(other, i, 1)); }
+    }
+
+    XCTAssertEqual(success, tsearch_bitmap_intersect(bitmap, other));
+    XCTAssertEqual(4370, tsearch_bitmap_get_count(bitmap));
+    XCTAssertEqual(1, tsearch_bitmap_get_count_for_int(bitmap, 15));
+    XCTAssertEqual(false, tsearch_bitmap_contains_int(bitmap, 3));
+
+    tsearch_bitmap_free(bitmap);
+    tsearch_bitmap_free(other);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Cursor
+// ------------------------------------------------------------------------------------------
+- (void)testCursor_ArrayAndBitmapContainers_VisitsIntegersInOrderAndSkipsToTargets
+{
+    // The first chunk becomes a bitmap container. The second chunk stays an array container.
+    for (GNEInteger i = 0; i < 65536; i += 2)
+    {
+        XCTAssertEqual(success, tsearch_bitmap_add_int(_bitmap, i, (size_t)(i % 7) + 1));
+    }
+    XCTAssertEqual(success, tsearch_bitmap_add_int(_bitmap, 70000, 4));
+    XCTAssertEqual(success, tsearch_bitmap_add_int(_bitmap, 70010, 5));
+    XCTAssertEqual(success, tsearch_bitmap_add_int(_bitmap, -3, 6));
+
+    tsearch_bitmap_cursor cursor;
+    tsearch_bitmap_cursor_init(&cursor);
+    GNEInteger integer = 0;
+    size_t count = 0;
+    XCTAssertTrue(tsearch_bitmap_cursor_next(_bitmap, &cursor, &integer, &count));
+    XCTAssertEqual(-3, integer);
+    XCTAssertEqual(6, count);
+    XCTAssertTrue(tsearch_bitmap_cursor_next(_bitmap, &cursor, &integer, &count));
+    XCTAssertEqual(0, integer);
+    XCTAssertEqual(1, count);
+
+    XCTAssertTrue(tsearch_bitmap_cursor_advance_to(_bitmap, &cursor, 1001, &integer, &count));
+    XCTAssertEqual(1002, integer);
+    XCTAssertEqual((1002 % 7) + 1, count);
+    XCTAssertTrue(tsearch_bitmap_cursor_next(_bitmap, &cursor, &integer, &count));
+    XCTAssertEqual(1004, integer);
+    XCTAssertEqual((1004 % 7) + 1, count);
+
+    XCTAssertTrue(tsearch_bitmap_cursor_advance_to(_bitmap, &cursor, 500, &integer, &count));
+    XCTAssertEqual(1006, integer);
+
+    XCTAssertTrue(tsearch_bitmap_cursor_advance_to(_bitmap, &cursor, 70001, &integer, &count));
+    XCTAssertEqual(70010, integer);
+    XCTAssertEqual(5, count);
+    XCTAssertFalse(tsearch_bitmap_cursor_next(_bitmap, &cursor, &integer, &count));
+    XCTAssertFalse(tsearch_bitmap_cursor_advance_to(_bitmap, &cursor, 0, &integer, &count));
+}
+
+
+@end
@@ -83,6 +83,24 @@ typedef struct tsearch_countedset
 // ------------------------------------------------------------------------------------------
 #pragma mark - Copy
 // ------------------------------------------------------------------------------------------
+- (void)testInitialization_SortedIntegers_BalancedTreeWithCounts
+{
+    GNEInteger integers[] = {-3, 0, 2, 8, 100};
+    size_t counts[] = {1, 4, 2, 1, 9};
+    tsearch_countedset_ptr countedSet = tsearch_countedset_init_with_sorted_ints(integers, counts, 5);
+    XCTAssertTrue(countedSet != NULL);
+    XCTAssertEqual(5, tsearch_countedset_get_count(countedSet));
+    XCTAssertEqual(2, countedSet->nodes[0].integer);
+    XCTAssertEqual(4, tsearch_countedset_get_count_for_int(countedSet, 0));
+    XCTAssertEqual(9, tsearch_countedset_get_count_for_int(countedSet, 100));
+    XCTAssertEqual(3, [self p_heightOfNodeAtIndex:0 inCountedSet:countedSet]);
+    tsearch_countedset_free(countedSet);
+
+    GNEInteger unsortedIntegers[] = {2, 1};
+    XCTAssertTrue(tsearch_countedset_init_with_sorted_ints(unsortedIntegers, counts, 2) == NULL);
+}
+
+
 - (void)testCopy_NullPointer_Null
 {
     XCTAssertTrue(NULL == tsearch_countedset_copy(NULL));
@@ -295,6 +313,157 @@ typedef struct tsearch_countedset
 }
 
 
+// ------------------------------------------------------------------------------------------
+#pragma mark - Copy Top Integers
+// ------------------------------------------------------------------------------------------
+- (void)testCopyTopIntegers_FourIntegersMinusOne_TopTwoInCorrectOrder
+{
+    size_t count = 11;
+    GNEInteger integers[] = {8, 4, 7, 4, 4, 8, 3, 4, 7, 8, 9};
+
+    [self p_addIntegers:integers count:count toCountedSet:_countedSet];
+    XCTAssertEqual(success, tsearch_countedset_remove_int(_countedSet, 4));
+
+    GNEInteger *results = NULL;
+    size_t resultsCount = 0;
+    XCTAssertEqual(success, tsearch_countedset_copy_top_ints(_countedSet, 2, &results, &resultsCount));
+    XCTAssertEqual(2, resultsCount);
+    XCTAssertEqual(8, results[0]);
+    XCTAssertEqual(7, results[1]);
+    free(results);
+
+    XCTAssertEqual(success, tsearch_countedset_copy_top_ints(_countedSet, 10, &results, &resultsCount));
+    XCTAssertEqual(4, resultsCount);
+    XCTAssertEqual(3, results[2]); // Ties are returned in ascending order.
+    XCTAssertEqual(9, results[3]);
+    free(results);
+
+    XCTAssertEqual(success, tsearch_countedset_copy_top_ints(_countedSet, 0, &results, &resultsCount));
+    XCTAssertEqual(0, resultsCount);
+    free(results);
+}
+
+
+- (void)testCopyTopIntegers_OneThousandRandomIntegers_SameAsFirstCopiedIntegers
+{
+    NSArray *numbers = [self p_randomNumberArrayWithCount:1000];
+    [self p_addNumbers:numbers toCountedSet:_countedSet];
+
+    GNEInteger *allResults = NULL, *topResults = NULL;
+    size_t allResultsCount = 0, topResultsCount = 0;
+    XCTAssertEqual(success, tsearch_countedset_copy_ints(_countedSet, &allResults, &allResultsCount));
+    XCTAssertEqual(success, tsearch_countedset_copy_top_ints(_countedSet, 20, &topResults, &topResultsCount));
+    XCTAssertEqual(20, topResultsCount);
+
+    for (size_t i = 0; i < topResultsCount; i++)
+    {
+        XCTAssertEqual(tsearch_countedset_get_count_for_int(_countedSet, allResults[i]),
+                       tsearch_countedset_get_count_for_int(_countedSet, topResults[i]));
+    }
+    for (size_t i = 1; i < topResultsCount; i++)
+    {
+        size_t previousCount = tsearch_countedset_get_count_for_int(_countedSet, topResults[i - 1]);
+        size_t count = tsearch_countedset_get_count_for_int(_countedSet, topResults[i]);
+        XCTAssertTrue(previousCount > count || (previousCount == count && topResults[i - 1] < topResults[i]));
+    }
+
+    free(allResults);
+    free(topResults);
+}
+
+
+- (void)testCopyTopIntegers_DenseBitmapSet_TopIntegersInCorrectOrder
+{
+    for (GNEInteger i = 0; i < 50000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i));
+        if (i % 1000 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i)); }
+    }
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 49999));
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 49999));
+    XCTAssertEqual(0, _countedSet->insertIndex);
+
+    GNEInteger *results = NULL;
+    size_t resultsCount = 0;
+    XCTAssertEqual(success, tsearch_countedset_copy_top_ints(_countedSet, 3, &results, &resultsCount));
+    XCTAssertEqual(3, resultsCount);
+    XCTAssertEqual(49999, results[0]);
+    XCTAssertEqual(0, results[1]);
+    XCTAssertEqual(1000, results[2]);
+    free(results);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Iterator
+// ------------------------------------------------------------------------------------------
+- (void)testIterator_TreeWithRemovedIntegers_VisitsRemainingIntegersInOrder
+{
+    GNEInteger integers[] = {50, 10, 40, 20, 30, 60, 70};
+    for (size_t i = 0; i < 7; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, integers[i]));
+    }
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 40));
+    XCTAssertEqual(success, tsearch_countedset_remove_int(_countedSet, 20));
+
+    tsearch_countedset_iterator_ptr iteratorPtr = tsearch_countedset_iterator_init(_countedSet);
+    GNEInteger integer = 0;
+    size_t count = 0;
+    XCTAssertTrue(tsearch_countedset_iterator_next(iteratorPtr, &integer, &count));
+    XCTAssertEqual(10, integer);
+    XCTAssertTrue(tsearch_countedset_iterator_next(iteratorPtr, &integer, &count));
+    XCTAssertEqual(30, integer);
+
+    XCTAssertTrue(tsearch_countedset_iterator_advance_to(iteratorPtr, 35, &integer, &count));
+    XCTAssertEqual(40, integer);
+    XCTAssertEqual(2, count);
+
+    // Targets before the current position don't move the iterator backwards.
+    XCTAssertTrue(tsearch_countedset_iterator_advance_to(iteratorPtr, 0, &integer, &count));
+    XCTAssertEqual(50, integer);
+
+    XCTAssertTrue(tsearch_countedset_iterator_advance_to(iteratorPtr, 70, &integer, &count));
+    XCTAssertEqual(70, integer);
+    XCTAssertFalse(tsearch_countedset_iterator_next(iteratorPtr, &integer, &count));
+    tsearch_countedset_iterator_free(iteratorPtr);
+}
+
+
+- (void)testIterator_DenseBitmapSet_SameIntegersAsCopySortedIntegers
+{
+    for (GNEInteger i = 0; i < 50000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 3));
+    }
+    XCTAssertEqual(0, _countedSet->insertIndex);
+
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    size_t integersCount = 0;
+    XCTAssertEqual(success, tsearch_countedset_copy_sorted_ints(_countedSet, &integers, &counts, &integersCount));
+
+    tsearch_countedset_iterator_ptr iteratorPtr = tsearch_countedset_iterator_init(_countedSet);
+    GNEInteger integer = 0;
+    size_t count = 0;
+    for (size_t i = 0; i < integersCount; i++)
+    {
+        XCTAssertTrue(tsearch_countedset_iterator_next(iteratorPtr, &integer, &count));
+        XCTAssertEqual(integers[i], integer);
+    }
+    XCTAssertFalse(tsearch_countedset_iterator_next(iteratorPtr, &integer, &count));
+    tsearch_countedset_iterator_free(iteratorPtr);
+
+    iteratorPtr = tsearch_countedset_iterator_init(_countedSet);
+    XCTAssertTrue(tsearch_countedset_iterator_advance_to(iteratorPtr, 100000, &integer, &count));
+    XCTAssertEqual(100002, integer);
+    tsearch_countedset_iterator_free(iteratorPtr);
+
+    free(integers);
+    free(counts);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Add/Contains/Count Integers
 // ------------------------------------------------------------------------------------------
@@ -551,6 +720,40 @@ typedef struct tsearch_countedset
 }
 
 
+- (void)testAddIntegers_TenThousandSortedIntegers_TreeRemainsBalanced
+{
+    size_t count = 10000;
+    for (size_t i = 0; i < count; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, (GNEInteger)i));
+    }
+
+    XCTAssertEqual(count, tsearch_countedset_get_count(_countedSet));
+    NSInteger height = [self p_heightOfNodeAtIndex:0 inCountedSet:_countedSet];
+    XCTAssertTrue(height <= 15); // 1.44 * log2(10000)
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(_countedSet, 0));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(_countedSet, 9999));
+}
+
+
+- (void)testAddIntegers_UnionRemovedIntegerWithCountOfTwo_CountedOnce
+{
+    tsearch_countedset_ptr otherCountedSet = tsearch_countedset_init();
+    GNEInteger integers[] = {5, 5};
+    [self p_addIntegers:integers count:2 toCountedSet:otherCountedSet];
+
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 5));
+    XCTAssertEqual(success, tsearch_countedset_remove_int(_countedSet, 5));
+    XCTAssertEqual(0, tsearch_countedset_get_count(_countedSet));
+
+    XCTAssertEqual(success, tsearch_countedset_union(_countedSet, otherCountedSet));
+    XCTAssertEqual(1, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(_countedSet, 5));
+
+    tsearch_countedset_free(otherCountedSet);
+}
+
+
 - (void)testAddIntegers_AddTenNumbers_NoDuplicatesAndCorrectCounts
 {
     size_t count = 10;
@@ -699,6 +902,91 @@ typedef struct tsearch_countedset
 }
 
 
+- (void)testRemove_ThreeQuartersOfOneThousandIntegers_TreeCompacted
+{
+    for (GNEInteger i = 0; i < 1000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i));
+    }
+    for (GNEInteger i = 0; i < 1000; i++)
+    {
+        if (i % 4 != 0) { XCTAssertEqual(success, tsearch_countedset_remove_int(_countedSet, i)); }
+    }
+
+    XCTAssertEqual(250, tsearch_countedset_get_count(_countedSet));
+    XCTAssertTrue((_countedSet->insertIndex - _countedSet->count) * 4 <= _countedSet->insertIndex);
+    XCTAssertTrue([self p_heightOfNodeAtIndex:0 inCountedSet:_countedSet] <= 10);
+    for (GNEInteger i = 0; i < 1000; i++)
+    {
+        XCTAssertEqual((i % 4 == 0) ? 1 : 0, tsearch_countedset_get_count_for_int(_countedSet, i));
+    }
+}
+
+
+- (void)testRemove_MaxTombstonePercentageOfOneHundred_TreeNotCompacted
+{
+    XCTAssertEqual(failure, tsearch_countedset_set_max_tombstone_percentage(_countedSet, 101));
+    XCTAssertEqual(success, tsearch_countedset_set_max_tombstone_percentage(_countedSet, 100));
+    for (GNEInteger i = 0; i < 1000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i));
+    }
+    for (GNEInteger i = 0; i < 1000; i++)
+    {
+        if (i % 4 != 0) { XCTAssertEqual(success, tsearch_countedset_remove_int(_countedSet, i)); }
+    }
+    XCTAssertEqual(250, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(1000, _countedSet->insertIndex);
+
+    XCTAssertEqual(success, tsearch_countedset_set_max_tombstone_percentage(_countedSet, 50));
+    XCTAssertEqual(250, _countedSet->insertIndex);
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(_countedSet, 996));
+}
+
+
+- (void)testRemove_RemoveAllIntegers_NodesReused
+{
+    for (GNEInteger i = 0; i < 100; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i));
+    }
+    XCTAssertEqual(success, tsearch_countedset_remove_all_ints(_countedSet));
+    XCTAssertEqual(0, _countedSet->insertIndex);
+
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 50));
+    XCTAssertEqual(1, _countedSet->insertIndex);
+    XCTAssertEqual(1, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(false, tsearch_countedset_contains_int(_countedSet, 49));
+}
+
+
+- (void)testShrinkToFit_TenThousandIntegersMinusAllButTen_CapacityReleased
+{
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 7));
+        if (i % 1000 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 7)); }
+    }
+    XCTAssertEqual(success, tsearch_countedset_set_max_tombstone_percentage(_countedSet, 100));
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        if (i % 1000 != 0) { XCTAssertEqual(success, tsearch_countedset_remove_int(_countedSet, i * 7)); }
+    }
+    XCTAssertEqual(10240 * sizeof(_tsearch_countedset_node), _countedSet->nodesCapacity);
+
+    XCTAssertEqual(success, tsearch_countedset_shrink_to_fit(_countedSet));
+    XCTAssertEqual(10, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(10, _countedSet->insertIndex);
+    XCTAssertEqual(12 * sizeof(_tsearch_countedset_node), _countedSet->nodesCapacity);
+    XCTAssertEqual(4, [self p_heightOfNodeAtIndex:0 inCountedSet:_countedSet]);
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(_countedSet, 9000 * 7));
+
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 1));
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 2));
+    XCTAssertEqual(12, tsearch_countedset_get_count(_countedSet));
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Union Set
 // ------------------------------------------------------------------------------------------
@@ -1244,6 +1532,60 @@ typedef struct tsearch_countedset
 }
 
 
+- (void)testIntersectSet_TenIntegersAndTenThousandIntegers_TenIntegersWithSummedCounts
+{
+    tsearch_countedset_ptr otherCountedSet = tsearch_countedset_init();
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(otherCountedSet, i));
+    }
+    for (GNEInteger i = 0; i < 10; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 1000));
+    }
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 20000));
+
+    XCTAssertEqual(success, tsearch_countedset_intersect(_countedSet, otherCountedSet));
+    XCTAssertEqual(10, tsearch_countedset_get_count(_countedSet));
+    for (GNEInteger i = 0; i < 10; i++)
+    {
+        XCTAssertEqual(2, tsearch_countedset_get_count_for_int(_countedSet, i * 1000));
+    }
+    XCTAssertEqual(false, tsearch_countedset_contains_int(_countedSet, 20000));
+
+    XCTAssertEqual(success, tsearch_countedset_intersect(otherCountedSet, _countedSet));
+    XCTAssertEqual(10, tsearch_countedset_get_count(otherCountedSet));
+    XCTAssertEqual(3, tsearch_countedset_get_count_for_int(otherCountedSet, 9000));
+    XCTAssertEqual(false, tsearch_countedset_contains_int(otherCountedSet, 1));
+    [self p_heightOfNodeAtIndex:0 inCountedSet:otherCountedSet];
+
+    tsearch_countedset_free(otherCountedSet);
+}
+
+
+- (void)testIntersectSet_MultiplesOfThreeAndFive_MultiplesOfFifteenWithSummedCounts
+{
+    tsearch_countedset_ptr otherCountedSet = tsearch_countedset_init();
+    for (GNEInteger i = 0; i < 30000; i++)
+    {
+        if (i % 3 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i)); }
+        if (i % 5 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(otherCountedSet, i)); }
+        if (i % 10 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(otherCountedSet, i)); }
+    }
+
+    XCTAssertEqual(success, tsearch_countedset_intersect(_countedSet, otherCountedSet));
+    XCTAssertEqual(2000, tsearch_countedset_get_count(_countedSet));
+    for (GNEInteger i = 0; i < 30000; i++)
+    {
+        size_t expectedCount = 0;
+        if (i % 15 == 0) { expectedCount = (i % 10 == 0) ? 3 : 2; }
+        XCTAssertEqual(expectedCount, tsearch_countedset_get_count_for_int(_countedSet, i));
+    }
+
+    tsearch_countedset_free(otherCountedSet);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Minus Set
 // ------------------------------------------------------------------------------------------
@@ -1421,6 +1763,154 @@ typedef struct tsearch_countedset
 }
 
 
+- (void)testMinusSet_TwoLargeSets_BalancedTreeWithoutRemovedIntegers
+{
+    tsearch_countedset_ptr otherCountedSet = tsearch_countedset_init();
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i));
+        if (i % 2 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(otherCountedSet, i)); }
+    }
+
+    XCTAssertEqual(success, tsearch_countedset_minus(_countedSet, otherCountedSet));
+    XCTAssertEqual(5000, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(5000, _countedSet->insertIndex);
+    XCTAssertEqual(10240 * sizeof(_tsearch_countedset_node), _countedSet->nodesCapacity);
+    XCTAssertEqual(false, tsearch_countedset_contains_int(_countedSet, 0));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(_countedSet, 9999));
+
+    NSInteger height = [self p_heightOfNodeAtIndex:0 inCountedSet:_countedSet];
+    XCTAssertEqual(13, height); // log2(5000) rounded up
+
+    XCTAssertEqual(success, tsearch_countedset_union(_countedSet, otherCountedSet));
+    XCTAssertEqual(10000, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(10000, _countedSet->insertIndex);
+    height = [self p_heightOfNodeAtIndex:0 inCountedSet:_countedSet];
+    XCTAssertEqual(14, height);
+
+    tsearch_countedset_free(otherCountedSet);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Bitmap
+// ------------------------------------------------------------------------------------------
+- (void)testBitmap_OneHundredThousandDenseIntegers_SmallerWithSameCounts
+{
+    for (GNEInteger i = 0; i < 100000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i));
+        if (i % 7 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i)); }
+    }
+
+    XCTAssertEqual(100000, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(0, _countedSet->insertIndex);
+    XCTAssertEqual(5 * sizeof(_tsearch_countedset_node), _countedSet->nodesCapacity);
+    XCTAssertTrue(tsearch_countedset_get_size(_countedSet) < 100000 * 8);
+    for (GNEInteger i = 0; i < 100000; i++)
+    {
+        XCTAssertEqual((i % 7 == 0) ? 2 : 1, tsearch_countedset_get_count_for_int(_countedSet, i));
+    }
+    XCTAssertEqual(false, tsearch_countedset_contains_int(_countedSet, -1));
+    XCTAssertEqual(false, tsearch_countedset_contains_int(_countedSet, 100000));
+
+    XCTAssertEqual(success, tsearch_countedset_remove_int(_countedSet, 7));
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 200000));
+    XCTAssertEqual(100000, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(false, tsearch_countedset_contains_int(_countedSet, 7));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(_countedSet, 200000));
+
+    GNEInteger *integers = NULL;
+    size_t count = 0;
+    XCTAssertEqual(success, tsearch_countedset_copy_ints(_countedSet, &integers, &count));
+    XCTAssertEqual(100000, count);
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(_countedSet, integers[0]));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(_countedSet, integers[count - 1]));
+    free(integers);
+
+    XCTAssertEqual(success, tsearch_countedset_remove_all_ints(_countedSet));
+    XCTAssertEqual(0, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 3));
+    XCTAssertEqual(1, _countedSet->insertIndex);
+}
+
+
+- (void)testBitmap_OneHundredThousandSparseIntegers_RemainsTree
+{
+    for (GNEInteger i = 0; i < 100000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 1000003));
+    }
+
+    XCTAssertEqual(100000, tsearch_countedset_get_count(_countedSet));
+    XCTAssertEqual(100000, _countedSet->insertIndex);
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(_countedSet, 99999 * (GNEInteger)1000003));
+}
+
+
+- (void)testBitmap_IgnoringCounts_AllCountsAreOne
+{
+    tsearch_countedset_ptr countedSet = tsearch_countedset_init_ignoring_counts();
+    tsearch_countedset_ptr otherCountedSet = tsearch_countedset_init();
+    for (GNEInteger i = 0; i < 50000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(countedSet, i));
+        XCTAssertEqual(success, tsearch_countedset_add_int(countedSet, i));
+        XCTAssertEqual(success, tsearch_countedset_add_int(otherCountedSet, i));
+    }
+
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(countedSet, 0));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(countedSet, 49999));
+    XCTAssertTrue(tsearch_countedset_get_size(countedSet) < tsearch_countedset_get_size(otherCountedSet));
+
+    XCTAssertEqual(success, tsearch_countedset_union(countedSet, otherCountedSet));
+    XCTAssertEqual(50000, tsearch_countedset_get_count(countedSet));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(countedSet, 25000));
+
+    XCTAssertEqual(success, tsearch_countedset_union(otherCountedSet, countedSet));
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(otherCountedSet, 25000));
+
+    tsearch_countedset_free(countedSet);
+    tsearch_countedset_free(otherCountedSet);
+}
+
+
+- (void)testBitmap_TwoDenseSets_SameResultsAsTrees
+{
+    tsearch_countedset_ptr otherCountedSet = tsearch_countedset_init();
+    for (GNEInteger i = 0; i < 60000; i++)
+    {
+        if (i % 2 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i)); }
+        if (i % 3 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(otherCountedSet, i)); }
+    }
+    XCTAssertEqual(0, _countedSet->insertIndex);
+    XCTAssertEqual(0, otherCountedSet->insertIndex);
+
+    tsearch_countedset_ptr unionSet = tsearch_countedset_copy(_countedSet);
+    XCTAssertEqual(success, tsearch_countedset_union(unionSet, otherCountedSet));
+    XCTAssertEqual(40000, tsearch_countedset_get_count(unionSet));
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(unionSet, 6));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(unionSet, 9));
+
+    tsearch_countedset_ptr minusSet = tsearch_countedset_copy(_countedSet);
+    XCTAssertEqual(success, tsearch_countedset_minus(minusSet, otherCountedSet));
+    XCTAssertEqual(20000, tsearch_countedset_get_count(minusSet));
+    XCTAssertEqual(false, tsearch_countedset_contains_int(minusSet, 6));
+    XCTAssertEqual(true, tsearch_countedset_contains_int(minusSet, 4));
+
+    XCTAssertEqual(success, tsearch_countedset_intersect(_countedSet, otherCountedSet));
+    XCTAssertEqual(10000, tsearch_countedset_get_count(_countedSet));
+    for (GNEInteger i = 0; i < 60000; i++)
+    {
+        XCTAssertEqual((i % 6 == 0) ? 2 : 0, tsearch_countedset_get_count_for_int(_countedSet, i));
+    }
+
+    tsearch_countedset_free(unionSet);
+    tsearch_countedset_free(minusSet);
+    tsearch_countedset_free(otherCountedSet);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Performance
 // ------------------------------------------------------------------------------------------
@@ -1527,6 +2017,21 @@ typedef struct tsearch_countedset
 }
 
 
+- (void)testPerformance_CopyTopTwentyOfOneHundredThousandIntegers
+{
+    NSArray *numbers = [self p_oneHundredThousandRandomIntegers_1];
+    [self p_addNumbers:numbers toCountedSet:_countedSet];
+
+    [self measureBlock:^()
+    {
+        GNEInteger *results = NULL;
+        size_t resultsCount = 0;
+        tsearch_countedset_copy_top_ints(_countedSet, 20, &results, &resultsCount);
+        free(results);
+    }];
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Helpers
 // ------------------------------------------------------------------------------------------
@@ -1555,6 +2060,20 @@ typedef struct tsearch_countedset
 }
 
 
+/// Returns the height of the subtree rooted at the specified index and asserts that
+/// every node's stored balance factor is correct and within the AVL limits.
+- (NSInteger)p_heightOfNodeAtIndex:(size_t)index inCountedSet:(tsearch_countedset_ptr)countedSet
+{
+    if (index == SIZE_MAX) { return 0; }
+    _tsearch_countedset_node node = countedSet->nodes[index];
+    NSInteger leftHeight = [self p_heightOfNodeAtIndex:node.left inCountedSet:countedSet];
+    NSInteger rightHeight = [self p_heightOfNodeAtIndex:node.right inCountedSet:countedSet];
+    XCTAssertEqual(leftHeight - rightHeight, (NSInteger)node.balance);
+    XCTAssertTrue(labs(leftHeight - rightHeight) <= 1);
+    return MAX(leftHeight, rightHeight) + 1;
+}
+
+
 - (void)p_addIntegers:(GNEInteger *)integers
                 count:(size_t)count
          toCountedSet:(tsearch_countedset_ptr)countedSet
@@ -0,0 +1,104 @@
+//
+//  forwardindex_tests.m
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "forwardindex.h"
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@interface GNEForwardIndexTests : XCTestCase
+{
+    tsearch_forwardindex_ptr _forwardIndex;
+}
+
+@end
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@implementation GNEForwardIndexTests
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Set Up / Tear Down
+// ------------------------------------------------------------------------------------------
+- (void)setUp
+{
+    [super setUp];
+    _forwardIndex = tsearch_forwardindex_init();
+}
+
+
+- (void)tearDown
+{
+    tsearch_forwardindex_free(_forwardIndex);
+    _forwardIndex = NULL;
+    [super tearDown];
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Add / Remove
+// ------------------------------------------------------------------------------------------
+- (void)testAddTerms_TwoDocuments_TermsInInsertionOrder
+{
+    XCTAssertEqual(success, tsearch_forwardindex_add_term(_forwardIndex, INT64_MIN, 7));
+    XCTAssertEqual(success, tsearch_forwardindex_add_term(_forwardIndex, 3, 2));
+    XCTAssertEqual(success, tsearch_forwardindex_add_term(_forwardIndex, INT64_MIN, 1));
+    XCTAssertEqual(2, tsearch_forwardindex_get_count(_forwardIndex));
+
+    size_t count = 0;
+    const uint32_t *terms = tsearch_forwardindex_get_terms(_forwardIndex, INT64_MIN, &count);
+    XCTAssertEqual(2, count);
+    XCTAssertEqual(7, terms[0]);
+    XCTAssertEqual(1, terms[1]);
+
+    XCTAssertTrue(tsearch_forwardindex_get_terms(_forwardIndex, 4, &count) == NULL);
+    XCTAssertEqual(0, count);
+}
+
+
+- (void)testRemoveDocuments_TenThousandDocuments_RemainingDocumentsKeepTheirTerms
+{
+    for (GNEInteger documentID = 0; documentID < 10000; documentID++)
+    {
+        for (uint32_t term = 0; term < (uint32_t)(documentID % 7) + 1; term++)
+        {
+            XCTAssertEqual(success, tsearch_forwardindex_add_term(_forwardIndex, documentID, term));
+        }
+    }
+    XCTAssertEqual(10000, tsearch_forwardindex_get_count(_forwardIndex));
+
+    for (GNEInteger documentID = 0; documentID < 10000; documentID += 2)
+    {
+        XCTAssertEqual(success, tsearch_forwardindex_remove_document(_forwardIndex, documentID));
+    }
+    XCTAssertEqual(success, tsearch_forwardindex_remove_document(_forwardIndex, 20000));
+    XCTAssertEqual(5000, tsearch_forwardindex_get_count(_forwardIndex));
+
+    for (GNEInteger documentID = 0; documentID < 10000; documentID++)
+    {
+        size_t count = 0;
+        const uint32_t *terms = tsearch_forwardindex_get_terms(_forwardIndex, documentID, &count);
+        if (documentID % 2 == 0)
+        {
+            XCTAssertTrue(terms == NULL);
+        }
+        else
+        {
+            XCTAssertEqual((size_t)(documentID % 7) + 1, count);
+            XCTAssertEqual(count - 1, terms[count - 1]);
+        }
+    }
+}
+
+
+@end
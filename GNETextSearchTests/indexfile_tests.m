@@ -0,0 +1,161 @@
+//
+//  indexfile_tests.m
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "indexfile.h"
+#import "ternarytree.h"
+#import "countedset.h"
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@interface GNEIndexFileTests : XCTestCase
+{
+    tsearch_ternarytree_ptr _treePtr;
+    NSString *_path;
+}
+
+@end
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@implementation GNEIndexFileTests
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Set Up / Tear Down
+// ------------------------------------------------------------------------------------------
+- (void)setUp
+{
+    [super setUp];
+    _treePtr = tsearch_ternarytree_init();
+    NSString *name = [NSString stringWithFormat:@"%@.tsearch", [NSUUID UUID].UUIDString];
+    _path = [NSTemporaryDirectory() stringByAppendingPathComponent:name];
+}
+
+
+- (void)tearDown
+{
+    tsearch_ternarytree_free(_treePtr);
+    _treePtr = NULL;
+    [[NSFileManager defaultManager] removeItemAtPath:_path error:nil];
+    _path = nil;
+    [super tearDown];
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Write / Open
+// ------------------------------------------------------------------------------------------
+- (void)testOpen_MissingFile_Null
+{
+    XCTAssertTrue(tsearch_indexfile_open(_path.UTF8String) == NULL);
+    XCTAssertTrue(tsearch_indexfile_open(NULL) == NULL);
+}
+
+
+- (void)testWrite_EmptyTree_NoResults
+{
+    XCTAssertEqual(success, tsearch_indexfile_write(_treePtr, _path.UTF8String));
+    tsearch_indexfile_ptr indexFilePtr = tsearch_indexfile_open(_path.UTF8String);
+    XCTAssertTrue(indexFilePtr != NULL);
+    XCTAssertEqual(0, tsearch_indexfile_get_count(indexFilePtr));
+    XCTAssertEqual(success, tsearch_indexfile_verify(indexFilePtr));
+    XCTAssertTrue(tsearch_indexfile_copy_search_results(indexFilePtr, "a") == NULL);
+    XCTAssertTrue(tsearch_indexfile_copy_prefix_search_results(indexFilePtr, "a") == NULL);
+    tsearch_indexfile_close(indexFilePtr);
+}
+
+
+- (void)testWrite_Words_SameResultsAsTree
+{
+    NSArray *words = @[@"an", @"ant", @"anthem", @"antler", @"bee", @"beetle", @"Größe", @"größe", @"日本語",
+                       @"zebra", @"a", @"ab", @"abc"];
+    for (NSUInteger i = 0; i < words.count * 4; i++)
+    {
+        tsearch_ternarytree_insert(_treePtr, [words[i % words.count] UTF8String], (GNEInteger)(i % 5));
+    }
+    XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, 4));
+
+    XCTAssertEqual(success, tsearch_indexfile_write(_treePtr, _path.UTF8String));
+    tsearch_indexfile_ptr indexFilePtr = tsearch_indexfile_open(_path.UTF8String);
+    XCTAssertTrue(indexFilePtr != NULL);
+    XCTAssertEqual(words.count, tsearch_indexfile_get_count(indexFilePtr));
+    XCTAssertEqual(success, tsearch_indexfile_verify(indexFilePtr));
+
+    NSArray *targets = [words arrayByAddingObjectsFromArray:@[@"b", @"Gr", @"日", @"antlers", @"x", @""]];
+    for (NSString *target in targets)
+    {
+        tsearch_countedset_ptr expectedPtr = tsearch_ternarytree_copy_search_results(_treePtr, target.UTF8String);
+        tsearch_countedset_ptr resultsPtr = tsearch_indexfile_copy_search_results(indexFilePtr, target.UTF8String);
+        [self assertCountedSet:resultsPtr equalsCountedSet:expectedPtr];
+        tsearch_countedset_free(expectedPtr);
+        tsearch_countedset_free(resultsPtr);
+
+        expectedPtr = tsearch_ternarytree_copy_prefix_search_results(_treePtr, target.UTF8String);
+        resultsPtr = tsearch_indexfile_copy_prefix_search_results(indexFilePtr, target.UTF8String);
+        [self assertCountedSet:resultsPtr equalsCountedSet:expectedPtr];
+        tsearch_countedset_free(expectedPtr);
+        tsearch_countedset_free(resultsPtr);
+    }
+    tsearch_indexfile_close(indexFilePtr);
+}
+
+
+- (void)testOpen_DamagedFile_NullOrFailsVerification
+{
+    for (GNEInteger documentID = 0; documentID < 100; documentID++)
+    {
+        NSString *word = [NSString stringWithFormat:@"word%lld", (long long)(documentID % 17)];
+        tsearch_ternarytree_insert(_treePtr, word.UTF8String, documentID);
+    }
+    XCTAssertEqual(success, tsearch_indexfile_write(_treePtr, _path.UTF8String));
+    NSData *data = [NSData dataWithContentsOfFile:_path];
+
+    NSMutableData *damagedHeader = [data mutableCopy];
+    ((uint8_t *)damagedHeader.mutableBytes)[20] ^= 0x01;
+    XCTAssertTrue([damagedHeader writeToFile:_path atomically:YES]);
+    XCTAssertTrue(tsearch_indexfile_open(_path.UTF8String) == NULL);
+
+    NSMutableData *damagedPostings = [data mutableCopy];
+    ((uint8_t *)damagedPostings.mutableBytes)[damagedPostings.length - 9] ^= 0x01;
+    XCTAssertTrue([damagedPostings writeToFile:_path atomically:YES]);
+    tsearch_indexfile_ptr indexFilePtr = tsearch_indexfile_open(_path.UTF8String);
+    XCTAssertTrue(indexFilePtr != NULL);
+    XCTAssertEqual(failure, tsearch_indexfile_verify(indexFilePtr));
+    tsearch_indexfile_close(indexFilePtr);
+
+    NSData *truncated = [data subdataWithRange:NSMakeRange(0, data.length / 2)];
+    XCTAssertTrue([truncated writeToFile:_path atomically:YES]);
+    XCTAssertTrue(tsearch_indexfile_open(_path.UTF8String) == NULL);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Helpers
+// ------------------------------------------------------------------------------------------
+- (void)assertCountedSet:(tsearch_countedset_ptr)ptr equalsCountedSet:(tsearch_countedset_ptr)expectedPtr
+{
+    XCTAssertEqual(ptr == NULL, expectedPtr == NULL);
+    XCTAssertEqual(tsearch_countedset_get_count(expectedPtr), tsearch_countedset_get_count(ptr));
+    GNEInteger *integers = NULL;
+    size_t count = 0;
+    if (expectedPtr == NULL || tsearch_countedset_copy_ints(expectedPtr, &integers, &count) == failure) { return; }
+    for (size_t i = 0; i < count; i++)
+    {
+        XCTAssertEqual(tsearch_countedset_get_count_for_int(expectedPtr, integers[i]),
+                       tsearch_countedset_get_count_for_int(ptr, integers[i]));
+    }
+    free(integers);
+}
+
+
+@end
@@ -0,0 +1,249 @@
+//
+//  postings_tests.m
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "postings.h"
+#import "countedset.h"
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@interface GNEPostingsTests : XCTestCase
+{
+    tsearch_countedset_ptr _countedSet;
+}
+
+@end
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@implementation GNEPostingsTests
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Set Up / Tear Down
+// ------------------------------------------------------------------------------------------
+- (void)setUp
+{
+    [super setUp];
+    _countedSet = tsearch_countedset_init();
+}
+
+
+- (void)tearDown
+{
+    tsearch_countedset_free(_countedSet);
+    _countedSet = NULL;
+    [super tearDown];
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Initialization
+// ------------------------------------------------------------------------------------------
+- (void)testInitialization_NullCountedSet_Null
+{
+    XCTAssertTrue(tsearch_postings_init_with_countedset(NULL) == NULL);
+}
+
+
+- (void)testInitialization_EmptyCountedSet_ZeroCount
+{
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    XCTAssertTrue(postings != NULL);
+    XCTAssertEqual(0, tsearch_postings_get_count(postings));
+    XCTAssertEqual(false, tsearch_postings_contains_int(postings, 0));
+    tsearch_postings_free(postings);
+}
+
+
+- (void)testInitialization_UnsortedIntegers_Null
+{
+    GNEInteger integers[] = {1, 3, 2};
+    size_t counts[] = {1, 1, 1};
+    XCTAssertTrue(tsearch_postings_init_with_sorted_ints(integers, counts, 3) == NULL);
+}
+
+
+- (void)testInitialization_ZeroCount_Null
+{
+    GNEInteger integers[] = {1, 2, 3};
+    size_t counts[] = {1, 0, 1};
+    XCTAssertTrue(tsearch_postings_init_with_sorted_ints(integers, counts, 3) == NULL);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Counts
+// ------------------------------------------------------------------------------------------
+- (void)testCounts_FiveIntegers_SameCountsAsCountedSet
+{
+    GNEInteger integers[] = {-40, 7, 7, 1000000, INT64_MAX, INT64_MIN, 7};
+    for (size_t i = 0; i < 7; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, integers[i]));
+    }
+
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    XCTAssertEqual(5, tsearch_postings_get_count(postings));
+    XCTAssertEqual(1, tsearch_postings_get_count_for_int(postings, -40));
+    XCTAssertEqual(3, tsearch_postings_get_count_for_int(postings, 7));
+    XCTAssertEqual(1, tsearch_postings_get_count_for_int(postings, 1000000));
+    XCTAssertEqual(1, tsearch_postings_get_count_for_int(postings, INT64_MAX));
+    XCTAssertEqual(1, tsearch_postings_get_count_for_int(postings, INT64_MIN));
+    XCTAssertEqual(0, tsearch_postings_get_count_for_int(postings, 8));
+    XCTAssertEqual(false, tsearch_postings_contains_int(postings, 0));
+    tsearch_postings_free(postings);
+}
+
+
+- (void)testCounts_TenThousandRandomIntegers_SameCountsAsCountedSet
+{
+    for (size_t i = 0; i < 10000; i++)
+    {
+        GNEInteger integer = (GNEInteger)arc4random_uniform(20000);
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, integer));
+    }
+
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    XCTAssertEqual(tsearch_countedset_get_count(_countedSet), tsearch_postings_get_count(postings));
+    for (GNEInteger integer = 0; integer < 20000; integer++)
+    {
+        XCTAssertEqual(tsearch_countedset_get_count_for_int(_countedSet, integer),
+                       tsearch_postings_get_count_for_int(postings, integer));
+    }
+    tsearch_postings_free(postings);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Conversion
+// ------------------------------------------------------------------------------------------
+- (void)testConversion_TenThousandIntegersRoundTrip_EqualCountedSet
+{
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 37));
+        if (i % 3 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 37)); }
+    }
+
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    tsearch_countedset_ptr copyPtr = tsearch_postings_copy_countedset(postings);
+    XCTAssertEqual(10000, tsearch_countedset_get_count(copyPtr));
+
+    GNEInteger *integers = NULL, *copyIntegers = NULL;
+    size_t *counts = NULL, *copyCounts = NULL;
+    size_t count = 0, copyCount = 0;
+    XCTAssertEqual(success, tsearch_countedset_copy_sorted_ints(_countedSet, &integers, &counts, &count));
+    XCTAssertEqual(success, tsearch_countedset_copy_sorted_ints(copyPtr, &copyIntegers, &copyCounts, &copyCount));
+    XCTAssertEqual(count, copyCount);
+    XCTAssertEqual(0, memcmp(integers, copyIntegers, count * sizeof(GNEInteger)));
+    XCTAssertEqual(0, memcmp(counts, copyCounts, count * sizeof(size_t)));
+
+    free(integers);
+    free(counts);
+    free(copyIntegers);
+    free(copyCounts);
+    tsearch_countedset_free(copyPtr);
+    tsearch_postings_free(postings);
+}
+
+
+- (void)testConversion_WriteSortedInts_SameAsCopySortedInts
+{
+    for (GNEInteger i = 0; i < 1000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int_with_count(_countedSet, i * i - 500, (size_t)(i % 4) + 1));
+    }
+
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    GNEInteger *integers = NULL;
+    size_t *counts = NULL;
+    size_t count = 0;
+    XCTAssertEqual(success, tsearch_postings_copy_sorted_ints(postings, &integers, &counts, &count));
+
+    GNEInteger writtenIntegers[1000];
+    size_t writtenCounts[1000];
+    XCTAssertEqual(count, tsearch_postings_write_sorted_ints(postings, writtenIntegers, writtenCounts));
+    XCTAssertEqual(0, memcmp(integers, writtenIntegers, count * sizeof(GNEInteger)));
+    XCTAssertEqual(0, memcmp(counts, writtenCounts, count * sizeof(size_t)));
+
+    free(integers);
+    free(counts);
+    tsearch_postings_free(postings);
+}
+
+
+- (void)testSize_TenThousandDenseIntegers_LessThanThreeBytesPerInteger
+{
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 3));
+    }
+
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    XCTAssertTrue(tsearch_postings_get_size(postings) < 10000 * 3);
+    tsearch_postings_free(postings);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Serialization
+// ------------------------------------------------------------------------------------------
+- (void)testSerialization_TenThousandIntegersRoundTrip_SameCounts
+{
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 11 - 5000));
+        if (i % 7 == 0) { XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, i * 11 - 5000)); }
+    }
+
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    size_t length = tsearch_postings_get_serialized_length(postings);
+    XCTAssertEqual(0, length % TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT);
+    uint64_t *bytes = malloc(length);
+    XCTAssertEqual(failure, tsearch_postings_serialize(postings, bytes, length - 1));
+    XCTAssertEqual(success, tsearch_postings_serialize(postings, bytes, length));
+
+    tsearch_postings_ptr serialized = tsearch_postings_init_with_serialized(bytes, length);
+    XCTAssertTrue(serialized != NULL);
+    XCTAssertEqual(10000, tsearch_postings_get_count(serialized));
+    for (GNEInteger i = 0; i < 10000; i++)
+    {
+        size_t expected = (i % 7 == 0) ? 2 : 1;
+        XCTAssertEqual(expected, tsearch_postings_get_count_for_int(serialized, i * 11 - 5000));
+        XCTAssertEqual(0, tsearch_postings_get_count_for_int(serialized, i * 11 - 4999));
+    }
+
+    tsearch_postings_free(serialized);
+    tsearch_postings_free(postings);
+    free(bytes);
+}
+
+
+- (void)testSerialization_TruncatedOrMisaligned_Null
+{
+    XCTAssertEqual(success, tsearch_countedset_add_int(_countedSet, 42));
+    tsearch_postings_ptr postings = tsearch_postings_init_with_countedset(_countedSet);
+    size_t length = tsearch_postings_get_serialized_length(postings);
+    uint64_t *bytes = calloc(length + TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT, 1);
+    XCTAssertEqual(success, tsearch_postings_serialize(postings, bytes, length));
+
+    XCTAssertTrue(tsearch_postings_init_with_serialized(bytes, length - TSEARCH_POSTINGS_SERIALIZED_ALIGNMENT) == NULL);
+    XCTAssertTrue(tsearch_postings_init_with_serialized((uint8_t *)bytes + 1, length) == NULL);
+    XCTAssertTrue(tsearch_postings_init_with_serialized(NULL, length) == NULL);
+
+    tsearch_postings_free(postings);
+    free(bytes);
+}
+
+
+@end
@@ -0,0 +1,109 @@
+//
+//  prefixcache_tests.m
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "prefixcache.h"
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@interface GNEPrefixCacheTests : XCTestCase
+{
+    tsearch_prefixcache_ptr _prefixCache;
+    tsearch_countedset_ptr _results;
+}
+
+@end
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@implementation GNEPrefixCacheTests
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Set Up / Tear Down
+// ------------------------------------------------------------------------------------------
+- (void)setUp
+{
+    [super setUp];
+    _prefixCache = tsearch_prefixcache_init(1024 * 1024);
+    _results = tsearch_countedset_init();
+    tsearch_countedset_add_int(_results, 1);
+    tsearch_countedset_add_int(_results, 2);
+}
+
+
+- (void)tearDown
+{
+    tsearch_prefixcache_free(_prefixCache);
+    _prefixCache = NULL;
+    tsearch_countedset_free(_results);
+    _results = NULL;
+    [super tearDown];
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Results
+// ------------------------------------------------------------------------------------------
+- (void)testAddResults_ShortAndLongPrefixes_OnlyShortPrefixesAreCached
+{
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "ab", 2, _results));
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "abcd", 4, _results));
+    XCTAssertEqual(success, tsearch_countedset_add_int(_results, 3));
+
+    tsearch_countedset_ptr cachedResults = tsearch_prefixcache_get_results(_prefixCache, "ab", 2);
+    XCTAssertEqual(2, tsearch_countedset_get_count(cachedResults));
+    XCTAssertTrue(tsearch_prefixcache_get_results(_prefixCache, "abcd", 4) == NULL);
+    XCTAssertTrue(tsearch_prefixcache_get_results(_prefixCache, "a", 1) == NULL);
+}
+
+
+- (void)testAddAndRemoveDocument_CachedPrefixes_ResultsStayUpToDate
+{
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "a", 1, _results));
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "ant", 3, _results));
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "b", 1, _results));
+
+    tsearch_prefixcache_add_document(_prefixCache, "antler", 3, 1);
+    tsearch_prefixcache_add_document(_prefixCache, "an", 1, 1);
+    XCTAssertEqual(3, tsearch_countedset_get_count(tsearch_prefixcache_get_results(_prefixCache, "a", 1)));
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(tsearch_prefixcache_get_results(_prefixCache, "a", 1), 1));
+    XCTAssertEqual(3, tsearch_countedset_get_count(tsearch_prefixcache_get_results(_prefixCache, "ant", 3)));
+    XCTAssertEqual(2, tsearch_countedset_get_count(tsearch_prefixcache_get_results(_prefixCache, "b", 1)));
+
+    tsearch_prefixcache_remove_document(_prefixCache, 1);
+    XCTAssertFalse(tsearch_countedset_contains_int(tsearch_prefixcache_get_results(_prefixCache, "a", 1), 1));
+    XCTAssertFalse(tsearch_countedset_contains_int(tsearch_prefixcache_get_results(_prefixCache, "ant", 3), 1));
+    XCTAssertFalse(tsearch_countedset_contains_int(tsearch_prefixcache_get_results(_prefixCache, "b", 1), 1));
+}
+
+
+- (void)testSetBudget_TooSmallForAllResults_LeastRecentlyUsedAreEvicted
+{
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "a", 1, _results));
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "b", 1, _results));
+    XCTAssertEqual(success, tsearch_prefixcache_add_results(_prefixCache, "c", 1, _results));
+    XCTAssertTrue(tsearch_prefixcache_get_results(_prefixCache, "a", 1) != NULL);
+
+    size_t size = tsearch_prefixcache_get_size(_prefixCache);
+    tsearch_prefixcache_set_budget(_prefixCache, (size / 3) * 2);
+    XCTAssertTrue(tsearch_prefixcache_get_results(_prefixCache, "a", 1) != NULL);
+    XCTAssertTrue(tsearch_prefixcache_get_results(_prefixCache, "b", 1) == NULL);
+    XCTAssertTrue(tsearch_prefixcache_get_results(_prefixCache, "c", 1) != NULL);
+
+    tsearch_prefixcache_set_budget(_prefixCache, 0);
+    XCTAssertEqual(0, tsearch_prefixcache_get_size(_prefixCache));
+    XCTAssertTrue(tsearch_prefixcache_get_results(_prefixCache, "a", 1) == NULL);
+}
+
+
+@end
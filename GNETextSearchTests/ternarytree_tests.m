@@ -378,6 +378,34 @@
 }
 
 
+- (void)testPrefixSearch_WithPrefixCache_CachedResultsFollowInsertsAndRemoves
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_options(tsearch_ternarytree_prefix_cache);
+    [self insertWords:@[@"ant", @"anthem", @"bee"] documentID:1 intoTree:treePtr];
+    [self insertWords:@[@"antler"] documentID:2 intoTree:treePtr];
+
+    tsearch_countedset_ptr resultsPtr = tsearch_ternarytree_copy_prefix_search_results(treePtr, "an");
+    XCTAssertEqual(2, tsearch_countedset_get_count(resultsPtr));
+    tsearch_countedset_free(resultsPtr);
+
+    [self insertWords:@[@"any"] documentID:3 intoTree:treePtr];
+    XCTAssertEqual(success, tsearch_ternarytree_remove(treePtr, 1));
+    resultsPtr = tsearch_ternarytree_copy_prefix_search_results(treePtr, "an");
+    XCTAssertEqual(2, tsearch_countedset_get_count(resultsPtr));
+    XCTAssertFalse(tsearch_countedset_contains_int(resultsPtr, 1));
+    XCTAssertTrue(tsearch_countedset_contains_int(resultsPtr, 3));
+    tsearch_countedset_free(resultsPtr);
+
+    XCTAssertEqual(success, tsearch_ternarytree_remove(treePtr, 2));
+    XCTAssertEqual(success, tsearch_ternarytree_remove(treePtr, 3));
+    XCTAssertTrue(NULL == tsearch_ternarytree_copy_prefix_search_results(treePtr, "an"));
+
+    XCTAssertEqual(failure, tsearch_ternarytree_set_prefix_cache_budget(_treePtr, 0));
+    XCTAssertEqual(success, tsearch_ternarytree_set_prefix_cache_budget(treePtr, 0));
+    tsearch_ternarytree_free(treePtr);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Partial Match Tests
 // ------------------------------------------------------------------------------------------
@@ -467,6 +495,33 @@
 }
 
 
+- (void)testPartialMatch_OverlappingTarget_ThreeMatchesForAAB
+{
+    NSString *target = @"aab";
+    NSArray *words = @[@"aaab", @"xaaaby", @"aba", @"aab"];
+    NSArray *randomizedWords = [self randomizeWords:words];
+    XCTAssertNoThrow([self insertWords:randomizedWords intoTree:_treePtr]);
+    NSArray *expectedWords = [self wordsInArray:randomizedWords withPartialMatch:target];
+    XCTAssertEqual(3, expectedWords.count);
+    [self assertResultsInTree:_treePtr matchingPartialTarget:target equalWords:expectedWords];
+}
+
+
+- (void)testPartialMatch_LMNWithTrigramIndex_SameResultsAsWithout
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_options(tsearch_ternarytree_trigram_index);
+    NSArray *randomizedWords = [self randomizeWords:[self wordsBeginningWithLMN]];
+    XCTAssertNoThrow([self insertWords:randomizedWords intoTree:treePtr]);
+
+    for (NSString *target in @[@"li", @"m", @"ess", @"ation", @"zzz"])
+    {
+        NSArray *expectedWords = [self wordsInArray:randomizedWords withPartialMatch:target];
+        [self assertResultsInTree:treePtr matchingPartialTarget:target equalWords:expectedWords];
+    }
+    tsearch_ternarytree_free(treePtr);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Suffix Search Tests
 // ------------------------------------------------------------------------------------------
@@ -509,6 +564,318 @@
 }
 
 
+- (void)testSuffixSearch_LMNWithSuffixIndex_SameResultsAsWithout
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_options(tsearch_ternarytree_suffix_index);
+    NSArray *randomizedWords = [self randomizeWords:[self wordsBeginningWithLMN]];
+    XCTAssertNoThrow([self insertWords:randomizedWords intoTree:treePtr]);
+
+    for (NSString *suffix in @[@"est", @"s", @"ness", @"men", @"zzz"])
+    {
+        NSArray *expectedWords = [self wordsInArray:randomizedWords withSuffix:suffix];
+        [self assertResultsInTree:treePtr matchingSuffix:suffix equalWords:expectedWords];
+    }
+    [self assertResultsInTree:treePtr equalWords:[[NSSet setWithArray:randomizedWords] allObjects]];
+    tsearch_ternarytree_free(treePtr);
+}
+
+
+- (void)testSuffixSearch_SuffixIndexAfterRemoveAndCompact_OnlyRemainingWords
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_options(tsearch_ternarytree_forward_index |
+                                                                            tsearch_ternarytree_suffix_index);
+    [self insertWords:@[@"ant", @"pant", @"bee"] documentID:1 intoTree:treePtr];
+    [self insertWords:@[@"want"] documentID:2 intoTree:treePtr];
+
+    XCTAssertEqual(success, tsearch_ternarytree_remove(treePtr, 1));
+    XCTAssertEqual(success, tsearch_ternarytree_compact(treePtr));
+    [self insertWords:@[@"can't"] documentID:3 intoTree:treePtr];
+
+    tsearch_countedset_ptr resultsPtr = tsearch_ternarytree_copy_suffix_search_results(treePtr, "nt", 2);
+    XCTAssertEqual(1, tsearch_countedset_get_count(resultsPtr));
+    XCTAssertTrue(tsearch_countedset_contains_int(resultsPtr, 2));
+    tsearch_countedset_free(resultsPtr);
+
+    resultsPtr = tsearch_ternarytree_copy_suffix_search_results(treePtr, "t", 1);
+    XCTAssertEqual(2, tsearch_countedset_get_count(resultsPtr));
+    XCTAssertTrue(tsearch_countedset_contains_int(resultsPtr, 3));
+    tsearch_countedset_free(resultsPtr);
+
+    XCTAssertTrue(NULL == tsearch_ternarytree_copy_suffix_search_results(treePtr, "ee", 2));
+    tsearch_ternarytree_free(treePtr);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Fuzzy Search Tests
+// ------------------------------------------------------------------------------------------
+- (void)testFuzzySearch_OneEdit_WordsWithinOneEdit
+{
+    [self insertWords:@[@"lord"] documentID:1 intoTree:_treePtr];
+    [self insertWords:@[@"lords", @"load"] documentID:2 intoTree:_treePtr];
+    [self insertWords:@[@"ord"] documentID:3 intoTree:_treePtr];
+    [self insertWords:@[@"word", @"lower"] documentID:4 intoTree:_treePtr];
+    [self insertWords:@[@"lard"] documentID:5 intoTree:_treePtr];
+
+    tsearch_countedset_ptr resultsPtr = tsearch_ternarytree_copy_fuzzy_search_results(_treePtr, "lord", 1);
+    XCTAssertEqual(5, tsearch_countedset_get_count(resultsPtr));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(resultsPtr, 1));
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(resultsPtr, 2));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(resultsPtr, 3));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(resultsPtr, 4));
+    XCTAssertEqual(1, tsearch_countedset_get_count_for_int(resultsPtr, 5));
+    tsearch_countedset_free(resultsPtr);
+
+    resultsPtr = tsearch_ternarytree_copy_fuzzy_search_results(_treePtr, "lord", 0);
+    XCTAssertEqual(1, tsearch_countedset_get_count(resultsPtr));
+    XCTAssertTrue(tsearch_countedset_contains_int(resultsPtr, 1));
+    tsearch_countedset_free(resultsPtr);
+}
+
+
+- (void)testFuzzySearch_NoWordsWithinMaxEdits_NoResults
+{
+    XCTAssertNoThrow([self insertWords:@[@"as", @"at", @"be", @"by", @"he", @"in"] intoTree:_treePtr]);
+    XCTAssertTrue(NULL == tsearch_ternarytree_copy_fuzzy_search_results(_treePtr, "zzzz", 1));
+    XCTAssertTrue(NULL == tsearch_ternarytree_copy_fuzzy_search_results(_treePtr, "", 1));
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Completions Tests
+// ------------------------------------------------------------------------------------------
+- (void)testCompletions_WordsInDifferentNumbersOfDocuments_MostFrequentFirst
+{
+    [self insertWords:@[@"the", @"then", @"there", @"to"] documentID:1 intoTree:_treePtr];
+    [self insertWords:@[@"the", @"there", @"them"] documentID:2 intoTree:_treePtr];
+    [self insertWords:@[@"the", @"there", @"they"] documentID:3 intoTree:_treePtr];
+    [self insertWords:@[@"the", @"thee"] documentID:4 intoTree:_treePtr];
+
+    tsearch_ternarytree_completion *completions = NULL;
+    size_t count = 0;
+    XCTAssertEqual(success, tsearch_ternarytree_copy_completions(_treePtr, "the", 2, &completions, &count));
+    XCTAssertEqual(2, count);
+    XCTAssertEqualObjects(@"the", @(completions[0].word));
+    XCTAssertEqual(4, completions[0].frequency);
+    XCTAssertEqualObjects(@"there", @(completions[1].word));
+    XCTAssertEqual(3, completions[1].frequency);
+    free(completions);
+
+    XCTAssertEqual(success, tsearch_ternarytree_copy_completions(_treePtr, "", 10, &completions, &count));
+    XCTAssertEqual(7, count);
+    XCTAssertEqualObjects(@"the", @(completions[0].word));
+    XCTAssertEqualObjects(@"there", @(completions[1].word));
+    free(completions);
+
+    XCTAssertEqual(success, tsearch_ternarytree_copy_completions(_treePtr, "x", 10, &completions, &count));
+    XCTAssertEqual(0, count);
+    XCTAssertTrue(completions == NULL);
+}
+
+
+- (void)testCompletions_AfterRemoveAndCompact_RankedByRemainingDocuments
+{
+    XCTAssertEqual(success, tsearch_ternarytree_set_max_empty_term_percentage(_treePtr, 100));
+    [self insertWords:@[@"cat", @"car"] documentID:1 intoTree:_treePtr];
+    [self insertWords:@[@"cat", @"cart"] documentID:2 intoTree:_treePtr];
+    [self insertWords:@[@"cart"] documentID:3 intoTree:_treePtr];
+    [self insertWords:@[@"cart"] documentID:4 intoTree:_treePtr];
+    XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, 3));
+    XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, 4));
+    XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, 1));
+
+    tsearch_ternarytree_completion *completions = NULL;
+    size_t count = 0;
+    XCTAssertEqual(success, tsearch_ternarytree_copy_completions(_treePtr, "ca", 10, &completions, &count));
+    XCTAssertEqual(2, count);
+    free(completions);
+
+    XCTAssertEqual(success, tsearch_ternarytree_compact(_treePtr));
+    [self insertWords:@[@"cat"] documentID:5 intoTree:_treePtr];
+    XCTAssertEqual(success, tsearch_ternarytree_copy_completions(_treePtr, "ca", 1, &completions, &count));
+    XCTAssertEqual(1, count);
+    XCTAssertEqualObjects(@"cat", @(completions[0].word));
+    XCTAssertEqual(2, completions[0].frequency);
+    free(completions);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Iterator Tests
+// ------------------------------------------------------------------------------------------
+- (void)testIterator_Prefix_WordsBeginningWithPrefixInOrder
+{
+    [self insertWords:@[@"car", @"cart", @"cat", @"ca", @"dog", @"c", @"catalog"] documentID:1 intoTree:_treePtr];
+    [self insertWords:@[@"cart"] documentID:2 intoTree:_treePtr];
+
+    tsearch_ternarytree_iterator_ptr iteratorPtr = tsearch_ternarytree_iterator_init(_treePtr, "ca");
+    NSMutableArray<NSString *> *words = [NSMutableArray array];
+    const char *word = NULL;
+    size_t length = 0;
+    tsearch_countedset_ptr documentIDs = NULL;
+    while (tsearch_ternarytree_iterator_next(iteratorPtr, &word, &length, &documentIDs) == true) {
+        XCTAssertEqual(strlen(word), length);
+        [words addObject:@(word)];
+        if (strcmp(word, "cart") == 0) { XCTAssertEqual(2, tsearch_countedset_get_count(documentIDs)); }
+    }
+    tsearch_ternarytree_iterator_free(iteratorPtr);
+
+    NSArray *expected = @[@"ca", @"car", @"cart", @"cat", @"catalog"];
+    XCTAssertEqualObjects(expected, words);
+}
+
+
+- (void)testIterator_EmptyPrefixAfterRemove_OnlyWordsWithDocuments
+{
+    XCTAssertEqual(success, tsearch_ternarytree_set_max_empty_term_percentage(_treePtr, 100));
+    [self insertWords:@[@"b", @"a", @"c"] documentID:1 intoTree:_treePtr];
+    [self insertWords:@[@"a"] documentID:2 intoTree:_treePtr];
+    XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, 1));
+
+    tsearch_ternarytree_iterator_ptr iteratorPtr = tsearch_ternarytree_iterator_init(_treePtr, "");
+    const char *word = NULL;
+    size_t length = 0;
+    tsearch_countedset_ptr documentIDs = NULL;
+    XCTAssertTrue(tsearch_ternarytree_iterator_next(iteratorPtr, &word, &length, &documentIDs));
+    XCTAssertEqualObjects(@"a", @(word));
+    XCTAssertFalse(tsearch_ternarytree_iterator_next(iteratorPtr, &word, &length, &documentIDs));
+    tsearch_ternarytree_iterator_free(iteratorPtr);
+
+    iteratorPtr = tsearch_ternarytree_iterator_init(_treePtr, "z");
+    XCTAssertTrue(iteratorPtr != NULL);
+    XCTAssertFalse(tsearch_ternarytree_iterator_next(iteratorPtr, &word, &length, &documentIDs));
+    tsearch_ternarytree_iterator_free(iteratorPtr);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Index Document Tests
+// ------------------------------------------------------------------------------------------
+- (void)testIndexDocument_RepeatedWords_SameCountsAsInsertingEachWord
+{
+    GNEInteger documentID = 42;
+    NSString *document = @"The cat and the hat, the end. Größe größe";
+    NSArray *words = @[@"The", @"cat", @"and", @"the", @"hat", @"the", @"end", @"Größe", @"größe"];
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init();
+    [self insertWords:words documentID:documentID intoTree:treePtr];
+
+    XCTAssertEqual(success, tsearch_ternarytree_index_document(_treePtr, document.UTF8String, documentID));
+    XCTAssertEqualObjects([self resultsInTree:treePtr], [self resultsInTree:_treePtr]);
+
+    tsearch_countedset_ptr resultsPtr = tsearch_ternarytree_copy_search_results(_treePtr, "the");
+    XCTAssertEqual(1, tsearch_countedset_get_count(resultsPtr));
+    XCTAssertEqual(2, tsearch_countedset_get_count_for_int(resultsPtr, documentID));
+    tsearch_countedset_free(resultsPtr);
+    tsearch_ternarytree_free(treePtr);
+}
+
+
+- (void)testIndexDocument_MoreDistinctWordsThanTableBuffer_CanFindAll
+{
+    GNEInteger documentID = 7;
+    NSMutableArray *words = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 500; i++)
+    {
+        [words addObject:[NSString stringWithFormat:@"word%lu", (unsigned long)i]];
+    }
+    NSString *document = [words componentsJoinedByString:@" "];
+
+    XCTAssertEqual(success, tsearch_ternarytree_index_document(_treePtr, document.UTF8String, documentID));
+    [self assertCanFindWords:words documentID:documentID inTree:_treePtr];
+}
+
+
+- (void)testIndexDocument_WithAllIndexes_SameResultsAsInsertingEachWord
+{
+    tsearch_ternarytree_options options = tsearch_ternarytree_forward_index | tsearch_ternarytree_suffix_index |
+                                          tsearch_ternarytree_trigram_index | tsearch_ternarytree_prefix_cache;
+    tsearch_ternarytree_ptr insertedPtr = tsearch_ternarytree_init_with_options(options);
+    tsearch_ternarytree_ptr indexedPtr = tsearch_ternarytree_init_with_options(options);
+    NSArray *words = [self wordsBeginningWithLMN];
+    for (GNEInteger documentID = 0; documentID < 10; documentID++)
+    {
+        NSMutableArray *documentWords = [NSMutableArray array];
+        for (NSUInteger i = (NSUInteger)documentID; i < words.count; i += 7)
+        {
+            [documentWords addObject:words[i]];
+        }
+        [self insertWords:documentWords documentID:documentID intoTree:insertedPtr];
+        NSString *document = [documentWords componentsJoinedByString:@", "];
+        XCTAssertEqual(success, tsearch_ternarytree_index_document(indexedPtr, document.UTF8String, documentID));
+    }
+    XCTAssertEqual(success, tsearch_ternarytree_remove(insertedPtr, 3));
+    XCTAssertEqual(success, tsearch_ternarytree_remove(indexedPtr, 3));
+
+    XCTAssertEqualObjects([self resultsInTree:insertedPtr], [self resultsInTree:indexedPtr]);
+    XCTAssertEqualObjects([self documentIDsPartiallyMatchingWord:@"m" inTree:insertedPtr],
+                          [self documentIDsPartiallyMatchingWord:@"m" inTree:indexedPtr]);
+    tsearch_ternarytree_free(insertedPtr);
+    tsearch_ternarytree_free(indexedPtr);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Bulk Build Tests
+// ------------------------------------------------------------------------------------------
+- (void)testInitWithPostings_NoPostings_EmptyTree
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_postings(NULL, 0, 0);
+    XCTAssertTrue(treePtr != NULL);
+    XCTAssertEqual(0, [self resultsInTree:treePtr].count);
+    XCTAssertTrue(NULL == tsearch_ternarytree_init_with_postings(NULL, 1, 0));
+    tsearch_ternarytree_free(treePtr);
+}
+
+
+- (void)testInitWithPostings_SortedPostings_CanFindAllAndInsertAfterward
+{
+    NSArray *words = [[[NSSet setWithArray:[self wordsBeginningWithLMN]] allObjects]
+                      sortedArrayUsingSelector:@selector(compare:)];
+    tsearch_ternarytree_posting *postings = malloc(words.count * sizeof(tsearch_ternarytree_posting));
+    for (NSUInteger i = 0; i < words.count; i++)
+    {
+        postings[i] = (tsearch_ternarytree_posting){[words[i] UTF8String], 1};
+    }
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_postings(postings, words.count, 0);
+    free(postings);
+
+    [self assertCanFindWords:words documentID:1 inTree:treePtr];
+    [self assertResultsInTree:treePtr equalWords:words];
+    [self insertWords:@[@"Zebra"] documentID:2 intoTree:treePtr];
+    [self assertCanFindWords:@[@"Zebra"] documentID:2 inTree:treePtr];
+    tsearch_ternarytree_free(treePtr);
+}
+
+
+- (void)testInitWithPostings_WithAllIndexes_SameResultsAsInsertingEachPosting
+{
+    tsearch_ternarytree_options options = tsearch_ternarytree_forward_index | tsearch_ternarytree_suffix_index |
+                                          tsearch_ternarytree_trigram_index | tsearch_ternarytree_prefix_cache;
+    tsearch_ternarytree_ptr insertedPtr = tsearch_ternarytree_init_with_options(options);
+    NSArray *words = [self randomizeWords:[self wordsBeginningWithLMN]];
+    NSUInteger count = words.count * 3;
+    tsearch_ternarytree_posting *postings = malloc(count * sizeof(tsearch_ternarytree_posting));
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        GNEInteger documentID = (GNEInteger)(i % 11);
+        postings[i] = (tsearch_ternarytree_posting){[words[i % words.count] UTF8String], documentID};
+        if (i % 97 == 0) { postings[i].word = ""; }
+        tsearch_ternarytree_insert(insertedPtr, postings[i].word, documentID);
+    }
+    tsearch_ternarytree_ptr builtPtr = tsearch_ternarytree_init_with_postings(postings, count, options);
+    free(postings);
+
+    XCTAssertEqualObjects([self resultsInTree:insertedPtr], [self resultsInTree:builtPtr]);
+    XCTAssertEqualObjects([self documentIDsPartiallyMatchingWord:@"m" inTree:insertedPtr],
+                          [self documentIDsPartiallyMatchingWord:@"m" inTree:builtPtr]);
+    XCTAssertEqual(success, tsearch_ternarytree_remove(insertedPtr, 3));
+    XCTAssertEqual(success, tsearch_ternarytree_remove(builtPtr, 3));
+    XCTAssertEqualObjects([self resultsInTree:insertedPtr], [self resultsInTree:builtPtr]);
+    tsearch_ternarytree_free(insertedPtr);
+    tsearch_ternarytree_free(builtPtr);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Remove Tests
 // ------------------------------------------------------------------------------------------
@@ -621,6 +988,162 @@
 }
 
 
+- (void)testRemove_WithForwardIndex_SameResultsAsWithout
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_forward_index();
+    NSArray *words = [self wordsBeginningWithLMN];
+    for (NSUInteger i = 0; i < words.count; i++)
+    {
+        GNEInteger documentID = (GNEInteger)(i % 10);
+        XCTAssertTrue(NULL != tsearch_ternarytree_insert(_treePtr, [words[i] UTF8String], documentID));
+        XCTAssertTrue(NULL != tsearch_ternarytree_insert(treePtr, [words[i] UTF8String], documentID));
+    }
+
+    for (GNEInteger documentID = 0; documentID < 10; documentID += 3)
+    {
+        XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, documentID));
+        XCTAssertEqual(success, tsearch_ternarytree_remove(treePtr, documentID));
+    }
+    XCTAssertEqual(success, tsearch_ternarytree_remove(treePtr, 100));
+
+    XCTAssertEqualObjects([self resultsInTree:_treePtr], [self resultsInTree:treePtr]);
+    XCTAssertEqualObjects([self documentIDsPartiallyMatchingWord:@"m" inTree:_treePtr],
+                          [self documentIDsPartiallyMatchingWord:@"m" inTree:treePtr]);
+    tsearch_ternarytree_free(treePtr);
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Compact Tests
+// ------------------------------------------------------------------------------------------
+- (void)testCompact_EmptyTree_Success
+{
+    XCTAssertEqual(success, tsearch_ternarytree_compact(_treePtr));
+    XCTAssertEqual(0, [self resultsInTree:_treePtr].count);
+}
+
+
+- (void)testCompact_LMN_SameWordsAndCanInsertAfterward
+{
+    NSArray *words = [[NSSet setWithArray:[self wordsBeginningWithLMN]] allObjects];
+    XCTAssertNoThrow([self insertWords:words intoTree:_treePtr]);
+
+    XCTAssertEqual(success, tsearch_ternarytree_compact(_treePtr));
+    [self assertCanFindWords:words inTree:_treePtr];
+    [self assertResultsInTree:_treePtr equalWords:words];
+
+    NSString *word = @"Zebra";
+    XCTAssertNoThrow([self insertWords:@[word] intoTree:_treePtr]);
+    [self assertCanFindWords:@[word] inTree:_treePtr];
+}
+
+
+- (void)testCompact_RemovedDocument_OnlyRemainingWords
+{
+    [self insertWords:@[@"an", @"ant", @"anthem", @"bee"] documentID:1 intoTree:_treePtr];
+    [self insertWords:@[@"ant", @"antler"] documentID:2 intoTree:_treePtr];
+
+    XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, 1));
+    XCTAssertEqual(success, tsearch_ternarytree_compact(_treePtr));
+    [self assertResultsInTree:_treePtr equalWords:@[@"ant", @"antler"]];
+    XCTAssertTrue(NULL == tsearch_ternarytree_copy_prefix_search_results(_treePtr, @"b".UTF8String));
+    [self assertCanFindWords:@[@"ant", @"antler"] documentID:2 inTree:_treePtr];
+
+    [self insertWords:@[@"anthem"] documentID:3 intoTree:_treePtr];
+    [self assertCanFindWords:@[@"anthem"] documentID:3 inTree:_treePtr];
+    [self assertResultsInTree:_treePtr equalWords:@[@"ant", @"anthem", @"antler"]];
+}
+
+
+- (void)testCompact_MaxEmptyTermPercentageOfZero_CompactsAfterEveryRemoval
+{
+    XCTAssertEqual(failure, tsearch_ternarytree_set_max_empty_term_percentage(_treePtr, 101));
+    XCTAssertEqual(success, tsearch_ternarytree_set_max_empty_term_percentage(_treePtr, 0));
+
+    NSArray *words = [self wordsBeginningWithLMN];
+    for (NSUInteger i = 0; i < words.count; i++)
+    {
+        XCTAssertTrue(NULL != tsearch_ternarytree_insert(_treePtr, [words[i] UTF8String], (GNEInteger)i));
+    }
+
+    NSMutableArray *remainingWords = [NSMutableArray array];
+    for (NSUInteger i = 0; i < words.count; i++)
+    {
+        if (i % 3 == 0) { [remainingWords addObject:words[i]]; }
+        else { XCTAssertEqual(success, tsearch_ternarytree_remove(_treePtr, (GNEInteger)i)); }
+    }
+
+    [self assertResultsInTree:_treePtr equalWords:remainingWords];
+    for (NSUInteger i = 0; i < words.count; i += 3)
+    {
+        [self assertCanFindWords:@[words[i]] documentID:(GNEInteger)i inTree:_treePtr];
+    }
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Deep Tree Tests
+// ------------------------------------------------------------------------------------------
+- (void)testDeepTree_TwoHundredThousandSortedWordsOnSmallStack_Success
+{
+    // Sorted words make a tree whose higher children form one long chain, which would overflow
+    // the stack if any of the walks below recursed once per node.
+    tsearch_ternarytree_ptr treePtr = _treePtr;
+    _treePtr = NULL;
+    __block size_t searchCount = 0, prefixCount = 0, partialCount = 0, suffixCount = 0;
+    __block result contentsResult = failure, removeResult = failure;
+    __block BOOL foundRemoved = YES;
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+
+    NSThread *thread = [[NSThread alloc] initWithBlock:^
+    {
+        char word[16];
+        for (GNEInteger i = 0; i < 200000; i++)
+        {
+            snprintf(word, sizeof(word), "w%06lld", (long long)i);
+            tsearch_ternarytree_insert(treePtr, word, i);
+        }
+
+        tsearch_countedset_ptr resultsPtr = tsearch_ternarytree_copy_search_results(treePtr, "w199999");
+        searchCount = tsearch_countedset_get_count(resultsPtr);
+        tsearch_countedset_free(resultsPtr);
+        resultsPtr = tsearch_ternarytree_copy_prefix_search_results(treePtr, "w1999");
+        prefixCount = tsearch_countedset_get_count(resultsPtr);
+        tsearch_countedset_free(resultsPtr);
+        resultsPtr = tsearch_ternarytree_copy_partial_search_results(treePtr, "99999", 5);
+        partialCount = tsearch_countedset_get_count(resultsPtr);
+        tsearch_countedset_free(resultsPtr);
+        resultsPtr = tsearch_ternarytree_copy_suffix_search_results(treePtr, "99999", 5);
+        suffixCount = tsearch_countedset_get_count(resultsPtr);
+        tsearch_countedset_free(resultsPtr);
+
+        char *contents = NULL;
+        size_t length = 0;
+        contentsResult = tsearch_ternarytree_copy_contents(treePtr, &contents, &length);
+        free(contents);
+
+        removeResult = tsearch_ternarytree_remove(treePtr, 0);
+        resultsPtr = tsearch_ternarytree_copy_search_results(treePtr, "w000000");
+        foundRemoved = (resultsPtr != NULL);
+        tsearch_countedset_free(resultsPtr);
+
+        tsearch_ternarytree_free(treePtr);
+        dispatch_semaphore_signal(semaphore);
+    }];
+    thread.stackSize = 256 * 1024;
+    [thread start];
+    dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+
+    XCTAssertEqual(1, searchCount);
+    XCTAssertEqual(100, prefixCount);
+    XCTAssertEqual(2, partialCount);
+    XCTAssertEqual(2, suffixCount);
+    XCTAssertEqual(success, contentsResult);
+    XCTAssertEqual(success, removeResult);
+    XCTAssertFalse(foundRemoved);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Performance
 // ------------------------------------------------------------------------------------------
@@ -687,6 +1210,24 @@
 }
 
 
+- (void)testPrefixSearchBibleWithPrefixCache_a__0_000
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_options(tsearch_ternarytree_prefix_cache);
+    [self insertBibleIntoTree:treePtr];
+    __block tsearch_countedset_ptr results = NULL;
+    NSString *prefix = @"a";
+
+    [self measureBlock:^()
+    {
+        results = tsearch_ternarytree_copy_prefix_search_results(treePtr, prefix.UTF8String);
+    }];
+
+    XCTAssertEqual([self numberOfVersesInBibleContainingPrefix:prefix], tsearch_countedset_get_count(results));
+    tsearch_countedset_free(results);
+    tsearch_ternarytree_free(treePtr);
+}
+
+
 - (void)testPartialMatchBible_go__007
 {
     [self insertBibleIntoTree:_treePtr];
@@ -704,6 +1245,63 @@
 }
 
 
+- (void)testPartialMatchBibleWithTrigramIndex_ing__0_000
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_options(tsearch_ternarytree_trigram_index);
+    [self insertBibleIntoTree:treePtr];
+    __block tsearch_countedset_ptr results = NULL;
+    NSString *target = @"ing";
+    size_t length = [target lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+
+    [self measureBlock:^()
+    {
+        results = tsearch_ternarytree_copy_partial_search_results(treePtr, target.UTF8String, length);
+    }];
+
+    XCTAssertEqual([self numberOfVersesInBibleContainingTarget:target], tsearch_countedset_get_count(results));
+    tsearch_countedset_free(results);
+    tsearch_ternarytree_free(treePtr);
+}
+
+
+- (void)testFuzzySearchBible_jerusalem__0_000
+{
+    [self insertBibleIntoTree:_treePtr];
+    __block tsearch_countedset_ptr results = NULL;
+    NSString *target = @"jerusalen";
+
+    [self measureBlock:^()
+    {
+        results = tsearch_ternarytree_copy_fuzzy_search_results(_treePtr, target.UTF8String, 2);
+    }];
+
+    XCTAssertTrue(results != NULL);
+    XCTAssertTrue(tsearch_countedset_get_count(results) >=
+                  (size_t)[self numberOfVersesInBibleContainingWord:@"jerusalem"]);
+    tsearch_countedset_free(results);
+}
+
+
+- (void)testCompletionsBible_a__0_000
+{
+    [self insertBibleIntoTree:_treePtr];
+    __block tsearch_ternarytree_completion *completions = NULL;
+    __block size_t count = 0;
+
+    [self measureBlock:^()
+    {
+        free(completions);
+        tsearch_ternarytree_copy_completions(_treePtr, "a", 10, &completions, &count);
+    }];
+
+    XCTAssertEqual(10, count);
+    XCTAssertEqual((size_t)[self numberOfVersesInBibleContainingWord:@(completions[0].word)],
+                   completions[0].frequency);
+    XCTAssertTrue(completions[0].frequency >= completions[9].frequency);
+    free(completions);
+}
+
+
 - (void)testSuffixSearchBible_t__0_038
 {
     [self insertBibleIntoTree:_treePtr];
@@ -719,6 +1317,23 @@
 }
 
 
+- (void)testSuffixSearchBibleWithSuffixIndex_t__0_000
+{
+    tsearch_ternarytree_ptr treePtr = tsearch_ternarytree_init_with_options(tsearch_ternarytree_suffix_index);
+    [self insertBibleIntoTree:treePtr];
+    __block tsearch_countedset_ptr results = NULL;
+    NSString *suffix = @"t";
+
+    [self measureBlock:^(){
+        results = tsearch_ternarytree_copy_suffix_search_results(treePtr, suffix.UTF8String, suffix.length);
+    }];
+
+    XCTAssertEqual([self numberOfVersesInBibleContainingSuffix:suffix], tsearch_countedset_get_count(results));
+    tsearch_countedset_free(results);
+    tsearch_ternarytree_free(treePtr);
+}
+
+
 // ------------------------------------------------------------------------------------------
 #pragma mark - Helpers
 // ------------------------------------------------------------------------------------------
@@ -970,7 +1585,7 @@
     NSDictionary *bible = [self bibleDictionary];
     [bible enumerateKeysAndObjectsUsingBlock:^(NSNumber *documentID, NSArray *words, BOOL *stop) {
         for (NSString *word in words) {
-            tsearch_ternarytree_insert(_treePtr, word.UTF8String, documentID.longLongValue);
+            tsearch_ternarytree_insert(treePtr, word.UTF8String, documentID.longLongValue);
         }
     }];
 }
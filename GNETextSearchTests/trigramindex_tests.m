@@ -0,0 +1,100 @@
+//
+//  trigramindex_tests.m
+//  GNETextSearch
+//
+//  Created by Anthony Drendel on 10/17/26.
+//  Copyright © 2026 Gone East LLC. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "trigramindex.h"
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@interface GNETrigramIndexTests : XCTestCase
+{
+    tsearch_trigramindex_ptr _trigramIndex;
+}
+
+@end
+
+
+// ------------------------------------------------------------------------------------------
+
+
+@implementation GNETrigramIndexTests
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Set Up / Tear Down
+// ------------------------------------------------------------------------------------------
+- (void)setUp
+{
+    [super setUp];
+    _trigramIndex = tsearch_trigramindex_init();
+}
+
+
+- (void)tearDown
+{
+    tsearch_trigramindex_free(_trigramIndex);
+    _trigramIndex = NULL;
+    [super tearDown];
+}
+
+
+// ------------------------------------------------------------------------------------------
+#pragma mark - Matching Terms
+// ------------------------------------------------------------------------------------------
+- (void)testCopyMatchingTerms_FourWords_OnlyWordsContainingTargetInOrder
+{
+    XCTAssertEqual(success, tsearch_trigramindex_add_term(_trigramIndex, 40, "banana", 6));
+    XCTAssertEqual(success, tsearch_trigramindex_add_term(_trigramIndex, 3, "nab", 3));
+    XCTAssertEqual(success, tsearch_trigramindex_add_term(_trigramIndex, 7, "anna", 4));
+    XCTAssertEqual(success, tsearch_trigramindex_add_term(_trigramIndex, 1, "ban", 3));
+    XCTAssertEqual(failure, tsearch_trigramindex_add_term(_trigramIndex, 1, "bandana", 7));
+
+    size_t count = 0;
+    uint32_t *terms = tsearch_trigramindex_copy_matching_terms(_trigramIndex, "ana", 3, &count);
+    XCTAssertEqual(1, count);
+    XCTAssertEqual(40, terms[0]);
+    free(terms);
+
+    terms = tsearch_trigramindex_copy_matching_terms(_trigramIndex, "an", 2, &count);
+    XCTAssertEqual(3, count);
+    XCTAssertEqual(1, terms[0]);
+    XCTAssertEqual(7, terms[1]);
+    XCTAssertEqual(40, terms[2]);
+    free(terms);
+
+    // "nab" has both of the trigrams in "anab", but not in that order.
+    XCTAssertTrue(tsearch_trigramindex_copy_matching_terms(_trigramIndex, "anab", 4, &count) == NULL);
+    XCTAssertEqual(0, count);
+}
+
+
+- (void)testRemoveTerm_WordWithRepeatedTrigram_NoLongerMatchesAndTermCanBeReused
+{
+    XCTAssertEqual(success, tsearch_trigramindex_add_term(_trigramIndex, 0, "aaaa", 4));
+    XCTAssertEqual(success, tsearch_trigramindex_add_term(_trigramIndex, 1, "baaa", 4));
+    tsearch_trigramindex_remove_term(_trigramIndex, 0);
+    tsearch_trigramindex_remove_term(_trigramIndex, 5);
+
+    size_t count = 0;
+    uint32_t *terms = tsearch_trigramindex_copy_matching_terms(_trigramIndex, "aaa", 3, &count);
+    XCTAssertEqual(1, count);
+    XCTAssertEqual(1, terms[0]);
+    free(terms);
+
+    XCTAssertEqual(success, tsearch_trigramindex_add_term(_trigramIndex, 0, "zaaa", 4));
+    terms = tsearch_trigramindex_copy_matching_terms(_trigramIndex, "aaa", 3, &count);
+    XCTAssertEqual(2, count);
+    XCTAssertEqual(0, terms[0]);
+    XCTAssertEqual(1, terms[1]);
+    free(terms);
+}
+
+
+@end